@@ -142,6 +142,26 @@ def extract_lv_haves(code):
         if have_set: haves.append(have_set)
     return haves
 
+########################################################################
+# Split a kernel name into its signature according to the name grammar
+# volk_(sig)_(multiplier-opt)_..._(name)_(sig)_(multiplier-opt)_...
+# Returns the input types, the operation name and the output types.
+# Scalar types keep their leading 's'.
+########################################################################
+def split_kernel_name(name):
+    type_matcher = re.compile(r'^s?\d+[fiucb]+$')
+    mult_matcher = re.compile(r'^x(\d+)$')
+    inputs, outputs, op = list(), list(), list()
+    for token in name.split('_')[1:]:
+        if type_matcher.match(token):
+            (outputs if op else inputs).append(token)
+        elif mult_matcher.match(token) and (outputs if op else inputs):
+            sigs = outputs if op else inputs
+            sigs.extend([sigs[-1]] * (int(mult_matcher.match(token).group(1)) - 1))
+        elif not outputs:
+            op.append(token)
+    return inputs, '_'.join(op), outputs
+
 ########################################################################
 # Represent a processing kernel, parse from file
 ########################################################################
@@ -149,6 +169,7 @@ class kernel_class(object):
     def __init__(self, kernel_file):
         self.name = os.path.splitext(os.path.basename(kernel_file))[0]
         self.pname = self.name.replace('volk_', 'p_')
+        self.inputs, self.op_name, self.outputs = split_kernel_name(self.name)
         code = open(kernel_file, 'rb').read().decode("utf-8")
         code = comment_remover(code)
         sections = split_into_nested_ifdef_sections(code)
@@ -10,9 +10,14 @@
 #ifndef INCLUDED_VOLK_ALLOC_H
 #define INCLUDED_VOLK_ALLOC_H
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <volk/volk.h>
@@ -73,5 +78,201 @@ bool operator!=(alloc<T> const&, alloc<U> const&)
 template <class T>
 using vector = std::vector<T, alloc<T>>;
 
+
+/*!
+ * \brief contiguous buffer using volk_malloc and volk_free that does not
+ * initialize its elements
+ *
+ * \details
+ * Unlike volk::vector, constructing or growing a buffer leaves the new
+ * elements default-initialized, i.e. untouched for the trivial types VOLK
+ * kernels operate on. This avoids a full memory pass over large capture
+ * buffers that are about to be overwritten anyway.
+ *
+ * The storage is padded: padded_size() is size() rounded up to a whole
+ * multiple of volk_get_alignment() elements. The rounding counts elements,
+ * not bytes, so it is the same for every element type. Buffers of different
+ * types with the same size() have the same padded_size(), and a kernel that
+ * converts between them (e.g. lv_16sc_t to lv_32fc_t) may be called with
+ * padded_size() as num_points. It is a multiple of every SIMD register width,
+ * so most kernels skip their scalar remainder loops on such calls.
+ *
+ * The elements in [size(), padded_size()) are zeroed whenever the size
+ * changes, but a kernel called with padded_size() writes to them, so their
+ * contents are unspecified afterwards. Reductions (dot products,
+ * accumulators, index searches) must be given size().
+ *
+ * example code:
+ *   volk::buffer<lv_32fc_t> in(N); // no initialization pass
+ *   volk::buffer<float> out(N);
+ *   read_samples(in.data(), in.size());
+ *   volk_32fc_magnitude_squared_32f(out.data(), in.data(), in.padded_size());
+ */
+template <class T>
+class buffer
+{
+    static_assert(std::is_trivially_copyable<T>::value &&
+                      std::is_trivially_destructible<T>::value,
+                  "volk::buffer only holds trivially copyable types");
+
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+
+    buffer() noexcept : _data(nullptr), _size(0), _capacity(0) {}
+
+    explicit buffer(size_type n) : buffer() { resize(n); }
+
+    buffer(size_type n, const T& value) : buffer() { resize(n, value); }
+
+    buffer(const buffer& other) : buffer()
+    {
+        resize(other._size);
+        if (_size)
+            std::memcpy(_data, other._data, _size * sizeof(T));
+    }
+
+    buffer(buffer&& other) noexcept : buffer() { swap(other); }
+
+    buffer& operator=(const buffer& other)
+    {
+        if (this != &other) {
+            buffer tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    buffer& operator=(buffer&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~buffer() { volk_free(_data); }
+
+    void swap(buffer& other) noexcept
+    {
+        std::swap(_data, other._data);
+        std::swap(_size, other._size);
+        std::swap(_capacity, other._capacity);
+    }
+
+    /*!
+     * \brief Resizes the buffer to \p n elements.
+     * Elements beyond the old size are left uninitialized. Existing elements
+     * are preserved.
+     */
+    void resize(size_type n)
+    {
+        reserve(n);
+        _size = n;
+        zero_padding();
+    }
+
+    //! Resizes the buffer to \p n elements, filling new elements with \p value
+    void resize(size_type n, const T& value)
+    {
+        const size_type old_size = _size;
+        resize(n);
+        if (n > old_size)
+            std::fill(_data + old_size, _data + n, value);
+    }
+
+    /*!
+     * \brief Makes sure that at least \p n elements plus padding fit without
+     * reallocation.
+     * The capacity at least doubles when it grows, so that growing a buffer
+     * element by element reallocates O(log n) times. Throws std::length_error
+     * if \p n exceeds max_size().
+     */
+    void reserve(size_type n)
+    {
+        if (n > max_size())
+            throw std::length_error("volk::buffer::reserve");
+        size_type n_padded = padded_elements(n);
+        if (n_padded <= _capacity)
+            return;
+        if (_capacity <= max_size() / 2)
+            n_padded = std::max(n_padded, 2 * _capacity);
+
+        T* p = static_cast<T*>(volk_malloc(n_padded * sizeof(T), volk_get_alignment()));
+        if (!p)
+            throw std::bad_alloc();
+        if (_size)
+            std::memcpy(p, _data, _size * sizeof(T));
+        volk_free(_data);
+        _data = p;
+        _capacity = n_padded;
+    }
+
+    void clear() noexcept { _size = 0; }
+
+    size_type size() const noexcept { return _size; }
+
+    //! size() rounded up to a whole multiple of volk_get_alignment() elements
+    size_type padded_size() const noexcept { return padded_elements(_size); }
+
+    size_type capacity() const noexcept { return _capacity; }
+
+    //! The largest size whose padded storage still fits the address space
+    size_type max_size() const noexcept
+    {
+        const size_type alignment = volk_get_alignment();
+        return std::numeric_limits<size_type>::max() / sizeof(T) / alignment * alignment;
+    }
+
+    bool empty() const noexcept { return _size == 0; }
+
+    T* data() noexcept { return _data; }
+    const T* data() const noexcept { return _data; }
+
+    T& operator[](size_type i) noexcept { return _data[i]; }
+    const T& operator[](size_type i) const noexcept { return _data[i]; }
+
+    T& front() noexcept { return _data[0]; }
+    const T& front() const noexcept { return _data[0]; }
+    T& back() noexcept { return _data[_size - 1]; }
+    const T& back() const noexcept { return _data[_size - 1]; }
+
+    iterator begin() noexcept { return _data; }
+    const_iterator begin() const noexcept { return _data; }
+    const_iterator cbegin() const noexcept { return _data; }
+    iterator end() noexcept { return _data + _size; }
+    const_iterator end() const noexcept { return _data + _size; }
+    const_iterator cend() const noexcept { return _data + _size; }
+
+private:
+    static size_type padded_elements(size_type n)
+    {
+        const size_type alignment = volk_get_alignment();
+        return (n + alignment - 1) / alignment * alignment;
+    }
+
+    void zero_padding() noexcept
+    {
+        const size_type n_padded = padded_size();
+        if (n_padded > _size)
+            std::memset(
+                static_cast<void*>(_data + _size), 0, (n_padded - _size) * sizeof(T));
+    }
+
+    T* _data;
+    size_type _size;
+    size_type _capacity;
+};
+
+template <class T>
+void swap(buffer<T>& a, buffer<T>& b) noexcept
+{
+    a.swap(b);
+}
+
 } // namespace volk
 #endif // INCLUDED_VOLK_ALLOC_H
@@ -0,0 +1,113 @@
+/* -*- c -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_ASYNC_H
+#define INCLUDED_VOLK_ASYNC_H
+
+#include <stddef.h>
+#include <volk/volk_common.h>
+
+__VOLK_DECL_BEGIN
+
+/*!
+ * \brief Asynchronous execution of kernel calls as a task graph
+ *
+ * \details
+ * A task is a function call (typically one or a few VOLK kernel calls) that
+ * declares the memory ranges it reads and writes. A submitted task runs once
+ * every earlier task it conflicts with has completed: a task that reads a
+ * range waits for earlier writers of it, a task that writes a range waits
+ * for earlier readers and writers. Tasks without conflicts run concurrently
+ * on a pool of worker threads with per-worker queues and work stealing, so
+ * independent channels overlap and consecutive blocks are pipelined.
+ *
+ * Each submitted task returns a handle that must be released with
+ * volk_async_release(). Without thread support tasks run synchronously in
+ * volk_async_submit().
+ *
+ * example code:
+ *   volk_async_access_t acc[] = { { in, n * sizeof(lv_32fc_t), VOLK_ASYNC_READ },
+ *                                 { out, n * sizeof(float), VOLK_ASYNC_WRITE } };
+ *   volk_async_task_t* t = volk_async_submit(compute_magnitude, &args, acc, 2);
+ *   ...
+ *   volk_async_wait(t);
+ *   volk_async_release(t);
+ */
+
+//! Access mode flags of a volk_async_access_t
+#define VOLK_ASYNC_READ 1
+#define VOLK_ASYNC_WRITE 2
+#define VOLK_ASYNC_READ_WRITE (VOLK_ASYNC_READ | VOLK_ASYNC_WRITE)
+
+//! Memory range accessed by a task
+typedef struct volk_async_access {
+    const void* ptr; //!< start of the range
+    size_t size;     //!< length of the range in bytes
+    int mode;        //!< VOLK_ASYNC_READ, VOLK_ASYNC_WRITE or both
+} volk_async_access_t;
+
+//! Opaque task handle
+typedef struct volk_async_task volk_async_task_t;
+
+//! Task body and completion callback
+typedef void (*volk_async_fn_t)(void* ctx);
+
+/*!
+ * \brief Submits a task to the graph.
+ * \param fn task body, called once on a worker thread
+ * \param ctx argument of \p fn
+ * \param accesses memory ranges accessed by the task (copied)
+ * \param num_accesses number of entries in \p accesses
+ * \return task handle, NULL if out of memory
+ */
+VOLK_API volk_async_task_t* volk_async_submit(volk_async_fn_t fn,
+                                              void* ctx,
+                                              const volk_async_access_t* accesses,
+                                              unsigned int num_accesses);
+
+//! Returns nonzero when \p task has completed
+VOLK_API int volk_async_test(volk_async_task_t* task);
+
+/*!
+ * \brief Blocks until \p task has completed.
+ * \details The calling thread runs queued tasks while it waits.
+ */
+VOLK_API void volk_async_wait(volk_async_task_t* task);
+
+//! Blocks until all submitted tasks have completed
+VOLK_API void volk_async_wait_all(void);
+
+/*!
+ * \brief Registers a completion callback.
+ * \details \p fn runs on the thread completing \p task. Several callbacks
+ * can be registered per task; they run in registration order.
+ * \return nonzero if registered, 0 if \p task has already completed, in
+ *         which case \p fn is not called
+ */
+VOLK_API int volk_async_then(volk_async_task_t* task, volk_async_fn_t fn, void* ctx);
+
+//! Releases a task handle; the task itself still runs to completion
+VOLK_API void volk_async_release(volk_async_task_t* task);
+
+/*!
+ * \brief Sets the number of worker threads.
+ * \details Waits for all submitted tasks before restarting the pool, so it
+ * is refused from within a task or completion callback, which would wait for
+ * itself.
+ * \param num_workers worker count, 0 selects the number of online CPUs
+ * \return 0 on success, -1 if called from a task (nothing changes)
+ */
+VOLK_API int volk_async_set_num_workers(unsigned int num_workers);
+
+//! Returns the number of worker threads
+VOLK_API unsigned int volk_async_get_num_workers(void);
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_ASYNC_H */
@@ -0,0 +1,156 @@
+/* -*- C++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_ASYNC_HH
+#define INCLUDED_VOLK_ASYNC_HH
+
+#include <volk/volk.hh>
+#include <volk/volk_async.h>
+
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define VOLK_ASYNC_COROUTINES 1
+#endif
+
+/*!
+ * \brief C++ interface to the asynchronous task graph (volk_async.h)
+ *
+ * \details
+ * A task is any callable, usually a lambda running one or more volk::
+ * kernel calls, together with the vectors it reads and writes. Tasks are
+ * ordered only by these accesses, so the per-channel chains below run
+ * concurrently while the steps within a channel stay in order.
+ *
+ * example code:
+ *   using namespace volk::async;
+ *   for (auto& ch : channels) {
+ *       submit([&] { volk::rotator(ch.mixed, ch.in, ch.phase_inc, ch.phase); },
+ *              { reads(ch.in), writes(ch.mixed) });
+ *       submit([&] { volk::magnitude_squared(ch.power, ch.mixed); },
+ *              { reads(ch.mixed), writes(ch.power) });
+ *   }
+ *   wait_all();
+ *
+ * With C++20 coroutines a task can be awaited with co_await; the coroutine
+ * then resumes on the worker thread that completed the task.
+ */
+namespace volk {
+namespace async {
+
+//! Declares that a task reads the elements of \p c
+template <class C>
+volk_async_access_t reads(const C& c)
+{
+    return { c.data(), c.size() * sizeof(*c.data()), VOLK_ASYNC_READ };
+}
+
+//! Declares that a task writes the elements of \p c
+template <class C>
+volk_async_access_t writes(const C& c)
+{
+    return { c.data(), c.size() * sizeof(*c.data()), VOLK_ASYNC_WRITE };
+}
+
+//! Declares that a task reads and writes the elements of \p c
+template <class C>
+volk_async_access_t updates(const C& c)
+{
+    return { c.data(), c.size() * sizeof(*c.data()), VOLK_ASYNC_READ_WRITE };
+}
+
+/*!
+ * \brief Completion handle of a submitted task
+ * \details Move-only; destroying the handle does not wait for the task.
+ */
+class task
+{
+public:
+    task() noexcept : _t(nullptr) {}
+    explicit task(volk_async_task_t* t) noexcept : _t(t) {}
+    task(task&& other) noexcept : _t(other._t) { other._t = nullptr; }
+    task& operator=(task&& other) noexcept
+    {
+        std::swap(_t, other._t);
+        return *this;
+    }
+    task(const task&) = delete;
+    task& operator=(const task&) = delete;
+    ~task() { volk_async_release(_t); }
+
+    bool valid() const noexcept { return _t != nullptr; }
+
+    //! Returns true when the task has completed
+    bool ready() const { return volk_async_test(_t) != 0; }
+
+    //! Blocks until the task has completed, running other tasks meanwhile
+    void wait() const { volk_async_wait(_t); }
+
+    volk_async_task_t* get() const noexcept { return _t; }
+
+#ifdef VOLK_ASYNC_COROUTINES
+    struct awaiter {
+        volk_async_task_t* t;
+
+        bool await_ready() const { return volk_async_test(t) != 0; }
+        bool await_suspend(std::coroutine_handle<> h)
+        {
+            return volk_async_then(t, &resume, h.address()) != 0;
+        }
+        void await_resume() const noexcept {}
+
+        static void resume(void* address)
+        {
+            std::coroutine_handle<>::from_address(address).resume();
+        }
+    };
+
+    awaiter operator co_await() const noexcept { return awaiter{ _t }; }
+#endif
+
+private:
+    volk_async_task_t* _t;
+};
+
+/*!
+ * \brief Submits \p f with the given memory accesses
+ * \throws std::bad_alloc if the task could not be created
+ */
+template <class F>
+task submit(F&& f, std::initializer_list<volk_async_access_t> accesses = {})
+{
+    typedef typename std::decay<F>::type fn_t;
+    fn_t* boxed = new fn_t(std::forward<F>(f));
+    volk_async_task_t* t = volk_async_submit(
+        [](void* ctx) {
+            fn_t* fn = static_cast<fn_t*>(ctx);
+            (*fn)();
+            delete fn;
+        },
+        boxed,
+        accesses.begin(),
+        static_cast<unsigned int>(accesses.size()));
+    if (!t) {
+        delete boxed;
+        throw std::bad_alloc();
+    }
+    return task(t);
+}
+
+//! Blocks until all submitted tasks have completed
+inline void wait_all() { volk_async_wait_all(); }
+
+} // namespace async
+} // namespace volk
+
+#endif /* INCLUDED_VOLK_ASYNC_HH */
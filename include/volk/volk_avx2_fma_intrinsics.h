@@ -0,0 +1,287 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*
+ * This file is intended to hold AVX2 FMA intrinsics of intrinsics.
+ * They should be used in VOLK kernels to avoid copy-paste.
+ */
+
+#ifndef INCLUDE_VOLK_VOLK_AVX2_FMA_INTRINSICS_H_
+#define INCLUDE_VOLK_VOLK_AVX2_FMA_INTRINSICS_H_
+#include <immintrin.h>
+
+/*
+ * log2(x) for x >= 0 as computed by volk_32f_log2_32f: the exponent plus a degree 6
+ * polynomial in the mantissa. Zero gives -127 like log2f_non_ieee(), infinities
+ * and NaNs are not supported.
+ */
+static inline __m256 _mm256_log2_ps_avx2_fma(const __m256 x)
+{
+    const __m256i bits = _mm256_castps_si256(x);
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 exp = _mm256_cvtepi32_ps(_mm256_sub_epi32(
+        _mm256_srli_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7f800000)), 23),
+        _mm256_set1_epi32(127)));
+    const __m256 frac = _mm256_castsi256_ps(_mm256_or_si256(
+        _mm256_castps_si256(one), _mm256_and_si256(bits, _mm256_set1_epi32(0x7fffff))));
+
+    __m256 mantissa = _mm256_set1_ps(-3.4436006e-2f);
+    mantissa = _mm256_fmadd_ps(mantissa, frac, _mm256_set1_ps(3.1821337e-1f));
+    mantissa = _mm256_fmadd_ps(mantissa, frac, _mm256_set1_ps(-1.2315303f));
+    mantissa = _mm256_fmadd_ps(mantissa, frac, _mm256_set1_ps(2.5988452f));
+    mantissa = _mm256_fmadd_ps(mantissa, frac, _mm256_set1_ps(-3.3241990f));
+    mantissa = _mm256_fmadd_ps(mantissa, frac, _mm256_set1_ps(3.1157899f));
+    return _mm256_fmadd_ps(mantissa, _mm256_sub_ps(frac, one), exp);
+}
+
+/*
+ * arctan(x) for x in [-1, 1]: an odd minimax polynomial of degree 13, with a
+ * relative error below 7.5e-7.
+ */
+static inline __m256 _mm256_arctan_poly_avx2_fma(const __m256 x)
+{
+    const __m256 x2 = _mm256_mul_ps(x, x);
+    __m256 arctan = _mm256_set1_ps(+0x1.01a37cp-7f);
+    arctan = _mm256_fmadd_ps(x2, arctan, _mm256_set1_ps(-0x1.2f3004p-5f));
+    arctan = _mm256_fmadd_ps(x2, arctan, _mm256_set1_ps(+0x1.5785aap-4f));
+    arctan = _mm256_fmadd_ps(x2, arctan, _mm256_set1_ps(-0x1.1436ap-3f));
+    arctan = _mm256_fmadd_ps(x2, arctan, _mm256_set1_ps(+0x1.972be6p-3f));
+    arctan = _mm256_fmadd_ps(x2, arctan, _mm256_set1_ps(-0x1.55437p-2f));
+    arctan = _mm256_fmadd_ps(x2, arctan, _mm256_set1_ps(+0x1.ffffeap-1f));
+    return _mm256_mul_ps(arctan, x);
+}
+
+/*
+ * atan2(y, x) from _mm256_arctan_poly_avx2_fma: the ratio of the smaller to the
+ * larger of |x| and |y| goes through the polynomial, and the result is mirrored
+ * into the quadrant of (x, y). atan2(0, 0) is 0, or pi for a negative zero x, as
+ * in atan2f(). Infinite inputs are not supported.
+ */
+static inline __m256 _mm256_atan2_ps_avx2_fma(const __m256 y, const __m256 x)
+{
+    const __m256 sign_mask = _mm256_set1_ps(-0.f);
+    const __m256 pi = _mm256_set1_ps(3.14159265358979323846f);
+    const __m256 pi_2 = _mm256_set1_ps(1.57079632679489661923f);
+
+    const __m256 swap = _mm256_cmp_ps(
+        _mm256_andnot_ps(sign_mask, y), _mm256_andnot_ps(sign_mask, x), _CMP_GT_OS);
+    __m256 ratio =
+        _mm256_div_ps(_mm256_blendv_ps(y, x, swap), _mm256_blendv_ps(x, y, swap));
+    // 0 / 0
+    ratio = _mm256_andnot_ps(_mm256_cmp_ps(ratio, ratio, _CMP_UNORD_Q), ratio);
+    __m256 result = _mm256_arctan_poly_avx2_fma(ratio);
+
+    // |y| > |x|: +-pi / 2 - arctan(x / y)
+    const __m256 offset = _mm256_or_ps(pi_2, _mm256_and_ps(ratio, sign_mask));
+    result = _mm256_blendv_ps(result, _mm256_sub_ps(offset, result), swap);
+    // x < 0: +-pi, with the sign of y
+    const __m256 x_neg =
+        _mm256_castsi256_ps(_mm256_srai_epi32(_mm256_castps_si256(x), 31));
+    return _mm256_add_ps(
+        result, _mm256_and_ps(_mm256_or_ps(pi, _mm256_and_ps(y, sign_mask)), x_neg));
+}
+
+/*
+ * scale * atan2(y, x) as in cephes atanf, slower but more accurate than
+ * _mm256_atan2_ps_avx2_fma: the ratio of the smaller to the larger of |x| and |y|
+ * is reduced to |r| <= tan(pi / 8), where a degree 9 polynomial is good to about
+ * 1 ulp. The result is a multiple of pi / 4 plus or minus that, and the multiple
+ * is scaled in extended precision so that a large scale does not magnify its
+ * rounding error. Signed zeros as in atan2f(), infinities are not supported.
+ */
+static inline __m256
+_mm256_atan2_cephes_ps_avx2_fma(const __m256 y, const __m256 x, const __m256 scale)
+{
+    const __m256 sign_mask = _mm256_set1_ps(-0.f);
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 ax = _mm256_andnot_ps(sign_mask, x);
+    const __m256 ay = _mm256_andnot_ps(sign_mask, y);
+
+    __m256 ratio = _mm256_div_ps(_mm256_min_ps(ax, ay), _mm256_max_ps(ax, ay));
+    // 0 / 0
+    ratio = _mm256_andnot_ps(_mm256_cmp_ps(ratio, ratio, _CMP_UNORD_Q), ratio);
+
+    // ratio > tan(pi / 8): pi / 4 + arctan((ratio - 1) / (ratio + 1))
+    const __m256 big =
+        _mm256_cmp_ps(ratio, _mm256_set1_ps(0.4142135623730950f), _CMP_GT_OS);
+    const __m256 r = _mm256_blendv_ps(
+        ratio, _mm256_div_ps(_mm256_sub_ps(ratio, one), _mm256_add_ps(ratio, one)), big);
+    const __m256 z = _mm256_mul_ps(r, r);
+    __m256 poly = _mm256_set1_ps(8.05374449538e-2f);
+    poly = _mm256_fmadd_ps(poly, z, _mm256_set1_ps(-1.38776856032e-1f));
+    poly = _mm256_fmadd_ps(poly, z, _mm256_set1_ps(1.99777106478e-1f));
+    poly = _mm256_fmadd_ps(poly, z, _mm256_set1_ps(-3.33329491539e-1f));
+    poly = _mm256_fmadd_ps(_mm256_mul_ps(poly, z), r, r);
+
+    // |y| > |x|: pi / 2 - arctan(|x| / |y|), x < 0: pi - arctan, each of which
+    // turns the octant m around and negates the polynomial
+    __m256 m = _mm256_and_ps(one, big);
+    const __m256 swap = _mm256_cmp_ps(ay, ax, _CMP_GT_OS);
+    m = _mm256_blendv_ps(m, _mm256_sub_ps(_mm256_set1_ps(2.f), m), swap);
+    poly = _mm256_xor_ps(poly, _mm256_and_ps(swap, sign_mask));
+    m = _mm256_blendv_ps(m, _mm256_sub_ps(_mm256_set1_ps(4.f), m), x);
+    poly = _mm256_xor_ps(poly, _mm256_and_ps(x, sign_mask));
+
+    // scale (m pi / 4 + poly) with pi / 4 in two parts
+    const __m256 sm = _mm256_mul_ps(scale, m);
+    __m256 result = _mm256_fmadd_ps(
+        sm, _mm256_set1_ps(-2.1855695e-8f), _mm256_mul_ps(scale, poly));
+    result = _mm256_fmadd_ps(sm, _mm256_set1_ps(0.78539818525314331f), result);
+    return _mm256_xor_ps(result, _mm256_and_ps(y, sign_mask));
+}
+
+/*
+ * exp(x) as computed by volk_32f_exp_32f_a_sse2 (cephes expf): x is clamped to
+ * +-88.376, split into n ln(2) + g with |g| <= ln(2) / 2, and exp(g) is a degree 5
+ * polynomial, scaled by 2^n. Large negative inputs flush to zero.
+ */
+static inline __m256 _mm256_exp_ps_avx2_fma(__m256 x)
+{
+    x = _mm256_max_ps(_mm256_min_ps(x, _mm256_set1_ps(88.3762626647949f)),
+                      _mm256_set1_ps(-88.3762626647949f));
+
+    // exp(x) = exp(g + n ln(2))
+    const __m256 fx = _mm256_floor_ps(
+        _mm256_fmadd_ps(x, _mm256_set1_ps(1.44269504088896341f), _mm256_set1_ps(0.5f)));
+    x = _mm256_fnmadd_ps(fx, _mm256_set1_ps(0.693359375f), x);
+    x = _mm256_fnmadd_ps(fx, _mm256_set1_ps(-2.12194440e-4f), x);
+
+    __m256 y = _mm256_set1_ps(1.9875691500e-4f);
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.3981999507e-3f));
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(8.3334519073e-3f));
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(4.1665795894e-2f));
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.6666665459e-1f));
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(5.0000001201e-1f));
+    y = _mm256_fmadd_ps(y, _mm256_mul_ps(x, x), x);
+    y = _mm256_add_ps(y, _mm256_set1_ps(1.f));
+
+    const __m256i pow2n = _mm256_slli_epi32(
+        _mm256_add_epi32(_mm256_cvttps_epi32(fx), _mm256_set1_epi32(0x7f)), 23);
+    return _mm256_mul_ps(y, _mm256_castsi256_ps(pow2n));
+}
+
+/*
+ * x^y for x >= 0 as exp(y ln(x)), with the cephes logf and expf polynomials: x is
+ * split into 2^e m with m in [sqrt(1/2), sqrt(2)), and y e is carried in two
+ * parts, so that the exponent of the result comes out exact and only y ln(m)
+ * and the reduced argument of exp() are rounded. Zero and denormals count as
+ * FLT_MIN, results that underflow flush to zero and overflow is not supported.
+ */
+static inline __m256 _mm256_pow_ps_avx2_fma(__m256 x, const __m256 y)
+{
+    const __m256 one = _mm256_set1_ps(1.f);
+    x = _mm256_max_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x00800000)));
+
+    // x = m 2^e with m in [0.5, 1)
+    __m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(
+        _mm256_srli_epi32(_mm256_castps_si256(x), 23), _mm256_set1_epi32(0x7e)));
+    x = _mm256_or_ps(_mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffff))),
+                     _mm256_set1_ps(0.5f));
+
+    // m < sqrt(1/2): f = 2 m - 1 and e - 1, else f = m - 1
+    const __m256 mask =
+        _mm256_cmp_ps(x, _mm256_set1_ps(0.707106781186547524f), _CMP_LT_OS);
+    e = _mm256_sub_ps(e, _mm256_and_ps(one, mask));
+    x = _mm256_add_ps(_mm256_sub_ps(x, one), _mm256_and_ps(x, mask));
+
+    // ln(1 + f)
+    const __m256 z = _mm256_mul_ps(x, x);
+    __m256 l = _mm256_set1_ps(7.0376836292e-2f);
+    l = _mm256_fmadd_ps(l, x, _mm256_set1_ps(-1.1514610310e-1f));
+    l = _mm256_fmadd_ps(l, x, _mm256_set1_ps(1.1676998740e-1f));
+    l = _mm256_fmadd_ps(l, x, _mm256_set1_ps(-1.2420140846e-1f));
+    l = _mm256_fmadd_ps(l, x, _mm256_set1_ps(1.4249322787e-1f));
+    l = _mm256_fmadd_ps(l, x, _mm256_set1_ps(-1.6668057665e-1f));
+    l = _mm256_fmadd_ps(l, x, _mm256_set1_ps(2.0000714765e-1f));
+    l = _mm256_fmadd_ps(l, x, _mm256_set1_ps(-2.4999993993e-1f));
+    l = _mm256_fmadd_ps(l, x, _mm256_set1_ps(3.3333331174e-1f));
+    l = _mm256_fmadd_ps(
+        _mm256_mul_ps(l, x), z, _mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), x));
+
+    // y ln(x) = (n + k + ye_lo) ln(2) + y ln(m) with n the nearest integer, and
+    // k = y e - n exact
+    const __m256 ye = _mm256_mul_ps(y, e);
+    const __m256 ye_lo = _mm256_fmsub_ps(y, e, ye);
+    const __m256 yl = _mm256_mul_ps(y, l);
+    __m256 n = _mm256_round_ps(
+        _mm256_fmadd_ps(yl, _mm256_set1_ps(1.44269504088896341f), ye),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    n = _mm256_max_ps(_mm256_min_ps(n, _mm256_set1_ps(127.f)), _mm256_set1_ps(-127.f));
+    const __m256 k = _mm256_sub_ps(ye, n);
+    __m256 g = _mm256_fmadd_ps(ye_lo, _mm256_set1_ps(0.693147180559945309f), yl);
+    g = _mm256_fmadd_ps(k, _mm256_set1_ps(-2.12194440e-4f), g);
+    g = _mm256_fmadd_ps(k, _mm256_set1_ps(0.693359375f), g);
+
+    // exp(g) 2^n
+    __m256 p = _mm256_set1_ps(1.9875691500e-4f);
+    p = _mm256_fmadd_ps(p, g, _mm256_set1_ps(1.3981999507e-3f));
+    p = _mm256_fmadd_ps(p, g, _mm256_set1_ps(8.3334519073e-3f));
+    p = _mm256_fmadd_ps(p, g, _mm256_set1_ps(4.1665795894e-2f));
+    p = _mm256_fmadd_ps(p, g, _mm256_set1_ps(1.6666665459e-1f));
+    p = _mm256_fmadd_ps(p, g, _mm256_set1_ps(5.0000001201e-1f));
+    p = _mm256_fmadd_ps(p, _mm256_mul_ps(g, g), g);
+    p = _mm256_add_ps(p, one);
+
+    const __m256i pow2n = _mm256_slli_epi32(
+        _mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(0x7f)), 23);
+    return _mm256_mul_ps(p, _mm256_castsi256_ps(pow2n));
+}
+
+/*
+ * sin(x) and cos(x) as in cephes sinf/cosf: x is reduced by multiples of pi / 4 in
+ * three steps, and the sine or cosine polynomial is picked per octant. Accurate to
+ * a few ulp for |x| up to about 8192.
+ */
+static inline void _mm256_sincos_ps_avx2_fma(__m256 x, __m256* sine, __m256* cosine)
+{
+    const __m256 sign_mask = _mm256_set1_ps(-0.f);
+    __m256 sign_sin = _mm256_and_ps(x, sign_mask);
+    x = _mm256_andnot_ps(sign_mask, x);
+
+    // j = (int)(4 x / pi) rounded up to even
+    __m256i j =
+        _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(1.27323954473516f)));
+    j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)),
+                         _mm256_set1_epi32(~1));
+    const __m256 y = _mm256_cvtepi32_ps(j);
+
+    // extended precision modular arithmetic
+    x = _mm256_fnmadd_ps(y, _mm256_set1_ps(0.78515625f), x);
+    x = _mm256_fnmadd_ps(y, _mm256_set1_ps(2.4187564849853515625e-4f), x);
+    x = _mm256_fnmadd_ps(y, _mm256_set1_ps(3.77489497744594108e-8f), x);
+
+    // octants 2 and 3 (mod 4) swap the polynomials, bit 2 of j (j + 2 for
+    // the cosine) is the sign
+    const __m256i two = _mm256_set1_epi32(2);
+    const __m256 swap =
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, two), two));
+    sign_sin = _mm256_xor_ps(sign_sin, _mm256_castsi256_ps(_mm256_slli_epi32(j, 29)));
+    const __m256 sign_cos = _mm256_castsi256_ps(
+        _mm256_slli_epi32(_mm256_add_epi32(j, two), 29));
+
+    const __m256 z = _mm256_mul_ps(x, x);
+    __m256 yc = _mm256_set1_ps(2.443315711809948e-5f);
+    yc = _mm256_fmadd_ps(yc, z, _mm256_set1_ps(-1.388731625493765e-3f));
+    yc = _mm256_fmadd_ps(yc, z, _mm256_set1_ps(4.166664568298827e-2f));
+    yc = _mm256_mul_ps(_mm256_mul_ps(yc, z), z);
+    yc = _mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), yc);
+    yc = _mm256_add_ps(yc, _mm256_set1_ps(1.f));
+
+    __m256 ys = _mm256_set1_ps(-1.9515295891e-4f);
+    ys = _mm256_fmadd_ps(ys, z, _mm256_set1_ps(8.3321608736e-3f));
+    ys = _mm256_fmadd_ps(ys, z, _mm256_set1_ps(-1.6666654611e-1f));
+    ys = _mm256_fmadd_ps(_mm256_mul_ps(ys, z), x, x);
+
+    *sine = _mm256_xor_ps(_mm256_blendv_ps(ys, yc, swap),
+                          _mm256_and_ps(sign_sin, sign_mask));
+    *cosine = _mm256_xor_ps(_mm256_blendv_ps(yc, ys, swap),
+                            _mm256_and_ps(sign_cos, sign_mask));
+}
+
+#endif /* INCLUDE_VOLK_VOLK_AVX2_FMA_INTRINSICS_H_ */
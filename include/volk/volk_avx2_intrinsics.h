@@ -330,4 +330,111 @@ static inline void vector_32fc_index_min_variant1(__m256 in0,
     *current_indices = _mm256_add_epi32(*current_indices, indices_increment);
 }
 
+/*
+ * True while the element offsets of 8 strided loads fit into signed 32 bits
+ */
+static inline int _mm256_stride_fits_epi32(unsigned int stride)
+{
+    return stride <= 0x7fffffff / 7;
+}
+
+/*
+ * Element offsets for the strided loads below: 0, stride, ..., 7 * stride as
+ * 32-bit integers while they fit, else 0, stride, 2 * stride and 3 * stride as
+ * 64-bit integers, so that they cannot overflow for any unsigned stride
+ */
+static inline __m256i _mm256_stride_index(unsigned int stride)
+{
+    if (_mm256_stride_fits_epi32(stride))
+        return _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                  _mm256_set1_epi32((int)stride));
+    return _mm256_mul_epu32(_mm256_setr_epi64x(0, 1, 2, 3), _mm256_set1_epi64x(stride));
+}
+
+/*
+ * Loads 8 floats that are stride floats apart, index from _mm256_stride_index()
+ */
+static inline __m256
+_mm256_loadu_strided_ps(const float* p, unsigned int stride, __m256i index)
+{
+    if (stride == 1)
+        return _mm256_loadu_ps(p);
+    if (_mm256_stride_fits_epi32(stride))
+        return _mm256_i32gather_ps(p, index, 4);
+    const __m128 lo = _mm256_i64gather_ps(p, index, 4);
+    const __m128 hi = _mm256_i64gather_ps(p + 4 * (size_t)stride, index, 4);
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+}
+
+/*
+ * Loads 8 32-bit integers that are stride integers apart, index from
+ * _mm256_stride_index()
+ */
+static inline __m256i
+_mm256_loadu_strided_epi32(const int* p, unsigned int stride, __m256i index)
+{
+    if (stride == 1)
+        return _mm256_loadu_si256((const __m256i*)p);
+    if (_mm256_stride_fits_epi32(stride))
+        return _mm256_i32gather_epi32(p, index, 4);
+    const __m128i lo = _mm256_i64gather_epi32(p, index, 4);
+    const __m128i hi = _mm256_i64gather_epi32(p + 4 * (size_t)stride, index, 4);
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+/*
+ * Loads 4 complex floats that are stride complex values apart, index from
+ * _mm256_stride_index()
+ */
+static inline __m256
+_mm256_loadu_strided_pc(const float* p, unsigned int stride, __m256i index)
+{
+    if (stride == 1)
+        return _mm256_loadu_ps(p);
+    if (_mm256_stride_fits_epi32(stride))
+        return _mm256_castpd_ps(
+            _mm256_i32gather_pd((const double*)p, _mm256_castsi256_si128(index), 8));
+    return _mm256_castpd_ps(_mm256_i64gather_pd((const double*)p, index, 8));
+}
+
+/*
+ * Stores 8 floats stride floats apart
+ */
+static inline void _mm256_storeu_strided_ps(float* p, unsigned int stride, __m256 v)
+{
+    if (stride == 1) {
+        _mm256_storeu_ps(p, v);
+        return;
+    }
+    const size_t s = stride;
+    const __m128 lo = _mm256_castps256_ps128(v);
+    const __m128 hi = _mm256_extractf128_ps(v, 1);
+    _mm_store_ss(p, lo);
+    _mm_store_ss(p + s, _mm_permute_ps(lo, 1));
+    _mm_store_ss(p + 2 * s, _mm_permute_ps(lo, 2));
+    _mm_store_ss(p + 3 * s, _mm_permute_ps(lo, 3));
+    _mm_store_ss(p + 4 * s, hi);
+    _mm_store_ss(p + 5 * s, _mm_permute_ps(hi, 1));
+    _mm_store_ss(p + 6 * s, _mm_permute_ps(hi, 2));
+    _mm_store_ss(p + 7 * s, _mm_permute_ps(hi, 3));
+}
+
+/*
+ * Stores 4 complex floats stride complex values apart
+ */
+static inline void _mm256_storeu_strided_pc(float* p, unsigned int stride, __m256 v)
+{
+    if (stride == 1) {
+        _mm256_storeu_ps(p, v);
+        return;
+    }
+    const size_t s = stride;
+    const __m128 lo = _mm256_castps256_ps128(v);
+    const __m128 hi = _mm256_extractf128_ps(v, 1);
+    _mm_storel_pi((__m64*)p, lo);
+    _mm_storeh_pi((__m64*)(p + 2 * s), lo);
+    _mm_storel_pi((__m64*)(p + 4 * s), hi);
+    _mm_storeh_pi((__m64*)(p + 6 * s), hi);
+}
+
 #endif /* INCLUDE_VOLK_VOLK_AVX2_INTRINSICS_H_ */
@@ -0,0 +1,332 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*
+ * This file is intended to hold AVX512F intrinsics of intrinsics.
+ * They should be used in VOLK kernels to avoid copy-paste.
+ */
+
+#ifndef INCLUDE_VOLK_VOLK_AVX512_INTRINSICS_H_
+#define INCLUDE_VOLK_VOLK_AVX512_INTRINSICS_H_
+#include <immintrin.h>
+
+/*
+ * re^2 + im^2 of the 16 complex values in cplxValue0 and cplxValue1, in order.
+ */
+static inline __m512 _mm512_magnitudesquared_ps_avx512f(__m512 cplxValue0,
+                                                        __m512 cplxValue1)
+{
+    const __m512i even =
+        _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+    cplxValue0 = _mm512_mul_ps(cplxValue0, cplxValue0);
+    cplxValue1 = _mm512_mul_ps(cplxValue1, cplxValue1);
+    cplxValue0 = _mm512_add_ps(cplxValue0, _mm512_permute_ps(cplxValue0, 0xB1));
+    cplxValue1 = _mm512_add_ps(cplxValue1, _mm512_permute_ps(cplxValue1, 0xB1));
+    return _mm512_permutex2var_ps(cplxValue0, even, cplxValue1);
+}
+
+/*
+ * Products of the eight complex values in x and y.
+ */
+static inline __m512 _mm512_complexmul_ps_avx512f(__m512 x, __m512 y)
+{
+    const __m512 yl = _mm512_moveldup_ps(y); // cr,cr,dr,dr ...
+    const __m512 yh = _mm512_movehdup_ps(y); // ci,ci,di,di ...
+    // ar*cr-ai*ci, ai*cr+ar*ci, ...
+    return _mm512_fmaddsub_ps(x, yl, _mm512_mul_ps(_mm512_permute_ps(x, 0xB1), yh));
+}
+
+/*
+ * The eight complex values in z scaled to unit magnitude.
+ */
+static inline __m512 _mm512_normalize_ps_avx512f(__m512 z)
+{
+    __m512 mag = _mm512_mul_ps(z, z);
+    mag = _mm512_add_ps(mag, _mm512_permute_ps(mag, 0xB1));
+    return _mm512_div_ps(z, _mm512_sqrt_ps(mag));
+}
+
+/*
+ * log2(x) for x >= 0 as computed by volk_32f_log2_32f: the exponent plus a degree 6
+ * polynomial in the mantissa. Zero gives -127 like log2f_non_ieee(), infinities
+ * and NaNs are not supported.
+ */
+static inline __m512 _mm512_log2_ps_avx512f(const __m512 x)
+{
+    const __m512i bits = _mm512_castps_si512(x);
+    const __m512 one = _mm512_set1_ps(1.f);
+    const __m512 exp = _mm512_cvtepi32_ps(_mm512_sub_epi32(
+        _mm512_srli_epi32(_mm512_and_si512(bits, _mm512_set1_epi32(0x7f800000)), 23),
+        _mm512_set1_epi32(127)));
+    const __m512 frac = _mm512_castsi512_ps(_mm512_or_si512(
+        _mm512_castps_si512(one), _mm512_and_si512(bits, _mm512_set1_epi32(0x7fffff))));
+
+    __m512 mantissa = _mm512_set1_ps(-3.4436006e-2f);
+    mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(3.1821337e-1f));
+    mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(-1.2315303f));
+    mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(2.5988452f));
+    mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(-3.3241990f));
+    mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(3.1157899f));
+    return _mm512_fmadd_ps(mantissa, _mm512_sub_ps(frac, one), exp);
+}
+
+/*
+ * arctan(x) for x in [-1, 1]: an odd minimax polynomial of degree 13, with a
+ * relative error below 7.5e-7.
+ */
+static inline __m512 _mm512_arctan_poly_avx512f(const __m512 x)
+{
+    const __m512 x2 = _mm512_mul_ps(x, x);
+    __m512 arctan = _mm512_set1_ps(+0x1.01a37cp-7f);
+    arctan = _mm512_fmadd_ps(x2, arctan, _mm512_set1_ps(-0x1.2f3004p-5f));
+    arctan = _mm512_fmadd_ps(x2, arctan, _mm512_set1_ps(+0x1.5785aap-4f));
+    arctan = _mm512_fmadd_ps(x2, arctan, _mm512_set1_ps(-0x1.1436ap-3f));
+    arctan = _mm512_fmadd_ps(x2, arctan, _mm512_set1_ps(+0x1.972be6p-3f));
+    arctan = _mm512_fmadd_ps(x2, arctan, _mm512_set1_ps(-0x1.55437p-2f));
+    arctan = _mm512_fmadd_ps(x2, arctan, _mm512_set1_ps(+0x1.ffffeap-1f));
+    return _mm512_mul_ps(arctan, x);
+}
+
+/*
+ * atan2(y, x) from _mm512_arctan_poly_avx512f: the ratio of the smaller to the
+ * larger of |x| and |y| goes through the polynomial, and the result is mirrored
+ * into the quadrant of (x, y). atan2(0, 0) is 0, or pi for a negative zero x, as
+ * in atan2f(). Infinite inputs are not supported.
+ */
+static inline __m512 _mm512_atan2_ps_avx512f(const __m512 y, const __m512 x)
+{
+    const __m512i sign_mask = _mm512_set1_epi32(0x80000000);
+    const __m512i pi = _mm512_castps_si512(_mm512_set1_ps(3.14159265358979323846f));
+    const __m512i pi_2 = _mm512_castps_si512(_mm512_set1_ps(1.57079632679489661923f));
+
+    const __mmask16 swap =
+        _mm512_cmp_ps_mask(_mm512_abs_ps(y), _mm512_abs_ps(x), _CMP_GT_OS);
+    __m512 ratio = _mm512_div_ps(_mm512_mask_blend_ps(swap, y, x),
+                                 _mm512_mask_blend_ps(swap, x, y));
+    // 0 / 0
+    ratio = _mm512_mask_blend_ps(
+        _mm512_cmp_ps_mask(ratio, ratio, _CMP_UNORD_Q), ratio, _mm512_setzero_ps());
+    __m512 result = _mm512_arctan_poly_avx512f(ratio);
+
+    // |y| > |x|: +-pi / 2 - arctan(x / y)
+    const __m512 offset = _mm512_castsi512_ps(
+        _mm512_or_si512(pi_2, _mm512_and_si512(_mm512_castps_si512(ratio), sign_mask)));
+    result = _mm512_mask_sub_ps(result, swap, offset, result);
+    // x < 0: +-pi, with the sign of y
+    const __m512 y_pi = _mm512_castsi512_ps(
+        _mm512_or_si512(pi, _mm512_and_si512(_mm512_castps_si512(y), sign_mask)));
+    const __mmask16 x_neg = _mm512_test_epi32_mask(_mm512_castps_si512(x), sign_mask);
+    return _mm512_mask_add_ps(result, x_neg, result, y_pi);
+}
+
+/*
+ * scale * atan2(y, x) as in cephes atanf, slower but more accurate than
+ * _mm512_atan2_ps_avx512f: the ratio of the smaller to the larger of |x| and |y|
+ * is reduced to |r| <= tan(pi / 8), where a degree 9 polynomial is good to about
+ * 1 ulp. The result is a multiple of pi / 4 plus or minus that, and the multiple
+ * is scaled in extended precision so that a large scale does not magnify its
+ * rounding error. Signed zeros as in atan2f(), infinities are not supported.
+ */
+static inline __m512
+_mm512_atan2_cephes_ps_avx512f(const __m512 y, const __m512 x, const __m512 scale)
+{
+    const __m512i sign_mask = _mm512_set1_epi32(0x80000000);
+    const __m512 one = _mm512_set1_ps(1.f);
+    const __m512 ax = _mm512_abs_ps(x);
+    const __m512 ay = _mm512_abs_ps(y);
+
+    __m512 ratio = _mm512_div_ps(_mm512_min_ps(ax, ay), _mm512_max_ps(ax, ay));
+    // 0 / 0
+    ratio = _mm512_mask_blend_ps(
+        _mm512_cmp_ps_mask(ratio, ratio, _CMP_UNORD_Q), ratio, _mm512_setzero_ps());
+
+    // ratio > tan(pi / 8): pi / 4 + arctan((ratio - 1) / (ratio + 1))
+    const __mmask16 big =
+        _mm512_cmp_ps_mask(ratio, _mm512_set1_ps(0.4142135623730950f), _CMP_GT_OS);
+    const __m512 r = _mm512_mask_div_ps(
+        ratio, big, _mm512_sub_ps(ratio, one), _mm512_add_ps(ratio, one));
+    const __m512 z = _mm512_mul_ps(r, r);
+    __m512 poly = _mm512_set1_ps(8.05374449538e-2f);
+    poly = _mm512_fmadd_ps(poly, z, _mm512_set1_ps(-1.38776856032e-1f));
+    poly = _mm512_fmadd_ps(poly, z, _mm512_set1_ps(1.99777106478e-1f));
+    poly = _mm512_fmadd_ps(poly, z, _mm512_set1_ps(-3.33329491539e-1f));
+    poly = _mm512_fmadd_ps(_mm512_mul_ps(poly, z), r, r);
+
+    // |y| > |x|: pi / 2 - arctan(|x| / |y|), x < 0: pi - arctan, each of which
+    // turns the octant m around and negates the polynomial
+    __m512 m = _mm512_mask_blend_ps(big, _mm512_setzero_ps(), one);
+    const __mmask16 swap = _mm512_cmp_ps_mask(ay, ax, _CMP_GT_OS);
+    m = _mm512_mask_sub_ps(m, swap, _mm512_set1_ps(2.f), m);
+    poly = _mm512_mask_sub_ps(poly, swap, _mm512_setzero_ps(), poly);
+    const __mmask16 x_neg = _mm512_test_epi32_mask(_mm512_castps_si512(x), sign_mask);
+    m = _mm512_mask_sub_ps(m, x_neg, _mm512_set1_ps(4.f), m);
+    poly = _mm512_mask_sub_ps(poly, x_neg, _mm512_setzero_ps(), poly);
+
+    // scale (m pi / 4 + poly) with pi / 4 in two parts
+    const __m512 sm = _mm512_mul_ps(scale, m);
+    __m512 result = _mm512_fmadd_ps(
+        sm, _mm512_set1_ps(-2.1855695e-8f), _mm512_mul_ps(scale, poly));
+    result = _mm512_fmadd_ps(sm, _mm512_set1_ps(0.78539818525314331f), result);
+    return _mm512_castsi512_ps(_mm512_xor_si512(
+        _mm512_castps_si512(result),
+        _mm512_and_si512(_mm512_castps_si512(y), sign_mask)));
+}
+
+/*
+ * exp(x) as computed by volk_32f_exp_32f_a_sse2 (cephes expf): x is clamped to
+ * +-88.376, split into n ln(2) + g with |g| <= ln(2) / 2, and exp(g) is a degree 5
+ * polynomial, scaled by 2^n. Large negative inputs flush to zero.
+ */
+static inline __m512 _mm512_exp_ps_avx512f(__m512 x)
+{
+    x = _mm512_max_ps(_mm512_min_ps(x, _mm512_set1_ps(88.3762626647949f)),
+                      _mm512_set1_ps(-88.3762626647949f));
+
+    // exp(x) = exp(g + n ln(2))
+    const __m512 fx = _mm512_roundscale_ps(
+        _mm512_fmadd_ps(x, _mm512_set1_ps(1.44269504088896341f), _mm512_set1_ps(0.5f)),
+        _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(0.693359375f), x);
+    x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(-2.12194440e-4f), x);
+
+    __m512 y = _mm512_set1_ps(1.9875691500e-4f);
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.3981999507e-3f));
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(8.3334519073e-3f));
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(4.1665795894e-2f));
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.6666665459e-1f));
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(5.0000001201e-1f));
+    y = _mm512_fmadd_ps(y, _mm512_mul_ps(x, x), x);
+    y = _mm512_add_ps(y, _mm512_set1_ps(1.f));
+
+    const __m512i pow2n = _mm512_slli_epi32(
+        _mm512_add_epi32(_mm512_cvttps_epi32(fx), _mm512_set1_epi32(0x7f)), 23);
+    return _mm512_mul_ps(y, _mm512_castsi512_ps(pow2n));
+}
+
+/*
+ * x^y for x >= 0 as exp(y ln(x)), with the cephes logf and expf polynomials: x is
+ * split into 2^e m with m in [sqrt(1/2), sqrt(2)), and y e is carried in two
+ * parts, so that the exponent of the result comes out exact and only y ln(m)
+ * and the reduced argument of exp() are rounded. Zero and denormals count as
+ * FLT_MIN, results that underflow flush to zero and overflow is not supported.
+ */
+static inline __m512 _mm512_pow_ps_avx512f(__m512 x, const __m512 y)
+{
+    const __m512 one = _mm512_set1_ps(1.f);
+    x = _mm512_max_ps(x, _mm512_castsi512_ps(_mm512_set1_epi32(0x00800000)));
+
+    // x = m 2^e with m in [0.5, 1)
+    __m512 e = _mm512_cvtepi32_ps(_mm512_sub_epi32(
+        _mm512_srli_epi32(_mm512_castps_si512(x), 23), _mm512_set1_epi32(0x7e)));
+    x = _mm512_castsi512_ps(_mm512_or_si512(
+        _mm512_and_si512(_mm512_castps_si512(x), _mm512_set1_epi32(0x7fffff)),
+        _mm512_castps_si512(_mm512_set1_ps(0.5f))));
+
+    // m < sqrt(1/2): f = 2 m - 1 and e - 1, else f = m - 1
+    const __mmask16 mask =
+        _mm512_cmp_ps_mask(x, _mm512_set1_ps(0.707106781186547524f), _CMP_LT_OS);
+    e = _mm512_mask_sub_ps(e, mask, e, one);
+    const __m512 f = _mm512_sub_ps(x, one);
+    x = _mm512_mask_add_ps(f, mask, f, x);
+
+    // ln(1 + f)
+    const __m512 z = _mm512_mul_ps(x, x);
+    __m512 l = _mm512_set1_ps(7.0376836292e-2f);
+    l = _mm512_fmadd_ps(l, x, _mm512_set1_ps(-1.1514610310e-1f));
+    l = _mm512_fmadd_ps(l, x, _mm512_set1_ps(1.1676998740e-1f));
+    l = _mm512_fmadd_ps(l, x, _mm512_set1_ps(-1.2420140846e-1f));
+    l = _mm512_fmadd_ps(l, x, _mm512_set1_ps(1.4249322787e-1f));
+    l = _mm512_fmadd_ps(l, x, _mm512_set1_ps(-1.6668057665e-1f));
+    l = _mm512_fmadd_ps(l, x, _mm512_set1_ps(2.0000714765e-1f));
+    l = _mm512_fmadd_ps(l, x, _mm512_set1_ps(-2.4999993993e-1f));
+    l = _mm512_fmadd_ps(l, x, _mm512_set1_ps(3.3333331174e-1f));
+    l = _mm512_fmadd_ps(
+        _mm512_mul_ps(l, x), z, _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), x));
+
+    // y ln(x) = (n + k + ye_lo) ln(2) + y ln(m) with n the nearest integer, and
+    // k = y e - n exact
+    const __m512 ye = _mm512_mul_ps(y, e);
+    const __m512 ye_lo = _mm512_fmsub_ps(y, e, ye);
+    const __m512 yl = _mm512_mul_ps(y, l);
+    __m512 n = _mm512_roundscale_ps(
+        _mm512_fmadd_ps(yl, _mm512_set1_ps(1.44269504088896341f), ye),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    n = _mm512_max_ps(_mm512_min_ps(n, _mm512_set1_ps(127.f)), _mm512_set1_ps(-127.f));
+    const __m512 k = _mm512_sub_ps(ye, n);
+    __m512 g = _mm512_fmadd_ps(ye_lo, _mm512_set1_ps(0.693147180559945309f), yl);
+    g = _mm512_fmadd_ps(k, _mm512_set1_ps(-2.12194440e-4f), g);
+    g = _mm512_fmadd_ps(k, _mm512_set1_ps(0.693359375f), g);
+
+    // exp(g) 2^n
+    __m512 p = _mm512_set1_ps(1.9875691500e-4f);
+    p = _mm512_fmadd_ps(p, g, _mm512_set1_ps(1.3981999507e-3f));
+    p = _mm512_fmadd_ps(p, g, _mm512_set1_ps(8.3334519073e-3f));
+    p = _mm512_fmadd_ps(p, g, _mm512_set1_ps(4.1665795894e-2f));
+    p = _mm512_fmadd_ps(p, g, _mm512_set1_ps(1.6666665459e-1f));
+    p = _mm512_fmadd_ps(p, g, _mm512_set1_ps(5.0000001201e-1f));
+    p = _mm512_fmadd_ps(p, _mm512_mul_ps(g, g), g);
+    p = _mm512_add_ps(p, one);
+
+    const __m512i pow2n = _mm512_slli_epi32(
+        _mm512_add_epi32(_mm512_cvtps_epi32(n), _mm512_set1_epi32(0x7f)), 23);
+    return _mm512_mul_ps(p, _mm512_castsi512_ps(pow2n));
+}
+
+/*
+ * sin(x) and cos(x) as in cephes sinf/cosf: x is reduced by multiples of pi / 4 in
+ * three steps, and the sine or cosine polynomial is picked per octant. Accurate to
+ * a few ulp for |x| up to about 8192.
+ */
+static inline void _mm512_sincos_ps_avx512f(__m512 x, __m512* sine, __m512* cosine)
+{
+    const __m512i sign_mask = _mm512_set1_epi32(0x80000000);
+    __m512i sign_sin = _mm512_and_si512(_mm512_castps_si512(x), sign_mask);
+    x = _mm512_abs_ps(x);
+
+    // j = (int)(4 x / pi) rounded up to even
+    __m512i j =
+        _mm512_cvttps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(1.27323954473516f)));
+    j = _mm512_and_si512(_mm512_add_epi32(j, _mm512_set1_epi32(1)),
+                         _mm512_set1_epi32(~1));
+    const __m512 y = _mm512_cvtepi32_ps(j);
+
+    // extended precision modular arithmetic
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(0.78515625f), x);
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(2.4187564849853515625e-4f), x);
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(3.77489497744594108e-8f), x);
+
+    // octants 2 and 3 (mod 4) swap the polynomials, bit 2 of j (j + 2 for
+    // the cosine) is the sign
+    const __m512i two = _mm512_set1_epi32(2);
+    const __mmask16 swap = _mm512_test_epi32_mask(j, two);
+    sign_sin = _mm512_and_si512(_mm512_xor_si512(sign_sin, _mm512_slli_epi32(j, 29)),
+                                sign_mask);
+    const __m512i sign_cos =
+        _mm512_and_si512(_mm512_slli_epi32(_mm512_add_epi32(j, two), 29), sign_mask);
+
+    const __m512 z = _mm512_mul_ps(x, x);
+    __m512 yc = _mm512_set1_ps(2.443315711809948e-5f);
+    yc = _mm512_fmadd_ps(yc, z, _mm512_set1_ps(-1.388731625493765e-3f));
+    yc = _mm512_fmadd_ps(yc, z, _mm512_set1_ps(4.166664568298827e-2f));
+    yc = _mm512_mul_ps(_mm512_mul_ps(yc, z), z);
+    yc = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), yc);
+    yc = _mm512_add_ps(yc, _mm512_set1_ps(1.f));
+
+    __m512 ys = _mm512_set1_ps(-1.9515295891e-4f);
+    ys = _mm512_fmadd_ps(ys, z, _mm512_set1_ps(8.3321608736e-3f));
+    ys = _mm512_fmadd_ps(ys, z, _mm512_set1_ps(-1.6666654611e-1f));
+    ys = _mm512_fmadd_ps(_mm512_mul_ps(ys, z), x, x);
+
+    *sine = _mm512_castsi512_ps(_mm512_xor_si512(
+        _mm512_castps_si512(_mm512_mask_blend_ps(swap, ys, yc)), sign_sin));
+    *cosine = _mm512_castsi512_ps(_mm512_xor_si512(
+        _mm512_castps_si512(_mm512_mask_blend_ps(swap, yc, ys)), sign_cos));
+}
+
+#endif /* INCLUDE_VOLK_VOLK_AVX512_INTRINSICS_H_ */
@@ -15,6 +15,7 @@
 #ifndef INCLUDE_VOLK_VOLK_AVX_INTRINSICS_H_
 #define INCLUDE_VOLK_VOLK_AVX_INTRINSICS_H_
 #include <immintrin.h>
+#include <stddef.h>
 
 static inline __m256 _mm256_complexmul_ps(__m256 x, __m256 y)
 {
@@ -192,4 +193,83 @@ static inline __m256 _mm256_accumulate_square_sum_ps(
     return _mm256_add_ps(sq_acc, aux);
 }
 
+/*
+ * Mask for _mm256_maskload_ps/_mm256_maskstore_ps selecting the first n
+ * (0 to 8) floats
+ */
+static inline __m256i _mm256_tail_mask(unsigned int n)
+{
+    static const int tail_masks[16] = { -1, -1, -1, -1, -1, -1, -1, -1,
+                                        0,  0,  0,  0,  0,  0,  0,  0 };
+    return _mm256_loadu_si256((const __m256i*)(tail_masks + 8 - n));
+}
+
+/*
+ * Horizontal sums of eight vectors: lane i of the result is the sum of all
+ * lanes of x_i
+ */
+static inline __m256 _mm256_transpose_sum8_ps(__m256 x0,
+                                              __m256 x1,
+                                              __m256 x2,
+                                              __m256 x3,
+                                              __m256 x4,
+                                              __m256 x5,
+                                              __m256 x6,
+                                              __m256 x7)
+{
+    // within each 128-bit half: partial sums of x0..x3 and x4..x7
+    const __m256 s0123 = _mm256_hadd_ps(_mm256_hadd_ps(x0, x1), _mm256_hadd_ps(x2, x3));
+    const __m256 s4567 = _mm256_hadd_ps(_mm256_hadd_ps(x4, x5), _mm256_hadd_ps(x6, x7));
+    return _mm256_add_ps(_mm256_permute2f128_ps(s0123, s4567, 0x20),
+                         _mm256_permute2f128_ps(s0123, s4567, 0x31));
+}
+
+/*
+ * Complex horizontal sums of four vectors of four complex values: complex
+ * lane i of the result is the sum of all complex lanes of z_i
+ */
+static inline __m256 _mm256_complex_transpose_sum4_ps(__m256 z0,
+                                                      __m256 z1,
+                                                      __m256 z2,
+                                                      __m256 z3)
+{
+    // low half: two partial sums of z0 (z1), high half: of z2 (z3)
+    const __m256 s02 = _mm256_add_ps(_mm256_permute2f128_ps(z0, z2, 0x20),
+                                     _mm256_permute2f128_ps(z0, z2, 0x31));
+    const __m256 s13 = _mm256_add_ps(_mm256_permute2f128_ps(z1, z3, 0x20),
+                                     _mm256_permute2f128_ps(z1, z3, 0x31));
+    return _mm256_add_ps(_mm256_shuffle_ps(s02, s13, _MM_SHUFFLE(1, 0, 1, 0)),
+                         _mm256_shuffle_ps(s02, s13, _MM_SHUFFLE(3, 2, 3, 2)));
+}
+
+/*
+ * Transposes four vectors of four complex values in place: afterwards complex
+ * lane j of z_i holds what was complex lane i of z_j
+ */
+static inline void
+_mm256_complex_transpose4_ps(__m256* z0, __m256* z1, __m256* z2, __m256* z3)
+{
+    const __m256d t0 = _mm256_unpacklo_pd(_mm256_castps_pd(*z0), _mm256_castps_pd(*z1));
+    const __m256d t1 = _mm256_unpackhi_pd(_mm256_castps_pd(*z0), _mm256_castps_pd(*z1));
+    const __m256d t2 = _mm256_unpacklo_pd(_mm256_castps_pd(*z2), _mm256_castps_pd(*z3));
+    const __m256d t3 = _mm256_unpackhi_pd(_mm256_castps_pd(*z2), _mm256_castps_pd(*z3));
+    *z0 = _mm256_castpd_ps(_mm256_permute2f128_pd(t0, t2, 0x20));
+    *z1 = _mm256_castpd_ps(_mm256_permute2f128_pd(t1, t3, 0x20));
+    *z2 = _mm256_castpd_ps(_mm256_permute2f128_pd(t0, t2, 0x31));
+    *z3 = _mm256_castpd_ps(_mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+/*
+ * Stores complex lane i of z to p + i * stride, stride counted in floats
+ */
+static inline void _mm256_storeu_complex_lanes_ps(float* p, size_t stride, __m256 z)
+{
+    const __m128 lo = _mm256_castps256_ps128(z);
+    const __m128 hi = _mm256_extractf128_ps(z, 1);
+    _mm_storel_pi((__m64*)p, lo);
+    _mm_storeh_pi((__m64*)(p + stride), lo);
+    _mm_storel_pi((__m64*)(p + 2 * stride), hi);
+    _mm_storeh_pi((__m64*)(p + 3 * stride), hi);
+}
+
 #endif /* INCLUDE_VOLK_VOLK_AVX_INTRINSICS_H_ */
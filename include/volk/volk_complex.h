@@ -13,7 +13,8 @@
 /*!
  * \brief Provide typedefs and operators for all complex types in C and C++.
  *
- * The typedefs encompass all signed integer and floating point types.
+ * The typedefs encompass all signed integer and floating point types, and the
+ * unsigned 8 bit type of offset binary IQ samples.
  * Each operator function is intended to work across all data types.
  * Under C++, these operators are defined as inline templates.
  * Under C, these operators are defined as preprocessor macros.
@@ -32,6 +33,7 @@
 #include <complex>
 
 typedef std::complex<int8_t> lv_8sc_t;
+typedef std::complex<uint8_t> lv_8uc_t;
 typedef std::complex<int16_t> lv_16sc_t;
 typedef std::complex<int32_t> lv_32sc_t;
 typedef std::complex<int64_t> lv_64sc_t;
@@ -68,6 +70,7 @@ inline T lv_conj(const T& x)
 #include <tgmath.h>
 
 typedef char complex lv_8sc_t;
+typedef unsigned char complex lv_8uc_t;
 typedef short complex lv_16sc_t;
 typedef long complex lv_32sc_t;
 typedef long long complex lv_64sc_t;
@@ -0,0 +1,427 @@
+/* -*- C++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_EXPR_HH
+#define INCLUDED_VOLK_EXPR_HH
+
+#include <volk/volk.hh>
+
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+/*!
+ * \brief Lazily evaluated, tiled compositions of VOLK kernels
+ *
+ * \details
+ * Chaining kernels on full vectors streams every intermediate result through
+ * main memory. The expressions in this namespace only record the chain; it is
+ * evaluated on assign() (or reduced by sum()) one tile at a time, running
+ * each kernel on a tile of default_tile_points points. The intermediates are
+ * held in small per-node buffers that stay in L1/L2 between kernels.
+ *
+ * Vectors enter an expression through lazy(), which does not copy. Nodes
+ * reference the vectors they were built from, so an expression must not
+ * outlive them.
+ *
+ * example code:
+ *   using namespace volk::expr;
+ *   // |a * b + c|^2 without full-length temporaries
+ *   assign(out, magnitude_squared(lazy(a) * lazy(b) + lazy(c)));
+ *   float energy = sum(magnitude_squared(lazy(a) * lazy(b)));
+ */
+namespace volk {
+namespace expr {
+
+//! Number of points per tile, 8 KiB of complex floats per intermediate
+constexpr std::size_t default_tile_points = 1024;
+
+struct expression_base {
+};
+
+template <class T>
+using is_expression = std::is_base_of<expression_base, typename std::decay<T>::type>;
+
+template <class T>
+struct is_scalar : std::is_arithmetic<T> {
+};
+
+template <class T>
+struct is_scalar<std::complex<T>> : std::true_type {
+};
+
+/*!
+ * \brief Expression leaf referring to an existing vector
+ */
+template <class T>
+class terminal : public expression_base
+{
+public:
+    typedef T value_type;
+
+    explicit terminal(span<const T> v) : _v(v) {}
+
+    std::size_t size() const { return _v.size(); }
+
+    const T* eval(std::size_t offset, std::size_t) const { return _v.data() + offset; }
+
+    void eval_into(T* out, std::size_t offset, std::size_t n) const
+    {
+        std::memmove(out, _v.data() + offset, n * sizeof(T));
+    }
+
+private:
+    span<const T> _v;
+};
+
+/*!
+ * \brief Common part of all nodes that run a kernel
+ * \details The derived class provides eval_into(); the result of eval() is
+ * kept in a tile buffer owned by the node.
+ */
+template <class Derived, class T>
+class node : public expression_base
+{
+public:
+    typedef T value_type;
+
+    const T* eval(std::size_t offset, std::size_t n) const
+    {
+        if (_tile.size() < n)
+            _tile.resize(n);
+        static_cast<const Derived*>(this)->eval_into(_tile.data(), offset, n);
+        return _tile.data();
+    }
+
+private:
+    mutable buffer<T> _tile;
+};
+
+namespace ops {
+
+// Each op tries the kernel with the operands in order and, for commutative
+// ops, falls back to swapping them (e.g. float * complex uses
+// volk_32fc_32f_multiply_32fc).
+
+struct multiply {
+    template <class O, class A, class B>
+    static auto apply(span<O> out, span<const A> a, span<const B> b, int)
+        -> decltype(volk::multiply(out, a, b))
+    {
+        volk::multiply(out, a, b);
+    }
+    template <class O, class A, class B>
+    static void apply(span<O> out, span<const A> a, span<const B> b, long)
+    {
+        volk::multiply(out, b, a);
+    }
+    template <class A, class B>
+    using result_t = decltype(std::declval<A>() * std::declval<B>());
+};
+
+struct add {
+    template <class O, class A, class B>
+    static auto apply(span<O> out, span<const A> a, span<const B> b, int)
+        -> decltype(volk::add(out, a, b))
+    {
+        volk::add(out, a, b);
+    }
+    template <class O, class A, class B>
+    static void apply(span<O> out, span<const A> a, span<const B> b, long)
+    {
+        volk::add(out, b, a);
+    }
+    template <class A, class B>
+    using result_t = decltype(std::declval<A>() + std::declval<B>());
+};
+
+struct subtract {
+    template <class O, class A, class B>
+    static void apply(span<O> out, span<const A> a, span<const B> b, int)
+    {
+        volk::subtract(out, a, b);
+    }
+    template <class A, class B>
+    using result_t = decltype(std::declval<A>() - std::declval<B>());
+};
+
+struct multiply_conjugate {
+    template <class O, class A, class B>
+    static void apply(span<O> out, span<const A> a, span<const B> b, int)
+    {
+        volk::multiply_conjugate(out, a, b);
+    }
+    template <class A, class B>
+    using result_t = A;
+};
+
+struct conjugate {
+    template <class O, class A>
+    static void apply(span<O> out, span<const A> a)
+    {
+        volk::conjugate(out, a);
+    }
+    template <class A>
+    using result_t = A;
+};
+
+struct magnitude {
+    template <class O, class A>
+    static void apply(span<O> out, span<const A> a)
+    {
+        volk::magnitude(out, a);
+    }
+    template <class A>
+    using result_t = typename A::value_type;
+};
+
+struct magnitude_squared {
+    template <class O, class A>
+    static void apply(span<O> out, span<const A> a)
+    {
+        volk::magnitude_squared(out, a);
+    }
+    template <class A>
+    using result_t = typename A::value_type;
+};
+
+/*!
+ * \brief Sum of one tile
+ * \details Uses the accumulator kernel where VOLK has one for the element type
+ * (float, complex float) and a plain loop otherwise.
+ */
+struct accumulate {
+    template <class T>
+    static auto apply(span<const T> a, int)
+        -> decltype(volk::accumulator(std::declval<T&>(), a), T())
+    {
+        T partial;
+        volk::accumulator(partial, a);
+        return partial;
+    }
+    template <class T>
+    static T apply(span<const T> a, long)
+    {
+        T partial = T(0);
+        for (const T& v : a)
+            partial += v;
+        return partial;
+    }
+};
+
+} // namespace ops
+
+/*!
+ * \brief Elementwise kernel with two vector operands
+ */
+template <class Op, class L, class R>
+class binary
+    : public node<binary<Op, L, R>,
+                  typename Op::template result_t<typename L::value_type,
+                                                 typename R::value_type>>
+{
+public:
+    typedef typename Op::template result_t<typename L::value_type,
+                                           typename R::value_type>
+        value_type;
+
+    binary(L l, R r) : _l(std::move(l)), _r(std::move(r))
+    {
+        assert(_l.size() == _r.size());
+    }
+
+    std::size_t size() const { return _l.size(); }
+
+    void eval_into(value_type* out, std::size_t offset, std::size_t n) const
+    {
+        Op::apply(span<value_type>(out, n),
+                  span<const typename L::value_type>(_l.eval(offset, n), n),
+                  span<const typename R::value_type>(_r.eval(offset, n), n),
+                  0);
+    }
+
+private:
+    L _l;
+    R _r;
+};
+
+/*!
+ * \brief Elementwise kernel with one vector operand
+ */
+template <class Op, class A>
+class unary
+    : public node<unary<Op, A>, typename Op::template result_t<typename A::value_type>>
+{
+public:
+    typedef typename Op::template result_t<typename A::value_type> value_type;
+
+    explicit unary(A a) : _a(std::move(a)) {}
+
+    std::size_t size() const { return _a.size(); }
+
+    void eval_into(value_type* out, std::size_t offset, std::size_t n) const
+    {
+        Op::apply(span<value_type>(out, n),
+                  span<const typename A::value_type>(_a.eval(offset, n), n));
+    }
+
+private:
+    A _a;
+};
+
+/*!
+ * \brief Vector times scalar
+ */
+template <class A>
+class scaled : public node<scaled<A>, typename A::value_type>
+{
+public:
+    typedef typename A::value_type value_type;
+
+    scaled(A a, value_type s) : _a(std::move(a)), _s(s) {}
+
+    std::size_t size() const { return _a.size(); }
+
+    void eval_into(value_type* out, std::size_t offset, std::size_t n) const
+    {
+        volk::multiply(span<value_type>(out, n),
+                       span<const value_type>(_a.eval(offset, n), n),
+                       _s);
+    }
+
+private:
+    A _a;
+    value_type _s;
+};
+
+//! Wraps a vector (volk::vector, volk::buffer, std::vector, span, ...)
+template <class C>
+terminal<detail::element_t<C>> lazy(const C& c)
+{
+    return terminal<detail::element_t<C>>(span<const detail::element_t<C>>(c));
+}
+
+template <class T>
+terminal<T> lazy(const T* data, std::size_t n)
+{
+    return terminal<T>(span<const T>(data, n));
+}
+
+template <class L,
+          class R,
+          class = typename std::enable_if<is_expression<L>::value &&
+                                          is_expression<R>::value>::type>
+binary<ops::multiply, L, R> operator*(L l, R r)
+{
+    return binary<ops::multiply, L, R>(std::move(l), std::move(r));
+}
+
+template <class A,
+          class S,
+          class = typename std::enable_if<is_expression<A>::value &&
+                                          is_scalar<S>::value>::type>
+scaled<A> operator*(A a, S s)
+{
+    return scaled<A>(std::move(a), typename A::value_type(s));
+}
+
+template <class A,
+          class S,
+          class = typename std::enable_if<is_expression<A>::value &&
+                                          is_scalar<S>::value>::type>
+scaled<A> operator*(S s, A a)
+{
+    return scaled<A>(std::move(a), typename A::value_type(s));
+}
+
+template <class L,
+          class R,
+          class = typename std::enable_if<is_expression<L>::value &&
+                                          is_expression<R>::value>::type>
+binary<ops::add, L, R> operator+(L l, R r)
+{
+    return binary<ops::add, L, R>(std::move(l), std::move(r));
+}
+
+template <class L,
+          class R,
+          class = typename std::enable_if<is_expression<L>::value &&
+                                          is_expression<R>::value>::type>
+binary<ops::subtract, L, R> operator-(L l, R r)
+{
+    return binary<ops::subtract, L, R>(std::move(l), std::move(r));
+}
+
+//! a * conj(b)
+template <class L, class R>
+binary<ops::multiply_conjugate, L, R> multiply_conjugate(L l, R r)
+{
+    return binary<ops::multiply_conjugate, L, R>(std::move(l), std::move(r));
+}
+
+template <class A>
+unary<ops::conjugate, A> conj(A a)
+{
+    return unary<ops::conjugate, A>(std::move(a));
+}
+
+template <class A>
+unary<ops::magnitude, A> magnitude(A a)
+{
+    return unary<ops::magnitude, A>(std::move(a));
+}
+
+template <class A>
+unary<ops::magnitude_squared, A> magnitude_squared(A a)
+{
+    return unary<ops::magnitude_squared, A>(std::move(a));
+}
+
+/*!
+ * \brief Evaluates \p e tile by tile into \p out
+ * \details The last node of the chain writes straight into \p out. \p out may
+ * be one of the vectors \p e reads, as long as it is not offset against it:
+ * each tile of \p out is written only after the same tile of the operands has
+ * been read.
+ */
+template <class E>
+void assign(span<typename E::value_type> out,
+            const E& e,
+            std::size_t tile_points = default_tile_points)
+{
+    assert(out.size() <= e.size());
+    for (std::size_t offset = 0; offset < out.size(); offset += tile_points) {
+        const std::size_t n = std::min(tile_points, out.size() - offset);
+        e.eval_into(out.data() + offset, offset, n);
+    }
+}
+
+/*!
+ * \brief Evaluates \p e tile by tile and returns the sum of all points
+ */
+template <class E>
+typename E::value_type sum(const E& e, std::size_t tile_points = default_tile_points)
+{
+    typedef typename E::value_type T;
+    T total = T(0);
+    for (std::size_t offset = 0; offset < e.size(); offset += tile_points) {
+        const std::size_t n = std::min(tile_points, e.size() - offset);
+        total += ops::accumulate::apply(span<const T>(e.eval(offset, n), n), 0);
+    }
+    return total;
+}
+
+} // namespace expr
+} // namespace volk
+
+#endif /* INCLUDED_VOLK_EXPR_HH */
@@ -0,0 +1,72 @@
+/* -*- c -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_FFT_H
+#define INCLUDED_VOLK_FFT_H
+
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+__VOLK_DECL_BEGIN
+
+/*!
+ * \brief FFT plans for volk_32fc_x2_fft_32fc
+ *
+ * \details
+ * A plan holds the twiddle factors of one transform size and direction,
+ * computed once in double precision. Transforms are unnormalized in both
+ * directions, an inverse after a forward transform scales by num_points.
+ * A plan is read-only after creation and can be shared between threads.
+ *
+ * example code:
+ *   volk_fft_plan_t* plan = volk_fft_plan_create(1024, VOLK_FFT_FORWARD);
+ *   volk_fft_execute(plan, out, in);
+ *   ...
+ *   volk_fft_plan_destroy(plan);
+ */
+
+//! Transform direction of a plan, the sign of the exponent
+#define VOLK_FFT_FORWARD -1
+#define VOLK_FFT_INVERSE 1
+
+//! Largest transform size supported by volk_fft_plan_create()
+#define VOLK_FFT_MAX_POINTS 65536
+
+//! Opaque plan handle
+typedef struct volk_fft_plan volk_fft_plan_t;
+
+/*!
+ * \brief Creates a plan.
+ * \param num_points transform size, a power of two up to VOLK_FFT_MAX_POINTS
+ * \param direction VOLK_FFT_FORWARD or VOLK_FFT_INVERSE
+ * \return the plan, NULL for an unsupported size or direction or if out of
+ *         memory
+ */
+VOLK_API volk_fft_plan_t* volk_fft_plan_create(unsigned int num_points, int direction);
+
+//! Frees a plan, NULL is ignored
+VOLK_API void volk_fft_plan_destroy(volk_fft_plan_t* plan);
+
+//! Returns the transform size of a plan
+VOLK_API unsigned int volk_fft_plan_size(const volk_fft_plan_t* plan);
+
+//! Returns the twiddle factors of a plan, as taken by volk_32fc_x2_fft_32fc
+VOLK_API const lv_32fc_t* volk_fft_plan_twiddles(const volk_fft_plan_t* plan);
+
+/*!
+ * \brief Transforms volk_fft_plan_size(plan) points of \p input into
+ * \p output.
+ * \details \p output may be the same buffer as \p input.
+ */
+VOLK_API void
+volk_fft_execute(const volk_fft_plan_t* plan, lv_32fc_t* output, const lv_32fc_t* input);
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_FFT_H */
@@ -0,0 +1,116 @@
+/* -*- c -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*
+ * Scalar conversions between 32 bit floats and the two 16 bit float formats of
+ * the 16f and 16bf kernels, both stored as uint16_t:
+ *
+ * 16f:  IEEE 754 binary16, 1 sign, 5 exponent and 10 mantissa bits
+ * 16bf: bfloat16, the upper half of a binary32, 1 sign, 8 exponent and 7
+ *       mantissa bits
+ *
+ * Narrowing rounds to nearest even and keeps subnormals, infinities and NaNs,
+ * like the F16C, AVX-512 and NEON conversion instructions, so the generic
+ * kernels and the SIMD ones produce the same bits.
+ */
+
+#ifndef INCLUDED_VOLK_FLOAT16_H
+#define INCLUDED_VOLK_FLOAT16_H
+
+#include <inttypes.h>
+#include <string.h>
+
+static inline float volk_16f_to_32f(uint16_t h)
+{
+    const uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t exponent = (h >> 10) & 0x1f;
+    uint32_t mantissa = h & 0x3ff;
+    uint32_t bits;
+
+    if (exponent == 0x1f) {
+        // infinity or NaN, made quiet
+        bits = sign | 0x7f800000 | (mantissa << 13) | (mantissa ? 0x00400000 : 0);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+        bits = sign;
+    } else {
+        // subnormal, normalize
+        exponent = 113;
+        while (!(mantissa & 0x400)) {
+            mantissa <<= 1;
+            exponent--;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+    }
+
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+static inline uint16_t volk_32f_to_16f(float f)
+{
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    const uint16_t sign = (bits >> 16) & 0x8000;
+    const uint32_t magnitude = bits & 0x7fffffff;
+
+    if (magnitude > 0x7f800000) {
+        // NaN, made quiet
+        return sign | 0x7e00 | ((magnitude >> 13) & 0x3ff);
+    }
+    if (magnitude >= 0x477ff000) {
+        // rounds past 65504
+        return sign | 0x7c00;
+    }
+    if (magnitude >= 0x38800000) {
+        // normal, rebias the exponent by 127 - 15
+        uint32_t rebiased = magnitude - 0x38000000;
+        rebiased += 0x0fff + ((rebiased >> 13) & 1);
+        return sign | (uint16_t)(rebiased >> 13);
+    }
+    if (magnitude <= 0x33000000) {
+        // at most half of the smallest subnormal
+        return sign;
+    }
+
+    // subnormal, the mantissa is in units of 2^-24
+    const uint32_t shift = 126 - (magnitude >> 23);
+    const uint32_t mantissa = (magnitude & 0x7fffff) | 0x800000;
+    const uint32_t rest = mantissa & ((1u << shift) - 1);
+    const uint32_t half = 1u << (shift - 1);
+    uint32_t result = mantissa >> shift;
+    if (rest > half || (rest == half && (result & 1))) {
+        result++;
+    }
+    return sign | (uint16_t)result;
+}
+
+static inline float volk_16bf_to_32f(uint16_t h)
+{
+    const uint32_t bits = (uint32_t)h << 16;
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+static inline uint16_t volk_32f_to_16bf(float f)
+{
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    if ((bits & 0x7fffffff) > 0x7f800000) {
+        // NaN, made quiet
+        return (uint16_t)((bits >> 16) | 0x0040);
+    }
+    bits += 0x7fff + ((bits >> 16) & 1);
+    return (uint16_t)(bits >> 16);
+}
+
+#endif /* INCLUDED_VOLK_FLOAT16_H */
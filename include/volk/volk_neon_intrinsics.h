@@ -56,6 +56,8 @@
   (this is the zlib license)
 
   _vsincosq_f32
+  _vpowq_f32
+  _vexpq_f32
 
 */
 
@@ -67,6 +69,7 @@
 #ifndef INCLUDE_VOLK_VOLK_NEON_INTRINSICS_H_
 #define INCLUDE_VOLK_VOLK_NEON_INTRINSICS_H_
 #include <arm_neon.h>
+#include <stddef.h>
 
 
 /* Magnitude squared for float32x4x2_t */
@@ -101,6 +104,16 @@ static inline float32x4_t _vinvq_f32(float32x4_t x)
     return recip;
 }
 
+/* Division; vdivq_f32 is armv8 only, elsewhere a times the inverse of b */
+static inline float32x4_t _vdivq_f32(float32x4_t a, float32x4_t b)
+{
+#ifdef __aarch64__
+    return vdivq_f32(a, b);
+#else
+    return vmulq_f32(a, _vinvq_f32(b));
+#endif
+}
+
 /* Complex multiplication for float32x4x2_t */
 static inline float32x4x2_t _vmultiply_complexq_f32(float32x4x2_t a_val,
                                                     float32x4x2_t b_val)
@@ -167,6 +180,226 @@ static inline float32x4_t _vlogq_f32(float32x4_t x)
     return poly;
 }
 
+/* log2(x) for x >= 0 as computed by volk_32f_log2_32f: the exponent plus a
+ * degree 6 polynomial in the mantissa. Zero gives -127 like log2f_non_ieee(),
+ * infinities and NaNs are not supported. */
+static inline float32x4_t _vlog2q_f32(float32x4_t x)
+{
+    const int32x4_t bits = vreinterpretq_s32_f32(x);
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t exponent = vcvtq_f32_s32(vsubq_s32(
+        vshrq_n_s32(vandq_s32(bits, vdupq_n_s32(0x7f800000)), 23), vdupq_n_s32(127)));
+    const float32x4_t frac = vreinterpretq_f32_s32(
+        vorrq_s32(vreinterpretq_s32_f32(one), vandq_s32(bits, vdupq_n_s32(0x7fffff))));
+
+    float32x4_t mantissa = vdupq_n_f32(-3.4436006e-2f);
+    mantissa = vmlaq_f32(vdupq_n_f32(3.1821337e-1f), mantissa, frac);
+    mantissa = vmlaq_f32(vdupq_n_f32(-1.2315303f), mantissa, frac);
+    mantissa = vmlaq_f32(vdupq_n_f32(2.5988452f), mantissa, frac);
+    mantissa = vmlaq_f32(vdupq_n_f32(-3.3241990f), mantissa, frac);
+    mantissa = vmlaq_f32(vdupq_n_f32(3.1157899f), mantissa, frac);
+    return vmlaq_f32(exponent, mantissa, vsubq_f32(frac, one));
+}
+
+/* x^y for x >= 0 as exp(y ln(x)), with the cephes logf and expf polynomials:
+ * x is split into 2^e m with m in [sqrt(1/2), sqrt(2)), and y e is carried in
+ * two parts, so that the exponent of the result comes out exact and only
+ * y ln(m) and the reduced argument of exp() are rounded. Zero and denormals
+ * count as FLT_MIN, results that underflow flush to zero and overflow is not
+ * supported. */
+static inline float32x4_t _vpowq_f32(float32x4_t x, float32x4_t y)
+{
+    const float32x4_t one = vdupq_n_f32(1.f);
+    x = vmaxq_f32(x, vreinterpretq_f32_u32(vdupq_n_u32(0x00800000)));
+
+    /* x = m 2^e with m in [0.5, 1) */
+    float32x4_t e = vcvtq_f32_s32(vsubq_s32(
+        vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_f32(x), 23)),
+        vdupq_n_s32(0x7e)));
+    x = vreinterpretq_f32_u32(
+        vorrq_u32(vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x7fffff)),
+                  vreinterpretq_u32_f32(vdupq_n_f32(0.5f))));
+
+    /* m < sqrt(1/2): f = 2 m - 1 and e - 1, else f = m - 1 */
+    const uint32x4_t mask = vcltq_f32(x, vdupq_n_f32(0.707106781186547524f));
+    e = vsubq_f32(e, vbslq_f32(mask, one, vdupq_n_f32(0.f)));
+    x = vaddq_f32(vsubq_f32(x, one), vbslq_f32(mask, x, vdupq_n_f32(0.f)));
+
+    /* ln(1 + f) */
+    const float32x4_t z = vmulq_f32(x, x);
+    float32x4_t l = vdupq_n_f32(7.0376836292e-2f);
+    l = vmlaq_f32(vdupq_n_f32(-1.1514610310e-1f), l, x);
+    l = vmlaq_f32(vdupq_n_f32(1.1676998740e-1f), l, x);
+    l = vmlaq_f32(vdupq_n_f32(-1.2420140846e-1f), l, x);
+    l = vmlaq_f32(vdupq_n_f32(1.4249322787e-1f), l, x);
+    l = vmlaq_f32(vdupq_n_f32(-1.6668057665e-1f), l, x);
+    l = vmlaq_f32(vdupq_n_f32(2.0000714765e-1f), l, x);
+    l = vmlaq_f32(vdupq_n_f32(-2.4999993993e-1f), l, x);
+    l = vmlaq_f32(vdupq_n_f32(3.3333331174e-1f), l, x);
+    l = vmlaq_f32(vmlsq_f32(x, z, vdupq_n_f32(0.5f)), vmulq_f32(l, x), z);
+
+    /* y e exact without fma: y in a 12 bit upper part and the rest, each of
+     * which times the 8 bit e fits the mantissa */
+    const float32x4_t y_hi =
+        vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(y), vdupq_n_u32(~0xfffu)));
+    const float32x4_t ye = vmulq_f32(y_hi, e);
+    const float32x4_t ye_lo = vmulq_f32(vsubq_f32(y, y_hi), e);
+    const float32x4_t yl = vmulq_f32(y, l);
+
+    /* y ln(x) = (n + k + ye_lo) ln(2) + y ln(m), n = floor(... + 1 / 2) and
+     * k = y e - n exact */
+    float32x4_t n = vaddq_f32(vmlaq_f32(ye, yl, vdupq_n_f32(1.44269504088896341f)),
+                              vdupq_n_f32(0.5f));
+    n = vmaxq_f32(vminq_f32(n, vdupq_n_f32(127.5f)), vdupq_n_f32(-126.5f));
+    const float32x4_t truncated = vcvtq_f32_s32(vcvtq_s32_f32(n));
+    n = vsubq_f32(truncated,
+                  vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(truncated, n),
+                                                  vreinterpretq_u32_f32(one))));
+    const float32x4_t k = vsubq_f32(ye, n);
+    float32x4_t g = vmlaq_f32(yl, ye_lo, vdupq_n_f32(0.693147180559945309f));
+    g = vmlaq_f32(g, k, vdupq_n_f32(0.693147180559945309f));
+
+    /* exp(g) 2^n */
+    float32x4_t p = vdupq_n_f32(1.9875691500e-4f);
+    p = vmlaq_f32(vdupq_n_f32(1.3981999507e-3f), p, g);
+    p = vmlaq_f32(vdupq_n_f32(8.3334519073e-3f), p, g);
+    p = vmlaq_f32(vdupq_n_f32(4.1665795894e-2f), p, g);
+    p = vmlaq_f32(vdupq_n_f32(1.6666665459e-1f), p, g);
+    p = vmlaq_f32(vdupq_n_f32(5.0000001201e-1f), p, g);
+    p = vmlaq_f32(g, p, vmulq_f32(g, g));
+    p = vaddq_f32(p, one);
+
+    const int32x4_t pow2n =
+        vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(0x7f)), 23);
+    return vmulq_f32(p, vreinterpretq_f32_s32(pow2n));
+}
+
+/* exp(x) as computed by volk_32f_exp_32f_a_sse2 (cephes expf): x is clamped
+ * to +-88.376, split into n ln(2) + g with |g| <= ln(2) / 2, and exp(g) is a
+ * degree 5 polynomial, scaled by 2^n. Large negative inputs flush to zero. */
+static inline float32x4_t _vexpq_f32(float32x4_t x)
+{
+    const float32x4_t one = vdupq_n_f32(1.f);
+    x = vmaxq_f32(vminq_f32(x, vdupq_n_f32(88.3762626647949f)),
+                  vdupq_n_f32(-88.3762626647949f));
+
+    /* exp(x) = exp(g + n ln(2)), n = floor(x / ln(2) + 1 / 2) */
+    float32x4_t fx = vmlaq_f32(vdupq_n_f32(0.5f), x, vdupq_n_f32(1.44269504088896341f));
+    const float32x4_t truncated = vcvtq_f32_s32(vcvtq_s32_f32(fx));
+    fx = vsubq_f32(truncated,
+                   vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(truncated, fx),
+                                                   vreinterpretq_u32_f32(one))));
+    x = vmlsq_f32(x, fx, vdupq_n_f32(0.693359375f));
+    x = vmlsq_f32(x, fx, vdupq_n_f32(-2.12194440e-4f));
+
+    float32x4_t y = vdupq_n_f32(1.9875691500e-4f);
+    y = vmlaq_f32(vdupq_n_f32(1.3981999507e-3f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(8.3334519073e-3f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(4.1665795894e-2f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(1.6666665459e-1f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(5.0000001201e-1f), y, x);
+    y = vmlaq_f32(x, y, vmulq_f32(x, x));
+    y = vaddq_f32(y, one);
+
+    const int32x4_t pow2n =
+        vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(fx), vdupq_n_s32(0x7f)), 23);
+    return vmulq_f32(y, vreinterpretq_f32_s32(pow2n));
+}
+
+/* arctan(x) for x in [-1, 1]: an odd minimax polynomial of degree 13, with a
+ * relative error below 7.5e-7. */
+static inline float32x4_t _varctanq_f32(float32x4_t x)
+{
+    const float32x4_t x2 = vmulq_f32(x, x);
+    float32x4_t arctan = vdupq_n_f32(+0x1.01a37cp-7f);
+    arctan = vmlaq_f32(vdupq_n_f32(-0x1.2f3004p-5f), x2, arctan);
+    arctan = vmlaq_f32(vdupq_n_f32(+0x1.5785aap-4f), x2, arctan);
+    arctan = vmlaq_f32(vdupq_n_f32(-0x1.1436ap-3f), x2, arctan);
+    arctan = vmlaq_f32(vdupq_n_f32(+0x1.972be6p-3f), x2, arctan);
+    arctan = vmlaq_f32(vdupq_n_f32(-0x1.55437p-2f), x2, arctan);
+    arctan = vmlaq_f32(vdupq_n_f32(+0x1.ffffeap-1f), x2, arctan);
+    return vmulq_f32(arctan, x);
+}
+
+/* atan2(y, x) from _varctanq_f32: the ratio of the smaller to the larger of
+ * |x| and |y| goes through the polynomial, and the result is mirrored into
+ * the quadrant of (x, y). atan2(0, 0) is 0, or pi for a negative zero x, as
+ * in atan2f(). Infinite inputs are not supported. */
+static inline float32x4_t _vatan2q_f32(float32x4_t y, float32x4_t x)
+{
+    const uint32x4_t sign_mask = vdupq_n_u32(0x80000000);
+    const uint32x4_t pi = vreinterpretq_u32_f32(vdupq_n_f32(3.14159265358979323846f));
+    const uint32x4_t pi_2 = vreinterpretq_u32_f32(vdupq_n_f32(1.57079632679489661923f));
+
+    const uint32x4_t swap = vcagtq_f32(y, x);
+    float32x4_t ratio =
+        vmulq_f32(vbslq_f32(swap, x, y), _vinvq_f32(vbslq_f32(swap, y, x)));
+    /* 0 / 0 */
+    ratio = vbslq_f32(vceqq_f32(ratio, ratio), ratio, vdupq_n_f32(0.f));
+    float32x4_t result = _varctanq_f32(ratio);
+
+    /* |y| > |x|: +-pi / 2 - arctan(x / y) */
+    const float32x4_t offset = vreinterpretq_f32_u32(
+        vorrq_u32(pi_2, vandq_u32(vreinterpretq_u32_f32(ratio), sign_mask)));
+    result = vbslq_f32(swap, vsubq_f32(offset, result), result);
+    /* x < 0: +-pi, with the sign of y */
+    const float32x4_t y_pi = vreinterpretq_f32_u32(
+        vorrq_u32(pi, vandq_u32(vreinterpretq_u32_f32(y), sign_mask)));
+    const uint32x4_t x_neg = vtstq_u32(vreinterpretq_u32_f32(x), sign_mask);
+    return vbslq_f32(x_neg, vaddq_f32(result, y_pi), result);
+}
+
+/* scale * atan2(y, x) as in cephes atanf, slower but more accurate than
+ * _vatan2q_f32: the ratio of the smaller to the larger of |x| and |y| is
+ * reduced to |r| <= tan(pi / 8), where a degree 9 polynomial is good to about
+ * 1 ulp. The result is a multiple of pi / 4 plus or minus that, and the
+ * multiple is scaled with pi / 4 in two parts so that a large scale does not
+ * magnify its rounding error. Signed zeros as in atan2f(), infinities are not
+ * supported. */
+static inline float32x4_t
+_vatan2q_cephes_f32(float32x4_t y, float32x4_t x, float32x4_t scale)
+{
+    const uint32x4_t sign_mask = vdupq_n_u32(0x80000000);
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t ax = vabsq_f32(x);
+    const float32x4_t ay = vabsq_f32(y);
+
+    float32x4_t ratio = _vdivq_f32(vminq_f32(ax, ay), vmaxq_f32(ax, ay));
+    /* 0 / 0 */
+    ratio = vbslq_f32(vceqq_f32(ratio, ratio), ratio, zero);
+
+    /* ratio > tan(pi / 8): pi / 4 + arctan((ratio - 1) / (ratio + 1)) */
+    const uint32x4_t big = vcgtq_f32(ratio, vdupq_n_f32(0.4142135623730950f));
+    const float32x4_t r = vbslq_f32(
+        big, _vdivq_f32(vsubq_f32(ratio, one), vaddq_f32(ratio, one)), ratio);
+    const float32x4_t z = vmulq_f32(r, r);
+    float32x4_t poly = vdupq_n_f32(8.05374449538e-2f);
+    poly = vmlaq_f32(vdupq_n_f32(-1.38776856032e-1f), poly, z);
+    poly = vmlaq_f32(vdupq_n_f32(1.99777106478e-1f), poly, z);
+    poly = vmlaq_f32(vdupq_n_f32(-3.33329491539e-1f), poly, z);
+    poly = vmlaq_f32(r, vmulq_f32(poly, z), r);
+
+    /* |y| > |x|: pi / 2 - arctan(|x| / |y|), x < 0: pi - arctan, each of
+     * which turns the octant m around and negates the polynomial */
+    float32x4_t m = vbslq_f32(big, one, zero);
+    const uint32x4_t swap = vcgtq_f32(ay, ax);
+    m = vbslq_f32(swap, vsubq_f32(vdupq_n_f32(2.f), m), m);
+    poly = vbslq_f32(swap, vnegq_f32(poly), poly);
+    const uint32x4_t x_neg = vtstq_u32(vreinterpretq_u32_f32(x), sign_mask);
+    m = vbslq_f32(x_neg, vsubq_f32(vdupq_n_f32(4.f), m), m);
+    poly = vbslq_f32(x_neg, vnegq_f32(poly), poly);
+
+    /* scale (m pi / 4 + poly) with pi / 4 in two parts */
+    const float32x4_t sm = vmulq_f32(scale, m);
+    float32x4_t result =
+        vmlaq_f32(vmulq_f32(scale, poly), sm, vdupq_n_f32(-2.1855695e-8f));
+    result = vmlaq_f32(result, sm, vdupq_n_f32(0.78539818525314331f));
+    return vreinterpretq_f32_u32(
+        veorq_u32(vreinterpretq_u32_f32(result),
+                  vandq_u32(vreinterpretq_u32_f32(y), sign_mask)));
+}
+
 /* Evaluation of 4 sines & cosines at once.
  * Optimized from here (zlib license)
  * http://gruntthepeon.free.fr/ssemath/ */
@@ -281,4 +514,118 @@ static inline float32x4_t _neon_accumulate_square_sum_f32(float32x4_t sq_acc,
 #endif
 }
 
+/*
+ * Stores lane i of the deinterleaved complex vector v as one complex value
+ * at p + i * stride, stride counted in floats
+ */
+static inline void _vst2q_lanes_f32(float* p, size_t stride, float32x4x2_t v)
+{
+    vst2q_lane_f32(p, v, 0);
+    vst2q_lane_f32(p + stride, v, 1);
+    vst2q_lane_f32(p + 2 * stride, v, 2);
+    vst2q_lane_f32(p + 3 * stride, v, 3);
+}
+
+/*
+ * Loads 4 floats that are stride floats apart
+ */
+static inline float32x4_t _vld1q_strided_f32(const float* p, unsigned int stride)
+{
+    if (stride == 1)
+        return vld1q_f32(p);
+    const size_t s = stride;
+    float32x4_t v = vld1q_dup_f32(p);
+    v = vld1q_lane_f32(p + s, v, 1);
+    v = vld1q_lane_f32(p + 2 * s, v, 2);
+    return vld1q_lane_f32(p + 3 * s, v, 3);
+}
+
+/*
+ * Stores 4 floats stride floats apart
+ */
+static inline void _vst1q_strided_f32(float* p, unsigned int stride, float32x4_t v)
+{
+    if (stride == 1) {
+        vst1q_f32(p, v);
+        return;
+    }
+    const size_t s = stride;
+    vst1q_lane_f32(p, v, 0);
+    vst1q_lane_f32(p + s, v, 1);
+    vst1q_lane_f32(p + 2 * s, v, 2);
+    vst1q_lane_f32(p + 3 * s, v, 3);
+}
+
+/*
+ * Loads 4 complex floats that are stride complex values apart, deinterleaved
+ * like vld2q_f32
+ */
+static inline float32x4x2_t _vld2q_strided_f32(const float* p, unsigned int stride)
+{
+    if (stride == 1)
+        return vld2q_f32(p);
+    const size_t s = 2 * (size_t)stride;
+    float32x4x2_t v;
+    v.val[0] = vdupq_n_f32(0.f);
+    v.val[1] = vdupq_n_f32(0.f);
+    v = vld2q_lane_f32(p, v, 0);
+    v = vld2q_lane_f32(p + s, v, 1);
+    v = vld2q_lane_f32(p + 2 * s, v, 2);
+    return vld2q_lane_f32(p + 3 * s, v, 3);
+}
+
+/*
+ * Stores the deinterleaved complex vector v as 4 complex floats stride
+ * complex values apart
+ */
+static inline void _vst2q_strided_f32(float* p, unsigned int stride, float32x4x2_t v)
+{
+    if (stride == 1)
+        vst2q_f32(p, v);
+    else
+        _vst2q_lanes_f32(p, 2 * (size_t)stride, v);
+}
+
+/*
+ * Square root; vsqrtq_f32 is armv8 only. Zero inputs give zero.
+ */
+static inline float32x4_t _vsqrtq_f32(float32x4_t x)
+{
+#ifdef __aarch64__
+    return vsqrtq_f32(x);
+#else
+    const float32x4_t root = vmulq_f32(x, _vinvsqrtq_f32(x));
+    const uint32x4_t nonzero = vcgtq_f32(x, vdupq_n_f32(0.f));
+    return vreinterpretq_f32_u32(vandq_u32(nonzero, vreinterpretq_u32_f32(root)));
+#endif
+}
+
+/*
+ * Packs the lowest bit of each byte of v into 16 bits, byte 0 in the lowest,
+ * like _mm_movemask_epi8 for vectors of 0 and 0xff bytes
+ */
+static inline uint16_t _vmovemaskq_u8(uint8x16_t v)
+{
+    static const uint8_t bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128,
+                                      1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t masked = vandq_u8(v, vld1q_u8(bits));
+    uint8x8_t sum = vpadd_u8(vget_low_u8(masked), vget_high_u8(masked));
+    sum = vpadd_u8(sum, sum);
+    sum = vpadd_u8(sum, sum);
+    return vget_lane_u8(sum, 0) | (vget_lane_u8(sum, 1) << 8);
+}
+
+/*
+ * Returns the horizontal sums of a, b, c and d in lanes 0 to 3
+ */
+static inline float32x4_t
+_vtranspose_sum4q_f32(float32x4_t a, float32x4_t b, float32x4_t c, float32x4_t d)
+{
+    const float32x2_t ab = vpadd_f32(vadd_f32(vget_low_f32(a), vget_high_f32(a)),
+                                     vadd_f32(vget_low_f32(b), vget_high_f32(b)));
+    const float32x2_t cd = vpadd_f32(vadd_f32(vget_low_f32(c), vget_high_f32(c)),
+                                     vadd_f32(vget_low_f32(d), vget_high_f32(d)));
+    return vcombine_f32(ab, cd);
+}
+
 #endif /* INCLUDE_VOLK_VOLK_NEON_INTRINSICS_H_ */
@@ -0,0 +1,171 @@
+/* -*- c -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_PARALLEL_H
+#define INCLUDED_VOLK_PARALLEL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+__VOLK_DECL_BEGIN
+
+/*!
+ * \brief Multi-threaded execution of VOLK kernels on large vectors
+ *
+ * \details
+ * The volk_parallel_* functions have the same signature and result as the
+ * kernel they are named after. Vectors of at least
+ * volk_parallel_get_threshold() points are split into chunks which are
+ * processed concurrently by a persistent pool of worker threads and the
+ * calling thread. Reductions combine the per-chunk results in chunk order.
+ * Shorter vectors, or calls made while the pool is busy with another call,
+ * run the kernel on the calling thread.
+ *
+ * The pool is started on first use. Without thread support all calls are
+ * serial.
+ */
+
+/*!
+ * \brief Sets the number of threads used for one call, including the caller.
+ * \param num_threads thread count; 0 selects the number of online CPUs and
+ *        1 disables multi-threading.
+ */
+VOLK_API void volk_parallel_set_num_threads(unsigned int num_threads);
+
+//! Returns the number of threads used for one call, including the caller
+VOLK_API unsigned int volk_parallel_get_num_threads(void);
+
+//! Sets the vector length below which calls stay on the calling thread
+VOLK_API void volk_parallel_set_threshold(size_t num_points);
+
+//! Returns the vector length below which calls stay on the calling thread
+VOLK_API size_t volk_parallel_get_threshold(void);
+
+/*!
+ * \brief Pins the worker threads to CPUs.
+ * \details Worker i runs on cpus[i % num_cpus]. Pass NULL or 0 to let the
+ * scheduler place the workers. Only supported on Linux; the setting applies
+ * when the pool is (re)started.
+ * \param cpus list of CPU numbers
+ * \param num_cpus number of entries in \p cpus
+ */
+VOLK_API void volk_parallel_set_affinity(const int* cpus, unsigned int num_cpus);
+
+/*!
+ * \brief Chunk function for volk_parallel_for
+ * \param ctx user context
+ * \param chunk index of the chunk, chunks are numbered in order of offset
+ * \param offset first point of the chunk
+ * \param num_points number of points in the chunk
+ */
+typedef void (*volk_parallel_fn_t)(void* ctx,
+                                   unsigned int chunk,
+                                   size_t offset,
+                                   size_t num_points);
+
+/*!
+ * \brief Splits [0, num_points) into chunks and calls \p fn for each of them
+ * on the thread pool.
+ * \details Chunk boundaries are multiples of 64 points, so chunks of
+ * aligned vectors stay aligned. Calls below the threshold, including empty
+ * ones, run as a single chunk on the calling thread.
+ * \return the number of chunks, at most VOLK_PARALLEL_MAX_CHUNKS
+ */
+VOLK_API unsigned int
+volk_parallel_for(volk_parallel_fn_t fn, void* ctx, size_t num_points);
+
+//! Upper bound of chunks per volk_parallel_for call
+#define VOLK_PARALLEL_MAX_CHUNKS 256
+
+/* elementwise kernels */
+VOLK_API void volk_parallel_32fc_x2_multiply_32fc(lv_32fc_t* cVector,
+                                                  const lv_32fc_t* aVector,
+                                                  const lv_32fc_t* bVector,
+                                                  unsigned int num_points);
+VOLK_API void volk_parallel_32fc_x2_multiply_conjugate_32fc(lv_32fc_t* cVector,
+                                                            const lv_32fc_t* aVector,
+                                                            const lv_32fc_t* bVector,
+                                                            unsigned int num_points);
+VOLK_API void volk_parallel_32fc_x2_add_32fc(lv_32fc_t* cVector,
+                                             const lv_32fc_t* aVector,
+                                             const lv_32fc_t* bVector,
+                                             unsigned int num_points);
+VOLK_API void volk_parallel_32fc_32f_multiply_32fc(lv_32fc_t* cVector,
+                                                   const lv_32fc_t* aVector,
+                                                   const float* bVector,
+                                                   unsigned int num_points);
+VOLK_API void volk_parallel_32fc_s32fc_multiply_32fc(lv_32fc_t* cVector,
+                                                     const lv_32fc_t* aVector,
+                                                     const lv_32fc_t scalar,
+                                                     unsigned int num_points);
+VOLK_API void volk_parallel_32fc_magnitude_32f(float* magnitudeVector,
+                                               const lv_32fc_t* complexVector,
+                                               unsigned int num_points);
+VOLK_API void volk_parallel_32fc_magnitude_squared_32f(float* magnitudeVector,
+                                                       const lv_32fc_t* complexVector,
+                                                       unsigned int num_points);
+VOLK_API void volk_parallel_32f_x2_multiply_32f(float* cVector,
+                                                const float* aVector,
+                                                const float* bVector,
+                                                unsigned int num_points);
+VOLK_API void volk_parallel_32f_x2_add_32f(float* cVector,
+                                           const float* aVector,
+                                           const float* bVector,
+                                           unsigned int num_points);
+VOLK_API void volk_parallel_32f_s32f_multiply_32f(float* cVector,
+                                                  const float* aVector,
+                                                  const float scalar,
+                                                  unsigned int num_points);
+VOLK_API void volk_parallel_16ic_convert_32fc(lv_32fc_t* outputVector,
+                                              const lv_16sc_t* inputVector,
+                                              unsigned int num_points);
+
+/* reductions */
+VOLK_API void volk_parallel_32f_x2_dot_prod_32f(float* result,
+                                                const float* input,
+                                                const float* taps,
+                                                unsigned int num_points);
+VOLK_API void volk_parallel_32fc_x2_dot_prod_32fc(lv_32fc_t* result,
+                                                  const lv_32fc_t* input,
+                                                  const lv_32fc_t* taps,
+                                                  unsigned int num_points);
+VOLK_API void volk_parallel_32fc_x2_conjugate_dot_prod_32fc(lv_32fc_t* result,
+                                                            const lv_32fc_t* input,
+                                                            const lv_32fc_t* taps,
+                                                            unsigned int num_points);
+VOLK_API void volk_parallel_32fc_32f_dot_prod_32fc(lv_32fc_t* result,
+                                                   const lv_32fc_t* input,
+                                                   const float* taps,
+                                                   unsigned int num_points);
+VOLK_API void volk_parallel_32f_accumulator_s32f(float* result,
+                                                 const float* inputBuffer,
+                                                 unsigned int num_points);
+VOLK_API void volk_parallel_32fc_accumulator_s32fc(lv_32fc_t* result,
+                                                   const lv_32fc_t* inputBuffer,
+                                                   unsigned int num_points);
+VOLK_API void volk_parallel_32f_index_max_32u(uint32_t* target,
+                                              const float* src0,
+                                              uint32_t num_points);
+VOLK_API void volk_parallel_32f_index_min_32u(uint32_t* target,
+                                              const float* source,
+                                              uint32_t num_points);
+VOLK_API void volk_parallel_32fc_index_max_32u(uint32_t* target,
+                                               const lv_32fc_t* src0,
+                                               uint32_t num_points);
+VOLK_API void volk_parallel_32f_stddev_and_mean_32f_x2(float* stddev,
+                                                       float* mean,
+                                                       const float* inputBuffer,
+                                                       unsigned int num_points);
+
+__VOLK_DECL_END
+
+#endif /* INCLUDED_VOLK_PARALLEL_H */
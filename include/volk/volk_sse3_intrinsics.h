@@ -64,4 +64,28 @@ static inline __m128 _mm_scaled_norm_dist_ps_sse3(const __m128 symbols0,
     return _mm_mul_ps(norms, scalar);
 }
 
+/*
+ * log2(x) for x >= 0 as computed by volk_32f_log2_32f: the exponent plus a degree 6
+ * polynomial in the mantissa. Zero gives -127 like log2f_non_ieee(), infinities
+ * and NaNs are not supported.
+ */
+static inline __m128 _mm_log2_ps_sse3(const __m128 x)
+{
+    const __m128i bits = _mm_castps_si128(x);
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 exp = _mm_cvtepi32_ps(_mm_sub_epi32(
+        _mm_srli_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7f800000)), 23),
+        _mm_set1_epi32(127)));
+    const __m128 frac = _mm_castsi128_ps(_mm_or_si128(
+        _mm_castps_si128(one), _mm_and_si128(bits, _mm_set1_epi32(0x7fffff))));
+
+    __m128 mantissa = _mm_set1_ps(-3.4436006e-2f);
+    mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(3.1821337e-1f));
+    mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(-1.2315303f));
+    mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(2.5988452f));
+    mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(-3.3241990f));
+    mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(3.1157899f));
+    return _mm_add_ps(_mm_mul_ps(mantissa, _mm_sub_ps(frac, one)), exp);
+}
+
 #endif /* INCLUDE_VOLK_VOLK_SSE3_INTRINSICS_H_ */
@@ -56,4 +56,57 @@ static inline __m128 _mm_accumulate_square_sum_ps(
     return _mm_add_ps(sq_acc, aux);
 }
 
+/*
+ * Loads 4 floats that are stride floats apart
+ */
+static inline __m128 _mm_loadu_strided_ps(const float* p, unsigned int stride)
+{
+    if (stride == 1)
+        return _mm_loadu_ps(p);
+    const size_t s = stride;
+    const __m128 lo = _mm_unpacklo_ps(_mm_load_ss(p), _mm_load_ss(p + s));
+    const __m128 hi = _mm_unpacklo_ps(_mm_load_ss(p + 2 * s), _mm_load_ss(p + 3 * s));
+    return _mm_movelh_ps(lo, hi);
+}
+
+/*
+ * Loads 2 complex floats that are stride complex values apart
+ */
+static inline __m128 _mm_loadu_strided_pc(const float* p, unsigned int stride)
+{
+    if (stride == 1)
+        return _mm_loadu_ps(p);
+    const __m128 lo = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)p);
+    return _mm_loadh_pi(lo, (const __m64*)(p + 2 * (size_t)stride));
+}
+
+/*
+ * Stores 4 floats stride floats apart
+ */
+static inline void _mm_storeu_strided_ps(float* p, unsigned int stride, __m128 v)
+{
+    if (stride == 1) {
+        _mm_storeu_ps(p, v);
+        return;
+    }
+    const size_t s = stride;
+    _mm_store_ss(p, v);
+    _mm_store_ss(p + s, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+    _mm_store_ss(p + 2 * s, _mm_movehl_ps(v, v));
+    _mm_store_ss(p + 3 * s, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)));
+}
+
+/*
+ * Stores 2 complex floats stride complex values apart
+ */
+static inline void _mm_storeu_strided_pc(float* p, unsigned int stride, __m128 v)
+{
+    if (stride == 1) {
+        _mm_storeu_ps(p, v);
+        return;
+    }
+    _mm_storel_pi((__m64*)p, v);
+    _mm_storeh_pi((__m64*)(p + 2 * (size_t)stride), v);
+}
+
 #endif /* INCLUDE_VOLK_VOLK_SSE_INTRINSICS_H_ */
@@ -0,0 +1,194 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16bf_convert_32f
+ *
+ * \b Overview
+ *
+ * Converts bfloat16 values into floats. The conversion is exact.
+ *
+ * The 16 bit values are bfloat16, the upper half of a float, held in
+ * uint16_t, see volk/volk_float16.h.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16bf_convert_32f(float* outputVector, const uint16_t* inputVector,
+ *                            unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The bfloat16 values.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The floats.
+ *
+ * \b Example
+ * Widen bfloat16 samples.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint16_t* in = (uint16_t*)volk_malloc(sizeof(uint16_t) * N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *
+ *   // fill in
+ *
+ *   volk_16bf_convert_32f(out, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16bf_convert_32f_a_H
+#define INCLUDED_volk_16bf_convert_32f_a_H
+
+#include <inttypes.h>
+#include <volk/volk_float16.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16bf_convert_32f_generic(float* outputVector,
+                                                 const uint16_t* inputVector,
+                                                 unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        outputVector[number] = volk_16bf_to_32f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16bf_convert_32f_a_avx2(float* outputVector,
+                                                const uint16_t* inputVector,
+                                                unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const __m128i in = _mm_load_si128((const __m128i*)(inputVector + number));
+        const __m256i out = _mm256_slli_epi32(_mm256_cvtepu16_epi32(in), 16);
+        _mm256_store_ps(outputVector + number, _mm256_castsi256_ps(out));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_16bf_to_32f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16bf_convert_32f_a_avx512f(float* outputVector,
+                                                   const uint16_t* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m256i in = _mm256_load_si256((const __m256i*)(inputVector + number));
+        const __m512i out = _mm512_slli_epi32(_mm512_cvtepu16_epi32(in), 16);
+        _mm512_store_ps(outputVector + number, _mm512_castsi512_ps(out));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_16bf_to_32f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_16bf_convert_32f_a_H */
+
+#ifndef INCLUDED_volk_16bf_convert_32f_u_H
+#define INCLUDED_volk_16bf_convert_32f_u_H
+
+#include <inttypes.h>
+#include <volk/volk_float16.h>
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16bf_convert_32f_u_avx2(float* outputVector,
+                                                const uint16_t* inputVector,
+                                                unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const __m128i in = _mm_loadu_si128((const __m128i*)(inputVector + number));
+        const __m256i out = _mm256_slli_epi32(_mm256_cvtepu16_epi32(in), 16);
+        _mm256_storeu_ps(outputVector + number, _mm256_castsi256_ps(out));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_16bf_to_32f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16bf_convert_32f_u_avx512f(float* outputVector,
+                                                   const uint16_t* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m256i in = _mm256_loadu_si256((const __m256i*)(inputVector + number));
+        const __m512i out = _mm512_slli_epi32(_mm512_cvtepu16_epi32(in), 16);
+        _mm512_storeu_ps(outputVector + number, _mm512_castsi512_ps(out));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_16bf_to_32f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_16bf_convert_32f_neon(float* outputVector,
+                                              const uint16_t* inputVector,
+                                              unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const uint16x8_t in = vld1q_u16(inputVector + number);
+        vst1q_f32(outputVector + number,
+                  vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(in), 16)));
+        vst1q_f32(outputVector + number + 4,
+                  vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(in), 16)));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_16bf_to_32f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16bf_convert_32f_u_H */
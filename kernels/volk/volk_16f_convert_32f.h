@@ -0,0 +1,190 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16f_convert_32f
+ *
+ * \b Overview
+ *
+ * Converts half precision floats into floats. The conversion is exact.
+ *
+ * The 16 bit values are IEEE 754 half precision floats (binary16) held in
+ * uint16_t, see volk/volk_float16.h.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16f_convert_32f(float* outputVector, const uint16_t* inputVector,
+ *                           unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The half precision floats.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The floats.
+ *
+ * \b Example
+ * Widen half precision FIR taps for filtering.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint16_t* in = (uint16_t*)volk_malloc(sizeof(uint16_t) * N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *
+ *   // fill in
+ *
+ *   volk_16f_convert_32f(out, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16f_convert_32f_a_H
+#define INCLUDED_volk_16f_convert_32f_a_H
+
+#include <inttypes.h>
+#include <volk/volk_float16.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16f_convert_32f_generic(float* outputVector,
+                                                const uint16_t* inputVector,
+                                                unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        outputVector[number] = volk_16f_to_32f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_F16C
+#include <immintrin.h>
+
+static inline void volk_16f_convert_32f_a_f16c(float* outputVector,
+                                               const uint16_t* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const __m128i in = _mm_load_si128((const __m128i*)(inputVector + number));
+        _mm256_store_ps(outputVector + number, _mm256_cvtph_ps(in));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_16f_to_32f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_F16C */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16f_convert_32f_a_avx512f(float* outputVector,
+                                                  const uint16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m256i in = _mm256_load_si256((const __m256i*)(inputVector + number));
+        _mm512_store_ps(outputVector + number, _mm512_cvtph_ps(in));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_16f_to_32f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_16f_convert_32f_a_H */
+
+#ifndef INCLUDED_volk_16f_convert_32f_u_H
+#define INCLUDED_volk_16f_convert_32f_u_H
+
+#include <inttypes.h>
+#include <volk/volk_float16.h>
+
+#ifdef LV_HAVE_F16C
+#include <immintrin.h>
+
+static inline void volk_16f_convert_32f_u_f16c(float* outputVector,
+                                               const uint16_t* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const __m128i in = _mm_loadu_si128((const __m128i*)(inputVector + number));
+        _mm256_storeu_ps(outputVector + number, _mm256_cvtph_ps(in));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_16f_to_32f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_F16C */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16f_convert_32f_u_avx512f(float* outputVector,
+                                                  const uint16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m256i in = _mm256_loadu_si256((const __m256i*)(inputVector + number));
+        _mm512_storeu_ps(outputVector + number, _mm512_cvtph_ps(in));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_16f_to_32f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16f_convert_32f_neonv8(float* outputVector,
+                                               const uint16_t* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const uint16x8_t in = vld1q_u16(inputVector + number);
+        vst1q_f32(outputVector + number,
+                  vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(in))));
+        vst1q_f32(outputVector + number + 4,
+                  vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(in))));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_16f_to_32f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16f_convert_32f_u_H */
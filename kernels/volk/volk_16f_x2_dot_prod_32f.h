@@ -0,0 +1,257 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16f_x2_dot_prod_32f
+ *
+ * \b Overview
+ *
+ * Computes the dot product of two vectors of half precision floats. The products
+ * are summed in single precision, the result is a float.
+ *
+ * The 16 bit values are IEEE 754 half precision floats (binary16) held in
+ * uint16_t, see volk/volk_float16.h.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16f_x2_dot_prod_32f(float* result, const uint16_t* input,
+ *                               const uint16_t* taps, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: The first vector of half precision floats.
+ * \li taps: The second vector of half precision floats.
+ * \li num_points: The number of values in both input vectors.
+ *
+ * \b Outputs
+ * \li result: The dot product.
+ *
+ * \b Example
+ * Correlate a block of stored samples with half precision taps.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint16_t* x = (uint16_t*)volk_malloc(sizeof(uint16_t) * N, alignment);
+ *   uint16_t* t = (uint16_t*)volk_malloc(sizeof(uint16_t) * N, alignment);
+ *   float y;
+ *
+ *   // fill in
+ *
+ *   volk_16f_x2_dot_prod_32f(&y, x, t, N);
+ *
+ *   volk_free(x);
+ *   volk_free(t);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16f_x2_dot_prod_32f_a_H
+#define INCLUDED_volk_16f_x2_dot_prod_32f_a_H
+
+#include <inttypes.h>
+#include <volk/volk_float16.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16f_x2_dot_prod_32f_generic(float* result,
+                                                    const uint16_t* input,
+                                                    const uint16_t* taps,
+                                                    unsigned int num_points)
+{
+    float dotProduct = 0.f;
+    for (unsigned int number = 0; number < num_points; number++) {
+        dotProduct += volk_16f_to_32f(input[number]) * volk_16f_to_32f(taps[number]);
+    }
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_F16C && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_16f_x2_dot_prod_32f_a_f16c_fma(float* result,
+                                                       const uint16_t* input,
+                                                       const uint16_t* taps,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __m256 dotProdVal0 = _mm256_setzero_ps();
+    __m256 dotProdVal1 = _mm256_setzero_ps();
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m256i a = _mm256_load_si256((const __m256i*)(input + number));
+        const __m256i b = _mm256_load_si256((const __m256i*)(taps + number));
+        dotProdVal0 = _mm256_fmadd_ps(_mm256_cvtph_ps(_mm256_castsi256_si128(a)),
+                                      _mm256_cvtph_ps(_mm256_castsi256_si128(b)),
+                                      dotProdVal0);
+        dotProdVal1 = _mm256_fmadd_ps(_mm256_cvtph_ps(_mm256_extractf128_si256(a, 1)),
+                                      _mm256_cvtph_ps(_mm256_extractf128_si256(b, 1)),
+                                      dotProdVal1);
+    }
+
+    __VOLK_ATTR_ALIGNED(32) float dotProductVector[8];
+    _mm256_store_ps(dotProductVector, _mm256_add_ps(dotProdVal0, dotProdVal1));
+    float dotProduct = 0.f;
+    for (int i = 0; i < 8; i++) {
+        dotProduct += dotProductVector[i];
+    }
+
+    for (; number < num_points; number++) {
+        dotProduct += volk_16f_to_32f(input[number]) * volk_16f_to_32f(taps[number]);
+    }
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_F16C && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16f_x2_dot_prod_32f_a_avx512f(float* result,
+                                                      const uint16_t* input,
+                                                      const uint16_t* taps,
+                                                      unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __m512 dotProdVal = _mm512_setzero_ps();
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m256i a = _mm256_load_si256((const __m256i*)(input + number));
+        const __m256i b = _mm256_load_si256((const __m256i*)(taps + number));
+        dotProdVal = _mm512_fmadd_ps(_mm512_cvtph_ps(a), _mm512_cvtph_ps(b), dotProdVal);
+    }
+
+    __VOLK_ATTR_ALIGNED(64) float dotProductVector[16];
+    _mm512_store_ps(dotProductVector, dotProdVal);
+    float dotProduct = 0.f;
+    for (int i = 0; i < 16; i++) {
+        dotProduct += dotProductVector[i];
+    }
+
+    for (; number < num_points; number++) {
+        dotProduct += volk_16f_to_32f(input[number]) * volk_16f_to_32f(taps[number]);
+    }
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_16f_x2_dot_prod_32f_a_H */
+
+#ifndef INCLUDED_volk_16f_x2_dot_prod_32f_u_H
+#define INCLUDED_volk_16f_x2_dot_prod_32f_u_H
+
+#include <inttypes.h>
+#include <volk/volk_float16.h>
+
+#if LV_HAVE_F16C && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_16f_x2_dot_prod_32f_u_f16c_fma(float* result,
+                                                       const uint16_t* input,
+                                                       const uint16_t* taps,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __m256 dotProdVal0 = _mm256_setzero_ps();
+    __m256 dotProdVal1 = _mm256_setzero_ps();
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)(input + number));
+        const __m256i b = _mm256_loadu_si256((const __m256i*)(taps + number));
+        dotProdVal0 = _mm256_fmadd_ps(_mm256_cvtph_ps(_mm256_castsi256_si128(a)),
+                                      _mm256_cvtph_ps(_mm256_castsi256_si128(b)),
+                                      dotProdVal0);
+        dotProdVal1 = _mm256_fmadd_ps(_mm256_cvtph_ps(_mm256_extractf128_si256(a, 1)),
+                                      _mm256_cvtph_ps(_mm256_extractf128_si256(b, 1)),
+                                      dotProdVal1);
+    }
+
+    __VOLK_ATTR_ALIGNED(32) float dotProductVector[8];
+    _mm256_storeu_ps(dotProductVector, _mm256_add_ps(dotProdVal0, dotProdVal1));
+    float dotProduct = 0.f;
+    for (int i = 0; i < 8; i++) {
+        dotProduct += dotProductVector[i];
+    }
+
+    for (; number < num_points; number++) {
+        dotProduct += volk_16f_to_32f(input[number]) * volk_16f_to_32f(taps[number]);
+    }
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_F16C && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16f_x2_dot_prod_32f_u_avx512f(float* result,
+                                                      const uint16_t* input,
+                                                      const uint16_t* taps,
+                                                      unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __m512 dotProdVal = _mm512_setzero_ps();
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)(input + number));
+        const __m256i b = _mm256_loadu_si256((const __m256i*)(taps + number));
+        dotProdVal = _mm512_fmadd_ps(_mm512_cvtph_ps(a), _mm512_cvtph_ps(b), dotProdVal);
+    }
+
+    __VOLK_ATTR_ALIGNED(64) float dotProductVector[16];
+    _mm512_storeu_ps(dotProductVector, dotProdVal);
+    float dotProduct = 0.f;
+    for (int i = 0; i < 16; i++) {
+        dotProduct += dotProductVector[i];
+    }
+
+    for (; number < num_points; number++) {
+        dotProduct += volk_16f_to_32f(input[number]) * volk_16f_to_32f(taps[number]);
+    }
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16f_x2_dot_prod_32f_neonv8(float* result,
+                                                   const uint16_t* input,
+                                                   const uint16_t* taps,
+                                                   unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    float32x4_t dotProdVal0 = vdupq_n_f32(0.f);
+    float32x4_t dotProdVal1 = vdupq_n_f32(0.f);
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const float16x8_t a = vreinterpretq_f16_u16(vld1q_u16(input + number));
+        const float16x8_t b = vreinterpretq_f16_u16(vld1q_u16(taps + number));
+        dotProdVal0 = vfmaq_f32(
+            dotProdVal0, vcvt_f32_f16(vget_low_f16(a)), vcvt_f32_f16(vget_low_f16(b)));
+        dotProdVal1 = vfmaq_f32(dotProdVal1, vcvt_high_f32_f16(a), vcvt_high_f32_f16(b));
+    }
+
+    float dotProduct = vaddvq_f32(vaddq_f32(dotProdVal0, dotProdVal1));
+    for (; number < num_points; number++) {
+        dotProduct += volk_16f_to_32f(input[number]) * volk_16f_to_32f(taps[number]);
+    }
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16f_x2_dot_prod_32f_u_H */
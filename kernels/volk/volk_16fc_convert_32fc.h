@@ -0,0 +1,134 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16fc_convert_32fc
+ *
+ * \b Overview
+ *
+ * Converts complex half precision floats into complex floats. The conversion is
+ * exact.
+ *
+ * The 16 bit values are IEEE 754 half precision floats (binary16) held in
+ * uint16_t, see volk/volk_float16.h. A complex value is two of them, the real
+ * part first.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16fc_convert_32fc(lv_32fc_t* outputVector, const uint16_t* inputVector,
+ *                             unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The complex half precision floats, 2 * num_points values.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex floats.
+ *
+ * \b Example
+ * Widen a stored block of half precision IQ samples.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint16_t* in = (uint16_t*)volk_malloc(sizeof(uint16_t) * 2 * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   // fill in
+ *
+ *   volk_16fc_convert_32fc(out, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16fc_convert_32fc_a_H
+#define INCLUDED_volk_16fc_convert_32fc_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_16f_convert_32f.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16fc_convert_32fc_generic(lv_32fc_t* outputVector,
+                                                  const uint16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    volk_16f_convert_32f_generic((float*)outputVector, inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_F16C
+
+static inline void volk_16fc_convert_32fc_a_f16c(lv_32fc_t* outputVector,
+                                                 const uint16_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_16f_convert_32f_a_f16c((float*)outputVector, inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_F16C */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_16fc_convert_32fc_a_avx512f(lv_32fc_t* outputVector,
+                                                    const uint16_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_16f_convert_32f_a_avx512f((float*)outputVector, inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_16fc_convert_32fc_a_H */
+
+#ifndef INCLUDED_volk_16fc_convert_32fc_u_H
+#define INCLUDED_volk_16fc_convert_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_16f_convert_32f.h>
+
+#ifdef LV_HAVE_F16C
+
+static inline void volk_16fc_convert_32fc_u_f16c(lv_32fc_t* outputVector,
+                                                 const uint16_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_16f_convert_32f_u_f16c((float*)outputVector, inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_F16C */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_16fc_convert_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                    const uint16_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_16f_convert_32f_u_avx512f((float*)outputVector, inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_16fc_convert_32fc_neonv8(lv_32fc_t* outputVector,
+                                                 const uint16_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_16f_convert_32f_neonv8((float*)outputVector, inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16fc_convert_32fc_u_H */
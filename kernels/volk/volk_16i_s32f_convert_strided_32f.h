@@ -0,0 +1,225 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16i_s32f_convert_strided_32f
+ *
+ * \b Overview
+ *
+ * Converts a strided vector of 16-bit integers into a strided vector of
+ * floats, dividing by \p scalar:
+ *
+ * out[i * out_stride] = in[i * in_stride] / scalar
+ *
+ * This converts single channels of interleaved multi-channel PCM without
+ * deinterleaving them first.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16i_s32f_convert_strided_32f(float* outputVector, const int16_t*
+ * inputVector, const float scalar, unsigned int out_stride, unsigned int in_stride,
+ * unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The 16-bit integer input vector.
+ * \li scalar: The value the inputs are divided by.
+ * \li out_stride: Distance in floats between consecutive output points.
+ * \li in_stride: Distance in integers between consecutive input points.
+ * \li num_points: The number of points to convert.
+ *
+ * \b Outputs
+ * \li outputVector: The float output vector.
+ *
+ * \b Example
+ * Convert the left channel of a stereo stream to floats in [-1, 1).
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   int16_t* pcm = (int16_t*)volk_malloc(sizeof(int16_t) * 2 * N, alignment);
+ *   float* left = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *
+ *   // fill pcm
+ *
+ *   volk_16i_s32f_convert_strided_32f(left, pcm, 32768.f, 1, 2, N);
+ *
+ *   volk_free(pcm);
+ *   volk_free(left);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16i_s32f_convert_strided_32f_u_H
+#define INCLUDED_volk_16i_s32f_convert_strided_32f_u_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_s32f_convert_strided_32f_generic(float* outputVector,
+                                                             const int16_t* inputVector,
+                                                             const float scalar,
+                                                             unsigned int out_stride,
+                                                             unsigned int in_stride,
+                                                             unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        *outputVector = ((float)(*inputVector)) / scalar;
+        outputVector += out_stride;
+        inputVector += in_stride;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+#include <volk/volk_sse_intrinsics.h>
+
+static inline void volk_16i_s32f_convert_strided_32f_u_sse2(float* outputVector,
+                                                            const int16_t* inputVector,
+                                                            const float scalar,
+                                                            unsigned int out_stride,
+                                                            unsigned int in_stride,
+                                                            unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m128 invScalar = _mm_set_ps1(1.0f / scalar);
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        __m128i inputVal;
+        if (in_stride == 1) {
+            inputVal = _mm_loadu_si128((const __m128i*)inputVector);
+        } else {
+            const size_t s = in_stride;
+            inputVal = _mm_setr_epi16(inputVector[0],
+                                      inputVector[s],
+                                      inputVector[2 * s],
+                                      inputVector[3 * s],
+                                      inputVector[4 * s],
+                                      inputVector[5 * s],
+                                      inputVector[6 * s],
+                                      inputVector[7 * s]);
+        }
+        // sign extend to 32 bits
+        const __m128 lo = _mm_cvtepi32_ps(
+            _mm_srai_epi32(_mm_unpacklo_epi16(inputVal, inputVal), 16));
+        const __m128 hi = _mm_cvtepi32_ps(
+            _mm_srai_epi32(_mm_unpackhi_epi16(inputVal, inputVal), 16));
+        _mm_storeu_strided_ps(outputVector, out_stride, _mm_mul_ps(lo, invScalar));
+        _mm_storeu_strided_ps(outputVector + 4 * (size_t)out_stride,
+                              out_stride,
+                              _mm_mul_ps(hi, invScalar));
+        inputVector += 8 * (size_t)in_stride;
+        outputVector += 8 * (size_t)out_stride;
+    }
+
+    volk_16i_s32f_convert_strided_32f_generic(outputVector,
+                                              inputVector,
+                                              scalar,
+                                              out_stride,
+                                              in_stride,
+                                              num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_16i_s32f_convert_strided_32f_u_avx2(float* outputVector,
+                                                            const int16_t* inputVector,
+                                                            const float scalar,
+                                                            unsigned int out_stride,
+                                                            unsigned int in_stride,
+                                                            unsigned int num_points)
+{
+    // The gather reads 32 bits per 16-bit input, i.e. one integer past each
+    // point. The last point of the vector is left to the scalar tail so the
+    // read never goes past the end of the input.
+    const unsigned int eighthPoints = num_points ? (num_points - 1) / 8 : 0;
+    const __m256 invScalar = _mm256_set1_ps(1.0f / scalar);
+    const __m256i in_index = _mm256_stride_index(in_stride);
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        __m256i inputVal;
+        if (in_stride == 1) {
+            inputVal =
+                _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)inputVector));
+        } else if (_mm256_stride_fits_epi32(in_stride)) {
+            inputVal = _mm256_i32gather_epi32((const int*)inputVector, in_index, 2);
+            inputVal = _mm256_srai_epi32(_mm256_slli_epi32(inputVal, 16), 16);
+        } else {
+            const int* in = (const int*)inputVector;
+            const int* in_hi = (const int*)(inputVector + 4 * (size_t)in_stride);
+            inputVal = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm256_i64gather_epi32(in, in_index, 2)),
+                _mm256_i64gather_epi32(in_hi, in_index, 2),
+                1);
+            inputVal = _mm256_srai_epi32(_mm256_slli_epi32(inputVal, 16), 16);
+        }
+        const __m256 ret = _mm256_mul_ps(_mm256_cvtepi32_ps(inputVal), invScalar);
+        _mm256_storeu_strided_ps(outputVector, out_stride, ret);
+        inputVector += 8 * (size_t)in_stride;
+        outputVector += 8 * (size_t)out_stride;
+    }
+
+    volk_16i_s32f_convert_strided_32f_generic(outputVector,
+                                              inputVector,
+                                              scalar,
+                                              out_stride,
+                                              in_stride,
+                                              num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_16i_s32f_convert_strided_32f_neon(float* outputVector,
+                                                          const int16_t* inputVector,
+                                                          const float scalar,
+                                                          unsigned int out_stride,
+                                                          unsigned int in_stride,
+                                                          unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float32x4_t invScalar = vdupq_n_f32(1.0f / scalar);
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        int16x4_t inputVal;
+        if (in_stride == 1) {
+            inputVal = vld1_s16(inputVector);
+        } else {
+            const size_t s = in_stride;
+            inputVal = vld1_dup_s16(inputVector);
+            inputVal = vld1_lane_s16(inputVector + s, inputVal, 1);
+            inputVal = vld1_lane_s16(inputVector + 2 * s, inputVal, 2);
+            inputVal = vld1_lane_s16(inputVector + 3 * s, inputVal, 3);
+        }
+        const float32x4_t ret = vmulq_f32(vcvtq_f32_s32(vmovl_s16(inputVal)), invScalar);
+        _vst1q_strided_f32(outputVector, out_stride, ret);
+        inputVector += 4 * (size_t)in_stride;
+        outputVector += 4 * (size_t)out_stride;
+    }
+
+    volk_16i_s32f_convert_strided_32f_generic(outputVector,
+                                              inputVector,
+                                              scalar,
+                                              out_stride,
+                                              in_stride,
+                                              num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16i_s32f_convert_strided_32f_u_H */
@@ -0,0 +1,96 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_16i_s32f_convert_stridedpuppet_32f_H
+#define INCLUDED_volk_16i_s32f_convert_stridedpuppet_32f_H
+
+#include <volk/volk_16i_s32f_convert_strided_32f.h>
+
+// Test geometry: outputs every VOLK_STRIDED_PUPPET_OUT points, the first input
+// every VOLK_STRIDED_PUPPET_IN points and the second one contiguous, as many
+// points as fit into num_points.
+#ifndef VOLK_STRIDED_PUPPET_IN
+#define VOLK_STRIDED_PUPPET_IN 3
+#define VOLK_STRIDED_PUPPET_OUT 2
+#define VOLK_STRIDED_PUPPET_COUNT(num_points) ((num_points) / VOLK_STRIDED_PUPPET_IN)
+#endif
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_16i_s32f_convert_stridedpuppet_32f_generic(float* outputVector,
+                                                const int16_t* inputVector,
+                                                const float scalar,
+                                                unsigned int num_points)
+{
+    volk_16i_s32f_convert_strided_32f_generic(outputVector,
+                                              inputVector,
+                                              scalar,
+                                              VOLK_STRIDED_PUPPET_OUT,
+                                              VOLK_STRIDED_PUPPET_IN,
+                                              VOLK_STRIDED_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+
+static inline void
+volk_16i_s32f_convert_stridedpuppet_32f_u_sse2(float* outputVector,
+                                               const int16_t* inputVector,
+                                               const float scalar,
+                                               unsigned int num_points)
+{
+    volk_16i_s32f_convert_strided_32f_u_sse2(outputVector,
+                                             inputVector,
+                                             scalar,
+                                             VOLK_STRIDED_PUPPET_OUT,
+                                             VOLK_STRIDED_PUPPET_IN,
+                                             VOLK_STRIDED_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void
+volk_16i_s32f_convert_stridedpuppet_32f_u_avx2(float* outputVector,
+                                               const int16_t* inputVector,
+                                               const float scalar,
+                                               unsigned int num_points)
+{
+    volk_16i_s32f_convert_strided_32f_u_avx2(outputVector,
+                                             inputVector,
+                                             scalar,
+                                             VOLK_STRIDED_PUPPET_OUT,
+                                             VOLK_STRIDED_PUPPET_IN,
+                                             VOLK_STRIDED_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_16i_s32f_convert_stridedpuppet_32f_neon(float* outputVector,
+                                             const int16_t* inputVector,
+                                             const float scalar,
+                                             unsigned int num_points)
+{
+    volk_16i_s32f_convert_strided_32f_neon(outputVector,
+                                           inputVector,
+                                           scalar,
+                                           VOLK_STRIDED_PUPPET_OUT,
+                                           VOLK_STRIDED_PUPPET_IN,
+                                           VOLK_STRIDED_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16i_s32f_convert_stridedpuppet_32f_H */
@@ -0,0 +1,206 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16ic_convert_strided_32fc
+ *
+ * \b Overview
+ *
+ * Converts a strided vector of complex 16-bit integers into a strided vector
+ * of complex floats:
+ *
+ * out[i * out_stride] = in[i * in_stride]
+ *
+ * This pulls single channels out of interleaved multi-channel sc16 streams
+ * without deinterleaving them first.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_convert_strided_32fc(lv_32fc_t* outputVector, const lv_16sc_t*
+ * inputVector, unsigned int out_stride, unsigned int in_stride, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The complex 16-bit integer input vector.
+ * \li out_stride: Distance in complex points between consecutive output points.
+ * \li in_stride: Distance in complex points between consecutive input points.
+ * \li num_points: The number of points to convert.
+ *
+ * \b Outputs
+ * \li outputVector: The complex float output vector.
+ *
+ * \b Example
+ * Convert channel 1 of a 2 channel interleaved sc16 stream.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_16sc_t* frames = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t) * 2 * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   // fill frames
+ *
+ *   volk_16ic_convert_strided_32fc(out, frames + 1, 1, 2, N);
+ *
+ *   volk_free(frames);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_convert_strided_32fc_u_H
+#define INCLUDED_volk_16ic_convert_strided_32fc_u_H
+
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_convert_strided_32fc_generic(lv_32fc_t* outputVector,
+                                                          const lv_16sc_t* inputVector,
+                                                          unsigned int out_stride,
+                                                          unsigned int in_stride,
+                                                          unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        *outputVector =
+            lv_cmake((float)lv_creal(*inputVector), (float)lv_cimag(*inputVector));
+        outputVector += out_stride;
+        inputVector += in_stride;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+#include <volk/volk_sse_intrinsics.h>
+
+static inline void volk_16ic_convert_strided_32fc_u_sse2(lv_32fc_t* outputVector,
+                                                         const lv_16sc_t* inputVector,
+                                                         unsigned int out_stride,
+                                                         unsigned int in_stride,
+                                                         unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        // one lv_16sc_t per 32-bit lane
+        __m128i cplxValue;
+        if (in_stride == 1) {
+            cplxValue = _mm_loadu_si128((const __m128i*)inputVector);
+        } else {
+            const int* in = (const int*)inputVector;
+            const size_t s = in_stride;
+            cplxValue = _mm_setr_epi32(in[0], in[s], in[2 * s], in[3 * s]);
+        }
+        // sign extend r0 i0 r1 i1 and r2 i2 r3 i3 to 32 bits
+        const __m128 lo = _mm_cvtepi32_ps(
+            _mm_srai_epi32(_mm_unpacklo_epi16(cplxValue, cplxValue), 16));
+        const __m128 hi = _mm_cvtepi32_ps(
+            _mm_srai_epi32(_mm_unpackhi_epi16(cplxValue, cplxValue), 16));
+        float* out = (float*)outputVector;
+        _mm_storeu_strided_pc(out, out_stride, lo);
+        _mm_storeu_strided_pc(out + 4 * (size_t)out_stride, out_stride, hi);
+        inputVector += 4 * (size_t)in_stride;
+        outputVector += 4 * (size_t)out_stride;
+    }
+
+    volk_16ic_convert_strided_32fc_generic(outputVector,
+                                           inputVector,
+                                           out_stride,
+                                           in_stride,
+                                           num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_16ic_convert_strided_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                         const lv_16sc_t* inputVector,
+                                                         unsigned int out_stride,
+                                                         unsigned int in_stride,
+                                                         unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256i in_index = _mm256_stride_index(in_stride);
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        // one lv_16sc_t per 32-bit lane
+        const __m256i cplxValue =
+            _mm256_loadu_strided_epi32((const int*)inputVector, in_stride, in_index);
+        const __m256 re =
+            _mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(cplxValue, 16), 16));
+        const __m256 im = _mm256_cvtepi32_ps(_mm256_srai_epi32(cplxValue, 16));
+        // r0 i0 r1 i1 r4 i4 r5 i5 and r2 i2 r3 i3 r6 i6 r7 i7
+        const __m256 lo = _mm256_unpacklo_ps(re, im);
+        const __m256 hi = _mm256_unpackhi_ps(re, im);
+        float* out = (float*)outputVector;
+        _mm256_storeu_strided_pc(out, out_stride, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_strided_pc(out + 8 * (size_t)out_stride,
+                                 out_stride,
+                                 _mm256_permute2f128_ps(lo, hi, 0x31));
+        inputVector += 8 * (size_t)in_stride;
+        outputVector += 8 * (size_t)out_stride;
+    }
+
+    volk_16ic_convert_strided_32fc_generic(outputVector,
+                                           inputVector,
+                                           out_stride,
+                                           in_stride,
+                                           num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_16ic_convert_strided_32fc_neon(lv_32fc_t* outputVector,
+                                                       const lv_16sc_t* inputVector,
+                                                       unsigned int out_stride,
+                                                       unsigned int in_stride,
+                                                       unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const int16_t* in = (const int16_t*)inputVector;
+        int16x4x2_t cplxValue;
+        if (in_stride == 1) {
+            cplxValue = vld2_s16(in);
+        } else {
+            const size_t s = 2 * (size_t)in_stride;
+            cplxValue.val[0] = vdup_n_s16(0);
+            cplxValue.val[1] = vdup_n_s16(0);
+            cplxValue = vld2_lane_s16(in, cplxValue, 0);
+            cplxValue = vld2_lane_s16(in + s, cplxValue, 1);
+            cplxValue = vld2_lane_s16(in + 2 * s, cplxValue, 2);
+            cplxValue = vld2_lane_s16(in + 3 * s, cplxValue, 3);
+        }
+        float32x4x2_t out;
+        out.val[0] = vcvtq_f32_s32(vmovl_s16(cplxValue.val[0]));
+        out.val[1] = vcvtq_f32_s32(vmovl_s16(cplxValue.val[1]));
+        _vst2q_strided_f32((float*)outputVector, out_stride, out);
+        inputVector += 4 * (size_t)in_stride;
+        outputVector += 4 * (size_t)out_stride;
+    }
+
+    volk_16ic_convert_strided_32fc_generic(outputVector,
+                                           inputVector,
+                                           out_stride,
+                                           in_stride,
+                                           num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16ic_convert_strided_32fc_u_H */
@@ -0,0 +1,443 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16ic_pack_sc12_8u
+ *
+ * \b Overview
+ *
+ * Packs 16 bit complex integers into the packed sc12 format, saturating both
+ * parts to [-2048, 2047].
+ *
+ * The packed sc12 format stores each complex sample in three bytes, as the
+ * little endian 24 bit word (Q << 12) | I, with I and Q in 12 bit two's
+ * complement.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_pack_sc12_8u(uint8_t* outputVector, const lv_16sc_t* inputVector,
+ *                             unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The complex 16 bit integers.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The packed samples, 3 * num_points bytes.
+ *
+ * \b Example
+ * Round trip a buffer through the packed format.
+ * \code
+ *   unsigned int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_16sc_t* in = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t) * N, alignment);
+ *   uint8_t* packed = (uint8_t*)volk_malloc(3 * N, alignment);
+ *   lv_16sc_t* out = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = lv_cmake((int16_t)(ii % 4096) - 2048, 2047 - (int16_t)(ii % 4096));
+ *   }
+ *
+ *   volk_16ic_pack_sc12_8u(packed, in, N);
+ *   volk_8u_unpack_sc12_16ic(out, packed, N);
+ *
+ *   volk_free(in);
+ *   volk_free(packed);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_pack_sc12_8u_a_H
+#define INCLUDED_volk_16ic_pack_sc12_8u_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+static inline void volk_16ic_pack_sc12_8u_sample(uint8_t* outputPtr,
+                                                 int16_t real,
+                                                 int16_t imag)
+{
+    real = real > 2047 ? 2047 : (real < -2048 ? -2048 : real);
+    imag = imag > 2047 ? 2047 : (imag < -2048 ? -2048 : imag);
+    outputPtr[0] = (uint8_t)real;
+    outputPtr[1] = (uint8_t)(((real >> 8) & 0x0f) | ((imag & 0x0f) << 4));
+    outputPtr[2] = (uint8_t)(imag >> 4);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_pack_sc12_8u_generic(uint8_t* outputVector,
+                                                  const lv_16sc_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+
+    for (unsigned int number = 0; number < num_points; number++) {
+        volk_16ic_pack_sc12_8u_sample(outputPtr, inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+        outputPtr += 3;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_16ic_pack_sc12_8u_a_ssse3(uint8_t* outputVector,
+                                                  const lv_16sc_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m128i maxVal = _mm_set1_epi16(2047);
+    const __m128i minVal = _mm_set1_epi16(-2048);
+    const __m128i mask = _mm_set1_epi16(0x0fff);
+    // (imag << 12) | real in each 32 bit lane
+    const __m128i weights = _mm_set1_epi32(0x10000001);
+    // the three low bytes of each lane
+    const __m128i compact =
+        _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        __m128i low = _mm_load_si128((const __m128i*)inputPtr);
+        __m128i high = _mm_load_si128((const __m128i*)(inputPtr + 8));
+        inputPtr += 16;
+
+        low = _mm_and_si128(_mm_min_epi16(_mm_max_epi16(low, minVal), maxVal), mask);
+        high = _mm_and_si128(_mm_min_epi16(_mm_max_epi16(high, minVal), maxVal), mask);
+        low = _mm_shuffle_epi8(_mm_madd_epi16(low, weights), compact);
+        high = _mm_shuffle_epi8(_mm_madd_epi16(high, weights), compact);
+        low = _mm_or_si128(low, _mm_slli_si128(high, 12));
+        _mm_storeu_si128((__m128i*)outputPtr, low);
+        _mm_storel_epi64((__m128i*)(outputPtr + 16), _mm_srli_si128(high, 4));
+        outputPtr += 24;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        volk_16ic_pack_sc12_8u_sample(outputPtr, inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+        outputPtr += 3;
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_pack_sc12_8u_a_avx2(uint8_t* outputVector,
+                                                 const lv_16sc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m256i maxVal = _mm256_set1_epi16(2047);
+    const __m256i minVal = _mm256_set1_epi16(-2048);
+    const __m256i mask = _mm256_set1_epi16(0x0fff);
+    // (imag << 12) | real in each 32 bit lane
+    const __m256i weights = _mm256_set1_epi32(0x10000001);
+    // the three low bytes of each lane
+    const __m256i compact = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1));
+    // join the 12 bytes of each 128 bit lane, the second half of the samples is
+    // split between the two stores
+    const __m256i lowJoin = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+    const __m256i highJoin = _mm256_setr_epi32(2, 4, 5, 6, 7, 7, 0, 1);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m256i low = _mm256_load_si256((const __m256i*)inputPtr);
+        __m256i high = _mm256_load_si256((const __m256i*)(inputPtr + 16));
+        inputPtr += 32;
+
+        low = _mm256_min_epi16(_mm256_max_epi16(low, minVal), maxVal);
+        high = _mm256_min_epi16(_mm256_max_epi16(high, minVal), maxVal);
+        low = _mm256_madd_epi16(_mm256_and_si256(low, mask), weights);
+        high = _mm256_madd_epi16(_mm256_and_si256(high, mask), weights);
+        low = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(low, compact), lowJoin);
+        high = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(high, compact), highJoin);
+        _mm256_storeu_si256((__m256i*)outputPtr, _mm256_blend_epi32(low, high, 0xc0));
+        _mm_storeu_si128((__m128i*)(outputPtr + 32), _mm256_castsi256_si128(high));
+        outputPtr += 48;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        volk_16ic_pack_sc12_8u_sample(outputPtr, inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+        outputPtr += 3;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512VBMI
+#include <immintrin.h>
+
+static inline void volk_16ic_pack_sc12_8u_a_avx512vbmi(uint8_t* outputVector,
+                                                       const lv_16sc_t* inputVector,
+                                                       unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i maxVal = _mm512_set1_epi16(2047);
+    const __m512i minVal = _mm512_set1_epi16(-2048);
+    const __m512i mask = _mm512_set1_epi16(0x0fff);
+    // (imag << 12) | real in each 32 bit lane
+    const __m512i weights = _mm512_set1_epi32(0x10000001);
+    // the three low bytes of each lane
+    const __m512i compact = _mm512_setr_epi32(0x04020100,
+                                              0x09080605,
+                                              0x0e0d0c0a,
+                                              0x14121110,
+                                              0x19181615,
+                                              0x1e1d1c1a,
+                                              0x24222120,
+                                              0x29282625,
+                                              0x2e2d2c2a,
+                                              0x34323130,
+                                              0x39383635,
+                                              0x3e3d3c3a,
+                                              0x00000000,
+                                              0x00000000,
+                                              0x00000000,
+                                              0x00000000);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m512i values = _mm512_load_si512(inputPtr);
+        inputPtr += 32;
+
+        values = _mm512_min_epi16(_mm512_max_epi16(values, minVal), maxVal);
+        values = _mm512_madd_epi16(_mm512_and_si512(values, mask), weights);
+        values = _mm512_permutexvar_epi8(compact, values);
+        _mm512_mask_storeu_epi8(outputPtr, 0xffffffffffffULL, values);
+        outputPtr += 48;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        volk_16ic_pack_sc12_8u_sample(outputPtr, inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+        outputPtr += 3;
+    }
+}
+
+#endif /* LV_HAVE_AVX512VBMI */
+
+#endif /* INCLUDED_volk_16ic_pack_sc12_8u_a_H */
+
+#ifndef INCLUDED_volk_16ic_pack_sc12_8u_u_H
+#define INCLUDED_volk_16ic_pack_sc12_8u_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_16ic_pack_sc12_8u_u_ssse3(uint8_t* outputVector,
+                                                  const lv_16sc_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m128i maxVal = _mm_set1_epi16(2047);
+    const __m128i minVal = _mm_set1_epi16(-2048);
+    const __m128i mask = _mm_set1_epi16(0x0fff);
+    // (imag << 12) | real in each 32 bit lane
+    const __m128i weights = _mm_set1_epi32(0x10000001);
+    // the three low bytes of each lane
+    const __m128i compact =
+        _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        __m128i low = _mm_loadu_si128((const __m128i*)inputPtr);
+        __m128i high = _mm_loadu_si128((const __m128i*)(inputPtr + 8));
+        inputPtr += 16;
+
+        low = _mm_and_si128(_mm_min_epi16(_mm_max_epi16(low, minVal), maxVal), mask);
+        high = _mm_and_si128(_mm_min_epi16(_mm_max_epi16(high, minVal), maxVal), mask);
+        low = _mm_shuffle_epi8(_mm_madd_epi16(low, weights), compact);
+        high = _mm_shuffle_epi8(_mm_madd_epi16(high, weights), compact);
+        low = _mm_or_si128(low, _mm_slli_si128(high, 12));
+        _mm_storeu_si128((__m128i*)outputPtr, low);
+        _mm_storel_epi64((__m128i*)(outputPtr + 16), _mm_srli_si128(high, 4));
+        outputPtr += 24;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        volk_16ic_pack_sc12_8u_sample(outputPtr, inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+        outputPtr += 3;
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_pack_sc12_8u_u_avx2(uint8_t* outputVector,
+                                                 const lv_16sc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m256i maxVal = _mm256_set1_epi16(2047);
+    const __m256i minVal = _mm256_set1_epi16(-2048);
+    const __m256i mask = _mm256_set1_epi16(0x0fff);
+    // (imag << 12) | real in each 32 bit lane
+    const __m256i weights = _mm256_set1_epi32(0x10000001);
+    // the three low bytes of each lane
+    const __m256i compact = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1));
+    // join the 12 bytes of each 128 bit lane, the second half of the samples is
+    // split between the two stores
+    const __m256i lowJoin = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+    const __m256i highJoin = _mm256_setr_epi32(2, 4, 5, 6, 7, 7, 0, 1);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m256i low = _mm256_loadu_si256((const __m256i*)inputPtr);
+        __m256i high = _mm256_loadu_si256((const __m256i*)(inputPtr + 16));
+        inputPtr += 32;
+
+        low = _mm256_min_epi16(_mm256_max_epi16(low, minVal), maxVal);
+        high = _mm256_min_epi16(_mm256_max_epi16(high, minVal), maxVal);
+        low = _mm256_madd_epi16(_mm256_and_si256(low, mask), weights);
+        high = _mm256_madd_epi16(_mm256_and_si256(high, mask), weights);
+        low = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(low, compact), lowJoin);
+        high = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(high, compact), highJoin);
+        _mm256_storeu_si256((__m256i*)outputPtr, _mm256_blend_epi32(low, high, 0xc0));
+        _mm_storeu_si128((__m128i*)(outputPtr + 32), _mm256_castsi256_si128(high));
+        outputPtr += 48;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        volk_16ic_pack_sc12_8u_sample(outputPtr, inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+        outputPtr += 3;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512VBMI
+#include <immintrin.h>
+
+static inline void volk_16ic_pack_sc12_8u_u_avx512vbmi(uint8_t* outputVector,
+                                                       const lv_16sc_t* inputVector,
+                                                       unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i maxVal = _mm512_set1_epi16(2047);
+    const __m512i minVal = _mm512_set1_epi16(-2048);
+    const __m512i mask = _mm512_set1_epi16(0x0fff);
+    // (imag << 12) | real in each 32 bit lane
+    const __m512i weights = _mm512_set1_epi32(0x10000001);
+    // the three low bytes of each lane
+    const __m512i compact = _mm512_setr_epi32(0x04020100,
+                                              0x09080605,
+                                              0x0e0d0c0a,
+                                              0x14121110,
+                                              0x19181615,
+                                              0x1e1d1c1a,
+                                              0x24222120,
+                                              0x29282625,
+                                              0x2e2d2c2a,
+                                              0x34323130,
+                                              0x39383635,
+                                              0x3e3d3c3a,
+                                              0x00000000,
+                                              0x00000000,
+                                              0x00000000,
+                                              0x00000000);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m512i values = _mm512_loadu_si512(inputPtr);
+        inputPtr += 32;
+
+        values = _mm512_min_epi16(_mm512_max_epi16(values, minVal), maxVal);
+        values = _mm512_madd_epi16(_mm512_and_si512(values, mask), weights);
+        values = _mm512_permutexvar_epi8(compact, values);
+        _mm512_mask_storeu_epi8(outputPtr, 0xffffffffffffULL, values);
+        outputPtr += 48;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        volk_16ic_pack_sc12_8u_sample(outputPtr, inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+        outputPtr += 3;
+    }
+}
+
+#endif /* LV_HAVE_AVX512VBMI */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_16ic_pack_sc12_8u_neon(uint8_t* outputVector,
+                                               const lv_16sc_t* inputVector,
+                                               unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const int16x8_t maxVal = vdupq_n_s16(2047);
+    const int16x8_t minVal = vdupq_n_s16(-2048);
+    const uint16x8_t mask = vdupq_n_u16(0x0f);
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        const int16x8x2_t values = vld2q_s16(inputPtr);
+        inputPtr += 16;
+
+        const uint16x8_t real =
+            vreinterpretq_u16_s16(vminq_s16(vmaxq_s16(values.val[0], minVal), maxVal));
+        const uint16x8_t imag =
+            vreinterpretq_u16_s16(vminq_s16(vmaxq_s16(values.val[1], minVal), maxVal));
+        uint8x8x3_t bytes;
+
+        bytes.val[0] = vmovn_u16(real);
+        bytes.val[1] = vmovn_u16(
+            vorrq_u16(vandq_u16(vshrq_n_u16(real, 8), mask), vshlq_n_u16(imag, 4)));
+        bytes.val[2] = vmovn_u16(vshrq_n_u16(imag, 4));
+        vst3_u8(outputPtr, bytes);
+        outputPtr += 24;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        volk_16ic_pack_sc12_8u_sample(outputPtr, inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+        outputPtr += 3;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16ic_pack_sc12_8u_u_H */
@@ -0,0 +1,103 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_16ic_pack_sc12puppet_8u_H
+#define INCLUDED_volk_16ic_pack_sc12puppet_8u_H
+
+#include <volk/volk_16ic_pack_sc12_8u.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_pack_sc12puppet_8u_generic(uint8_t* outputVector,
+                                                        const lv_16sc_t* inputVector,
+                                                        unsigned int num_points)
+{
+    volk_16ic_pack_sc12_8u_generic(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSSE3
+
+static inline void volk_16ic_pack_sc12puppet_8u_a_ssse3(uint8_t* outputVector,
+                                                        const lv_16sc_t* inputVector,
+                                                        unsigned int num_points)
+{
+    volk_16ic_pack_sc12_8u_a_ssse3(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_SSSE3
+
+static inline void volk_16ic_pack_sc12puppet_8u_u_ssse3(uint8_t* outputVector,
+                                                        const lv_16sc_t* inputVector,
+                                                        unsigned int num_points)
+{
+    volk_16ic_pack_sc12_8u_u_ssse3(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_16ic_pack_sc12puppet_8u_a_avx2(uint8_t* outputVector,
+                                                       const lv_16sc_t* inputVector,
+                                                       unsigned int num_points)
+{
+    volk_16ic_pack_sc12_8u_a_avx2(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_16ic_pack_sc12puppet_8u_u_avx2(uint8_t* outputVector,
+                                                       const lv_16sc_t* inputVector,
+                                                       unsigned int num_points)
+{
+    volk_16ic_pack_sc12_8u_u_avx2(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512VBMI
+
+static inline void volk_16ic_pack_sc12puppet_8u_a_avx512vbmi(uint8_t* outputVector,
+                                                             const lv_16sc_t* inputVector,
+                                                             unsigned int num_points)
+{
+    volk_16ic_pack_sc12_8u_a_avx512vbmi(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_AVX512VBMI */
+
+#ifdef LV_HAVE_AVX512VBMI
+
+static inline void volk_16ic_pack_sc12puppet_8u_u_avx512vbmi(uint8_t* outputVector,
+                                                             const lv_16sc_t* inputVector,
+                                                             unsigned int num_points)
+{
+    volk_16ic_pack_sc12_8u_u_avx512vbmi(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_AVX512VBMI */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_16ic_pack_sc12puppet_8u_neon(uint8_t* outputVector,
+                                                     const lv_16sc_t* inputVector,
+                                                     unsigned int num_points)
+{
+    volk_16ic_pack_sc12_8u_neon(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16ic_pack_sc12puppet_8u_H */
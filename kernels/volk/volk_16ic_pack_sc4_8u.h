@@ -0,0 +1,409 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16ic_pack_sc4_8u
+ *
+ * \b Overview
+ *
+ * Packs 16 bit complex integers into the packed sc4 format, saturating both
+ * parts to [-8, 7].
+ *
+ * The packed sc4 format stores each complex sample in one byte, I in the low
+ * and Q in the high nibble, both in 4 bit two's complement.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_pack_sc4_8u(uint8_t* outputVector, const lv_16sc_t* inputVector,
+ *                            unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The complex 16 bit integers.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The packed samples, one byte each.
+ *
+ * \b Example
+ * Round trip a buffer through the packed format.
+ * \code
+ *   unsigned int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_16sc_t* in = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t) * N, alignment);
+ *   uint8_t* packed = (uint8_t*)volk_malloc(N, alignment);
+ *   lv_16sc_t* out = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = lv_cmake((int16_t)(ii % 16) - 8, 7 - (int16_t)(ii % 16));
+ *   }
+ *
+ *   volk_16ic_pack_sc4_8u(packed, in, N);
+ *   volk_8u_unpack_sc4_16ic(out, packed, N);
+ *
+ *   volk_free(in);
+ *   volk_free(packed);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_pack_sc4_8u_a_H
+#define INCLUDED_volk_16ic_pack_sc4_8u_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+static inline uint8_t volk_16ic_pack_sc4_8u_sample(int16_t real, int16_t imag)
+{
+    real = real > 7 ? 7 : (real < -8 ? -8 : real);
+    imag = imag > 7 ? 7 : (imag < -8 ? -8 : imag);
+    return (uint8_t)((real & 0x0f) | ((imag & 0x0f) << 4));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_pack_sc4_8u_generic(uint8_t* outputVector,
+                                                 const lv_16sc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+
+    for (unsigned int number = 0; number < num_points; number++) {
+        *outputPtr++ = volk_16ic_pack_sc4_8u_sample(inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_16ic_pack_sc4_8u_a_sse2(uint8_t* outputVector,
+                                                const lv_16sc_t* inputVector,
+                                                unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m128i maxVal = _mm_set1_epi16(7);
+    const __m128i minVal = _mm_set1_epi16(-8);
+    const __m128i realMask = _mm_set1_epi16(0x000f);
+    const __m128i imagMask = _mm_set1_epi16(0x00f0);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m128i values[4];
+        for (int i = 0; i < 4; i++) {
+            values[i] = _mm_load_si128((const __m128i*)inputPtr + i);
+            values[i] = _mm_min_epi16(_mm_max_epi16(values[i], minVal), maxVal);
+        }
+        inputPtr += 32;
+
+        // one sample per 16 bit lane, then the nibbles of each lane into its low byte
+        __m128i low = _mm_packs_epi16(values[0], values[1]);
+        __m128i high = _mm_packs_epi16(values[2], values[3]);
+        low = _mm_or_si128(_mm_and_si128(low, realMask),
+                           _mm_and_si128(_mm_srli_epi16(low, 4), imagMask));
+        high = _mm_or_si128(_mm_and_si128(high, realMask),
+                            _mm_and_si128(_mm_srli_epi16(high, 4), imagMask));
+        _mm_store_si128((__m128i*)outputPtr, _mm_packus_epi16(low, high));
+        outputPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *outputPtr++ = volk_16ic_pack_sc4_8u_sample(inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_pack_sc4_8u_a_avx2(uint8_t* outputVector,
+                                                const lv_16sc_t* inputVector,
+                                                unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int thirtysecondPoints = num_points / 32;
+    const __m256i maxVal = _mm256_set1_epi16(7);
+    const __m256i minVal = _mm256_set1_epi16(-8);
+    const __m256i realMask = _mm256_set1_epi16(0x000f);
+    const __m256i imagMask = _mm256_set1_epi16(0x00f0);
+    // undo the interleaving of the 128 bit lanes by the two packs
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    unsigned int number = 0;
+
+    for (; number < thirtysecondPoints; number++) {
+        __m256i values[4];
+        for (int i = 0; i < 4; i++) {
+            values[i] = _mm256_load_si256((const __m256i*)inputPtr + i);
+            values[i] = _mm256_min_epi16(_mm256_max_epi16(values[i], minVal), maxVal);
+        }
+        inputPtr += 64;
+
+        // one sample per 16 bit lane, then the nibbles of each lane into its low byte
+        __m256i low = _mm256_packs_epi16(values[0], values[1]);
+        __m256i high = _mm256_packs_epi16(values[2], values[3]);
+        low = _mm256_or_si256(_mm256_and_si256(low, realMask),
+                              _mm256_and_si256(_mm256_srli_epi16(low, 4), imagMask));
+        high = _mm256_or_si256(_mm256_and_si256(high, realMask),
+                               _mm256_and_si256(_mm256_srli_epi16(high, 4), imagMask));
+        const __m256i bytes = _mm256_packus_epi16(low, high);
+        _mm256_store_si256((__m256i*)outputPtr,
+                           _mm256_permutevar8x32_epi32(bytes, order));
+        outputPtr += 32;
+    }
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        *outputPtr++ = volk_16ic_pack_sc4_8u_sample(inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16ic_pack_sc4_8u_a_avx512bw(uint8_t* outputVector,
+                                                    const lv_16sc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int sixtyfourthPoints = num_points / 64;
+    const __m512i maxVal = _mm512_set1_epi16(7);
+    const __m512i minVal = _mm512_set1_epi16(-8);
+    const __m512i realMask = _mm512_set1_epi16(0x000f);
+    const __m512i imagMask = _mm512_set1_epi16(0x00f0);
+    // undo the interleaving of the 128 bit lanes by the two packs
+    const __m512i order =
+        _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    unsigned int number = 0;
+
+    for (; number < sixtyfourthPoints; number++) {
+        __m512i values[4];
+        for (int i = 0; i < 4; i++) {
+            values[i] = _mm512_load_si512(inputPtr + 32 * i);
+            values[i] = _mm512_min_epi16(_mm512_max_epi16(values[i], minVal), maxVal);
+        }
+        inputPtr += 128;
+
+        // one sample per 16 bit lane, then the nibbles of each lane into its low byte
+        __m512i low = _mm512_packs_epi16(values[0], values[1]);
+        __m512i high = _mm512_packs_epi16(values[2], values[3]);
+        low = _mm512_or_si512(_mm512_and_si512(low, realMask),
+                              _mm512_and_si512(_mm512_srli_epi16(low, 4), imagMask));
+        high = _mm512_or_si512(_mm512_and_si512(high, realMask),
+                               _mm512_and_si512(_mm512_srli_epi16(high, 4), imagMask));
+        const __m512i bytes = _mm512_packus_epi16(low, high);
+        _mm512_store_si512(outputPtr, _mm512_permutexvar_epi32(order, bytes));
+        outputPtr += 64;
+    }
+
+    number = sixtyfourthPoints * 64;
+    for (; number < num_points; number++) {
+        *outputPtr++ = volk_16ic_pack_sc4_8u_sample(inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_AVX512BW */
+
+#endif /* INCLUDED_volk_16ic_pack_sc4_8u_a_H */
+
+#ifndef INCLUDED_volk_16ic_pack_sc4_8u_u_H
+#define INCLUDED_volk_16ic_pack_sc4_8u_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_16ic_pack_sc4_8u_u_sse2(uint8_t* outputVector,
+                                                const lv_16sc_t* inputVector,
+                                                unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m128i maxVal = _mm_set1_epi16(7);
+    const __m128i minVal = _mm_set1_epi16(-8);
+    const __m128i realMask = _mm_set1_epi16(0x000f);
+    const __m128i imagMask = _mm_set1_epi16(0x00f0);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m128i values[4];
+        for (int i = 0; i < 4; i++) {
+            values[i] = _mm_loadu_si128((const __m128i*)inputPtr + i);
+            values[i] = _mm_min_epi16(_mm_max_epi16(values[i], minVal), maxVal);
+        }
+        inputPtr += 32;
+
+        // one sample per 16 bit lane, then the nibbles of each lane into its low byte
+        __m128i low = _mm_packs_epi16(values[0], values[1]);
+        __m128i high = _mm_packs_epi16(values[2], values[3]);
+        low = _mm_or_si128(_mm_and_si128(low, realMask),
+                           _mm_and_si128(_mm_srli_epi16(low, 4), imagMask));
+        high = _mm_or_si128(_mm_and_si128(high, realMask),
+                            _mm_and_si128(_mm_srli_epi16(high, 4), imagMask));
+        _mm_storeu_si128((__m128i*)outputPtr, _mm_packus_epi16(low, high));
+        outputPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *outputPtr++ = volk_16ic_pack_sc4_8u_sample(inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_pack_sc4_8u_u_avx2(uint8_t* outputVector,
+                                                const lv_16sc_t* inputVector,
+                                                unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int thirtysecondPoints = num_points / 32;
+    const __m256i maxVal = _mm256_set1_epi16(7);
+    const __m256i minVal = _mm256_set1_epi16(-8);
+    const __m256i realMask = _mm256_set1_epi16(0x000f);
+    const __m256i imagMask = _mm256_set1_epi16(0x00f0);
+    // undo the interleaving of the 128 bit lanes by the two packs
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    unsigned int number = 0;
+
+    for (; number < thirtysecondPoints; number++) {
+        __m256i values[4];
+        for (int i = 0; i < 4; i++) {
+            values[i] = _mm256_loadu_si256((const __m256i*)inputPtr + i);
+            values[i] = _mm256_min_epi16(_mm256_max_epi16(values[i], minVal), maxVal);
+        }
+        inputPtr += 64;
+
+        // one sample per 16 bit lane, then the nibbles of each lane into its low byte
+        __m256i low = _mm256_packs_epi16(values[0], values[1]);
+        __m256i high = _mm256_packs_epi16(values[2], values[3]);
+        low = _mm256_or_si256(_mm256_and_si256(low, realMask),
+                              _mm256_and_si256(_mm256_srli_epi16(low, 4), imagMask));
+        high = _mm256_or_si256(_mm256_and_si256(high, realMask),
+                               _mm256_and_si256(_mm256_srli_epi16(high, 4), imagMask));
+        const __m256i bytes = _mm256_packus_epi16(low, high);
+        _mm256_storeu_si256((__m256i*)outputPtr,
+                           _mm256_permutevar8x32_epi32(bytes, order));
+        outputPtr += 32;
+    }
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        *outputPtr++ = volk_16ic_pack_sc4_8u_sample(inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_16ic_pack_sc4_8u_u_avx512bw(uint8_t* outputVector,
+                                                    const lv_16sc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int sixtyfourthPoints = num_points / 64;
+    const __m512i maxVal = _mm512_set1_epi16(7);
+    const __m512i minVal = _mm512_set1_epi16(-8);
+    const __m512i realMask = _mm512_set1_epi16(0x000f);
+    const __m512i imagMask = _mm512_set1_epi16(0x00f0);
+    // undo the interleaving of the 128 bit lanes by the two packs
+    const __m512i order =
+        _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    unsigned int number = 0;
+
+    for (; number < sixtyfourthPoints; number++) {
+        __m512i values[4];
+        for (int i = 0; i < 4; i++) {
+            values[i] = _mm512_loadu_si512(inputPtr + 32 * i);
+            values[i] = _mm512_min_epi16(_mm512_max_epi16(values[i], minVal), maxVal);
+        }
+        inputPtr += 128;
+
+        // one sample per 16 bit lane, then the nibbles of each lane into its low byte
+        __m512i low = _mm512_packs_epi16(values[0], values[1]);
+        __m512i high = _mm512_packs_epi16(values[2], values[3]);
+        low = _mm512_or_si512(_mm512_and_si512(low, realMask),
+                              _mm512_and_si512(_mm512_srli_epi16(low, 4), imagMask));
+        high = _mm512_or_si512(_mm512_and_si512(high, realMask),
+                               _mm512_and_si512(_mm512_srli_epi16(high, 4), imagMask));
+        const __m512i bytes = _mm512_packus_epi16(low, high);
+        _mm512_storeu_si512(outputPtr, _mm512_permutexvar_epi32(order, bytes));
+        outputPtr += 64;
+    }
+
+    number = sixtyfourthPoints * 64;
+    for (; number < num_points; number++) {
+        *outputPtr++ = volk_16ic_pack_sc4_8u_sample(inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_AVX512BW */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_16ic_pack_sc4_8u_neon(uint8_t* outputVector,
+                                              const lv_16sc_t* inputVector,
+                                              unsigned int num_points)
+{
+    const int16_t* inputPtr = (const int16_t*)inputVector;
+    uint8_t* outputPtr = outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const int16x8_t maxVal = vdupq_n_s16(7);
+    const int16x8_t minVal = vdupq_n_s16(-8);
+    const int16x8_t mask = vdupq_n_s16(0x0f);
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        const int16x8x2_t values = vld2q_s16(inputPtr);
+        inputPtr += 16;
+
+        const int16x8_t real = vminq_s16(vmaxq_s16(values.val[0], minVal), maxVal);
+        const int16x8_t imag = vminq_s16(vmaxq_s16(values.val[1], minVal), maxVal);
+        const int16x8_t bytes = vorrq_s16(vandq_s16(real, mask), vshlq_n_s16(imag, 4));
+        vst1_u8(outputPtr, vmovn_u16(vreinterpretq_u16_s16(bytes)));
+        outputPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        *outputPtr++ = volk_16ic_pack_sc4_8u_sample(inputPtr[0], inputPtr[1]);
+        inputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16ic_pack_sc4_8u_u_H */
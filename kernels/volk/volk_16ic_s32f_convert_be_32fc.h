@@ -0,0 +1,352 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16ic_s32f_convert_be_32fc
+ *
+ * \b Overview
+ *
+ * Converts complex 16 bit integers in big endian (network) byte order, as
+ * carried by VITA-49 and similar packet formats, into complex floats divided by
+ * a scalar. This replaces a volk_16u_byteswap, volk_16ic_convert_32fc and
+ * scaling pass with a single one.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_s32f_convert_be_32fc(lv_32fc_t* outputVector,
+ *                                     const lv_16sc_t* inputVector,
+ *                                     const float scalar, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The big endian complex 16 bit integers.
+ * \li scalar: The value the samples are divided by, 32768 for full scale.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex floats.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 2048;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_16sc_t* in = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   // copy the packet payload into in
+ *
+ *   volk_16ic_s32f_convert_be_32fc(out, in, 32768.f, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_s32f_convert_be_32fc_a_H
+#define INCLUDED_volk_16ic_s32f_convert_be_32fc_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_s32f_convert_be_32fc_generic(lv_32fc_t* outputVector,
+                                                          const lv_16sc_t* inputVector,
+                                                          const float scalar,
+                                                          unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint16_t* inputPtr = (const uint16_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+
+    for (unsigned int number = 0; number < num_points * 2; number++) {
+        const uint16_t value = *inputPtr++;
+        *outputPtr++ = (float)(int16_t)((value << 8) | (value >> 8)) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_16ic_s32f_convert_be_32fc_a_ssse3(lv_32fc_t* outputVector,
+                                                          const lv_16sc_t* inputVector,
+                                                          const float scalar,
+                                                          unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint16_t* inputPtr = (const uint16_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int quarterPoints = num_points / 4;
+    const __m128 invScalar = _mm_set1_ps(iScalar);
+    // swap the bytes of each part into the upper half of a 32 bit lane
+    const __m128i lowSwap =
+        _mm_setr_epi8(-1, -1, 1, 0, -1, -1, 3, 2, -1, -1, 5, 4, -1, -1, 7, 6);
+    const __m128i highSwap =
+        _mm_setr_epi8(-1, -1, 9, 8, -1, -1, 11, 10, -1, -1, 13, 12, -1, -1, 15, 14);
+    unsigned int number = 0;
+
+    for (; number < quarterPoints; number++) {
+        const __m128i values = _mm_load_si128((const __m128i*)inputPtr);
+        inputPtr += 8;
+
+        const __m128i low = _mm_srai_epi32(_mm_shuffle_epi8(values, lowSwap), 16);
+        const __m128i high = _mm_srai_epi32(_mm_shuffle_epi8(values, highSwap), 16);
+        _mm_store_ps(outputPtr, _mm_mul_ps(_mm_cvtepi32_ps(low), invScalar));
+        _mm_store_ps(outputPtr + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), invScalar));
+        outputPtr += 8;
+    }
+
+    for (number = quarterPoints * 8; number < num_points * 2; number++) {
+        const uint16_t value = *inputPtr++;
+        *outputPtr++ = (float)(int16_t)((value << 8) | (value >> 8)) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_s32f_convert_be_32fc_a_avx2(lv_32fc_t* outputVector,
+                                                         const lv_16sc_t* inputVector,
+                                                         const float scalar,
+                                                         unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint16_t* inputPtr = (const uint16_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 invScalar = _mm256_set1_ps(iScalar);
+    const __m256i swap = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        __m256i values = _mm256_load_si256((const __m256i*)inputPtr);
+        inputPtr += 16;
+
+        values = _mm256_shuffle_epi8(values, swap);
+        const __m256i low = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(values));
+        const __m256i high = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(values, 1));
+        const __m256 lowValues = _mm256_cvtepi32_ps(low);
+        const __m256 highValues = _mm256_cvtepi32_ps(high);
+        _mm256_store_ps(outputPtr, _mm256_mul_ps(lowValues, invScalar));
+        _mm256_store_ps(outputPtr + 8, _mm256_mul_ps(highValues, invScalar));
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 16; number < num_points * 2; number++) {
+        const uint16_t value = *inputPtr++;
+        *outputPtr++ = (float)(int16_t)((value << 8) | (value >> 8)) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16ic_s32f_convert_be_32fc_a_avx512f(lv_32fc_t* outputVector,
+                                                            const lv_16sc_t* inputVector,
+                                                            const float scalar,
+                                                            unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint16_t* inputPtr = (const uint16_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 invScalar = _mm512_set1_ps(iScalar);
+    const __m256i swap = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m256i low = _mm256_load_si256((const __m256i*)inputPtr);
+        __m256i high = _mm256_load_si256((const __m256i*)(inputPtr + 16));
+        inputPtr += 32;
+
+        low = _mm256_shuffle_epi8(low, swap);
+        high = _mm256_shuffle_epi8(high, swap);
+        const __m512 lowValues = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(low));
+        const __m512 highValues = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(high));
+        _mm512_store_ps(outputPtr, _mm512_mul_ps(lowValues, invScalar));
+        _mm512_store_ps(outputPtr + 16, _mm512_mul_ps(highValues, invScalar));
+        outputPtr += 32;
+    }
+
+    for (number = sixteenthPoints * 32; number < num_points * 2; number++) {
+        const uint16_t value = *inputPtr++;
+        *outputPtr++ = (float)(int16_t)((value << 8) | (value >> 8)) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_16ic_s32f_convert_be_32fc_a_H */
+
+#ifndef INCLUDED_volk_16ic_s32f_convert_be_32fc_u_H
+#define INCLUDED_volk_16ic_s32f_convert_be_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_16ic_s32f_convert_be_32fc_u_ssse3(lv_32fc_t* outputVector,
+                                                          const lv_16sc_t* inputVector,
+                                                          const float scalar,
+                                                          unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint16_t* inputPtr = (const uint16_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int quarterPoints = num_points / 4;
+    const __m128 invScalar = _mm_set1_ps(iScalar);
+    // swap the bytes of each part into the upper half of a 32 bit lane
+    const __m128i lowSwap =
+        _mm_setr_epi8(-1, -1, 1, 0, -1, -1, 3, 2, -1, -1, 5, 4, -1, -1, 7, 6);
+    const __m128i highSwap =
+        _mm_setr_epi8(-1, -1, 9, 8, -1, -1, 11, 10, -1, -1, 13, 12, -1, -1, 15, 14);
+    unsigned int number = 0;
+
+    for (; number < quarterPoints; number++) {
+        const __m128i values = _mm_loadu_si128((const __m128i*)inputPtr);
+        inputPtr += 8;
+
+        const __m128i low = _mm_srai_epi32(_mm_shuffle_epi8(values, lowSwap), 16);
+        const __m128i high = _mm_srai_epi32(_mm_shuffle_epi8(values, highSwap), 16);
+        _mm_storeu_ps(outputPtr, _mm_mul_ps(_mm_cvtepi32_ps(low), invScalar));
+        _mm_storeu_ps(outputPtr + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), invScalar));
+        outputPtr += 8;
+    }
+
+    for (number = quarterPoints * 8; number < num_points * 2; number++) {
+        const uint16_t value = *inputPtr++;
+        *outputPtr++ = (float)(int16_t)((value << 8) | (value >> 8)) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_s32f_convert_be_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                         const lv_16sc_t* inputVector,
+                                                         const float scalar,
+                                                         unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint16_t* inputPtr = (const uint16_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 invScalar = _mm256_set1_ps(iScalar);
+    const __m256i swap = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        __m256i values = _mm256_loadu_si256((const __m256i*)inputPtr);
+        inputPtr += 16;
+
+        values = _mm256_shuffle_epi8(values, swap);
+        const __m256i low = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(values));
+        const __m256i high = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(values, 1));
+        const __m256 lowValues = _mm256_cvtepi32_ps(low);
+        const __m256 highValues = _mm256_cvtepi32_ps(high);
+        _mm256_storeu_ps(outputPtr, _mm256_mul_ps(lowValues, invScalar));
+        _mm256_storeu_ps(outputPtr + 8, _mm256_mul_ps(highValues, invScalar));
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 16; number < num_points * 2; number++) {
+        const uint16_t value = *inputPtr++;
+        *outputPtr++ = (float)(int16_t)((value << 8) | (value >> 8)) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16ic_s32f_convert_be_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                            const lv_16sc_t* inputVector,
+                                                            const float scalar,
+                                                            unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint16_t* inputPtr = (const uint16_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 invScalar = _mm512_set1_ps(iScalar);
+    const __m256i swap = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m256i low = _mm256_loadu_si256((const __m256i*)inputPtr);
+        __m256i high = _mm256_loadu_si256((const __m256i*)(inputPtr + 16));
+        inputPtr += 32;
+
+        low = _mm256_shuffle_epi8(low, swap);
+        high = _mm256_shuffle_epi8(high, swap);
+        const __m512 lowValues = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(low));
+        const __m512 highValues = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(high));
+        _mm512_storeu_ps(outputPtr, _mm512_mul_ps(lowValues, invScalar));
+        _mm512_storeu_ps(outputPtr + 16, _mm512_mul_ps(highValues, invScalar));
+        outputPtr += 32;
+    }
+
+    for (number = sixteenthPoints * 32; number < num_points * 2; number++) {
+        const uint16_t value = *inputPtr++;
+        *outputPtr++ = (float)(int16_t)((value << 8) | (value >> 8)) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_16ic_s32f_convert_be_32fc_neon(lv_32fc_t* outputVector,
+                                                       const lv_16sc_t* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint16_t* inputPtr = (const uint16_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int quarterPoints = num_points / 4;
+    unsigned int number = 0;
+
+    for (; number < quarterPoints; number++) {
+        const uint8x16_t bytes = vrev16q_u8(vld1q_u8((const uint8_t*)inputPtr));
+        inputPtr += 8;
+
+        const int16x8_t values = vreinterpretq_s16_u8(bytes);
+        const int32x4_t low = vmovl_s16(vget_low_s16(values));
+        const int32x4_t high = vmovl_s16(vget_high_s16(values));
+        vst1q_f32(outputPtr, vmulq_n_f32(vcvtq_f32_s32(low), iScalar));
+        vst1q_f32(outputPtr + 4, vmulq_n_f32(vcvtq_f32_s32(high), iScalar));
+        outputPtr += 8;
+    }
+
+    for (number = quarterPoints * 8; number < num_points * 2; number++) {
+        const uint16_t value = *inputPtr++;
+        *outputPtr++ = (float)(int16_t)((value << 8) | (value >> 8)) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16ic_s32f_convert_be_32fc_u_H */
@@ -0,0 +1,456 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16ic_s32f_s32fc_x2_rotator_32fc
+ *
+ * \b Overview
+ *
+ * Converts the complex 16 bit integers to complex floats, divides them by a
+ * scalar and rotates them at a fixed rate per sample from an initial phase, in a
+ * single pass. This replaces a conversion to a 32fc buffer followed by
+ * volk_32fc_s32fc_x2_rotator_32fc, without writing and reading back the
+ * intermediate buffer. Like the rotator, the phase is renormalized every ROTATOR_RELOAD
+ * samples and at the end of every call, and is written back so that consecutive
+ * calls continue the oscillation.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_s32f_s32fc_x2_rotator_32fc(lv_32fc_t* outVector,
+ *                                           const lv_16sc_t* inVector,
+ *                                           const float scalar,
+ *                                           const lv_32fc_t phase_inc,
+ *                                           lv_32fc_t* phase,
+ *                                           unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li inVector: The complex integers to be converted and rotated.
+ * \li scalar: The value each converted component is divided by.
+ * \li phase_inc: rotational velocity, expected to have unit magnitude.
+ * \li phase: initial phase offset, updated to the phase after the last sample.
+ * \li num_points: The number of complex values to convert and rotate.
+ *
+ * \b Outputs
+ * \li outVector: The rotated complex floats.
+ *
+ * \b Example
+ * Shift a full scale 16 bit stream down by f=0.1 (normalized frequency).
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_16sc_t* in = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   // fill in with samples from the receiver
+ *
+ *   const float frequency = -0.1f;
+ *   const lv_32fc_t phase_increment =
+ *       lv_cmake(std::cos(frequency), std::sin(frequency));
+ *   lv_32fc_t phase = lv_cmake(1.f, 0.f);
+ *
+ *   // call repeatedly with the same phase to keep the mixer continuous
+ *   volk_16ic_s32f_s32fc_x2_rotator_32fc(out, in, 32768.f, phase_increment, &phase, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_s32f_s32fc_x2_rotator_32fc_a_H
+#define INCLUDED_volk_16ic_s32f_s32fc_x2_rotator_32fc_a_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <volk/volk_32fc_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_s32f_s32fc_x2_rotator_32fc_generic(lv_32fc_t* outVector,
+                                                                const lv_16sc_t* inVector,
+                                                                const float scalar,
+                                                                const lv_32fc_t phase_inc,
+                                                                lv_32fc_t* phase,
+                                                                unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const int16_t* inPtr = (const int16_t*)inVector;
+    unsigned int i, j;
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        const unsigned int block =
+            (num_points - i < ROTATOR_RELOAD) ? num_points - i : ROTATOR_RELOAD;
+        for (j = 0; j < block; ++j) {
+            const lv_32fc_t sample =
+                lv_cmake((float)inPtr[0] * iScalar, (float)inPtr[1] * iScalar);
+            *outVector++ = sample * (*phase);
+            (*phase) *= phase_inc;
+            inPtr += 2;
+        }
+        (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void
+volk_16ic_s32f_s32fc_x2_rotator_32fc_a_sse4_1(lv_32fc_t* outVector,
+                                              const lv_16sc_t* inVector,
+                                              const float scalar,
+                                              const lv_32fc_t phase_inc,
+                                              lv_32fc_t* phase,
+                                              unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const int16_t* inPtr = (const int16_t*)inVector;
+    lv_32fc_t* cPtr = outVector;
+    lv_32fc_t incr = 1;
+    lv_32fc_t phase_Ptr[2] = { (*phase), (*phase) };
+    unsigned int i, j;
+
+    for (i = 0; i < 2; ++i) {
+        phase_Ptr[i] *= incr;
+        incr *= phase_inc;
+    }
+
+    const __m128 scale_Val = _mm_set1_ps(iScalar);
+    const __m128 inc_Val =
+        _mm_setr_ps(lv_creal(incr), lv_cimag(incr), lv_creal(incr), lv_cimag(incr));
+    __m128 phase_Val = _mm_loadu_ps((float*)phase_Ptr);
+    __m128 aVal, tmp;
+
+    const unsigned int half_points = num_points / 2;
+    for (i = 0; i < half_points; i += ROTATOR_RELOAD_2) {
+        const unsigned int block =
+            (half_points - i < ROTATOR_RELOAD_2) ? half_points - i : ROTATOR_RELOAD_2;
+        for (j = 0; j < block; ++j) {
+            aVal = _mm_cvtepi32_ps(
+                _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)inPtr)));
+            aVal = _mm_mul_ps(aVal, scale_Val);
+
+            _mm_store_ps((float*)cPtr, _mm_complexmul_ps(aVal, phase_Val));
+            phase_Val = _mm_complexmul_ps(phase_Val, inc_Val);
+
+            inPtr += 4;
+            cPtr += 2;
+        }
+        // renormalize so rounding errors do not change the magnitude
+        tmp = _mm_mul_ps(phase_Val, phase_Val);
+        tmp = _mm_hadd_ps(tmp, tmp);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0xD8);
+        phase_Val = _mm_div_ps(phase_Val, _mm_sqrt_ps(tmp));
+    }
+
+    _mm_storeu_ps((float*)phase_Ptr, phase_Val);
+
+    for (i = 0; i < num_points % 2; ++i) {
+        const lv_32fc_t sample =
+            lv_cmake((float)inPtr[0] * iScalar, (float)inPtr[1] * iScalar);
+        *cPtr++ = sample * phase_Ptr[0];
+        phase_Ptr[0] *= phase_inc;
+        inPtr += 2;
+    }
+
+    (*phase) = phase_Ptr[0];
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_16ic_s32f_s32fc_x2_rotator_32fc_a_avx2(lv_32fc_t* outVector,
+                                                               const lv_16sc_t* inVector,
+                                                               const float scalar,
+                                                               const lv_32fc_t phase_inc,
+                                                               lv_32fc_t* phase,
+                                                               unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const int16_t* inPtr = (const int16_t*)inVector;
+    lv_32fc_t* cPtr = outVector;
+    lv_32fc_t incr = 1;
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_Ptr[4] = { (*phase), (*phase), (*phase), (*phase) };
+    unsigned int i, j;
+
+    for (i = 0; i < 4; ++i) {
+        phase_Ptr[i] *= incr;
+        incr *= phase_inc;
+    }
+
+    const __m256 scale_Val = _mm256_set1_ps(iScalar);
+    const __m256 inc_Val = _mm256_setr_ps(lv_creal(incr),
+                                          lv_cimag(incr),
+                                          lv_creal(incr),
+                                          lv_cimag(incr),
+                                          lv_creal(incr),
+                                          lv_cimag(incr),
+                                          lv_creal(incr),
+                                          lv_cimag(incr));
+    __m256 phase_Val = _mm256_load_ps((float*)phase_Ptr);
+    __m256 aVal;
+
+    const unsigned int quarter_points = num_points / 4;
+    for (i = 0; i < quarter_points; i += ROTATOR_RELOAD_4) {
+        const unsigned int block = (quarter_points - i < ROTATOR_RELOAD_4)
+                                       ? quarter_points - i
+                                       : ROTATOR_RELOAD_4;
+        for (j = 0; j < block; ++j) {
+            aVal = _mm256_cvtepi32_ps(
+                _mm256_cvtepi16_epi32(_mm_load_si128((const __m128i*)inPtr)));
+            aVal = _mm256_mul_ps(aVal, scale_Val);
+
+            _mm256_store_ps((float*)cPtr, _mm256_complexmul_ps(aVal, phase_Val));
+            phase_Val = _mm256_complexmul_ps(phase_Val, inc_Val);
+
+            inPtr += 8;
+            cPtr += 4;
+        }
+        // renormalize so rounding errors do not change the magnitude
+        phase_Val = _mm256_normalize_ps(phase_Val);
+    }
+
+    _mm256_store_ps((float*)phase_Ptr, phase_Val);
+
+    for (i = 0; i < num_points % 4; ++i) {
+        const lv_32fc_t sample =
+            lv_cmake((float)inPtr[0] * iScalar, (float)inPtr[1] * iScalar);
+        *cPtr++ = sample * phase_Ptr[0];
+        phase_Ptr[0] *= phase_inc;
+        inPtr += 2;
+    }
+
+    (*phase) = phase_Ptr[0];
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#endif /* INCLUDED_volk_16ic_s32f_s32fc_x2_rotator_32fc_a_H */
+
+#ifndef INCLUDED_volk_16ic_s32f_s32fc_x2_rotator_32fc_u_H
+#define INCLUDED_volk_16ic_s32f_s32fc_x2_rotator_32fc_u_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <volk/volk_32fc_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void
+volk_16ic_s32f_s32fc_x2_rotator_32fc_u_sse4_1(lv_32fc_t* outVector,
+                                              const lv_16sc_t* inVector,
+                                              const float scalar,
+                                              const lv_32fc_t phase_inc,
+                                              lv_32fc_t* phase,
+                                              unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const int16_t* inPtr = (const int16_t*)inVector;
+    lv_32fc_t* cPtr = outVector;
+    lv_32fc_t incr = 1;
+    lv_32fc_t phase_Ptr[2] = { (*phase), (*phase) };
+    unsigned int i, j;
+
+    for (i = 0; i < 2; ++i) {
+        phase_Ptr[i] *= incr;
+        incr *= phase_inc;
+    }
+
+    const __m128 scale_Val = _mm_set1_ps(iScalar);
+    const __m128 inc_Val =
+        _mm_setr_ps(lv_creal(incr), lv_cimag(incr), lv_creal(incr), lv_cimag(incr));
+    __m128 phase_Val = _mm_loadu_ps((float*)phase_Ptr);
+    __m128 aVal, tmp;
+
+    const unsigned int half_points = num_points / 2;
+    for (i = 0; i < half_points; i += ROTATOR_RELOAD_2) {
+        const unsigned int block =
+            (half_points - i < ROTATOR_RELOAD_2) ? half_points - i : ROTATOR_RELOAD_2;
+        for (j = 0; j < block; ++j) {
+            aVal = _mm_cvtepi32_ps(
+                _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)inPtr)));
+            aVal = _mm_mul_ps(aVal, scale_Val);
+
+            _mm_storeu_ps((float*)cPtr, _mm_complexmul_ps(aVal, phase_Val));
+            phase_Val = _mm_complexmul_ps(phase_Val, inc_Val);
+
+            inPtr += 4;
+            cPtr += 2;
+        }
+        // renormalize so rounding errors do not change the magnitude
+        tmp = _mm_mul_ps(phase_Val, phase_Val);
+        tmp = _mm_hadd_ps(tmp, tmp);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0xD8);
+        phase_Val = _mm_div_ps(phase_Val, _mm_sqrt_ps(tmp));
+    }
+
+    _mm_storeu_ps((float*)phase_Ptr, phase_Val);
+
+    for (i = 0; i < num_points % 2; ++i) {
+        const lv_32fc_t sample =
+            lv_cmake((float)inPtr[0] * iScalar, (float)inPtr[1] * iScalar);
+        *cPtr++ = sample * phase_Ptr[0];
+        phase_Ptr[0] *= phase_inc;
+        inPtr += 2;
+    }
+
+    (*phase) = phase_Ptr[0];
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_16ic_s32f_s32fc_x2_rotator_32fc_u_avx2(lv_32fc_t* outVector,
+                                                               const lv_16sc_t* inVector,
+                                                               const float scalar,
+                                                               const lv_32fc_t phase_inc,
+                                                               lv_32fc_t* phase,
+                                                               unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const int16_t* inPtr = (const int16_t*)inVector;
+    lv_32fc_t* cPtr = outVector;
+    lv_32fc_t incr = 1;
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_Ptr[4] = { (*phase), (*phase), (*phase), (*phase) };
+    unsigned int i, j;
+
+    for (i = 0; i < 4; ++i) {
+        phase_Ptr[i] *= incr;
+        incr *= phase_inc;
+    }
+
+    const __m256 scale_Val = _mm256_set1_ps(iScalar);
+    const __m256 inc_Val = _mm256_setr_ps(lv_creal(incr),
+                                          lv_cimag(incr),
+                                          lv_creal(incr),
+                                          lv_cimag(incr),
+                                          lv_creal(incr),
+                                          lv_cimag(incr),
+                                          lv_creal(incr),
+                                          lv_cimag(incr));
+    __m256 phase_Val = _mm256_loadu_ps((float*)phase_Ptr);
+    __m256 aVal;
+
+    const unsigned int quarter_points = num_points / 4;
+    for (i = 0; i < quarter_points; i += ROTATOR_RELOAD_4) {
+        const unsigned int block = (quarter_points - i < ROTATOR_RELOAD_4)
+                                       ? quarter_points - i
+                                       : ROTATOR_RELOAD_4;
+        for (j = 0; j < block; ++j) {
+            aVal = _mm256_cvtepi32_ps(
+                _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)inPtr)));
+            aVal = _mm256_mul_ps(aVal, scale_Val);
+
+            _mm256_storeu_ps((float*)cPtr, _mm256_complexmul_ps(aVal, phase_Val));
+            phase_Val = _mm256_complexmul_ps(phase_Val, inc_Val);
+
+            inPtr += 8;
+            cPtr += 4;
+        }
+        // renormalize so rounding errors do not change the magnitude
+        phase_Val = _mm256_normalize_ps(phase_Val);
+    }
+
+    _mm256_storeu_ps((float*)phase_Ptr, phase_Val);
+
+    for (i = 0; i < num_points % 4; ++i) {
+        const lv_32fc_t sample =
+            lv_cmake((float)inPtr[0] * iScalar, (float)inPtr[1] * iScalar);
+        *cPtr++ = sample * phase_Ptr[0];
+        phase_Ptr[0] *= phase_inc;
+        inPtr += 2;
+    }
+
+    (*phase) = phase_Ptr[0];
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_16ic_s32f_s32fc_x2_rotator_32fc_neon(lv_32fc_t* outVector,
+                                                             const lv_16sc_t* inVector,
+                                                             const float scalar,
+                                                             const lv_32fc_t phase_inc,
+                                                             lv_32fc_t* phase,
+                                                             unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const int16_t* inPtr = (const int16_t*)inVector;
+    lv_32fc_t* cPtr = outVector;
+    lv_32fc_t incr = 1;
+    lv_32fc_t phase_Ptr[4] = { (*phase), (*phase), (*phase), (*phase) };
+    unsigned int i, j;
+
+    for (i = 0; i < 4; ++i) {
+        phase_Ptr[i] *= incr;
+        incr *= phase_inc;
+    }
+
+    const lv_32fc_t incr_Ptr[4] = { incr, incr, incr, incr };
+    const float32x4x2_t incr_vec = vld2q_f32((float*)incr_Ptr);
+    float32x4x2_t phase_vec = vld2q_f32((float*)phase_Ptr);
+    float32x4x2_t input_vec;
+
+    const unsigned int quarter_points = num_points / 4;
+    for (i = 0; i < quarter_points; i += ROTATOR_RELOAD_4) {
+        const unsigned int block = (quarter_points - i < ROTATOR_RELOAD_4)
+                                       ? quarter_points - i
+                                       : ROTATOR_RELOAD_4;
+        for (j = 0; j < block; ++j) {
+            const int16x4x2_t iVal = vld2_s16(inPtr);
+            input_vec.val[0] = vcvtq_f32_s32(vmovl_s16(iVal.val[0]));
+            input_vec.val[1] = vcvtq_f32_s32(vmovl_s16(iVal.val[1]));
+            input_vec.val[0] = vmulq_n_f32(input_vec.val[0], iScalar);
+            input_vec.val[1] = vmulq_n_f32(input_vec.val[1], iScalar);
+
+            vst2q_f32((float*)cPtr, _vmultiply_complexq_f32(input_vec, phase_vec));
+            phase_vec = _vmultiply_complexq_f32(phase_vec, incr_vec);
+
+            inPtr += 8;
+            cPtr += 4;
+        }
+        // renormalize so rounding errors do not change the magnitude
+        const float32x4_t inv_mag = _vinvsqrtq_f32(_vmagnitudesquaredq_f32(phase_vec));
+        phase_vec.val[0] = vmulq_f32(phase_vec.val[0], inv_mag);
+        phase_vec.val[1] = vmulq_f32(phase_vec.val[1], inv_mag);
+    }
+
+    vst2q_f32((float*)phase_Ptr, phase_vec);
+
+    for (i = 0; i < num_points % 4; ++i) {
+        const lv_32fc_t sample =
+            lv_cmake((float)inPtr[0] * iScalar, (float)inPtr[1] * iScalar);
+        *cPtr++ = sample * phase_Ptr[0];
+        phase_Ptr[0] *= phase_inc;
+        inPtr += 2;
+    }
+
+    (*phase) = phase_Ptr[0];
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16ic_s32f_s32fc_x2_rotator_32fc_u_H */
@@ -0,0 +1,119 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_16ic_s32fc_rotatorpuppet_32fc_H
+#define INCLUDED_volk_16ic_s32fc_rotatorpuppet_32fc_H
+
+#include <math.h>
+#include <volk/volk_16ic_s32f_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_s32fc_rotatorpuppet_32fc_generic(lv_32fc_t* outVector,
+                                                              const lv_16sc_t* inVector,
+                                                              const lv_32fc_t phase_inc,
+                                                              unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_16ic_s32f_s32fc_x2_rotator_32fc_generic(
+        outVector, inVector, 32768.f, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_16ic_s32fc_rotatorpuppet_32fc_neon(lv_32fc_t* outVector,
+                                                           const lv_16sc_t* inVector,
+                                                           const lv_32fc_t phase_inc,
+                                                           unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_16ic_s32f_s32fc_x2_rotator_32fc_neon(
+        outVector, inVector, 32768.f, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#ifdef LV_HAVE_SSE4_1
+
+static inline void volk_16ic_s32fc_rotatorpuppet_32fc_a_sse4_1(lv_32fc_t* outVector,
+                                                               const lv_16sc_t* inVector,
+                                                               const lv_32fc_t phase_inc,
+                                                               unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_16ic_s32f_s32fc_x2_rotator_32fc_a_sse4_1(
+        outVector, inVector, 32768.f, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+#ifdef LV_HAVE_SSE4_1
+
+static inline void volk_16ic_s32fc_rotatorpuppet_32fc_u_sse4_1(lv_32fc_t* outVector,
+                                                               const lv_16sc_t* inVector,
+                                                               const lv_32fc_t phase_inc,
+                                                               unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_16ic_s32f_s32fc_x2_rotator_32fc_u_sse4_1(
+        outVector, inVector, 32768.f, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_16ic_s32fc_rotatorpuppet_32fc_a_avx2(lv_32fc_t* outVector,
+                                                             const lv_16sc_t* inVector,
+                                                             const lv_32fc_t phase_inc,
+                                                             unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_16ic_s32f_s32fc_x2_rotator_32fc_a_avx2(
+        outVector, inVector, 32768.f, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_16ic_s32fc_rotatorpuppet_32fc_u_avx2(lv_32fc_t* outVector,
+                                                             const lv_16sc_t* inVector,
+                                                             const lv_32fc_t phase_inc,
+                                                             unsigned int num_points)
+{
+    lv_32fc_t phase[1] = { lv_cmake(.3f, .95393f) };
+    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    const lv_32fc_t phase_inc_n =
+        phase_inc / hypotf(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_16ic_s32f_s32fc_x2_rotator_32fc_u_avx2(
+        outVector, inVector, 32768.f, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#endif /* INCLUDED_volk_16ic_s32fc_rotatorpuppet_32fc_H */
@@ -0,0 +1,236 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_16f_x2_multiply_add_32f
+ *
+ * \b Overview
+ *
+ * Multiplies two vectors of half precision floats and adds the products to a
+ * vector of floats:
+ *
+ * outputVector[i] = addVector[i] + aVector[i] * bVector[i]
+ *
+ * The products and sums are computed in single precision; the SIMD versions use
+ * fused multiply-adds. outputVector may be addVector, to accumulate in place.
+ *
+ * The 16 bit values are IEEE 754 half precision floats (binary16) held in
+ * uint16_t, see volk/volk_float16.h.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_16f_x2_multiply_add_32f(float* outputVector, const float* addVector,
+ *                                       const uint16_t* aVector,
+ *                                       const uint16_t* bVector,
+ *                                       unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li addVector: The floats the products are added to.
+ * \li aVector: The first vector of half precision factors.
+ * \li bVector: The second vector of half precision factors.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The sums.
+ *
+ * \b Example
+ * Accumulate the products of stored half precision vectors.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* acc = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   uint16_t* a = (uint16_t*)volk_malloc(sizeof(uint16_t) * N, alignment);
+ *   uint16_t* b = (uint16_t*)volk_malloc(sizeof(uint16_t) * N, alignment);
+ *
+ *   // fill in
+ *
+ *   volk_32f_16f_x2_multiply_add_32f(acc, acc, a, b, N);
+ *
+ *   volk_free(acc);
+ *   volk_free(a);
+ *   volk_free(b);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_16f_x2_multiply_add_32f_a_H
+#define INCLUDED_volk_32f_16f_x2_multiply_add_32f_a_H
+
+#include <inttypes.h>
+#include <volk/volk_float16.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_16f_x2_multiply_add_32f_generic(float* outputVector,
+                                                            const float* addVector,
+                                                            const uint16_t* aVector,
+                                                            const uint16_t* bVector,
+                                                            unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        outputVector[number] = addVector[number] + volk_16f_to_32f(aVector[number]) *
+                                                       volk_16f_to_32f(bVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_F16C && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_16f_x2_multiply_add_32f_a_f16c_fma(float* outputVector,
+                                                               const float* addVector,
+                                                               const uint16_t* aVector,
+                                                               const uint16_t* bVector,
+                                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const __m256 a =
+            _mm256_cvtph_ps(_mm_load_si128((const __m128i*)(aVector + number)));
+        const __m256 b =
+            _mm256_cvtph_ps(_mm_load_si128((const __m128i*)(bVector + number)));
+        _mm256_store_ps(outputVector + number,
+                        _mm256_fmadd_ps(a, b, _mm256_load_ps(addVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = addVector[number] + volk_16f_to_32f(aVector[number]) *
+                                                       volk_16f_to_32f(bVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_F16C && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_16f_x2_multiply_add_32f_a_avx512f(float* outputVector,
+                                                              const float* addVector,
+                                                              const uint16_t* aVector,
+                                                              const uint16_t* bVector,
+                                                              unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m512 a =
+            _mm512_cvtph_ps(_mm256_load_si256((const __m256i*)(aVector + number)));
+        const __m512 b =
+            _mm512_cvtph_ps(_mm256_load_si256((const __m256i*)(bVector + number)));
+        _mm512_store_ps(outputVector + number,
+                        _mm512_fmadd_ps(a, b, _mm512_load_ps(addVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = addVector[number] + volk_16f_to_32f(aVector[number]) *
+                                                       volk_16f_to_32f(bVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32f_16f_x2_multiply_add_32f_a_H */
+
+#ifndef INCLUDED_volk_32f_16f_x2_multiply_add_32f_u_H
+#define INCLUDED_volk_32f_16f_x2_multiply_add_32f_u_H
+
+#include <inttypes.h>
+#include <volk/volk_float16.h>
+
+#if LV_HAVE_F16C && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_16f_x2_multiply_add_32f_u_f16c_fma(float* outputVector,
+                                                               const float* addVector,
+                                                               const uint16_t* aVector,
+                                                               const uint16_t* bVector,
+                                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const __m256 a =
+            _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(aVector + number)));
+        const __m256 b =
+            _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(bVector + number)));
+        _mm256_storeu_ps(outputVector + number,
+                        _mm256_fmadd_ps(a, b, _mm256_loadu_ps(addVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = addVector[number] + volk_16f_to_32f(aVector[number]) *
+                                                       volk_16f_to_32f(bVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_F16C && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_16f_x2_multiply_add_32f_u_avx512f(float* outputVector,
+                                                              const float* addVector,
+                                                              const uint16_t* aVector,
+                                                              const uint16_t* bVector,
+                                                              unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m512 a =
+            _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(aVector + number)));
+        const __m512 b =
+            _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(bVector + number)));
+        _mm512_storeu_ps(outputVector + number,
+                        _mm512_fmadd_ps(a, b, _mm512_loadu_ps(addVector + number)));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = addVector[number] + volk_16f_to_32f(aVector[number]) *
+                                                       volk_16f_to_32f(bVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_16f_x2_multiply_add_32f_neonv8(float* outputVector,
+                                                           const float* addVector,
+                                                           const uint16_t* aVector,
+                                                           const uint16_t* bVector,
+                                                           unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    unsigned int number = 0;
+
+    for (; number < quarterPoints * 4; number += 4) {
+        const float32x4_t a =
+            vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(aVector + number)));
+        const float32x4_t b =
+            vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(bVector + number)));
+        vst1q_f32(outputVector + number, vfmaq_f32(vld1q_f32(addVector + number), a, b));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = addVector[number] + volk_16f_to_32f(aVector[number]) *
+                                                       volk_16f_to_32f(bVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_16f_x2_multiply_add_32f_u_H */
@@ -0,0 +1,266 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_convert_16bf
+ *
+ * \b Overview
+ *
+ * Converts floats into bfloat16 values, rounding to nearest even.
+ *
+ * The 16 bit values are bfloat16, the upper half of a float, held in
+ * uint16_t, see volk/volk_float16.h.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_convert_16bf(uint16_t* outputVector, const float* inputVector,
+ *                            unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The floats.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The bfloat16 values.
+ *
+ * \b Example
+ * Store samples as bfloat16.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   uint16_t* out = (uint16_t*)volk_malloc(sizeof(uint16_t) * N, alignment);
+ *
+ *   // fill in
+ *
+ *   volk_32f_convert_16bf(out, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_convert_16bf_a_H
+#define INCLUDED_volk_32f_convert_16bf_a_H
+
+#include <inttypes.h>
+#include <volk/volk_float16.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_convert_16bf_generic(uint16_t* outputVector,
+                                                 const float* inputVector,
+                                                 unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        outputVector[number] = volk_32f_to_16bf(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16bf_a_avx2(uint16_t* outputVector,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m256i absMask = _mm256_set1_epi32(0x7fffffff);
+    const __m256i infinity = _mm256_set1_epi32(0x7f800000);
+    const __m256i quietBit = _mm256_set1_epi32(0x00400000);
+    const __m256i roundingBias = _mm256_set1_epi32(0x7fff);
+    const __m256i one = _mm256_set1_epi32(1);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        __m256i halves[2];
+        for (int i = 0; i < 2; i++) {
+            const __m256i bits = _mm256_castps_si256(
+                _mm256_load_ps(inputVector + number + 8 * i));
+            // round to nearest even, NaNs only get the quiet bit
+            const __m256i isNan =
+                _mm256_cmpgt_epi32(_mm256_and_si256(bits, absMask), infinity);
+            const __m256i bias = _mm256_add_epi32(
+                roundingBias, _mm256_and_si256(_mm256_srli_epi32(bits, 16), one));
+            const __m256i rounded = _mm256_blendv_epi8(_mm256_add_epi32(bits, bias),
+                                                       _mm256_or_si256(bits, quietBit),
+                                                       isNan);
+            halves[i] = _mm256_srli_epi32(rounded, 16);
+        }
+        // packus interleaves the 128 bit lanes of its inputs
+        const __m256i out = _mm256_permute4x64_epi64(
+            _mm256_packus_epi32(halves[0], halves[1]), 0xd8);
+        _mm256_store_si256((__m256i*)(outputVector + number), out);
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_32f_to_16bf(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16bf_a_avx512f(uint16_t* outputVector,
+                                                   const float* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i absMask = _mm512_set1_epi32(0x7fffffff);
+    const __m512i infinity = _mm512_set1_epi32(0x7f800000);
+    const __m512i quietBit = _mm512_set1_epi32(0x00400000);
+    const __m512i roundingBias = _mm512_set1_epi32(0x7fff);
+    const __m512i one = _mm512_set1_epi32(1);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m512i bits = _mm512_castps_si512(_mm512_load_ps(inputVector + number));
+        // round to nearest even, NaNs only get the quiet bit
+        const __mmask16 isNan =
+            _mm512_cmpgt_epi32_mask(_mm512_and_si512(bits, absMask), infinity);
+        const __m512i bias = _mm512_add_epi32(
+            roundingBias, _mm512_and_si512(_mm512_srli_epi32(bits, 16), one));
+        const __m512i rounded = _mm512_mask_blend_epi32(
+            isNan, _mm512_add_epi32(bits, bias), _mm512_or_si512(bits, quietBit));
+        _mm256_store_si256((__m256i*)(outputVector + number),
+                           _mm512_cvtepi32_epi16(_mm512_srli_epi32(rounded, 16)));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_32f_to_16bf(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32f_convert_16bf_a_H */
+
+#ifndef INCLUDED_volk_32f_convert_16bf_u_H
+#define INCLUDED_volk_32f_convert_16bf_u_H
+
+#include <inttypes.h>
+#include <volk/volk_float16.h>
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16bf_u_avx2(uint16_t* outputVector,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m256i absMask = _mm256_set1_epi32(0x7fffffff);
+    const __m256i infinity = _mm256_set1_epi32(0x7f800000);
+    const __m256i quietBit = _mm256_set1_epi32(0x00400000);
+    const __m256i roundingBias = _mm256_set1_epi32(0x7fff);
+    const __m256i one = _mm256_set1_epi32(1);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        __m256i halves[2];
+        for (int i = 0; i < 2; i++) {
+            const __m256i bits = _mm256_castps_si256(
+                _mm256_loadu_ps(inputVector + number + 8 * i));
+            // round to nearest even, NaNs only get the quiet bit
+            const __m256i isNan =
+                _mm256_cmpgt_epi32(_mm256_and_si256(bits, absMask), infinity);
+            const __m256i bias = _mm256_add_epi32(
+                roundingBias, _mm256_and_si256(_mm256_srli_epi32(bits, 16), one));
+            const __m256i rounded = _mm256_blendv_epi8(_mm256_add_epi32(bits, bias),
+                                                       _mm256_or_si256(bits, quietBit),
+                                                       isNan);
+            halves[i] = _mm256_srli_epi32(rounded, 16);
+        }
+        // packus interleaves the 128 bit lanes of its inputs
+        const __m256i out = _mm256_permute4x64_epi64(
+            _mm256_packus_epi32(halves[0], halves[1]), 0xd8);
+        _mm256_storeu_si256((__m256i*)(outputVector + number), out);
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_32f_to_16bf(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16bf_u_avx512f(uint16_t* outputVector,
+                                                   const float* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i absMask = _mm512_set1_epi32(0x7fffffff);
+    const __m512i infinity = _mm512_set1_epi32(0x7f800000);
+    const __m512i quietBit = _mm512_set1_epi32(0x00400000);
+    const __m512i roundingBias = _mm512_set1_epi32(0x7fff);
+    const __m512i one = _mm512_set1_epi32(1);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m512i bits = _mm512_castps_si512(_mm512_loadu_ps(inputVector + number));
+        // round to nearest even, NaNs only get the quiet bit
+        const __mmask16 isNan =
+            _mm512_cmpgt_epi32_mask(_mm512_and_si512(bits, absMask), infinity);
+        const __m512i bias = _mm512_add_epi32(
+            roundingBias, _mm512_and_si512(_mm512_srli_epi32(bits, 16), one));
+        const __m512i rounded = _mm512_mask_blend_epi32(
+            isNan, _mm512_add_epi32(bits, bias), _mm512_or_si512(bits, quietBit));
+        _mm256_storeu_si256((__m256i*)(outputVector + number),
+                           _mm512_cvtepi32_epi16(_mm512_srli_epi32(rounded, 16)));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_32f_to_16bf(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_convert_16bf_neon(uint16_t* outputVector,
+                                              const float* inputVector,
+                                              unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const uint32x4_t absMask = vdupq_n_u32(0x7fffffff);
+    const uint32x4_t infinity = vdupq_n_u32(0x7f800000);
+    const uint32x4_t quietBit = vdupq_n_u32(0x00400000);
+    const uint32x4_t roundingBias = vdupq_n_u32(0x7fff);
+    const uint32x4_t one = vdupq_n_u32(1);
+    unsigned int number = 0;
+
+    for (; number < quarterPoints * 4; number += 4) {
+        const uint32x4_t bits = vreinterpretq_u32_f32(vld1q_f32(inputVector + number));
+        // round to nearest even, NaNs only get the quiet bit
+        const uint32x4_t isNan = vcgtq_u32(vandq_u32(bits, absMask), infinity);
+        const uint32x4_t bias =
+            vaddq_u32(roundingBias, vandq_u32(vshrq_n_u32(bits, 16), one));
+        const uint32x4_t rounded =
+            vbslq_u32(isNan, vorrq_u32(bits, quietBit), vaddq_u32(bits, bias));
+        vst1_u16(outputVector + number, vshrn_n_u32(rounded, 16));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_32f_to_16bf(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_convert_16bf_u_H */
@@ -0,0 +1,194 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_convert_16f
+ *
+ * \b Overview
+ *
+ * Converts floats into half precision floats, rounding to nearest even. Values
+ * beyond the half precision range become infinities.
+ *
+ * The 16 bit values are IEEE 754 half precision floats (binary16) held in
+ * uint16_t, see volk/volk_float16.h.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_convert_16f(uint16_t* outputVector, const float* inputVector,
+ *                           unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The floats.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outputVector: The half precision floats.
+ *
+ * \b Example
+ * Store FIR taps in half precision.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   uint16_t* out = (uint16_t*)volk_malloc(sizeof(uint16_t) * N, alignment);
+ *
+ *   // fill in
+ *
+ *   volk_32f_convert_16f(out, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_convert_16f_a_H
+#define INCLUDED_volk_32f_convert_16f_a_H
+
+#include <inttypes.h>
+#include <volk/volk_float16.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_convert_16f_generic(uint16_t* outputVector,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        outputVector[number] = volk_32f_to_16f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_F16C
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16f_a_f16c(uint16_t* outputVector,
+                                               const float* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const __m256 in = _mm256_load_ps(inputVector + number);
+        _mm_store_si128((__m128i*)(outputVector + number),
+                        _mm256_cvtps_ph(in, _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_32f_to_16f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_F16C */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16f_a_avx512f(uint16_t* outputVector,
+                                                  const float* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m512 in = _mm512_load_ps(inputVector + number);
+        _mm256_store_si256((__m256i*)(outputVector + number),
+                           _mm512_cvtps_ph(in, _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_32f_to_16f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32f_convert_16f_a_H */
+
+#ifndef INCLUDED_volk_32f_convert_16f_u_H
+#define INCLUDED_volk_32f_convert_16f_u_H
+
+#include <inttypes.h>
+#include <volk/volk_float16.h>
+
+#ifdef LV_HAVE_F16C
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16f_u_f16c(uint16_t* outputVector,
+                                               const float* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const __m256 in = _mm256_loadu_ps(inputVector + number);
+        _mm_storeu_si128((__m128i*)(outputVector + number),
+                        _mm256_cvtps_ph(in, _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_32f_to_16f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_F16C */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16f_u_avx512f(uint16_t* outputVector,
+                                                  const float* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m512 in = _mm512_loadu_ps(inputVector + number);
+        _mm256_storeu_si256((__m256i*)(outputVector + number),
+                           _mm512_cvtps_ph(in, _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_32f_to_16f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_convert_16f_neonv8(uint16_t* outputVector,
+                                               const float* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const float16x4_t low = vcvt_f16_f32(vld1q_f32(inputVector + number));
+        const float16x4_t high = vcvt_f16_f32(vld1q_f32(inputVector + number + 4));
+        vst1q_u16(outputVector + number,
+                  vcombine_u16(vreinterpret_u16_f16(low), vreinterpret_u16_f16(high)));
+    }
+
+    for (; number < num_points; number++) {
+        outputVector[number] = volk_32f_to_16f(inputVector[number]);
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_convert_16f_u_H */
@@ -0,0 +1,132 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_index_max_64u
+ *
+ * \b Overview
+ *
+ * Returns Argmax_i x[i]. Finds and returns the index which contains the first maximum
+ * value in the given vector. Unlike volk_32f_index_max_32u(), the index and the
+ * number of points are 64 bits wide, for vectors of 2^32 points and more.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_index_max_64u(uint64_t* target, const float* src0, uint64_t num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li src0: The input vector of floats.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li target: The index of the first maximum value in the input buffer.
+ *
+ * \b Example
+ * \code
+ *   int N = 10;
+ *   uint32_t alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint64_t index;
+ *
+ *   for(uint32_t ii = 0; ii < N; ++ii){
+ *       float x = (float)ii;
+ *       // a parabola with a maximum at x=4
+ *       in[ii] = -(x-4) * (x-4) + 5;
+ *   }
+ *
+ *   volk_32f_index_max_64u(&index, in, N);
+ *
+ *   printf("maximum is %1.2f at index %" PRIu64 "\n", in[index], index);
+ *
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_index_max_64u_a_H
+#define INCLUDED_volk_32f_index_max_64u_a_H
+
+#include <inttypes.h>
+#include <volk/volk_32f_index_max_and_value_64u_32f.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32f_index_max_64u_generic(uint64_t* target,
+                                                  const float* src0,
+                                                  uint64_t num_points)
+{
+    float value;
+    volk_32f_index_max_and_value_64u_32f_generic(target, &value, src0, num_points);
+}
+
+#endif /*LV_HAVE_GENERIC*/
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_32f_index_max_64u_a_avx2(uint64_t* target,
+                                                 const float* src0,
+                                                 uint64_t num_points)
+{
+    float value;
+    volk_32f_index_max_and_value_64u_32f_a_avx2(target, &value, src0, num_points);
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32f_index_max_64u_a_avx512f(uint64_t* target,
+                                                    const float* src0,
+                                                    uint64_t num_points)
+{
+    float value;
+    volk_32f_index_max_and_value_64u_32f_a_avx512f(target, &value, src0, num_points);
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
+#endif /*INCLUDED_volk_32f_index_max_64u_a_H*/
+
+#ifndef INCLUDED_volk_32f_index_max_64u_u_H
+#define INCLUDED_volk_32f_index_max_64u_u_H
+
+#include <inttypes.h>
+#include <volk/volk_32f_index_max_and_value_64u_32f.h>
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_32f_index_max_64u_u_avx2(uint64_t* target,
+                                                 const float* src0,
+                                                 uint64_t num_points)
+{
+    float value;
+    volk_32f_index_max_and_value_64u_32f_u_avx2(target, &value, src0, num_points);
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_32f_index_max_64u_u_avx512f(uint64_t* target,
+                                                    const float* src0,
+                                                    uint64_t num_points)
+{
+    float value;
+    volk_32f_index_max_and_value_64u_32f_u_avx512f(target, &value, src0, num_points);
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
+#ifdef LV_HAVE_NEON
+static inline void volk_32f_index_max_64u_neon(uint64_t* target,
+                                               const float* src0,
+                                               uint64_t num_points)
+{
+    float value;
+    volk_32f_index_max_and_value_64u_32f_neon(target, &value, src0, num_points);
+}
+
+#endif /*LV_HAVE_NEON*/
+
+#endif /*INCLUDED_volk_32f_index_max_64u_u_H*/
@@ -0,0 +1,435 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_index_max_and_value_64u_32f
+ *
+ * \b Overview
+ *
+ * Returns Argmax_i x[i] and the maximum itself. Finds the index which contains the
+ * first maximum value in the given vector, like volk_32f_index_max_64u(), and also
+ * returns that value so the caller does not have to read it back from the input.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_index_max_and_value_64u_32f(uint64_t* target, float* value,
+ *                                           const float* src0, uint64_t num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li src0: The input vector of floats.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li target: The index of the first maximum value in the input buffer.
+ * \li value: The maximum value, src0[*target].
+ *
+ * \b Example
+ * \code
+ *   int N = 10;
+ *   uint32_t alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   uint64_t index;
+ *   float peak;
+ *
+ *   for(uint32_t ii = 0; ii < N; ++ii){
+ *       float x = (float)ii;
+ *       // a parabola with a maximum at x=4
+ *       in[ii] = -(x-4) * (x-4) + 5;
+ *   }
+ *
+ *   volk_32f_index_max_and_value_64u_32f(&index, &peak, in, N);
+ *
+ *   printf("maximum is %1.2f at index %" PRIu64 "\n", peak, index);
+ *
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_index_max_and_value_64u_32f_a_H
+#define INCLUDED_volk_32f_index_max_and_value_64u_32f_a_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+// The vector loops keep 32-bit lane indices, restarted every block of this many points
+#ifndef VOLK_INDEX_64U_BLOCK_POINTS
+#define VOLK_INDEX_64U_BLOCK_POINTS (UINT64_C(1) << 31)
+#endif
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32f_index_max_and_value_64u_32f_generic(uint64_t* target,
+                                                                float* value,
+                                                                const float* src0,
+                                                                uint64_t num_points)
+{
+    if (num_points > 0) {
+        float max = src0[0];
+        uint64_t index = 0;
+
+        for (uint64_t i = 1; i < num_points; ++i) {
+            if (src0[i] > max) {
+                index = i;
+                max = src0[i];
+            }
+        }
+        target[0] = index;
+        value[0] = max;
+    }
+}
+
+#endif /*LV_HAVE_GENERIC*/
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_index_max_and_value_64u_32f_a_avx2(uint64_t* target,
+                                                               float* value,
+                                                               const float* src0,
+                                                               uint64_t num_points)
+{
+    if (num_points > 0) {
+        const uint64_t vectorPoints = num_points - num_points % 8;
+        const __m256i indexIncrementValues = _mm256_set1_epi32(8);
+        __VOLK_ATTR_ALIGNED(32) float maxValuesBuffer[8];
+        __VOLK_ATTR_ALIGNED(32) uint32_t maxIndexesBuffer[8];
+
+        float max = src0[0];
+        uint64_t index = 0;
+
+        for (uint64_t block = 0; block < vectorPoints;
+             block += VOLK_INDEX_64U_BLOCK_POINTS) {
+            uint64_t blockPoints = vectorPoints - block;
+            if (blockPoints > VOLK_INDEX_64U_BLOCK_POINTS) {
+                blockPoints = VOLK_INDEX_64U_BLOCK_POINTS;
+            }
+            const float* inputPtr = src0 + block;
+            __m256 maxValues = _mm256_set1_ps(max);
+            __m256i maxValuesIndex = _mm256_setzero_si256();
+            __m256i currentIndexes = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+            for (uint64_t number = 0; number < blockPoints; number += 8) {
+                const __m256 currentValues = _mm256_load_ps(inputPtr);
+                inputPtr += 8;
+                const __m256 compareResults =
+                    _mm256_cmp_ps(currentValues, maxValues, _CMP_GT_OS);
+                maxValuesIndex = _mm256_castps_si256(
+                    _mm256_blendv_ps(_mm256_castsi256_ps(maxValuesIndex),
+                                     _mm256_castsi256_ps(currentIndexes),
+                                     compareResults));
+                maxValues = _mm256_blendv_ps(maxValues, currentValues, compareResults);
+                currentIndexes = _mm256_add_epi32(currentIndexes, indexIncrementValues);
+            }
+
+            // the first of the maxima of the lanes, as an index into src0
+            _mm256_store_ps(maxValuesBuffer, maxValues);
+            _mm256_store_si256((__m256i*)maxIndexesBuffer, maxValuesIndex);
+            for (int i = 0; i < 8; i++) {
+                const uint64_t candidate = block + maxIndexesBuffer[i];
+                if (maxValuesBuffer[i] > max ||
+                    (maxValuesBuffer[i] == max && candidate < index)) {
+                    max = maxValuesBuffer[i];
+                    index = candidate;
+                }
+            }
+        }
+
+        for (uint64_t number = vectorPoints; number < num_points; number++) {
+            if (src0[number] > max) {
+                index = number;
+                max = src0[number];
+            }
+        }
+        target[0] = index;
+        value[0] = max;
+    }
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_index_max_and_value_64u_32f_a_avx512f(uint64_t* target,
+                                                                  float* value,
+                                                                  const float* src0,
+                                                                  uint64_t num_points)
+{
+    if (num_points > 0) {
+        const uint64_t vectorPoints = num_points - num_points % 16;
+        const __m512i indexIncrementValues = _mm512_set1_epi32(16);
+        __VOLK_ATTR_ALIGNED(64) float maxValuesBuffer[16];
+        __VOLK_ATTR_ALIGNED(64) uint32_t maxIndexesBuffer[16];
+
+        float max = src0[0];
+        uint64_t index = 0;
+
+        for (uint64_t block = 0; block < vectorPoints;
+             block += VOLK_INDEX_64U_BLOCK_POINTS) {
+            uint64_t blockPoints = vectorPoints - block;
+            if (blockPoints > VOLK_INDEX_64U_BLOCK_POINTS) {
+                blockPoints = VOLK_INDEX_64U_BLOCK_POINTS;
+            }
+            const float* inputPtr = src0 + block;
+            __m512 maxValues = _mm512_set1_ps(max);
+            __m512i maxValuesIndex = _mm512_setzero_si512();
+            __m512i currentIndexes =
+                _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+            for (uint64_t number = 0; number < blockPoints; number += 16) {
+                const __m512 currentValues = _mm512_load_ps(inputPtr);
+                inputPtr += 16;
+                const __mmask16 compareResults =
+                    _mm512_cmp_ps_mask(currentValues, maxValues, _CMP_GT_OS);
+                maxValuesIndex = _mm512_mask_blend_epi32(
+                    compareResults, maxValuesIndex, currentIndexes);
+                maxValues =
+                    _mm512_mask_blend_ps(compareResults, maxValues, currentValues);
+                currentIndexes = _mm512_add_epi32(currentIndexes, indexIncrementValues);
+            }
+
+            // the first of the maxima of the lanes, as an index into src0
+            _mm512_store_ps(maxValuesBuffer, maxValues);
+            _mm512_store_si512((__m512i*)maxIndexesBuffer, maxValuesIndex);
+            for (int i = 0; i < 16; i++) {
+                const uint64_t candidate = block + maxIndexesBuffer[i];
+                if (maxValuesBuffer[i] > max ||
+                    (maxValuesBuffer[i] == max && candidate < index)) {
+                    max = maxValuesBuffer[i];
+                    index = candidate;
+                }
+            }
+        }
+
+        for (uint64_t number = vectorPoints; number < num_points; number++) {
+            if (src0[number] > max) {
+                index = number;
+                max = src0[number];
+            }
+        }
+        target[0] = index;
+        value[0] = max;
+    }
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
+#endif /*INCLUDED_volk_32f_index_max_and_value_64u_32f_a_H*/
+
+#ifndef INCLUDED_volk_32f_index_max_and_value_64u_32f_u_H
+#define INCLUDED_volk_32f_index_max_and_value_64u_32f_u_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+// The vector loops keep 32-bit lane indices, restarted every block of this many points
+#ifndef VOLK_INDEX_64U_BLOCK_POINTS
+#define VOLK_INDEX_64U_BLOCK_POINTS (UINT64_C(1) << 31)
+#endif
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_index_max_and_value_64u_32f_u_avx2(uint64_t* target,
+                                                               float* value,
+                                                               const float* src0,
+                                                               uint64_t num_points)
+{
+    if (num_points > 0) {
+        const uint64_t vectorPoints = num_points - num_points % 8;
+        const __m256i indexIncrementValues = _mm256_set1_epi32(8);
+        __VOLK_ATTR_ALIGNED(32) float maxValuesBuffer[8];
+        __VOLK_ATTR_ALIGNED(32) uint32_t maxIndexesBuffer[8];
+
+        float max = src0[0];
+        uint64_t index = 0;
+
+        for (uint64_t block = 0; block < vectorPoints;
+             block += VOLK_INDEX_64U_BLOCK_POINTS) {
+            uint64_t blockPoints = vectorPoints - block;
+            if (blockPoints > VOLK_INDEX_64U_BLOCK_POINTS) {
+                blockPoints = VOLK_INDEX_64U_BLOCK_POINTS;
+            }
+            const float* inputPtr = src0 + block;
+            __m256 maxValues = _mm256_set1_ps(max);
+            __m256i maxValuesIndex = _mm256_setzero_si256();
+            __m256i currentIndexes = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+            for (uint64_t number = 0; number < blockPoints; number += 8) {
+                const __m256 currentValues = _mm256_loadu_ps(inputPtr);
+                inputPtr += 8;
+                const __m256 compareResults =
+                    _mm256_cmp_ps(currentValues, maxValues, _CMP_GT_OS);
+                maxValuesIndex = _mm256_castps_si256(
+                    _mm256_blendv_ps(_mm256_castsi256_ps(maxValuesIndex),
+                                     _mm256_castsi256_ps(currentIndexes),
+                                     compareResults));
+                maxValues = _mm256_blendv_ps(maxValues, currentValues, compareResults);
+                currentIndexes = _mm256_add_epi32(currentIndexes, indexIncrementValues);
+            }
+
+            // the first of the maxima of the lanes, as an index into src0
+            _mm256_store_ps(maxValuesBuffer, maxValues);
+            _mm256_store_si256((__m256i*)maxIndexesBuffer, maxValuesIndex);
+            for (int i = 0; i < 8; i++) {
+                const uint64_t candidate = block + maxIndexesBuffer[i];
+                if (maxValuesBuffer[i] > max ||
+                    (maxValuesBuffer[i] == max && candidate < index)) {
+                    max = maxValuesBuffer[i];
+                    index = candidate;
+                }
+            }
+        }
+
+        for (uint64_t number = vectorPoints; number < num_points; number++) {
+            if (src0[number] > max) {
+                index = number;
+                max = src0[number];
+            }
+        }
+        target[0] = index;
+        value[0] = max;
+    }
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_index_max_and_value_64u_32f_u_avx512f(uint64_t* target,
+                                                                  float* value,
+                                                                  const float* src0,
+                                                                  uint64_t num_points)
+{
+    if (num_points > 0) {
+        const uint64_t vectorPoints = num_points - num_points % 16;
+        const __m512i indexIncrementValues = _mm512_set1_epi32(16);
+        __VOLK_ATTR_ALIGNED(64) float maxValuesBuffer[16];
+        __VOLK_ATTR_ALIGNED(64) uint32_t maxIndexesBuffer[16];
+
+        float max = src0[0];
+        uint64_t index = 0;
+
+        for (uint64_t block = 0; block < vectorPoints;
+             block += VOLK_INDEX_64U_BLOCK_POINTS) {
+            uint64_t blockPoints = vectorPoints - block;
+            if (blockPoints > VOLK_INDEX_64U_BLOCK_POINTS) {
+                blockPoints = VOLK_INDEX_64U_BLOCK_POINTS;
+            }
+            const float* inputPtr = src0 + block;
+            __m512 maxValues = _mm512_set1_ps(max);
+            __m512i maxValuesIndex = _mm512_setzero_si512();
+            __m512i currentIndexes =
+                _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+            for (uint64_t number = 0; number < blockPoints; number += 16) {
+                const __m512 currentValues = _mm512_loadu_ps(inputPtr);
+                inputPtr += 16;
+                const __mmask16 compareResults =
+                    _mm512_cmp_ps_mask(currentValues, maxValues, _CMP_GT_OS);
+                maxValuesIndex = _mm512_mask_blend_epi32(
+                    compareResults, maxValuesIndex, currentIndexes);
+                maxValues =
+                    _mm512_mask_blend_ps(compareResults, maxValues, currentValues);
+                currentIndexes = _mm512_add_epi32(currentIndexes, indexIncrementValues);
+            }
+
+            // the first of the maxima of the lanes, as an index into src0
+            _mm512_store_ps(maxValuesBuffer, maxValues);
+            _mm512_store_si512((__m512i*)maxIndexesBuffer, maxValuesIndex);
+            for (int i = 0; i < 16; i++) {
+                const uint64_t candidate = block + maxIndexesBuffer[i];
+                if (maxValuesBuffer[i] > max ||
+                    (maxValuesBuffer[i] == max && candidate < index)) {
+                    max = maxValuesBuffer[i];
+                    index = candidate;
+                }
+            }
+        }
+
+        for (uint64_t number = vectorPoints; number < num_points; number++) {
+            if (src0[number] > max) {
+                index = number;
+                max = src0[number];
+            }
+        }
+        target[0] = index;
+        value[0] = max;
+    }
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_index_max_and_value_64u_32f_neon(uint64_t* target,
+                                                             float* value,
+                                                             const float* src0,
+                                                             uint64_t num_points)
+{
+    if (num_points > 0) {
+        const uint64_t vectorPoints = num_points - num_points % 4;
+        const uint32x4_t indexIncrementValues = vdupq_n_u32(4);
+        const uint32_t laneIndexes[4] = { 0, 1, 2, 3 };
+        float maxValuesBuffer[4];
+        uint32_t maxIndexesBuffer[4];
+
+        float max = src0[0];
+        uint64_t index = 0;
+
+        for (uint64_t block = 0; block < vectorPoints;
+             block += VOLK_INDEX_64U_BLOCK_POINTS) {
+            uint64_t blockPoints = vectorPoints - block;
+            if (blockPoints > VOLK_INDEX_64U_BLOCK_POINTS) {
+                blockPoints = VOLK_INDEX_64U_BLOCK_POINTS;
+            }
+            const float* inputPtr = src0 + block;
+            float32x4_t maxValues = vdupq_n_f32(max);
+            uint32x4_t maxValuesIndex = vdupq_n_u32(0);
+            uint32x4_t currentIndexes = vld1q_u32(laneIndexes);
+
+            for (uint64_t number = 0; number < blockPoints; number += 4) {
+                const float32x4_t currentValues = vld1q_f32(inputPtr);
+                inputPtr += 4;
+                const uint32x4_t compareResults = vcgtq_f32(currentValues, maxValues);
+                maxValuesIndex =
+                    vbslq_u32(compareResults, currentIndexes, maxValuesIndex);
+                maxValues = vbslq_f32(compareResults, currentValues, maxValues);
+                currentIndexes = vaddq_u32(currentIndexes, indexIncrementValues);
+            }
+
+            // the first of the maxima of the lanes, as an index into src0
+            vst1q_f32(maxValuesBuffer, maxValues);
+            vst1q_u32(maxIndexesBuffer, maxValuesIndex);
+            for (int i = 0; i < 4; i++) {
+                const uint64_t candidate = block + maxIndexesBuffer[i];
+                if (maxValuesBuffer[i] > max ||
+                    (maxValuesBuffer[i] == max && candidate < index)) {
+                    max = maxValuesBuffer[i];
+                    index = candidate;
+                }
+            }
+        }
+
+        for (uint64_t number = vectorPoints; number < num_points; number++) {
+            if (src0[number] > max) {
+                index = number;
+                max = src0[number];
+            }
+        }
+        target[0] = index;
+        value[0] = max;
+    }
+}
+
+#endif /*LV_HAVE_NEON*/
+
+#endif /*INCLUDED_volk_32f_index_max_and_value_64u_32f_u_H*/
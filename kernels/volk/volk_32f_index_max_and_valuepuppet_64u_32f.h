@@ -0,0 +1,78 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32f_index_max_and_valuepuppet_64u_32f_H
+#define INCLUDED_volk_32f_index_max_and_valuepuppet_64u_32f_H
+
+#include <volk/volk_32f_index_max_and_value_64u_32f.h>
+
+// The kernel takes a uint64_t length, the test harness passes an
+// unsigned int one.
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_index_max_and_valuepuppet_64u_32f_generic(
+    uint64_t* target, float* value, const float* src0, unsigned int num_points)
+{
+    volk_32f_index_max_and_value_64u_32f_generic(target, value, src0, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32f_index_max_and_valuepuppet_64u_32f_a_avx2(
+    uint64_t* target, float* value, const float* src0, unsigned int num_points)
+{
+    volk_32f_index_max_and_value_64u_32f_a_avx2(target, value, src0, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32f_index_max_and_valuepuppet_64u_32f_u_avx2(
+    uint64_t* target, float* value, const float* src0, unsigned int num_points)
+{
+    volk_32f_index_max_and_value_64u_32f_u_avx2(target, value, src0, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_index_max_and_valuepuppet_64u_32f_a_avx512f(
+    uint64_t* target, float* value, const float* src0, unsigned int num_points)
+{
+    volk_32f_index_max_and_value_64u_32f_a_avx512f(target, value, src0, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_index_max_and_valuepuppet_64u_32f_u_avx512f(
+    uint64_t* target, float* value, const float* src0, unsigned int num_points)
+{
+    volk_32f_index_max_and_value_64u_32f_u_avx512f(target, value, src0, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_index_max_and_valuepuppet_64u_32f_neon(
+    uint64_t* target, float* value, const float* src0, unsigned int num_points)
+{
+    volk_32f_index_max_and_value_64u_32f_neon(target, value, src0, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_index_max_and_valuepuppet_64u_32f_H */
@@ -0,0 +1,443 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_index_topk_32u
+ *
+ * \b Overview
+ *
+ * Finds the indices of the \p k largest peaks of the input in one pass.
+ *
+ * src0[i] is a peak if it is larger than the \p guard values before it and not
+ * smaller than the \p guard values after it, so two peaks are always more than
+ * \p guard points apart and of a flat top only the first point counts. With a
+ * guard of 0 every point is a peak and the kernel returns the indices of the k
+ * largest values.
+ *
+ * The indices are written in order of decreasing value, equal values in order
+ * of their index. If there are fewer than k peaks, the remaining entries of
+ * target are set to num_points.
+ *
+ * The SIMD versions compare whole vectors against the smallest of the k peaks
+ * found so far and only look at the points of a vector that exceed it, so once
+ * the first k peaks are in, most of the input is skipped at vector speed.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_index_topk_32u(uint32_t* target, const float* src0, uint32_t k,
+ *                              uint32_t guard, uint32_t num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li src0: The input vector of floats.
+ * \li k: The number of peaks to find.
+ * \li guard: The number of points on either side a peak has to dominate.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li target: The indices of the k largest peaks, k values.
+ *
+ * \b Example
+ * Find the 4 strongest bins of a spectrum that are at least 8 bins apart.
+ * \code
+ *   uint32_t N = 65536;
+ *   uint32_t k = 4;
+ *   uint32_t alignment = volk_get_alignment();
+ *   float* spectrum = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   uint32_t peaks[4];
+ *
+ *   // fill spectrum, e.g. with volk_32fc_s32f_power_spectrum_32f
+ *
+ *   volk_32f_index_topk_32u(peaks, spectrum, k, 7, N);
+ *
+ *   for (uint32_t ii = 0; ii < k && peaks[ii] < N; ++ii) {
+ *       printf("peak %u: %1.2f at bin %u\n", ii, spectrum[peaks[ii]], peaks[ii]);
+ *   }
+ *
+ *   volk_free(spectrum);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_index_topk_32u_a_H
+#define INCLUDED_volk_32f_index_topk_32u_a_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+// Takes src0[i] into the count of k peaks sorted in target if it is one and
+// beats the smallest of them, returns the new count.
+static inline uint32_t volk_32f_index_topk_32u_update(uint32_t* target,
+                                                      const float* src0,
+                                                      uint32_t count,
+                                                      uint32_t k,
+                                                      uint32_t guard,
+                                                      uint32_t num_points,
+                                                      uint32_t i)
+{
+    const float value = src0[i];
+    if (count == k && !(value > src0[target[k - 1]])) {
+        return count;
+    }
+
+    const uint32_t first = i > guard ? i - guard : 0;
+    const uint32_t last = num_points - 1 - i > guard ? i + guard : num_points - 1;
+    for (uint32_t j = first; j < i; j++) {
+        if (!(src0[j] < value)) {
+            return count;
+        }
+    }
+    for (uint32_t j = i + 1; j <= last; j++) {
+        if (src0[j] > value) {
+            return count;
+        }
+    }
+
+    uint32_t pos = count < k ? count++ : k - 1;
+    while (pos > 0 && src0[target[pos - 1]] < value) {
+        target[pos] = target[pos - 1];
+        pos--;
+    }
+    target[pos] = i;
+    return count;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_index_topk_32u_generic(uint32_t* target,
+                                                   const float* src0,
+                                                   uint32_t k,
+                                                   uint32_t guard,
+                                                   uint32_t num_points)
+{
+    uint32_t count = 0;
+    if (k > 0) {
+        for (uint32_t i = 0; i < num_points; i++) {
+            count = volk_32f_index_topk_32u_update(
+                target, src0, count, k, guard, num_points, i);
+        }
+    }
+    for (; count < k; count++) {
+        target[count] = num_points;
+    }
+}
+
+#endif /*LV_HAVE_GENERIC*/
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_index_topk_32u_a_sse(uint32_t* target,
+                                                 const float* src0,
+                                                 uint32_t k,
+                                                 uint32_t guard,
+                                                 uint32_t num_points)
+{
+    uint32_t count = 0;
+    if (k > 0) {
+        const uint32_t quarterPoints = num_points / 4;
+        __m128 threshold = _mm_setzero_ps();
+        uint32_t number = 0;
+
+        for (; number < quarterPoints * 4; number += 4) {
+            if (count == k) {
+                const __m128 values = _mm_load_ps(src0 + number);
+                if (!_mm_movemask_ps(_mm_cmpgt_ps(values, threshold))) {
+                    continue;
+                }
+            }
+            for (uint32_t i = number; i < number + 4; i++) {
+                count = volk_32f_index_topk_32u_update(
+                    target, src0, count, k, guard, num_points, i);
+            }
+            if (count == k) {
+                threshold = _mm_set1_ps(src0[target[k - 1]]);
+            }
+        }
+
+        for (; number < num_points; number++) {
+            count = volk_32f_index_topk_32u_update(
+                target, src0, count, k, guard, num_points, number);
+        }
+    }
+    for (; count < k; count++) {
+        target[count] = num_points;
+    }
+}
+
+#endif /*LV_HAVE_SSE*/
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_index_topk_32u_a_avx(uint32_t* target,
+                                                 const float* src0,
+                                                 uint32_t k,
+                                                 uint32_t guard,
+                                                 uint32_t num_points)
+{
+    uint32_t count = 0;
+    if (k > 0) {
+        const uint32_t eighthPoints = num_points / 8;
+        __m256 threshold = _mm256_setzero_ps();
+        uint32_t number = 0;
+
+        for (; number < eighthPoints * 8; number += 8) {
+            if (count == k) {
+                const __m256 values = _mm256_load_ps(src0 + number);
+                if (!_mm256_movemask_ps(_mm256_cmp_ps(values, threshold, _CMP_GT_OS))) {
+                    continue;
+                }
+            }
+            for (uint32_t i = number; i < number + 8; i++) {
+                count = volk_32f_index_topk_32u_update(
+                    target, src0, count, k, guard, num_points, i);
+            }
+            if (count == k) {
+                threshold = _mm256_set1_ps(src0[target[k - 1]]);
+            }
+        }
+
+        for (; number < num_points; number++) {
+            count = volk_32f_index_topk_32u_update(
+                target, src0, count, k, guard, num_points, number);
+        }
+    }
+    for (; count < k; count++) {
+        target[count] = num_points;
+    }
+}
+
+#endif /*LV_HAVE_AVX*/
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_index_topk_32u_a_avx512f(uint32_t* target,
+                                                     const float* src0,
+                                                     uint32_t k,
+                                                     uint32_t guard,
+                                                     uint32_t num_points)
+{
+    uint32_t count = 0;
+    if (k > 0) {
+        const uint32_t sixteenthPoints = num_points / 16;
+        __m512 threshold = _mm512_setzero_ps();
+        uint32_t number = 0;
+
+        for (; number < sixteenthPoints * 16; number += 16) {
+            if (count == k) {
+                const __m512 values = _mm512_load_ps(src0 + number);
+                if (!_mm512_cmp_ps_mask(values, threshold, _CMP_GT_OS)) {
+                    continue;
+                }
+            }
+            for (uint32_t i = number; i < number + 16; i++) {
+                count = volk_32f_index_topk_32u_update(
+                    target, src0, count, k, guard, num_points, i);
+            }
+            if (count == k) {
+                threshold = _mm512_set1_ps(src0[target[k - 1]]);
+            }
+        }
+
+        for (; number < num_points; number++) {
+            count = volk_32f_index_topk_32u_update(
+                target, src0, count, k, guard, num_points, number);
+        }
+    }
+    for (; count < k; count++) {
+        target[count] = num_points;
+    }
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
+#endif /*INCLUDED_volk_32f_index_topk_32u_a_H*/
+
+#ifndef INCLUDED_volk_32f_index_topk_32u_u_H
+#define INCLUDED_volk_32f_index_topk_32u_u_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_index_topk_32u_u_sse(uint32_t* target,
+                                                 const float* src0,
+                                                 uint32_t k,
+                                                 uint32_t guard,
+                                                 uint32_t num_points)
+{
+    uint32_t count = 0;
+    if (k > 0) {
+        const uint32_t quarterPoints = num_points / 4;
+        __m128 threshold = _mm_setzero_ps();
+        uint32_t number = 0;
+
+        for (; number < quarterPoints * 4; number += 4) {
+            if (count == k) {
+                const __m128 values = _mm_loadu_ps(src0 + number);
+                if (!_mm_movemask_ps(_mm_cmpgt_ps(values, threshold))) {
+                    continue;
+                }
+            }
+            for (uint32_t i = number; i < number + 4; i++) {
+                count = volk_32f_index_topk_32u_update(
+                    target, src0, count, k, guard, num_points, i);
+            }
+            if (count == k) {
+                threshold = _mm_set1_ps(src0[target[k - 1]]);
+            }
+        }
+
+        for (; number < num_points; number++) {
+            count = volk_32f_index_topk_32u_update(
+                target, src0, count, k, guard, num_points, number);
+        }
+    }
+    for (; count < k; count++) {
+        target[count] = num_points;
+    }
+}
+
+#endif /*LV_HAVE_SSE*/
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_index_topk_32u_u_avx(uint32_t* target,
+                                                 const float* src0,
+                                                 uint32_t k,
+                                                 uint32_t guard,
+                                                 uint32_t num_points)
+{
+    uint32_t count = 0;
+    if (k > 0) {
+        const uint32_t eighthPoints = num_points / 8;
+        __m256 threshold = _mm256_setzero_ps();
+        uint32_t number = 0;
+
+        for (; number < eighthPoints * 8; number += 8) {
+            if (count == k) {
+                const __m256 values = _mm256_loadu_ps(src0 + number);
+                if (!_mm256_movemask_ps(_mm256_cmp_ps(values, threshold, _CMP_GT_OS))) {
+                    continue;
+                }
+            }
+            for (uint32_t i = number; i < number + 8; i++) {
+                count = volk_32f_index_topk_32u_update(
+                    target, src0, count, k, guard, num_points, i);
+            }
+            if (count == k) {
+                threshold = _mm256_set1_ps(src0[target[k - 1]]);
+            }
+        }
+
+        for (; number < num_points; number++) {
+            count = volk_32f_index_topk_32u_update(
+                target, src0, count, k, guard, num_points, number);
+        }
+    }
+    for (; count < k; count++) {
+        target[count] = num_points;
+    }
+}
+
+#endif /*LV_HAVE_AVX*/
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_index_topk_32u_u_avx512f(uint32_t* target,
+                                                     const float* src0,
+                                                     uint32_t k,
+                                                     uint32_t guard,
+                                                     uint32_t num_points)
+{
+    uint32_t count = 0;
+    if (k > 0) {
+        const uint32_t sixteenthPoints = num_points / 16;
+        __m512 threshold = _mm512_setzero_ps();
+        uint32_t number = 0;
+
+        for (; number < sixteenthPoints * 16; number += 16) {
+            if (count == k) {
+                const __m512 values = _mm512_loadu_ps(src0 + number);
+                if (!_mm512_cmp_ps_mask(values, threshold, _CMP_GT_OS)) {
+                    continue;
+                }
+            }
+            for (uint32_t i = number; i < number + 16; i++) {
+                count = volk_32f_index_topk_32u_update(
+                    target, src0, count, k, guard, num_points, i);
+            }
+            if (count == k) {
+                threshold = _mm512_set1_ps(src0[target[k - 1]]);
+            }
+        }
+
+        for (; number < num_points; number++) {
+            count = volk_32f_index_topk_32u_update(
+                target, src0, count, k, guard, num_points, number);
+        }
+    }
+    for (; count < k; count++) {
+        target[count] = num_points;
+    }
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_index_topk_32u_neon(uint32_t* target,
+                                                const float* src0,
+                                                uint32_t k,
+                                                uint32_t guard,
+                                                uint32_t num_points)
+{
+    uint32_t count = 0;
+    if (k > 0) {
+        const uint32_t quarterPoints = num_points / 4;
+        float32x4_t threshold = vdupq_n_f32(0.f);
+        uint32_t number = 0;
+
+        for (; number < quarterPoints * 4; number += 4) {
+            if (count == k) {
+                const uint32x4_t above = vcgtq_f32(vld1q_f32(src0 + number), threshold);
+                const uint32x2_t any =
+                    vorr_u32(vget_low_u32(above), vget_high_u32(above));
+                if (!(vget_lane_u32(any, 0) | vget_lane_u32(any, 1))) {
+                    continue;
+                }
+            }
+            for (uint32_t i = number; i < number + 4; i++) {
+                count = volk_32f_index_topk_32u_update(
+                    target, src0, count, k, guard, num_points, i);
+            }
+            if (count == k) {
+                threshold = vdupq_n_f32(src0[target[k - 1]]);
+            }
+        }
+
+        for (; number < num_points; number++) {
+            count = volk_32f_index_topk_32u_update(
+                target, src0, count, k, guard, num_points, number);
+        }
+    }
+    for (; count < k; count++) {
+        target[count] = num_points;
+    }
+}
+
+#endif /*LV_HAVE_NEON*/
+
+#endif /*INCLUDED_volk_32f_index_topk_32u_u_H*/
@@ -0,0 +1,144 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32f_index_topkpuppet_32u_H
+#define INCLUDED_volk_32f_index_topkpuppet_32u_H
+
+#include <volk/volk_32f_index_topk_32u.h>
+
+// Test geometry: the VOLK_TOPK_PUPPET_K largest peaks with a guard of
+// VOLK_TOPK_PUPPET_GUARD points, fewer if num_points is smaller.
+#ifndef VOLK_TOPK_PUPPET_K
+#define VOLK_TOPK_PUPPET_K 16
+#define VOLK_TOPK_PUPPET_GUARD 5
+#define VOLK_TOPK_PUPPET_COUNT(num_points) \
+    ((num_points) < VOLK_TOPK_PUPPET_K ? (num_points) : VOLK_TOPK_PUPPET_K)
+#endif
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_index_topkpuppet_32u_generic(uint32_t* target,
+                                                         const float* src0,
+                                                         uint32_t num_points)
+{
+    volk_32f_index_topk_32u_generic(target,
+                                    src0,
+                                    VOLK_TOPK_PUPPET_COUNT(num_points),
+                                    VOLK_TOPK_PUPPET_GUARD,
+                                    num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32f_index_topkpuppet_32u_a_sse(uint32_t* target,
+                                                       const float* src0,
+                                                       uint32_t num_points)
+{
+    volk_32f_index_topk_32u_a_sse(target,
+                                  src0,
+                                  VOLK_TOPK_PUPPET_COUNT(num_points),
+                                  VOLK_TOPK_PUPPET_GUARD,
+                                  num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32f_index_topkpuppet_32u_u_sse(uint32_t* target,
+                                                       const float* src0,
+                                                       uint32_t num_points)
+{
+    volk_32f_index_topk_32u_u_sse(target,
+                                  src0,
+                                  VOLK_TOPK_PUPPET_COUNT(num_points),
+                                  VOLK_TOPK_PUPPET_GUARD,
+                                  num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_index_topkpuppet_32u_a_avx(uint32_t* target,
+                                                       const float* src0,
+                                                       uint32_t num_points)
+{
+    volk_32f_index_topk_32u_a_avx(target,
+                                  src0,
+                                  VOLK_TOPK_PUPPET_COUNT(num_points),
+                                  VOLK_TOPK_PUPPET_GUARD,
+                                  num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_index_topkpuppet_32u_u_avx(uint32_t* target,
+                                                       const float* src0,
+                                                       uint32_t num_points)
+{
+    volk_32f_index_topk_32u_u_avx(target,
+                                  src0,
+                                  VOLK_TOPK_PUPPET_COUNT(num_points),
+                                  VOLK_TOPK_PUPPET_GUARD,
+                                  num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_index_topkpuppet_32u_a_avx512f(uint32_t* target,
+                                                           const float* src0,
+                                                           uint32_t num_points)
+{
+    volk_32f_index_topk_32u_a_avx512f(target,
+                                      src0,
+                                      VOLK_TOPK_PUPPET_COUNT(num_points),
+                                      VOLK_TOPK_PUPPET_GUARD,
+                                      num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_index_topkpuppet_32u_u_avx512f(uint32_t* target,
+                                                           const float* src0,
+                                                           uint32_t num_points)
+{
+    volk_32f_index_topk_32u_u_avx512f(target,
+                                      src0,
+                                      VOLK_TOPK_PUPPET_COUNT(num_points),
+                                      VOLK_TOPK_PUPPET_GUARD,
+                                      num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_index_topkpuppet_32u_neon(uint32_t* target,
+                                                      const float* src0,
+                                                      uint32_t num_points)
+{
+    volk_32f_index_topk_32u_neon(target,
+                                 src0,
+                                 VOLK_TOPK_PUPPET_COUNT(num_points),
+                                 VOLK_TOPK_PUPPET_GUARD,
+                                 num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_index_topkpuppet_32u_H */
@@ -0,0 +1,184 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_x2_add_strided_32f
+ *
+ * \b Overview
+ *
+ * Adds two strided vectors element by element:
+ *
+ * c[i * c_stride] = a[i * a_stride] + b[i * b_stride]
+ *
+ * This reads and writes channels of interleaved multi-channel buffers in
+ * place, without deinterleaving them into temporaries first.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_add_strided_32f(float* cVector, const float* aVector, const float*
+ * bVector, unsigned int c_stride, unsigned int a_stride, unsigned int b_stride, unsigned
+ * int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: First vector of input points.
+ * \li bVector: Second vector of input points.
+ * \li c_stride: Distance in floats between consecutive output points.
+ * \li a_stride: Distance in floats between consecutive points of aVector.
+ * \li b_stride: Distance in floats between consecutive points of bVector.
+ * \li num_points: The number of points to process.
+ *
+ * \b Outputs
+ * \li cVector: The output vector.
+ *
+ * \b Example
+ * Add channel 1 of a 4 channel interleaved buffer to channel 0 in place.
+ * \code
+ *   int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* frames = (float*)volk_malloc(sizeof(float) * 4 * N, alignment);
+ *
+ *   // fill frames
+ *
+ *   volk_32f_x2_add_strided_32f(frames, frames, frames + 1, 4, 4, 4, N);
+ *
+ *   volk_free(frames);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_add_strided_32f_u_H
+#define INCLUDED_volk_32f_x2_add_strided_32f_u_H
+
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_add_strided_32f_generic(float* cVector,
+                                                       const float* aVector,
+                                                       const float* bVector,
+                                                       unsigned int c_stride,
+                                                       unsigned int a_stride,
+                                                       unsigned int b_stride,
+                                                       unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        *cVector = *aVector + *bVector;
+        cVector += c_stride;
+        aVector += a_stride;
+        bVector += b_stride;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+#include <volk/volk_sse_intrinsics.h>
+
+static inline void volk_32f_x2_add_strided_32f_u_sse(float* cVector,
+                                                     const float* aVector,
+                                                     const float* bVector,
+                                                     unsigned int c_stride,
+                                                     unsigned int a_stride,
+                                                     unsigned int b_stride,
+                                                     unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const __m128 x = _mm_loadu_strided_ps(aVector, a_stride);
+        const __m128 y = _mm_loadu_strided_ps(bVector, b_stride);
+        _mm_storeu_strided_ps(cVector, c_stride, _mm_add_ps(x, y));
+        aVector += 4 * (size_t)a_stride;
+        bVector += 4 * (size_t)b_stride;
+        cVector += 4 * (size_t)c_stride;
+    }
+
+    volk_32f_x2_add_strided_32f_generic(cVector,
+                                        aVector,
+                                        bVector,
+                                        c_stride,
+                                        a_stride,
+                                        b_stride,
+                                        num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32f_x2_add_strided_32f_u_avx2(float* cVector,
+                                                      const float* aVector,
+                                                      const float* bVector,
+                                                      unsigned int c_stride,
+                                                      unsigned int a_stride,
+                                                      unsigned int b_stride,
+                                                      unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256i a_index = _mm256_stride_index(a_stride);
+    const __m256i b_index = _mm256_stride_index(b_stride);
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m256 aVal = _mm256_loadu_strided_ps(aVector, a_stride, a_index);
+        const __m256 bVal = _mm256_loadu_strided_ps(bVector, b_stride, b_index);
+        _mm256_storeu_strided_ps(cVector, c_stride, _mm256_add_ps(aVal, bVal));
+        aVector += 8 * (size_t)a_stride;
+        bVector += 8 * (size_t)b_stride;
+        cVector += 8 * (size_t)c_stride;
+    }
+
+    volk_32f_x2_add_strided_32f_generic(cVector,
+                                        aVector,
+                                        bVector,
+                                        c_stride,
+                                        a_stride,
+                                        b_stride,
+                                        num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_x2_add_strided_32f_neon(float* cVector,
+                                                    const float* aVector,
+                                                    const float* bVector,
+                                                    unsigned int c_stride,
+                                                    unsigned int a_stride,
+                                                    unsigned int b_stride,
+                                                    unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const float32x4_t x = _vld1q_strided_f32(aVector, a_stride);
+        const float32x4_t y = _vld1q_strided_f32(bVector, b_stride);
+        _vst1q_strided_f32(cVector, c_stride, vaddq_f32(x, y));
+        aVector += 4 * (size_t)a_stride;
+        bVector += 4 * (size_t)b_stride;
+        cVector += 4 * (size_t)c_stride;
+    }
+
+    volk_32f_x2_add_strided_32f_generic(cVector,
+                                        aVector,
+                                        bVector,
+                                        c_stride,
+                                        a_stride,
+                                        b_stride,
+                                        num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_add_strided_32f_u_H */
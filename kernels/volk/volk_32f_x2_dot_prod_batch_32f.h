@@ -0,0 +1,190 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_x2_dot_prod_batch_32f
+ *
+ * \b Overview
+ *
+ * Computes \p num_batches dot products of \p num_points floats in one call.
+ * Batch b uses the vectors starting at input + b * input_stride and
+ * taps + b * taps_stride; a taps_stride of 0 applies the same taps to every
+ * input vector. This avoids the per-call overhead of
+ * volk_32f_x2_dot_prod_32f for many short vectors, and the SIMD versions
+ * reduce several batches at once.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_dot_prod_batch_32f(float* result, const float* input, const float*
+ * taps, unsigned int input_stride, unsigned int taps_stride, unsigned int num_batches,
+ * unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: first vector of batch 0.
+ * \li taps: taps vector of batch 0.
+ * \li input_stride: distance in points between consecutive input vectors.
+ * \li taps_stride: distance in points between consecutive taps vectors.
+ * \li num_batches: number of dot products.
+ * \li num_points: number of points in each vector.
+ *
+ * \b Outputs
+ * \li result: vector of \p num_batches dot products.
+ *
+ * \b Example
+ * Correlate 64 consecutive 32 point blocks against the same taps.
+ * \code
+ *   unsigned int len = 32, nbatch = 64;
+ *   float* in = (float*)volk_malloc(sizeof(float) * len * nbatch, volk_get_alignment());
+ *   float* taps = (float*)volk_malloc(sizeof(float) * len, volk_get_alignment());
+ *   float* out = (float*)volk_malloc(sizeof(float) * nbatch, volk_get_alignment());
+ *
+ *   // fill in and taps
+ *
+ *   volk_32f_x2_dot_prod_batch_32f(out, in, taps, len, 0, nbatch, len);
+ *
+ *   volk_free(in);
+ *   volk_free(taps);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_dot_prod_batch_32f_u_H
+#define INCLUDED_volk_32f_x2_dot_prod_batch_32f_u_H
+
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_dot_prod_batch_32f_generic(float* result,
+                                                          const float* input,
+                                                          const float* taps,
+                                                          unsigned int input_stride,
+                                                          unsigned int taps_stride,
+                                                          unsigned int num_batches,
+                                                          unsigned int num_points)
+{
+    for (unsigned int b = 0; b < num_batches; b++) {
+        const float* in = input + (size_t)b * input_stride;
+        const float* tp = taps + (size_t)b * taps_stride;
+        float sum = 0.f;
+        for (unsigned int i = 0; i < num_points; i++) {
+            sum += in[i] * tp[i];
+        }
+        result[b] = sum;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32f_x2_dot_prod_batch_32f_u_avx(float* result,
+                                                        const float* input,
+                                                        const float* taps,
+                                                        unsigned int input_stride,
+                                                        unsigned int taps_stride,
+                                                        unsigned int num_batches,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256i tail = _mm256_tail_mask(num_points - eighthPoints * 8);
+
+    // eight batches per iteration, one accumulator each; the horizontal sums
+    // of all eight are done together at the end
+    for (unsigned int b = 0; b < num_batches; b += 8) {
+        const unsigned int batches = num_batches - b < 8 ? num_batches - b : 8;
+        const float* in[8];
+        const float* tp[8];
+        __m256 acc[8];
+        for (unsigned int j = 0; j < 8; j++) {
+            // short last group: repeat its last batch, the result is dropped
+            const unsigned int bj = b + (j < batches ? j : batches - 1);
+            in[j] = input + (size_t)bj * input_stride;
+            tp[j] = taps + (size_t)bj * taps_stride;
+            acc[j] = _mm256_setzero_ps();
+        }
+
+        for (unsigned int number = 0; number < eighthPoints; number++) {
+            for (unsigned int j = 0; j < 8; j++) {
+                acc[j] = _mm256_add_ps(
+                    acc[j],
+                    _mm256_mul_ps(_mm256_loadu_ps(in[j]), _mm256_loadu_ps(tp[j])));
+                in[j] += 8;
+                tp[j] += 8;
+            }
+        }
+        if (num_points & 7) {
+            for (unsigned int j = 0; j < 8; j++) {
+                acc[j] = _mm256_add_ps(acc[j],
+                                       _mm256_mul_ps(_mm256_maskload_ps(in[j], tail),
+                                                     _mm256_maskload_ps(tp[j], tail)));
+            }
+        }
+
+        const __m256 sums = _mm256_transpose_sum8_ps(
+            acc[0], acc[1], acc[2], acc[3], acc[4], acc[5], acc[6], acc[7]);
+        _mm256_maskstore_ps(result + b, _mm256_tail_mask(batches), sums);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_x2_dot_prod_batch_32f_neon(float* result,
+                                                       const float* input,
+                                                       const float* taps,
+                                                       unsigned int input_stride,
+                                                       unsigned int taps_stride,
+                                                       unsigned int num_batches,
+                                                       unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    // four batches per iteration, one accumulator each; the horizontal sums
+    // of all four are done together at the end
+    for (unsigned int b = 0; b < num_batches; b += 4) {
+        const unsigned int batches = num_batches - b < 4 ? num_batches - b : 4;
+        const float* in[4];
+        const float* tp[4];
+        float32x4_t acc[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            // short last group: repeat its last batch, the result is dropped
+            const unsigned int bj = b + (j < batches ? j : batches - 1);
+            in[j] = input + (size_t)bj * input_stride;
+            tp[j] = taps + (size_t)bj * taps_stride;
+            acc[j] = vdupq_n_f32(0.f);
+        }
+
+        for (unsigned int number = 0; number < quarterPoints; number++) {
+            for (unsigned int j = 0; j < 4; j++) {
+                acc[j] = vmlaq_f32(acc[j], vld1q_f32(in[j]), vld1q_f32(tp[j]));
+                in[j] += 4;
+                tp[j] += 4;
+            }
+        }
+
+        float sums[4];
+        vst1q_f32(sums, _vtranspose_sum4q_f32(acc[0], acc[1], acc[2], acc[3]));
+        for (unsigned int j = 0; j < batches; j++) {
+            for (unsigned int number = quarterPoints * 4; number < num_points; number++)
+                sums[j] += (*in[j]++) * (*tp[j]++);
+            result[b + j] = sums[j];
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_dot_prod_batch_32f_u_H */
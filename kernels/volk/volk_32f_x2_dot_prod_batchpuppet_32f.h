@@ -0,0 +1,80 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32f_x2_dot_prod_batchpuppet_32f_H
+#define INCLUDED_volk_32f_x2_dot_prod_batchpuppet_32f_H
+
+#include <volk/volk_32f_x2_dot_prod_batch_32f.h>
+
+// Test geometry: vectors of VOLK_BATCH_PUPPET_LEN points that start every
+// VOLK_BATCH_PUPPET_STRIDE points, as many as fit into num_points.
+#ifndef VOLK_BATCH_PUPPET_LEN
+#define VOLK_BATCH_PUPPET_LEN 23
+#define VOLK_BATCH_PUPPET_STRIDE 27
+#define VOLK_BATCH_PUPPET_COUNT(num_points) \
+    ((num_points) < VOLK_BATCH_PUPPET_LEN   \
+         ? 0                                \
+         : ((num_points)-VOLK_BATCH_PUPPET_LEN) / VOLK_BATCH_PUPPET_STRIDE + 1)
+#endif
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_dot_prod_batchpuppet_32f_generic(float* result,
+                                                                const float* input,
+                                                                const float* taps,
+                                                                unsigned int num_points)
+{
+    volk_32f_x2_dot_prod_batch_32f_generic(result,
+                                           input,
+                                           taps,
+                                           VOLK_BATCH_PUPPET_STRIDE,
+                                           VOLK_BATCH_PUPPET_STRIDE,
+                                           VOLK_BATCH_PUPPET_COUNT(num_points),
+                                           VOLK_BATCH_PUPPET_LEN);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_x2_dot_prod_batchpuppet_32f_u_avx(float* result,
+                                                              const float* input,
+                                                              const float* taps,
+                                                              unsigned int num_points)
+{
+    volk_32f_x2_dot_prod_batch_32f_u_avx(result,
+                                         input,
+                                         taps,
+                                         VOLK_BATCH_PUPPET_STRIDE,
+                                         VOLK_BATCH_PUPPET_STRIDE,
+                                         VOLK_BATCH_PUPPET_COUNT(num_points),
+                                         VOLK_BATCH_PUPPET_LEN);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_x2_dot_prod_batchpuppet_32f_neon(float* result,
+                                                             const float* input,
+                                                             const float* taps,
+                                                             unsigned int num_points)
+{
+    volk_32f_x2_dot_prod_batch_32f_neon(result,
+                                        input,
+                                        taps,
+                                        VOLK_BATCH_PUPPET_STRIDE,
+                                        VOLK_BATCH_PUPPET_STRIDE,
+                                        VOLK_BATCH_PUPPET_COUNT(num_points),
+                                        VOLK_BATCH_PUPPET_LEN);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_dot_prod_batchpuppet_32f_H */
@@ -0,0 +1,198 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_x2_dot_prod_strided_32f
+ *
+ * \b Overview
+ *
+ * Computes the dot product of two strided vectors:
+ *
+ * result = sum(input[i * input_stride] * taps[i * taps_stride])
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_dot_prod_strided_32f(float* result, const float* input, const float*
+ * taps, unsigned int input_stride, unsigned int taps_stride, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: First vector of input points.
+ * \li taps: Second vector of input points.
+ * \li input_stride: Distance in floats between consecutive points of input.
+ * \li taps_stride: Distance in floats between consecutive points of taps.
+ * \li num_points: The number of points to process.
+ *
+ * \b Outputs
+ * \li result: The dot product.
+ *
+ * \b Example
+ * Correlate channel 3 of a 6 channel interleaved buffer with a reference.
+ * \code
+ *   int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* frames = (float*)volk_malloc(sizeof(float) * 6 * N, alignment);
+ *   float* ref = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float result;
+ *
+ *   // fill frames and ref
+ *
+ *   volk_32f_x2_dot_prod_strided_32f(&result, frames + 3, ref, 6, 1, N);
+ *
+ *   volk_free(frames);
+ *   volk_free(ref);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_dot_prod_strided_32f_u_H
+#define INCLUDED_volk_32f_x2_dot_prod_strided_32f_u_H
+
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_dot_prod_strided_32f_generic(float* result,
+                                                            const float* input,
+                                                            const float* taps,
+                                                            unsigned int input_stride,
+                                                            unsigned int taps_stride,
+                                                            unsigned int num_points)
+{
+    float dotProduct = 0;
+    for (unsigned int number = 0; number < num_points; number++) {
+        dotProduct += (*input) * (*taps);
+        input += input_stride;
+        taps += taps_stride;
+    }
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+#include <volk/volk_sse_intrinsics.h>
+
+static inline void volk_32f_x2_dot_prod_strided_32f_u_sse(float* result,
+                                                          const float* input,
+                                                          const float* taps,
+                                                          unsigned int input_stride,
+                                                          unsigned int taps_stride,
+                                                          unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    __m128 dotProdVal = _mm_setzero_ps();
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const __m128 aVal = _mm_loadu_strided_ps(input, input_stride);
+        const __m128 bVal = _mm_loadu_strided_ps(taps, taps_stride);
+        dotProdVal = _mm_add_ps(dotProdVal, _mm_mul_ps(aVal, bVal));
+        input += 4 * (size_t)input_stride;
+        taps += 4 * (size_t)taps_stride;
+    }
+
+    __VOLK_ATTR_ALIGNED(16) float dotProductVector[4];
+    _mm_store_ps(dotProductVector, dotProdVal);
+
+    float dotProduct = dotProductVector[0] + dotProductVector[1] + dotProductVector[2] +
+                       dotProductVector[3];
+
+    for (unsigned int number = quarterPoints * 4; number < num_points; number++) {
+        dotProduct += (*input) * (*taps);
+        input += input_stride;
+        taps += taps_stride;
+    }
+
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32f_x2_dot_prod_strided_32f_u_avx2(float* result,
+                                                           const float* input,
+                                                           const float* taps,
+                                                           unsigned int input_stride,
+                                                           unsigned int taps_stride,
+                                                           unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256i input_index = _mm256_stride_index(input_stride);
+    const __m256i taps_index = _mm256_stride_index(taps_stride);
+
+    __m256 dotProdVal = _mm256_setzero_ps();
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m256 aVal = _mm256_loadu_strided_ps(input, input_stride, input_index);
+        const __m256 bVal = _mm256_loadu_strided_ps(taps, taps_stride, taps_index);
+        dotProdVal = _mm256_add_ps(dotProdVal, _mm256_mul_ps(aVal, bVal));
+        input += 8 * (size_t)input_stride;
+        taps += 8 * (size_t)taps_stride;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) float dotProductVector[8];
+    _mm256_store_ps(dotProductVector, dotProdVal);
+
+    float dotProduct = dotProductVector[0] + dotProductVector[1] + dotProductVector[2] +
+                       dotProductVector[3] + dotProductVector[4] + dotProductVector[5] +
+                       dotProductVector[6] + dotProductVector[7];
+
+    for (unsigned int number = eighthPoints * 8; number < num_points; number++) {
+        dotProduct += (*input) * (*taps);
+        input += input_stride;
+        taps += taps_stride;
+    }
+
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_x2_dot_prod_strided_32f_neon(float* result,
+                                                         const float* input,
+                                                         const float* taps,
+                                                         unsigned int input_stride,
+                                                         unsigned int taps_stride,
+                                                         unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    float32x4_t dotProdVal = vdupq_n_f32(0.f);
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const float32x4_t aVal = _vld1q_strided_f32(input, input_stride);
+        const float32x4_t bVal = _vld1q_strided_f32(taps, taps_stride);
+        dotProdVal = vmlaq_f32(dotProdVal, aVal, bVal);
+        input += 4 * (size_t)input_stride;
+        taps += 4 * (size_t)taps_stride;
+    }
+
+    float dotProductVector[4];
+    vst1q_f32(dotProductVector, dotProdVal);
+
+    float dotProduct = dotProductVector[0] + dotProductVector[1] + dotProductVector[2] +
+                       dotProductVector[3];
+
+    for (unsigned int number = quarterPoints * 4; number < num_points; number++) {
+        dotProduct += (*input) * (*taps);
+        input += input_stride;
+        taps += taps_stride;
+    }
+
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_dot_prod_strided_32f_u_H */
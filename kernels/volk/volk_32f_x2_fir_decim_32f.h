@@ -0,0 +1,295 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_x2_fir_decim_32f
+ *
+ * \b Overview
+ *
+ * Runs a real FIR filter over a real input and keeps every \p decimation-th
+ * output:
+ *
+ * output[n] = sum(input[n * decimation + k] * taps[k]) for k in [0, num_taps)
+ *
+ * The taps are applied in the same order as in volk_32f_x2_dot_prod_32f, so
+ * pass them reversed to get the convolution. The input has to hold
+ * (num_points - 1) * decimation + num_taps samples.
+ *
+ * The SIMD versions compute several outputs per pass over the taps, so every
+ * tap load is shared by a whole block of outputs.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_fir_decim_32f(float* output, const float* input, const float* taps,
+ * unsigned int num_taps, unsigned int decimation, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: The input samples.
+ * \li taps: The filter taps.
+ * \li num_taps: The number of taps.
+ * \li decimation: The distance in input samples between consecutive outputs.
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li output: The filtered and decimated samples.
+ *
+ * \b Example
+ * Filter a block of samples with a 64 tap low pass filter and decimate by 4.
+ * \code
+ *   unsigned int num_taps = 64;
+ *   unsigned int decim = 4;
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * ((N - 1) * decim + num_taps),
+ *                                   alignment);
+ *   float* taps = (float*)volk_malloc(sizeof(float) * num_taps, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *
+ *   // fill taps and in
+ *
+ *   volk_32f_x2_fir_decim_32f(out, in, taps, num_taps, decim, N);
+ *
+ *   volk_free(in);
+ *   volk_free(taps);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_fir_decim_32f_u_H
+#define INCLUDED_volk_32f_x2_fir_decim_32f_u_H
+
+#include <stddef.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_fir_decim_32f_generic(float* output,
+                                                     const float* input,
+                                                     const float* taps,
+                                                     unsigned int num_taps,
+                                                     unsigned int decimation,
+                                                     unsigned int num_points)
+{
+    for (unsigned int n = 0; n < num_points; n++) {
+        const float* in = input + (size_t)n * decimation;
+        float sum = 0.f;
+        for (unsigned int k = 0; k < num_taps; k++) {
+            sum += in[k] * taps[k];
+        }
+        output[n] = sum;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_x2_fir_decim_32f_u_sse(float* output,
+                                                   const float* input,
+                                                   const float* taps,
+                                                   unsigned int num_taps,
+                                                   unsigned int decimation,
+                                                   unsigned int num_points)
+{
+    const unsigned int quarterTaps = num_taps / 4;
+
+    // four outputs per pass over the taps, one accumulator each
+    for (unsigned int n = 0; n < num_points; n += 4) {
+        const unsigned int outputs = num_points - n < 4 ? num_points - n : 4;
+        const float* in[4];
+        __m128 acc[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            // short last block: repeat its last output, the result is dropped
+            const unsigned int nj = n + (j < outputs ? j : outputs - 1);
+            in[j] = input + (size_t)nj * decimation;
+            acc[j] = _mm_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < quarterTaps; k++) {
+            const __m128 t = _mm_loadu_ps(taps + 4 * k);
+            for (unsigned int j = 0; j < 4; j++) {
+                acc[j] = _mm_add_ps(acc[j], _mm_mul_ps(_mm_loadu_ps(in[j] + 4 * k), t));
+            }
+        }
+
+        _MM_TRANSPOSE4_PS(acc[0], acc[1], acc[2], acc[3]);
+        __VOLK_ATTR_ALIGNED(16) float sums[4];
+        _mm_store_ps(sums,
+                     _mm_add_ps(_mm_add_ps(acc[0], acc[1]), _mm_add_ps(acc[2], acc[3])));
+
+        for (unsigned int j = 0; j < outputs; j++) {
+            float sum = sums[j];
+            for (unsigned int k = quarterTaps * 4; k < num_taps; k++) {
+                sum += in[j][k] * taps[k];
+            }
+            output[n + j] = sum;
+        }
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32f_x2_fir_decim_32f_u_avx2_fma(float* output,
+                                                        const float* input,
+                                                        const float* taps,
+                                                        unsigned int num_taps,
+                                                        unsigned int decimation,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighthTaps = num_taps / 8;
+    const __m256i tail = _mm256_tail_mask(num_taps - eighthTaps * 8);
+
+    // eight outputs per pass over the taps, one accumulator each; the
+    // horizontal sums of all eight are done together at the end
+    for (unsigned int n = 0; n < num_points; n += 8) {
+        const unsigned int outputs = num_points - n < 8 ? num_points - n : 8;
+        const float* in[8];
+        __m256 acc[8];
+        for (unsigned int j = 0; j < 8; j++) {
+            // short last block: repeat its last output, the result is dropped
+            const unsigned int nj = n + (j < outputs ? j : outputs - 1);
+            in[j] = input + (size_t)nj * decimation;
+            acc[j] = _mm256_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < eighthTaps; k++) {
+            const __m256 t = _mm256_loadu_ps(taps + 8 * k);
+            for (unsigned int j = 0; j < 8; j++) {
+                acc[j] = _mm256_fmadd_ps(_mm256_loadu_ps(in[j] + 8 * k), t, acc[j]);
+            }
+        }
+        if (num_taps & 7) {
+            const __m256 t = _mm256_maskload_ps(taps + 8 * eighthTaps, tail);
+            for (unsigned int j = 0; j < 8; j++) {
+                acc[j] = _mm256_fmadd_ps(
+                    _mm256_maskload_ps(in[j] + 8 * eighthTaps, tail), t, acc[j]);
+            }
+        }
+
+        const __m256 sums = _mm256_transpose_sum8_ps(
+            acc[0], acc[1], acc[2], acc[3], acc[4], acc[5], acc[6], acc[7]);
+        _mm256_maskstore_ps(output + n, _mm256_tail_mask(outputs), sums);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32f_x2_fir_decim_32f_u_avx512f(float* output,
+                                                       const float* input,
+                                                       const float* taps,
+                                                       unsigned int num_taps,
+                                                       unsigned int decimation,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenthTaps = num_taps / 16;
+    const __mmask16 tail = (__mmask16)((1u << (num_taps - sixteenthTaps * 16)) - 1);
+
+    // eight outputs per pass over the taps, one accumulator each
+    for (unsigned int n = 0; n < num_points; n += 8) {
+        const unsigned int outputs = num_points - n < 8 ? num_points - n : 8;
+        const float* in[8];
+        __m512 acc[8];
+        for (unsigned int j = 0; j < 8; j++) {
+            // short last block: repeat its last output, the result is dropped
+            const unsigned int nj = n + (j < outputs ? j : outputs - 1);
+            in[j] = input + (size_t)nj * decimation;
+            acc[j] = _mm512_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < sixteenthTaps; k++) {
+            const __m512 t = _mm512_loadu_ps(taps + 16 * k);
+            for (unsigned int j = 0; j < 8; j++) {
+                acc[j] = _mm512_fmadd_ps(_mm512_loadu_ps(in[j] + 16 * k), t, acc[j]);
+            }
+        }
+        if (tail) {
+            const __m512 t = _mm512_maskz_loadu_ps(tail, taps + 16 * sixteenthTaps);
+            for (unsigned int j = 0; j < 8; j++) {
+                acc[j] = _mm512_fmadd_ps(
+                    _mm512_maskz_loadu_ps(tail, in[j] + 16 * sixteenthTaps), t, acc[j]);
+            }
+        }
+
+        // fold each accumulator to 256 bits, then sum all eight together
+        __m256 half[8];
+        for (unsigned int j = 0; j < 8; j++) {
+            half[j] = _mm256_add_ps(
+                _mm512_castps512_ps256(acc[j]),
+                _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc[j]), 1)));
+        }
+        const __m256 sums = _mm256_transpose_sum8_ps(
+            half[0], half[1], half[2], half[3], half[4], half[5], half[6], half[7]);
+        _mm256_maskstore_ps(output + n, _mm256_tail_mask(outputs), sums);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_fir_decim_32f_neon(float* output,
+                                                  const float* input,
+                                                  const float* taps,
+                                                  unsigned int num_taps,
+                                                  unsigned int decimation,
+                                                  unsigned int num_points)
+{
+    const unsigned int quarterTaps = num_taps / 4;
+
+    // four outputs per pass over the taps, one accumulator each
+    for (unsigned int n = 0; n < num_points; n += 4) {
+        const unsigned int outputs = num_points - n < 4 ? num_points - n : 4;
+        const float* in[4];
+        float32x4_t acc[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            // short last block: repeat its last output, the result is dropped
+            const unsigned int nj = n + (j < outputs ? j : outputs - 1);
+            in[j] = input + (size_t)nj * decimation;
+            acc[j] = vdupq_n_f32(0);
+        }
+
+        for (unsigned int k = 0; k < quarterTaps; k++) {
+            const float32x4_t t = vld1q_f32(taps + 4 * k);
+            for (unsigned int j = 0; j < 4; j++) {
+                acc[j] = vmlaq_f32(acc[j], vld1q_f32(in[j] + 4 * k), t);
+            }
+        }
+
+        float32x2_t half[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            half[j] = vadd_f32(vget_low_f32(acc[j]), vget_high_f32(acc[j]));
+        }
+        __VOLK_ATTR_ALIGNED(16) float sums[4];
+        vst1q_f32(sums,
+                  vcombine_f32(vpadd_f32(half[0], half[1]), vpadd_f32(half[2], half[3])));
+
+        for (unsigned int j = 0; j < outputs; j++) {
+            float sum = sums[j];
+            for (unsigned int k = quarterTaps * 4; k < num_taps; k++) {
+                sum += in[j][k] * taps[k];
+            }
+            output[n + j] = sum;
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_fir_decim_32f_u_H */
@@ -0,0 +1,304 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_x2_polyphase_resample_32f
+ *
+ * \b Overview
+ *
+ * Resamples a real signal by the rational factor num_phases / decimation
+ * with a polyphase filterbank.
+ *
+ * The filterbank holds num_phases phases of taps_per_phase taps each, phase p
+ * starting at taps + p * taps_per_phase. Each output is the dot product of a
+ * phase with a window of the input, as in volk_32f_x2_dot_prod_32f. After
+ * every output the phase advances by \p decimation, and the input window
+ * moves forward by one sample for every num_phases it wraps around.
+ *
+ * For a prototype low pass filter h of num_phases * taps_per_phase taps,
+ * designed at the interpolated rate, tap k of phase p is
+ * h[p + (taps_per_phase - 1 - k) * num_phases], scaled by num_phases for unity
+ * gain.
+ *
+ * \p phase carries the filterbank phase from one call to the next. With
+ * \p phase as it was on entry, the input has to hold
+ * (phase + (num_points - 1) * decimation) / num_phases + taps_per_phase
+ * samples, and the next call starts (phase + num_points * decimation) /
+ * num_phases samples further on.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_polyphase_resample_32f(float* output, const float* input, const
+ * float* taps, unsigned int num_phases, unsigned int taps_per_phase, unsigned int
+ * decimation, unsigned int* phase, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: The input samples.
+ * \li taps: The filterbank, num_phases * taps_per_phase taps.
+ * \li num_phases: The number of phases, the interpolation factor.
+ * \li taps_per_phase: The number of taps in each phase.
+ * \li decimation: The phase advance per output, the decimation factor.
+ * \li phase: The filterbank phase of the first output, in [0, num_phases).
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li output: The resampled signal.
+ * \li phase: The filterbank phase of the next output.
+ *
+ * \b Example
+ * Resample num_in samples from 48 kHz to 44.1 kHz (147 / 160) in blocks of
+ * 441 outputs.
+ * \code
+ *   unsigned int L = 147, M = 160, T = 16, N = 441;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* taps = (float*)volk_malloc(sizeof(float) * L * T, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   unsigned int phase = 0;
+ *
+ *   // fill taps from the prototype filter, as above
+ *
+ *   const float* end = in + num_in;
+ *   while ((phase + (N - 1) * M) / L + T <= (unsigned int)(end - in)) {
+ *       const unsigned int consumed = (phase + N * M) / L;
+ *       volk_32f_x2_polyphase_resample_32f(out, in, taps, L, T, M, &phase, N);
+ *       in += consumed;
+ *       // use out
+ *   }
+ *
+ *   volk_free(taps);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_polyphase_resample_32f_u_H
+#define INCLUDED_volk_32f_x2_polyphase_resample_32f_u_H
+
+#include <stddef.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_polyphase_resample_32f_generic(float* output,
+                                                              const float* input,
+                                                              const float* taps,
+                                                              unsigned int num_phases,
+                                                              unsigned int taps_per_phase,
+                                                              unsigned int decimation,
+                                                              unsigned int* phase,
+                                                              unsigned int num_points)
+{
+    unsigned int p = *phase;
+    for (unsigned int n = 0; n < num_points; n++) {
+        const float* h = taps + (size_t)p * taps_per_phase;
+        float sum = 0.f;
+        for (unsigned int k = 0; k < taps_per_phase; k++) {
+            sum += input[k] * h[k];
+        }
+        output[n] = sum;
+
+        p += decimation;
+        input += p / num_phases;
+        p %= num_phases;
+    }
+    *phase = p;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_x2_polyphase_resample_32f_u_sse(float* output,
+                                                            const float* input,
+                                                            const float* taps,
+                                                            unsigned int num_phases,
+                                                            unsigned int taps_per_phase,
+                                                            unsigned int decimation,
+                                                            unsigned int* phase,
+                                                            unsigned int num_points)
+{
+    const unsigned int quarterTaps = taps_per_phase / 4;
+    unsigned int p = *phase;
+
+    // four outputs, each with its own phase and input window, per pass
+    for (unsigned int n = 0; n < num_points; n += 4) {
+        const unsigned int outputs = num_points - n < 4 ? num_points - n : 4;
+        const float* x[4];
+        const float* h[4];
+        __m128 acc[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            if (j < outputs) {
+                x[j] = input;
+                h[j] = taps + (size_t)p * taps_per_phase;
+                p += decimation;
+                input += p / num_phases;
+                p %= num_phases;
+            } else {
+                // short last block: repeat its last output, the result is dropped
+                x[j] = x[outputs - 1];
+                h[j] = h[outputs - 1];
+            }
+            acc[j] = _mm_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < quarterTaps; k++) {
+            for (unsigned int j = 0; j < 4; j++) {
+                acc[j] = _mm_add_ps(
+                    acc[j],
+                    _mm_mul_ps(_mm_loadu_ps(x[j] + 4 * k), _mm_loadu_ps(h[j] + 4 * k)));
+            }
+        }
+
+        _MM_TRANSPOSE4_PS(acc[0], acc[1], acc[2], acc[3]);
+        __VOLK_ATTR_ALIGNED(16) float sums[4];
+        _mm_store_ps(sums,
+                     _mm_add_ps(_mm_add_ps(acc[0], acc[1]), _mm_add_ps(acc[2], acc[3])));
+
+        for (unsigned int j = 0; j < outputs; j++) {
+            float sum = sums[j];
+            for (unsigned int k = quarterTaps * 4; k < taps_per_phase; k++) {
+                sum += x[j][k] * h[j][k];
+            }
+            output[n + j] = sum;
+        }
+    }
+    *phase = p;
+}
+
+#endif /* LV_HAVE_SSE */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void
+volk_32f_x2_polyphase_resample_32f_u_avx2_fma(float* output,
+                                              const float* input,
+                                              const float* taps,
+                                              unsigned int num_phases,
+                                              unsigned int taps_per_phase,
+                                              unsigned int decimation,
+                                              unsigned int* phase,
+                                              unsigned int num_points)
+{
+    const unsigned int eighthTaps = taps_per_phase / 8;
+    const __m256i tail = _mm256_tail_mask(taps_per_phase - eighthTaps * 8);
+    unsigned int p = *phase;
+
+    // eight outputs, each with its own phase and input window, per pass; the
+    // horizontal sums of all eight are done together at the end
+    for (unsigned int n = 0; n < num_points; n += 8) {
+        const unsigned int outputs = num_points - n < 8 ? num_points - n : 8;
+        const float* x[8];
+        const float* h[8];
+        __m256 acc[8];
+        for (unsigned int j = 0; j < 8; j++) {
+            if (j < outputs) {
+                x[j] = input;
+                h[j] = taps + (size_t)p * taps_per_phase;
+                p += decimation;
+                input += p / num_phases;
+                p %= num_phases;
+            } else {
+                // short last block: repeat its last output, the result is dropped
+                x[j] = x[outputs - 1];
+                h[j] = h[outputs - 1];
+            }
+            acc[j] = _mm256_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < eighthTaps; k++) {
+            for (unsigned int j = 0; j < 8; j++) {
+                acc[j] = _mm256_fmadd_ps(
+                    _mm256_loadu_ps(x[j] + 8 * k), _mm256_loadu_ps(h[j] + 8 * k), acc[j]);
+            }
+        }
+        if (taps_per_phase & 7) {
+            for (unsigned int j = 0; j < 8; j++) {
+                acc[j] = _mm256_fmadd_ps(_mm256_maskload_ps(x[j] + 8 * eighthTaps, tail),
+                                         _mm256_maskload_ps(h[j] + 8 * eighthTaps, tail),
+                                         acc[j]);
+            }
+        }
+
+        const __m256 sums = _mm256_transpose_sum8_ps(
+            acc[0], acc[1], acc[2], acc[3], acc[4], acc[5], acc[6], acc[7]);
+        _mm256_maskstore_ps(output + n, _mm256_tail_mask(outputs), sums);
+    }
+    *phase = p;
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_polyphase_resample_32f_neon(float* output,
+                                                           const float* input,
+                                                           const float* taps,
+                                                           unsigned int num_phases,
+                                                           unsigned int taps_per_phase,
+                                                           unsigned int decimation,
+                                                           unsigned int* phase,
+                                                           unsigned int num_points)
+{
+    const unsigned int quarterTaps = taps_per_phase / 4;
+    unsigned int p = *phase;
+
+    // four outputs, each with its own phase and input window, per pass
+    for (unsigned int n = 0; n < num_points; n += 4) {
+        const unsigned int outputs = num_points - n < 4 ? num_points - n : 4;
+        const float* x[4];
+        const float* h[4];
+        float32x4_t acc[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            if (j < outputs) {
+                x[j] = input;
+                h[j] = taps + (size_t)p * taps_per_phase;
+                p += decimation;
+                input += p / num_phases;
+                p %= num_phases;
+            } else {
+                // short last block: repeat its last output, the result is dropped
+                x[j] = x[outputs - 1];
+                h[j] = h[outputs - 1];
+            }
+            acc[j] = vdupq_n_f32(0);
+        }
+
+        for (unsigned int k = 0; k < quarterTaps; k++) {
+            for (unsigned int j = 0; j < 4; j++) {
+                acc[j] =
+                    vmlaq_f32(acc[j], vld1q_f32(x[j] + 4 * k), vld1q_f32(h[j] + 4 * k));
+            }
+        }
+
+        float32x2_t half[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            half[j] = vadd_f32(vget_low_f32(acc[j]), vget_high_f32(acc[j]));
+        }
+        __VOLK_ATTR_ALIGNED(16) float sums[4];
+        vst1q_f32(sums,
+                  vcombine_f32(vpadd_f32(half[0], half[1]), vpadd_f32(half[2], half[3])));
+
+        for (unsigned int j = 0; j < outputs; j++) {
+            float sum = sums[j];
+            for (unsigned int k = quarterTaps * 4; k < taps_per_phase; k++) {
+                sum += x[j][k] * h[j][k];
+            }
+            output[n + j] = sum;
+        }
+    }
+    *phase = p;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_polyphase_resample_32f_u_H */
@@ -0,0 +1,114 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32f_x2_polyphase_resamplepuppet_32f_H
+#define INCLUDED_volk_32f_x2_polyphase_resamplepuppet_32f_H
+
+#include <volk/volk_32f_x2_polyphase_resample_32f.h>
+
+// Test geometry: a VOLK_RESAMPLE_PUPPET_PHASES phase filterbank of
+// VOLK_RESAMPLE_PUPPET_TAPS taps per phase, resampling by
+// VOLK_RESAMPLE_PUPPET_PHASES / VOLK_RESAMPLE_PUPPET_DECIM from phase
+// VOLK_RESAMPLE_PUPPET_PHASE0, as many outputs as the input of num_points
+// holds.
+#ifndef VOLK_RESAMPLE_PUPPET_PHASES
+#define VOLK_RESAMPLE_PUPPET_PHASES 8
+#define VOLK_RESAMPLE_PUPPET_TAPS 13
+#define VOLK_RESAMPLE_PUPPET_DECIM 11
+#define VOLK_RESAMPLE_PUPPET_PHASE0 3
+#define VOLK_RESAMPLE_PUPPET_COUNT(num_points)                               \
+    ((num_points) < VOLK_RESAMPLE_PUPPET_PHASES * VOLK_RESAMPLE_PUPPET_TAPS \
+         ? 0                                                                 \
+         : ((num_points)-VOLK_RESAMPLE_PUPPET_TAPS) *                        \
+               VOLK_RESAMPLE_PUPPET_PHASES / VOLK_RESAMPLE_PUPPET_DECIM)
+#endif
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32f_x2_polyphase_resamplepuppet_32f_generic(float* output,
+                                                 const float* input,
+                                                 const float* taps,
+                                                 unsigned int num_points)
+{
+    unsigned int phase = VOLK_RESAMPLE_PUPPET_PHASE0;
+    volk_32f_x2_polyphase_resample_32f_generic(output,
+                                               input,
+                                               taps,
+                                               VOLK_RESAMPLE_PUPPET_PHASES,
+                                               VOLK_RESAMPLE_PUPPET_TAPS,
+                                               VOLK_RESAMPLE_PUPPET_DECIM,
+                                               &phase,
+                                               VOLK_RESAMPLE_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32f_x2_polyphase_resamplepuppet_32f_u_sse(float* output,
+                                                                  const float* input,
+                                                                  const float* taps,
+                                                                  unsigned int num_points)
+{
+    unsigned int phase = VOLK_RESAMPLE_PUPPET_PHASE0;
+    volk_32f_x2_polyphase_resample_32f_u_sse(output,
+                                             input,
+                                             taps,
+                                             VOLK_RESAMPLE_PUPPET_PHASES,
+                                             VOLK_RESAMPLE_PUPPET_TAPS,
+                                             VOLK_RESAMPLE_PUPPET_DECIM,
+                                             &phase,
+                                             VOLK_RESAMPLE_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_SSE */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void
+volk_32f_x2_polyphase_resamplepuppet_32f_u_avx2_fma(float* output,
+                                                    const float* input,
+                                                    const float* taps,
+                                                    unsigned int num_points)
+{
+    unsigned int phase = VOLK_RESAMPLE_PUPPET_PHASE0;
+    volk_32f_x2_polyphase_resample_32f_u_avx2_fma(output,
+                                                  input,
+                                                  taps,
+                                                  VOLK_RESAMPLE_PUPPET_PHASES,
+                                                  VOLK_RESAMPLE_PUPPET_TAPS,
+                                                  VOLK_RESAMPLE_PUPPET_DECIM,
+                                                  &phase,
+                                                  VOLK_RESAMPLE_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_x2_polyphase_resamplepuppet_32f_neon(float* output,
+                                                                 const float* input,
+                                                                 const float* taps,
+                                                                 unsigned int num_points)
+{
+    unsigned int phase = VOLK_RESAMPLE_PUPPET_PHASE0;
+    volk_32f_x2_polyphase_resample_32f_neon(output,
+                                            input,
+                                            taps,
+                                            VOLK_RESAMPLE_PUPPET_PHASES,
+                                            VOLK_RESAMPLE_PUPPET_TAPS,
+                                            VOLK_RESAMPLE_PUPPET_DECIM,
+                                            &phase,
+                                            VOLK_RESAMPLE_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_polyphase_resamplepuppet_32f_H */
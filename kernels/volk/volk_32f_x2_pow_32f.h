@@ -504,6 +504,45 @@ static inline void volk_32f_x2_pow_32f_a_sse4_1(float* cVector,
 
 #endif /* LV_HAVE_SSE4_1 for aligned */
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_x2_pow_32f_a_avx512f(float* cVector,
+                                                 const float* bVector,
+                                                 const float* aVector,
+                                                 unsigned int num_points)
+{
+    float* cPtr = cVector;
+    const float* bPtr = bVector;
+    const float* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const __m512 ln2 = _mm512_set1_ps(0.6931471805f);
+
+    for (; number < sixteenthPoints; number++) {
+        // b * ln(a), then exp(b * ln(a))
+        const __m512 logarithm =
+            _mm512_mul_ps(_mm512_log2_ps_avx512f(_mm512_load_ps(aPtr)), ln2);
+        const __m512 cVal =
+            _mm512_exp_ps_avx512f(_mm512_mul_ps(_mm512_load_ps(bPtr), logarithm));
+        _mm512_store_ps(cPtr, cVal);
+
+        aPtr += 16;
+        bPtr += 16;
+        cPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *cPtr++ = powf(*aPtr++, *bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F for aligned */
+
 #endif /* INCLUDED_volk_32f_x2_pow_32f_a_H */
 
 #ifndef INCLUDED_volk_32f_x2_pow_32f_u_H
@@ -974,4 +1013,79 @@ static inline void volk_32f_x2_pow_32f_u_avx2(float* cVector,
 
 #endif /* LV_HAVE_AVX2 for unaligned */
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_x2_pow_32f_u_avx512f(float* cVector,
+                                                 const float* bVector,
+                                                 const float* aVector,
+                                                 unsigned int num_points)
+{
+    float* cPtr = cVector;
+    const float* bPtr = bVector;
+    const float* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const __m512 ln2 = _mm512_set1_ps(0.6931471805f);
+
+    for (; number < sixteenthPoints; number++) {
+        // b * ln(a), then exp(b * ln(a))
+        const __m512 logarithm =
+            _mm512_mul_ps(_mm512_log2_ps_avx512f(_mm512_loadu_ps(aPtr)), ln2);
+        const __m512 cVal =
+            _mm512_exp_ps_avx512f(_mm512_mul_ps(_mm512_loadu_ps(bPtr), logarithm));
+        _mm512_storeu_ps(cPtr, cVal);
+
+        aPtr += 16;
+        bPtr += 16;
+        cPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *cPtr++ = powf(*aPtr++, *bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F for unaligned */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_x2_pow_32f_neon(float* cVector,
+                                            const float* bVector,
+                                            const float* aVector,
+                                            unsigned int num_points)
+{
+    float* cPtr = cVector;
+    const float* bPtr = bVector;
+    const float* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float32x4_t ln2 = vdupq_n_f32(0.6931471805f);
+
+    for (; number < quarterPoints; number++) {
+        // b * ln(a), then exp(b * ln(a))
+        const float32x4_t logarithm = vmulq_f32(_vlog2q_f32(vld1q_f32(aPtr)), ln2);
+        vst1q_f32(cPtr, _vexpq_f32(vmulq_f32(vld1q_f32(bPtr), logarithm)));
+
+        aPtr += 4;
+        bPtr += 4;
+        cPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *cPtr++ = powf(*aPtr++, *bPtr++);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
 #endif /* INCLUDED_volk_32f_x2_log2_32f_u_H */
@@ -0,0 +1,302 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_16f_dot_prod_32fc
+ *
+ * \b Overview
+ *
+ * Computes the dot product of a vector of complex floats and a vector of half
+ * precision real taps, accumulating in single precision. This is one output of a
+ * complex FIR filter with taps stored at half the memory traffic.
+ *
+ * The 16 bit values are IEEE 754 half precision floats (binary16) held in
+ * uint16_t, see volk/volk_float16.h.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_16f_dot_prod_32fc(lv_32fc_t* result, const lv_32fc_t* input,
+ *                                  const uint16_t* taps, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: The complex samples.
+ * \li taps: The half precision taps.
+ * \li num_points: The number of values in both input vectors.
+ *
+ * \b Outputs
+ * \li result: The complex dot product.
+ *
+ * \b Example
+ * Filter one output with half precision taps.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* x = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   uint16_t* t = (uint16_t*)volk_malloc(sizeof(uint16_t) * N, alignment);
+ *   lv_32fc_t y;
+ *
+ *   // fill in
+ *
+ *   volk_32fc_16f_dot_prod_32fc(&y, x, t, N);
+ *
+ *   volk_free(x);
+ *   volk_free(t);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_16f_dot_prod_32fc_a_H
+#define INCLUDED_volk_32fc_16f_dot_prod_32fc_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_float16.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_16f_dot_prod_32fc_generic(lv_32fc_t* result,
+                                                       const lv_32fc_t* input,
+                                                       const uint16_t* taps,
+                                                       unsigned int num_points)
+{
+    float res[2] = { 0.f, 0.f };
+    for (unsigned int number = 0; number < num_points; number++) {
+        const float tap = volk_16f_to_32f(taps[number]);
+        res[0] += lv_creal(input[number]) * tap;
+        res[1] += lv_cimag(input[number]) * tap;
+    }
+    *result = lv_cmake(res[0], res[1]);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_F16C && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_16f_dot_prod_32fc_a_f16c_fma(lv_32fc_t* result,
+                                                          const lv_32fc_t* input,
+                                                          const uint16_t* taps,
+                                                          unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    __m256 dotProdVal0 = _mm256_setzero_ps();
+    __m256 dotProdVal1 = _mm256_setzero_ps();
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const __m256 t =
+            _mm256_cvtph_ps(_mm_load_si128((const __m128i*)(taps + number)));
+        // t0 t0 t1 t1 t4 t4 t5 t5 and t2 t2 t3 t3 t6 t6 t7 t7
+        const __m256 tLow = _mm256_unpacklo_ps(t, t);
+        const __m256 tHigh = _mm256_unpackhi_ps(t, t);
+        const float* in = (const float*)(input + number);
+        dotProdVal0 = _mm256_fmadd_ps(_mm256_load_ps(in),
+                                      _mm256_permute2f128_ps(tLow, tHigh, 0x20),
+                                      dotProdVal0);
+        dotProdVal1 = _mm256_fmadd_ps(_mm256_load_ps(in + 8),
+                                      _mm256_permute2f128_ps(tLow, tHigh, 0x31),
+                                      dotProdVal1);
+    }
+
+    __VOLK_ATTR_ALIGNED(32) float dotProductVector[8];
+    _mm256_store_ps(dotProductVector, _mm256_add_ps(dotProdVal0, dotProdVal1));
+    float res[2] = { 0.f, 0.f };
+    for (int i = 0; i < 8; i += 2) {
+        res[0] += dotProductVector[i];
+        res[1] += dotProductVector[i + 1];
+    }
+
+    for (; number < num_points; number++) {
+        const float tap = volk_16f_to_32f(taps[number]);
+        res[0] += lv_creal(input[number]) * tap;
+        res[1] += lv_cimag(input[number]) * tap;
+    }
+    *result = lv_cmake(res[0], res[1]);
+}
+
+#endif /* LV_HAVE_F16C && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_16f_dot_prod_32fc_a_avx512f(lv_32fc_t* result,
+                                                         const lv_32fc_t* input,
+                                                         const uint16_t* taps,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i lowIndexes =
+        _mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0);
+    const __m512i highIndexes =
+        _mm512_set_epi32(15, 15, 14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8);
+    __m512 dotProdVal0 = _mm512_setzero_ps();
+    __m512 dotProdVal1 = _mm512_setzero_ps();
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m512 t =
+            _mm512_cvtph_ps(_mm256_load_si256((const __m256i*)(taps + number)));
+        const float* in = (const float*)(input + number);
+        dotProdVal0 = _mm512_fmadd_ps(
+            _mm512_load_ps(in), _mm512_permutexvar_ps(lowIndexes, t), dotProdVal0);
+        dotProdVal1 = _mm512_fmadd_ps(
+            _mm512_load_ps(in + 16), _mm512_permutexvar_ps(highIndexes, t), dotProdVal1);
+    }
+
+    __VOLK_ATTR_ALIGNED(64) float dotProductVector[16];
+    _mm512_store_ps(dotProductVector, _mm512_add_ps(dotProdVal0, dotProdVal1));
+    float res[2] = { 0.f, 0.f };
+    for (int i = 0; i < 16; i += 2) {
+        res[0] += dotProductVector[i];
+        res[1] += dotProductVector[i + 1];
+    }
+
+    for (; number < num_points; number++) {
+        const float tap = volk_16f_to_32f(taps[number]);
+        res[0] += lv_creal(input[number]) * tap;
+        res[1] += lv_cimag(input[number]) * tap;
+    }
+    *result = lv_cmake(res[0], res[1]);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_16f_dot_prod_32fc_a_H */
+
+#ifndef INCLUDED_volk_32fc_16f_dot_prod_32fc_u_H
+#define INCLUDED_volk_32fc_16f_dot_prod_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_float16.h>
+
+#if LV_HAVE_F16C && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_16f_dot_prod_32fc_u_f16c_fma(lv_32fc_t* result,
+                                                          const lv_32fc_t* input,
+                                                          const uint16_t* taps,
+                                                          unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    __m256 dotProdVal0 = _mm256_setzero_ps();
+    __m256 dotProdVal1 = _mm256_setzero_ps();
+    unsigned int number = 0;
+
+    for (; number < eighthPoints * 8; number += 8) {
+        const __m256 t =
+            _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(taps + number)));
+        // t0 t0 t1 t1 t4 t4 t5 t5 and t2 t2 t3 t3 t6 t6 t7 t7
+        const __m256 tLow = _mm256_unpacklo_ps(t, t);
+        const __m256 tHigh = _mm256_unpackhi_ps(t, t);
+        const float* in = (const float*)(input + number);
+        dotProdVal0 = _mm256_fmadd_ps(_mm256_loadu_ps(in),
+                                      _mm256_permute2f128_ps(tLow, tHigh, 0x20),
+                                      dotProdVal0);
+        dotProdVal1 = _mm256_fmadd_ps(_mm256_loadu_ps(in + 8),
+                                      _mm256_permute2f128_ps(tLow, tHigh, 0x31),
+                                      dotProdVal1);
+    }
+
+    __VOLK_ATTR_ALIGNED(32) float dotProductVector[8];
+    _mm256_storeu_ps(dotProductVector, _mm256_add_ps(dotProdVal0, dotProdVal1));
+    float res[2] = { 0.f, 0.f };
+    for (int i = 0; i < 8; i += 2) {
+        res[0] += dotProductVector[i];
+        res[1] += dotProductVector[i + 1];
+    }
+
+    for (; number < num_points; number++) {
+        const float tap = volk_16f_to_32f(taps[number]);
+        res[0] += lv_creal(input[number]) * tap;
+        res[1] += lv_cimag(input[number]) * tap;
+    }
+    *result = lv_cmake(res[0], res[1]);
+}
+
+#endif /* LV_HAVE_F16C && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_16f_dot_prod_32fc_u_avx512f(lv_32fc_t* result,
+                                                         const lv_32fc_t* input,
+                                                         const uint16_t* taps,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i lowIndexes =
+        _mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0);
+    const __m512i highIndexes =
+        _mm512_set_epi32(15, 15, 14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8);
+    __m512 dotProdVal0 = _mm512_setzero_ps();
+    __m512 dotProdVal1 = _mm512_setzero_ps();
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints * 16; number += 16) {
+        const __m512 t =
+            _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(taps + number)));
+        const float* in = (const float*)(input + number);
+        dotProdVal0 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(in), _mm512_permutexvar_ps(lowIndexes, t), dotProdVal0);
+        dotProdVal1 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(in + 16), _mm512_permutexvar_ps(highIndexes, t), dotProdVal1);
+    }
+
+    __VOLK_ATTR_ALIGNED(64) float dotProductVector[16];
+    _mm512_storeu_ps(dotProductVector, _mm512_add_ps(dotProdVal0, dotProdVal1));
+    float res[2] = { 0.f, 0.f };
+    for (int i = 0; i < 16; i += 2) {
+        res[0] += dotProductVector[i];
+        res[1] += dotProductVector[i + 1];
+    }
+
+    for (; number < num_points; number++) {
+        const float tap = volk_16f_to_32f(taps[number]);
+        res[0] += lv_creal(input[number]) * tap;
+        res[1] += lv_cimag(input[number]) * tap;
+    }
+    *result = lv_cmake(res[0], res[1]);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32fc_16f_dot_prod_32fc_neonv8(lv_32fc_t* result,
+                                                      const lv_32fc_t* input,
+                                                      const uint16_t* taps,
+                                                      unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    float32x4_t realVal = vdupq_n_f32(0.f);
+    float32x4_t imagVal = vdupq_n_f32(0.f);
+    unsigned int number = 0;
+
+    for (; number < quarterPoints * 4; number += 4) {
+        const float32x4_t t = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(taps + number)));
+        const float32x4x2_t in = vld2q_f32((const float*)(input + number));
+        realVal = vfmaq_f32(realVal, in.val[0], t);
+        imagVal = vfmaq_f32(imagVal, in.val[1], t);
+    }
+
+    float res[2] = { vaddvq_f32(realVal), vaddvq_f32(imagVal) };
+
+    for (; number < num_points; number++) {
+        const float tap = volk_16f_to_32f(taps[number]);
+        res[0] += lv_creal(input[number]) * tap;
+        res[1] += lv_cimag(input[number]) * tap;
+    }
+    *result = lv_cmake(res[0], res[1]);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_16f_dot_prod_32fc_u_H */
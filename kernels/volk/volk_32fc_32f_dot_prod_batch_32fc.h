@@ -0,0 +1,210 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_32f_dot_prod_batch_32fc
+ *
+ * \b Overview
+ *
+ * Computes \p num_batches dot products of complex input vectors with real
+ * taps in one call. Batch b uses the vectors starting at
+ * input + b * input_stride and taps + b * taps_stride; a taps_stride of 0
+ * applies the same taps to every input vector. This avoids the per-call
+ * overhead of volk_32fc_32f_dot_prod_32fc for many short vectors, and the
+ * SIMD versions reduce several batches at once.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_dot_prod_batch_32fc(lv_32fc_t* result, const lv_32fc_t* input,
+ * const float* taps, unsigned int input_stride, unsigned int taps_stride, unsigned int
+ * num_batches, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: first vector of batch 0.
+ * \li taps: taps vector of batch 0.
+ * \li input_stride: distance in points between consecutive input vectors.
+ * \li taps_stride: distance in points between consecutive taps vectors.
+ * \li num_batches: number of dot products.
+ * \li num_points: number of points in each vector.
+ *
+ * \b Outputs
+ * \li result: vector of \p num_batches dot products.
+ *
+ * \b Example
+ * Filter outputs of a 32 tap real filter at 100 positions, 4 samples apart.
+ * \code
+ *   unsigned int ntaps = 32, nout = 100, step = 4;
+ *   size_t alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(
+ *       sizeof(lv_32fc_t) * (step * (nout - 1) + ntaps), alignment);
+ *   float* taps = (float*)volk_malloc(sizeof(float) * ntaps, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * nout, alignment);
+ *
+ *   // fill in and taps
+ *
+ *   volk_32fc_32f_dot_prod_batch_32fc(out, in, taps, step, 0, nout, ntaps);
+ *
+ *   volk_free(in);
+ *   volk_free(taps);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_dot_prod_batch_32fc_u_H
+#define INCLUDED_volk_32fc_32f_dot_prod_batch_32fc_u_H
+
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32f_dot_prod_batch_32fc_generic(lv_32fc_t* result,
+                                                             const lv_32fc_t* input,
+                                                             const float* taps,
+                                                             unsigned int input_stride,
+                                                             unsigned int taps_stride,
+                                                             unsigned int num_batches,
+                                                             unsigned int num_points)
+{
+    for (unsigned int b = 0; b < num_batches; b++) {
+        const float* in = (const float*)(input + (size_t)b * input_stride);
+        const float* tp = taps + (size_t)b * taps_stride;
+        float re = 0.f, im = 0.f;
+        for (unsigned int i = 0; i < num_points; i++) {
+            re += in[2 * i] * tp[i];
+            im += in[2 * i + 1] * tp[i];
+        }
+        result[b] = lv_cmake(re, im);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_32f_dot_prod_batch_32fc_u_avx(lv_32fc_t* result,
+                                                           const lv_32fc_t* input,
+                                                           const float* taps,
+                                                           unsigned int input_stride,
+                                                           unsigned int taps_stride,
+                                                           unsigned int num_batches,
+                                                           unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const unsigned int rem = num_points - quarterPoints * 4;
+    const __m256i tail = _mm256_tail_mask(2 * rem);
+    const __m128i taps_tail = _mm256_castsi256_si128(_mm256_tail_mask(rem));
+
+    // four batches per iteration, reduced together at the end
+    for (unsigned int b = 0; b < num_batches; b += 4) {
+        const unsigned int batches = num_batches - b < 4 ? num_batches - b : 4;
+        const float* in[4];
+        const float* tp[4];
+        __m256 acc[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            // short last group: repeat its last batch, the result is dropped
+            const unsigned int bj = b + (j < batches ? j : batches - 1);
+            in[j] = (const float*)(input + (size_t)bj * input_stride);
+            tp[j] = taps + (size_t)bj * taps_stride;
+            acc[j] = _mm256_setzero_ps();
+        }
+
+        for (unsigned int number = 0; number < quarterPoints; number++) {
+            for (unsigned int j = 0; j < 4; j++) {
+                const __m128 t = _mm_loadu_ps(tp[j]);
+                // t0,t0,t1,t1,t2,t2,t3,t3
+                const __m256 tt =
+                    _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_unpacklo_ps(t, t)),
+                                         _mm_unpackhi_ps(t, t),
+                                         1);
+                acc[j] =
+                    _mm256_add_ps(acc[j], _mm256_mul_ps(_mm256_loadu_ps(in[j]), tt));
+                in[j] += 8;
+                tp[j] += 4;
+            }
+        }
+        if (rem) {
+            for (unsigned int j = 0; j < 4; j++) {
+                const __m128 t = _mm_maskload_ps(tp[j], taps_tail);
+                const __m256 tt =
+                    _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_unpacklo_ps(t, t)),
+                                         _mm_unpackhi_ps(t, t),
+                                         1);
+                const __m256 x = _mm256_maskload_ps(in[j], tail);
+                acc[j] = _mm256_add_ps(acc[j], _mm256_mul_ps(x, tt));
+            }
+        }
+
+        const __m256 sums =
+            _mm256_complex_transpose_sum4_ps(acc[0], acc[1], acc[2], acc[3]);
+        _mm256_maskstore_ps((float*)(result + b), _mm256_tail_mask(2 * batches), sums);
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_32f_dot_prod_batch_32fc_neon(lv_32fc_t* result,
+                                                          const lv_32fc_t* input,
+                                                          const float* taps,
+                                                          unsigned int input_stride,
+                                                          unsigned int taps_stride,
+                                                          unsigned int num_batches,
+                                                          unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    // four batches per iteration on deinterleaved real and imaginary parts;
+    // the horizontal sums of all four are done together at the end
+    for (unsigned int b = 0; b < num_batches; b += 4) {
+        const unsigned int batches = num_batches - b < 4 ? num_batches - b : 4;
+        const lv_32fc_t* in[4];
+        const float* tp[4];
+        float32x4_t acc_re[4], acc_im[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            // short last group: repeat its last batch, the result is dropped
+            const unsigned int bj = b + (j < batches ? j : batches - 1);
+            in[j] = input + (size_t)bj * input_stride;
+            tp[j] = taps + (size_t)bj * taps_stride;
+            acc_re[j] = vdupq_n_f32(0.f);
+            acc_im[j] = vdupq_n_f32(0.f);
+        }
+
+        for (unsigned int number = 0; number < quarterPoints; number++) {
+            for (unsigned int j = 0; j < 4; j++) {
+                const float32x4x2_t x = vld2q_f32((const float*)in[j]);
+                const float32x4_t y = vld1q_f32(tp[j]);
+                acc_re[j] = vmlaq_f32(acc_re[j], x.val[0], y);
+                acc_im[j] = vmlaq_f32(acc_im[j], x.val[1], y);
+                in[j] += 4;
+                tp[j] += 4;
+            }
+        }
+
+        float re[4], im[4];
+        vst1q_f32(re, _vtranspose_sum4q_f32(acc_re[0], acc_re[1], acc_re[2], acc_re[3]));
+        vst1q_f32(im, _vtranspose_sum4q_f32(acc_im[0], acc_im[1], acc_im[2], acc_im[3]));
+        for (unsigned int j = 0; j < batches; j++) {
+            lv_32fc_t sum = lv_cmake(re[j], im[j]);
+            for (unsigned int number = quarterPoints * 4; number < num_points; number++)
+                sum += (*in[j]++) * (*tp[j]++);
+            result[b + j] = sum;
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_dot_prod_batch_32fc_u_H */
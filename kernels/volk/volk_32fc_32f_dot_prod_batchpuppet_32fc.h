@@ -0,0 +1,81 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_dot_prod_batchpuppet_32fc_H
+#define INCLUDED_volk_32fc_32f_dot_prod_batchpuppet_32fc_H
+
+#include <volk/volk_32fc_32f_dot_prod_batch_32fc.h>
+
+// Test geometry: vectors of VOLK_BATCH_PUPPET_LEN points that start every
+// VOLK_BATCH_PUPPET_STRIDE points, as many as fit into num_points.
+#ifndef VOLK_BATCH_PUPPET_LEN
+#define VOLK_BATCH_PUPPET_LEN 23
+#define VOLK_BATCH_PUPPET_STRIDE 27
+#define VOLK_BATCH_PUPPET_COUNT(num_points) \
+    ((num_points) < VOLK_BATCH_PUPPET_LEN   \
+         ? 0                                \
+         : ((num_points)-VOLK_BATCH_PUPPET_LEN) / VOLK_BATCH_PUPPET_STRIDE + 1)
+#endif
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_32f_dot_prod_batchpuppet_32fc_generic(lv_32fc_t* result,
+                                                const lv_32fc_t* input,
+                                                const float* taps,
+                                                unsigned int num_points)
+{
+    volk_32fc_32f_dot_prod_batch_32fc_generic(result,
+                                              input,
+                                              taps,
+                                              VOLK_BATCH_PUPPET_STRIDE,
+                                              0,
+                                              VOLK_BATCH_PUPPET_COUNT(num_points),
+                                              VOLK_BATCH_PUPPET_LEN);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_32f_dot_prod_batchpuppet_32fc_u_avx(lv_32fc_t* result,
+                                                                 const lv_32fc_t* input,
+                                                                 const float* taps,
+                                                                 unsigned int num_points)
+{
+    volk_32fc_32f_dot_prod_batch_32fc_u_avx(result,
+                                            input,
+                                            taps,
+                                            VOLK_BATCH_PUPPET_STRIDE,
+                                            0,
+                                            VOLK_BATCH_PUPPET_COUNT(num_points),
+                                            VOLK_BATCH_PUPPET_LEN);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_32f_dot_prod_batchpuppet_32fc_neon(lv_32fc_t* result,
+                                                                const lv_32fc_t* input,
+                                                                const float* taps,
+                                                                unsigned int num_points)
+{
+    volk_32fc_32f_dot_prod_batch_32fc_neon(result,
+                                           input,
+                                           taps,
+                                           VOLK_BATCH_PUPPET_STRIDE,
+                                           0,
+                                           VOLK_BATCH_PUPPET_COUNT(num_points),
+                                           VOLK_BATCH_PUPPET_LEN);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_dot_prod_batchpuppet_32fc_H */
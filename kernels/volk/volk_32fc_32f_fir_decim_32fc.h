@@ -0,0 +1,363 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_32f_fir_decim_32fc
+ *
+ * \b Overview
+ *
+ * Runs a FIR filter with real taps over a complex input and keeps every
+ * \p decimation-th output:
+ *
+ * output[n] = sum(input[n * decimation + k] * taps[k]) for k in [0, num_taps)
+ *
+ * The taps are applied in the same order as in volk_32fc_32f_dot_prod_32fc,
+ * so pass them reversed to get the convolution. The input has to hold
+ * (num_points - 1) * decimation + num_taps samples.
+ *
+ * The SIMD versions compute several outputs per pass over the taps, so every
+ * tap load is shared by a whole block of outputs.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_fir_decim_32fc(lv_32fc_t* output, const lv_32fc_t* input, const
+ * float* taps, unsigned int num_taps, unsigned int decimation, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: The complex input samples.
+ * \li taps: The real filter taps.
+ * \li num_taps: The number of taps.
+ * \li decimation: The distance in input samples between consecutive outputs.
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li output: The filtered and decimated samples.
+ *
+ * \b Example
+ * Channel filter a block of baseband samples and decimate by 8.
+ * \code
+ *   unsigned int num_taps = 127;
+ *   unsigned int decim = 8;
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(
+ *       sizeof(lv_32fc_t) * ((N - 1) * decim + num_taps), alignment);
+ *   float* taps = (float*)volk_malloc(sizeof(float) * num_taps, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   // fill taps and in
+ *
+ *   volk_32fc_32f_fir_decim_32fc(out, in, taps, num_taps, decim, N);
+ *
+ *   volk_free(in);
+ *   volk_free(taps);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_fir_decim_32fc_u_H
+#define INCLUDED_volk_32fc_32f_fir_decim_32fc_u_H
+
+#include <stddef.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32f_fir_decim_32fc_generic(lv_32fc_t* output,
+                                                        const lv_32fc_t* input,
+                                                        const float* taps,
+                                                        unsigned int num_taps,
+                                                        unsigned int decimation,
+                                                        unsigned int num_points)
+{
+    for (unsigned int n = 0; n < num_points; n++) {
+        const float* in = (const float*)(input + (size_t)n * decimation);
+        float sum_re = 0.f;
+        float sum_im = 0.f;
+        for (unsigned int k = 0; k < num_taps; k++) {
+            sum_re += in[2 * k] * taps[k];
+            sum_im += in[2 * k + 1] * taps[k];
+        }
+        output[n] = lv_cmake(sum_re, sum_im);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32fc_32f_fir_decim_32fc_u_sse(lv_32fc_t* output,
+                                                      const lv_32fc_t* input,
+                                                      const float* taps,
+                                                      unsigned int num_taps,
+                                                      unsigned int decimation,
+                                                      unsigned int num_points)
+{
+    const unsigned int quarterTaps = num_taps / 4;
+
+    // four outputs per pass over the taps, one accumulator each
+    for (unsigned int n = 0; n < num_points; n += 4) {
+        const unsigned int outputs = num_points - n < 4 ? num_points - n : 4;
+        const float* in[4];
+        __m128 acc[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            // short last block: repeat its last output, the result is dropped
+            const unsigned int nj = n + (j < outputs ? j : outputs - 1);
+            in[j] = (const float*)(input + (size_t)nj * decimation);
+            acc[j] = _mm_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < quarterTaps; k++) {
+            const __m128 t = _mm_loadu_ps(taps + 4 * k);
+            const __m128 t01 = _mm_unpacklo_ps(t, t); // t0|t0|t1|t1
+            const __m128 t23 = _mm_unpackhi_ps(t, t); // t2|t2|t3|t3
+            for (unsigned int j = 0; j < 4; j++) {
+                const float* x = in[j] + 8 * k;
+                acc[j] = _mm_add_ps(acc[j], _mm_mul_ps(_mm_loadu_ps(x), t01));
+                acc[j] = _mm_add_ps(acc[j], _mm_mul_ps(_mm_loadu_ps(x + 4), t23));
+            }
+        }
+
+        // each accumulator holds two partial complex sums
+        __VOLK_ATTR_ALIGNED(16) lv_32fc_t sums[4];
+        _mm_store_ps((float*)sums,
+                     _mm_add_ps(_mm_movelh_ps(acc[0], acc[1]),
+                                _mm_movehl_ps(acc[1], acc[0])));
+        _mm_store_ps((float*)(sums + 2),
+                     _mm_add_ps(_mm_movelh_ps(acc[2], acc[3]),
+                                _mm_movehl_ps(acc[3], acc[2])));
+
+        for (unsigned int j = 0; j < outputs; j++) {
+            float sum_re = lv_creal(sums[j]);
+            float sum_im = lv_cimag(sums[j]);
+            for (unsigned int k = quarterTaps * 4; k < num_taps; k++) {
+                sum_re += in[j][2 * k] * taps[k];
+                sum_im += in[j][2 * k + 1] * taps[k];
+            }
+            output[n + j] = lv_cmake(sum_re, sum_im);
+        }
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_32f_fir_decim_32fc_u_avx2_fma(lv_32fc_t* output,
+                                                           const lv_32fc_t* input,
+                                                           const float* taps,
+                                                           unsigned int num_taps,
+                                                           unsigned int decimation,
+                                                           unsigned int num_points)
+{
+    const unsigned int eighthTaps = num_taps / 8;
+    const unsigned int tailTaps = num_taps - eighthTaps * 8;
+    const __m256i tail = _mm256_tail_mask(tailTaps);
+    const __m256i tail0 = _mm256_tail_mask(tailTaps < 4 ? 2 * tailTaps : 8);
+    const __m256i tail1 = _mm256_tail_mask(tailTaps < 4 ? 0 : 2 * tailTaps - 8);
+
+    // eight outputs per pass over the taps, one accumulator each
+    for (unsigned int n = 0; n < num_points; n += 8) {
+        const unsigned int outputs = num_points - n < 8 ? num_points - n : 8;
+        const float* in[8];
+        __m256 acc[8];
+        for (unsigned int j = 0; j < 8; j++) {
+            // short last block: repeat its last output, the result is dropped
+            const unsigned int nj = n + (j < outputs ? j : outputs - 1);
+            in[j] = (const float*)(input + (size_t)nj * decimation);
+            acc[j] = _mm256_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < eighthTaps; k++) {
+            const __m256 t = _mm256_loadu_ps(taps + 8 * k);
+            const __m256 tlo = _mm256_unpacklo_ps(t, t); // t0|t0|t1|t1|t4|t4|t5|t5
+            const __m256 thi = _mm256_unpackhi_ps(t, t); // t2|t2|t3|t3|t6|t6|t7|t7
+            const __m256 t0 = _mm256_permute2f128_ps(tlo, thi, 0x20);
+            const __m256 t1 = _mm256_permute2f128_ps(tlo, thi, 0x31);
+            for (unsigned int j = 0; j < 8; j++) {
+                const float* x = in[j] + 16 * k;
+                acc[j] = _mm256_fmadd_ps(_mm256_loadu_ps(x), t0, acc[j]);
+                acc[j] = _mm256_fmadd_ps(_mm256_loadu_ps(x + 8), t1, acc[j]);
+            }
+        }
+        if (tailTaps) {
+            const __m256 t = _mm256_maskload_ps(taps + 8 * eighthTaps, tail);
+            const __m256 tlo = _mm256_unpacklo_ps(t, t);
+            const __m256 thi = _mm256_unpackhi_ps(t, t);
+            const __m256 t0 = _mm256_permute2f128_ps(tlo, thi, 0x20);
+            const __m256 t1 = _mm256_permute2f128_ps(tlo, thi, 0x31);
+            for (unsigned int j = 0; j < 8; j++) {
+                const float* x = in[j] + 16 * eighthTaps;
+                acc[j] = _mm256_fmadd_ps(_mm256_maskload_ps(x, tail0), t0, acc[j]);
+                acc[j] = _mm256_fmadd_ps(_mm256_maskload_ps(x + 8, tail1), t1, acc[j]);
+            }
+        }
+
+        __VOLK_ATTR_ALIGNED(32) lv_32fc_t sums[8];
+        _mm256_store_ps((float*)sums,
+                        _mm256_complex_transpose_sum4_ps(acc[0], acc[1], acc[2], acc[3]));
+        _mm256_store_ps((float*)(sums + 4),
+                        _mm256_complex_transpose_sum4_ps(acc[4], acc[5], acc[6], acc[7]));
+        for (unsigned int j = 0; j < outputs; j++) {
+            output[n + j] = sums[j];
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_32f_fir_decim_32fc_u_avx512f(lv_32fc_t* output,
+                                                          const lv_32fc_t* input,
+                                                          const float* taps,
+                                                          unsigned int num_taps,
+                                                          unsigned int decimation,
+                                                          unsigned int num_points)
+{
+    const unsigned int sixteenthTaps = num_taps / 16;
+    const unsigned int tailTaps = num_taps - sixteenthTaps * 16;
+    const __mmask16 tail = (__mmask16)((1u << tailTaps) - 1);
+    const __mmask16 tail0 =
+        (__mmask16)(tailTaps < 8 ? (1u << (2 * tailTaps)) - 1 : 0xffff);
+    const __mmask16 tail1 =
+        (__mmask16)(tailTaps < 8 ? 0 : (1u << (2 * tailTaps - 16)) - 1);
+    // duplicate each real tap for the real and imaginary part
+    const __m512i dup0 = _mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0);
+    const __m512i dup1 =
+        _mm512_set_epi32(15, 15, 14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8);
+
+    // eight outputs per pass over the taps, one accumulator each
+    for (unsigned int n = 0; n < num_points; n += 8) {
+        const unsigned int outputs = num_points - n < 8 ? num_points - n : 8;
+        const float* in[8];
+        __m512 acc[8];
+        for (unsigned int j = 0; j < 8; j++) {
+            // short last block: repeat its last output, the result is dropped
+            const unsigned int nj = n + (j < outputs ? j : outputs - 1);
+            in[j] = (const float*)(input + (size_t)nj * decimation);
+            acc[j] = _mm512_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < sixteenthTaps; k++) {
+            const __m512 t = _mm512_loadu_ps(taps + 16 * k);
+            const __m512 t0 = _mm512_permutexvar_ps(dup0, t);
+            const __m512 t1 = _mm512_permutexvar_ps(dup1, t);
+            for (unsigned int j = 0; j < 8; j++) {
+                const float* x = in[j] + 32 * k;
+                acc[j] = _mm512_fmadd_ps(_mm512_loadu_ps(x), t0, acc[j]);
+                acc[j] = _mm512_fmadd_ps(_mm512_loadu_ps(x + 16), t1, acc[j]);
+            }
+        }
+        if (tail) {
+            const __m512 t = _mm512_maskz_loadu_ps(tail, taps + 16 * sixteenthTaps);
+            const __m512 t0 = _mm512_permutexvar_ps(dup0, t);
+            const __m512 t1 = _mm512_permutexvar_ps(dup1, t);
+            for (unsigned int j = 0; j < 8; j++) {
+                const float* x = in[j] + 32 * sixteenthTaps;
+                acc[j] = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail0, x), t0, acc[j]);
+                acc[j] =
+                    _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail1, x + 16), t1, acc[j]);
+            }
+        }
+
+        // fold each accumulator to four complex sums, then sum four at a time
+        __m256 half[8];
+        for (unsigned int j = 0; j < 8; j++) {
+            half[j] = _mm256_add_ps(
+                _mm512_castps512_ps256(acc[j]),
+                _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc[j]), 1)));
+        }
+        __VOLK_ATTR_ALIGNED(32) lv_32fc_t sums[8];
+        _mm256_store_ps(
+            (float*)sums,
+            _mm256_complex_transpose_sum4_ps(half[0], half[1], half[2], half[3]));
+        _mm256_store_ps(
+            (float*)(sums + 4),
+            _mm256_complex_transpose_sum4_ps(half[4], half[5], half[6], half[7]));
+        for (unsigned int j = 0; j < outputs; j++) {
+            output[n + j] = sums[j];
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_32f_fir_decim_32fc_neon(lv_32fc_t* output,
+                                                     const lv_32fc_t* input,
+                                                     const float* taps,
+                                                     unsigned int num_taps,
+                                                     unsigned int decimation,
+                                                     unsigned int num_points)
+{
+    const unsigned int quarterTaps = num_taps / 4;
+
+    // four outputs per pass over the taps, separate real and imaginary
+    // accumulators for each
+    for (unsigned int n = 0; n < num_points; n += 4) {
+        const unsigned int outputs = num_points - n < 4 ? num_points - n : 4;
+        const float* in[4];
+        float32x4_t acc_re[4];
+        float32x4_t acc_im[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            // short last block: repeat its last output, the result is dropped
+            const unsigned int nj = n + (j < outputs ? j : outputs - 1);
+            in[j] = (const float*)(input + (size_t)nj * decimation);
+            acc_re[j] = vdupq_n_f32(0);
+            acc_im[j] = vdupq_n_f32(0);
+        }
+
+        for (unsigned int k = 0; k < quarterTaps; k++) {
+            const float32x4_t t = vld1q_f32(taps + 4 * k);
+            for (unsigned int j = 0; j < 4; j++) {
+                const float32x4x2_t x = vld2q_f32(in[j] + 8 * k);
+                acc_re[j] = vmlaq_f32(acc_re[j], x.val[0], t);
+                acc_im[j] = vmlaq_f32(acc_im[j], x.val[1], t);
+            }
+        }
+
+        float32x2_t half_re[4];
+        float32x2_t half_im[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            half_re[j] = vadd_f32(vget_low_f32(acc_re[j]), vget_high_f32(acc_re[j]));
+            half_im[j] = vadd_f32(vget_low_f32(acc_im[j]), vget_high_f32(acc_im[j]));
+        }
+        float32x4x2_t sum;
+        sum.val[0] = vcombine_f32(vpadd_f32(half_re[0], half_re[1]),
+                                  vpadd_f32(half_re[2], half_re[3]));
+        sum.val[1] = vcombine_f32(vpadd_f32(half_im[0], half_im[1]),
+                                  vpadd_f32(half_im[2], half_im[3]));
+        __VOLK_ATTR_ALIGNED(16) lv_32fc_t sums[4];
+        vst2q_f32((float*)sums, sum);
+
+        for (unsigned int j = 0; j < outputs; j++) {
+            float sum_re = lv_creal(sums[j]);
+            float sum_im = lv_cimag(sums[j]);
+            for (unsigned int k = quarterTaps * 4; k < num_taps; k++) {
+                sum_re += in[j][2 * k] * taps[k];
+                sum_im += in[j][2 * k + 1] * taps[k];
+            }
+            output[n + j] = lv_cmake(sum_re, sum_im);
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_fir_decim_32fc_u_H */
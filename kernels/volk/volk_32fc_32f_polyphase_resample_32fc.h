@@ -0,0 +1,351 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_32f_polyphase_resample_32fc
+ *
+ * \b Overview
+ *
+ * Resamples a complex signal by the rational factor num_phases / decimation
+ * with a polyphase filterbank of real taps.
+ *
+ * The filterbank holds num_phases phases of taps_per_phase taps each, phase p
+ * starting at taps + p * taps_per_phase. Each output is the dot product of a
+ * phase with a window of the input, as in volk_32fc_32f_dot_prod_32fc. After
+ * every output the phase advances by \p decimation, and the input window
+ * moves forward by one sample for every num_phases it wraps around.
+ *
+ * For a prototype low pass filter h of num_phases * taps_per_phase taps,
+ * designed at the interpolated rate, tap k of phase p is
+ * h[p + (taps_per_phase - 1 - k) * num_phases], scaled by num_phases for unity
+ * gain.
+ *
+ * \p phase carries the filterbank phase from one call to the next. With
+ * \p phase as it was on entry, the input has to hold
+ * (phase + (num_points - 1) * decimation) / num_phases + taps_per_phase
+ * samples, and the next call starts (phase + num_points * decimation) /
+ * num_phases samples further on.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_polyphase_resample_32fc(lv_32fc_t* output, const lv_32fc_t*
+ * input, const float* taps, unsigned int num_phases, unsigned int taps_per_phase,
+ * unsigned int decimation, unsigned int* phase, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: The complex input samples.
+ * \li taps: The filterbank, num_phases * taps_per_phase real taps.
+ * \li num_phases: The number of phases, the interpolation factor.
+ * \li taps_per_phase: The number of taps in each phase.
+ * \li decimation: The phase advance per output, the decimation factor.
+ * \li phase: The filterbank phase of the first output, in [0, num_phases).
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li output: The resampled signal.
+ * \li phase: The filterbank phase of the next output.
+ *
+ * \b Example
+ * Resample num_in samples by 4 / 5 in blocks of 1000 outputs.
+ * \code
+ *   unsigned int L = 4, M = 5, T = 24, N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* taps = (float*)volk_malloc(sizeof(float) * L * T, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   unsigned int phase = 0;
+ *
+ *   // fill taps from the prototype filter, as above
+ *
+ *   const lv_32fc_t* end = in + num_in;
+ *   while ((phase + (N - 1) * M) / L + T <= (unsigned int)(end - in)) {
+ *       const unsigned int consumed = (phase + N * M) / L;
+ *       volk_32fc_32f_polyphase_resample_32fc(out, in, taps, L, T, M, &phase, N);
+ *       in += consumed;
+ *       // use out
+ *   }
+ *
+ *   volk_free(taps);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_polyphase_resample_32fc_u_H
+#define INCLUDED_volk_32fc_32f_polyphase_resample_32fc_u_H
+
+#include <stddef.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_32f_polyphase_resample_32fc_generic(lv_32fc_t* output,
+                                              const lv_32fc_t* input,
+                                              const float* taps,
+                                              unsigned int num_phases,
+                                              unsigned int taps_per_phase,
+                                              unsigned int decimation,
+                                              unsigned int* phase,
+                                              unsigned int num_points)
+{
+    unsigned int p = *phase;
+    for (unsigned int n = 0; n < num_points; n++) {
+        const float* x = (const float*)input;
+        const float* h = taps + (size_t)p * taps_per_phase;
+        float sum_re = 0.f;
+        float sum_im = 0.f;
+        for (unsigned int k = 0; k < taps_per_phase; k++) {
+            sum_re += x[2 * k] * h[k];
+            sum_im += x[2 * k + 1] * h[k];
+        }
+        output[n] = lv_cmake(sum_re, sum_im);
+
+        p += decimation;
+        input += p / num_phases;
+        p %= num_phases;
+    }
+    *phase = p;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void
+volk_32fc_32f_polyphase_resample_32fc_u_sse(lv_32fc_t* output,
+                                            const lv_32fc_t* input,
+                                            const float* taps,
+                                            unsigned int num_phases,
+                                            unsigned int taps_per_phase,
+                                            unsigned int decimation,
+                                            unsigned int* phase,
+                                            unsigned int num_points)
+{
+    const unsigned int quarterTaps = taps_per_phase / 4;
+    unsigned int p = *phase;
+
+    // four outputs, each with its own phase and input window, per pass
+    for (unsigned int n = 0; n < num_points; n += 4) {
+        const unsigned int outputs = num_points - n < 4 ? num_points - n : 4;
+        const float* x[4];
+        const float* h[4];
+        __m128 acc[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            if (j < outputs) {
+                x[j] = (const float*)input;
+                h[j] = taps + (size_t)p * taps_per_phase;
+                p += decimation;
+                input += p / num_phases;
+                p %= num_phases;
+            } else {
+                // short last block: repeat its last output, the result is dropped
+                x[j] = x[outputs - 1];
+                h[j] = h[outputs - 1];
+            }
+            acc[j] = _mm_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < quarterTaps; k++) {
+            for (unsigned int j = 0; j < 4; j++) {
+                const __m128 t = _mm_loadu_ps(h[j] + 4 * k);
+                const float* xk = x[j] + 8 * k;
+                // t0|t0|t1|t1 and t2|t2|t3|t3
+                acc[j] = _mm_add_ps(
+                    acc[j], _mm_mul_ps(_mm_loadu_ps(xk), _mm_unpacklo_ps(t, t)));
+                acc[j] = _mm_add_ps(
+                    acc[j], _mm_mul_ps(_mm_loadu_ps(xk + 4), _mm_unpackhi_ps(t, t)));
+            }
+        }
+
+        // each accumulator holds two partial complex sums
+        __VOLK_ATTR_ALIGNED(16) lv_32fc_t sums[4];
+        _mm_store_ps((float*)sums,
+                     _mm_add_ps(_mm_movelh_ps(acc[0], acc[1]),
+                                _mm_movehl_ps(acc[1], acc[0])));
+        _mm_store_ps((float*)(sums + 2),
+                     _mm_add_ps(_mm_movelh_ps(acc[2], acc[3]),
+                                _mm_movehl_ps(acc[3], acc[2])));
+
+        for (unsigned int j = 0; j < outputs; j++) {
+            float sum_re = lv_creal(sums[j]);
+            float sum_im = lv_cimag(sums[j]);
+            for (unsigned int k = quarterTaps * 4; k < taps_per_phase; k++) {
+                sum_re += x[j][2 * k] * h[j][k];
+                sum_im += x[j][2 * k + 1] * h[j][k];
+            }
+            output[n + j] = lv_cmake(sum_re, sum_im);
+        }
+    }
+    *phase = p;
+}
+
+#endif /* LV_HAVE_SSE */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void
+volk_32fc_32f_polyphase_resample_32fc_u_avx2_fma(lv_32fc_t* output,
+                                                 const lv_32fc_t* input,
+                                                 const float* taps,
+                                                 unsigned int num_phases,
+                                                 unsigned int taps_per_phase,
+                                                 unsigned int decimation,
+                                                 unsigned int* phase,
+                                                 unsigned int num_points)
+{
+    const unsigned int eighthTaps = taps_per_phase / 8;
+    const unsigned int tailTaps = taps_per_phase - eighthTaps * 8;
+    const __m256i tail = _mm256_tail_mask(tailTaps);
+    const __m256i tail0 = _mm256_tail_mask(tailTaps < 4 ? 2 * tailTaps : 8);
+    const __m256i tail1 = _mm256_tail_mask(tailTaps < 4 ? 0 : 2 * tailTaps - 8);
+    // duplicate each real tap for the real and imaginary part
+    const __m256i dup0 = _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0);
+    const __m256i dup1 = _mm256_set_epi32(7, 7, 6, 6, 5, 5, 4, 4);
+    unsigned int p = *phase;
+
+    // eight outputs, each with its own phase and input window, per pass
+    for (unsigned int n = 0; n < num_points; n += 8) {
+        const unsigned int outputs = num_points - n < 8 ? num_points - n : 8;
+        const float* x[8];
+        const float* h[8];
+        __m256 acc[8];
+        for (unsigned int j = 0; j < 8; j++) {
+            if (j < outputs) {
+                x[j] = (const float*)input;
+                h[j] = taps + (size_t)p * taps_per_phase;
+                p += decimation;
+                input += p / num_phases;
+                p %= num_phases;
+            } else {
+                // short last block: repeat its last output, the result is dropped
+                x[j] = x[outputs - 1];
+                h[j] = h[outputs - 1];
+            }
+            acc[j] = _mm256_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < eighthTaps; k++) {
+            for (unsigned int j = 0; j < 8; j++) {
+                const __m256 t = _mm256_loadu_ps(h[j] + 8 * k);
+                const float* xk = x[j] + 16 * k;
+                acc[j] = _mm256_fmadd_ps(
+                    _mm256_loadu_ps(xk), _mm256_permutevar8x32_ps(t, dup0), acc[j]);
+                acc[j] = _mm256_fmadd_ps(
+                    _mm256_loadu_ps(xk + 8), _mm256_permutevar8x32_ps(t, dup1), acc[j]);
+            }
+        }
+        if (tailTaps) {
+            for (unsigned int j = 0; j < 8; j++) {
+                const __m256 t = _mm256_maskload_ps(h[j] + 8 * eighthTaps, tail);
+                const float* xk = x[j] + 16 * eighthTaps;
+                acc[j] = _mm256_fmadd_ps(_mm256_maskload_ps(xk, tail0),
+                                         _mm256_permutevar8x32_ps(t, dup0),
+                                         acc[j]);
+                acc[j] = _mm256_fmadd_ps(_mm256_maskload_ps(xk + 8, tail1),
+                                         _mm256_permutevar8x32_ps(t, dup1),
+                                         acc[j]);
+            }
+        }
+
+        __VOLK_ATTR_ALIGNED(32) lv_32fc_t sums[8];
+        _mm256_store_ps((float*)sums,
+                        _mm256_complex_transpose_sum4_ps(acc[0], acc[1], acc[2], acc[3]));
+        _mm256_store_ps((float*)(sums + 4),
+                        _mm256_complex_transpose_sum4_ps(acc[4], acc[5], acc[6], acc[7]));
+        for (unsigned int j = 0; j < outputs; j++) {
+            output[n + j] = sums[j];
+        }
+    }
+    *phase = p;
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_32f_polyphase_resample_32fc_neon(lv_32fc_t* output,
+                                                              const lv_32fc_t* input,
+                                                              const float* taps,
+                                                              unsigned int num_phases,
+                                                              unsigned int taps_per_phase,
+                                                              unsigned int decimation,
+                                                              unsigned int* phase,
+                                                              unsigned int num_points)
+{
+    const unsigned int quarterTaps = taps_per_phase / 4;
+    unsigned int p = *phase;
+
+    // four outputs, each with its own phase and input window, per pass;
+    // separate real and imaginary accumulators for each
+    for (unsigned int n = 0; n < num_points; n += 4) {
+        const unsigned int outputs = num_points - n < 4 ? num_points - n : 4;
+        const float* x[4];
+        const float* h[4];
+        float32x4_t acc_re[4];
+        float32x4_t acc_im[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            if (j < outputs) {
+                x[j] = (const float*)input;
+                h[j] = taps + (size_t)p * taps_per_phase;
+                p += decimation;
+                input += p / num_phases;
+                p %= num_phases;
+            } else {
+                // short last block: repeat its last output, the result is dropped
+                x[j] = x[outputs - 1];
+                h[j] = h[outputs - 1];
+            }
+            acc_re[j] = vdupq_n_f32(0);
+            acc_im[j] = vdupq_n_f32(0);
+        }
+
+        for (unsigned int k = 0; k < quarterTaps; k++) {
+            for (unsigned int j = 0; j < 4; j++) {
+                const float32x4_t t = vld1q_f32(h[j] + 4 * k);
+                const float32x4x2_t xk = vld2q_f32(x[j] + 8 * k);
+                acc_re[j] = vmlaq_f32(acc_re[j], xk.val[0], t);
+                acc_im[j] = vmlaq_f32(acc_im[j], xk.val[1], t);
+            }
+        }
+
+        float32x2_t half_re[4];
+        float32x2_t half_im[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            half_re[j] = vadd_f32(vget_low_f32(acc_re[j]), vget_high_f32(acc_re[j]));
+            half_im[j] = vadd_f32(vget_low_f32(acc_im[j]), vget_high_f32(acc_im[j]));
+        }
+        float32x4x2_t sum;
+        sum.val[0] = vcombine_f32(vpadd_f32(half_re[0], half_re[1]),
+                                  vpadd_f32(half_re[2], half_re[3]));
+        sum.val[1] = vcombine_f32(vpadd_f32(half_im[0], half_im[1]),
+                                  vpadd_f32(half_im[2], half_im[3]));
+        __VOLK_ATTR_ALIGNED(16) lv_32fc_t sums[4];
+        vst2q_f32((float*)sums, sum);
+
+        for (unsigned int j = 0; j < outputs; j++) {
+            float sum_re = lv_creal(sums[j]);
+            float sum_im = lv_cimag(sums[j]);
+            for (unsigned int k = quarterTaps * 4; k < taps_per_phase; k++) {
+                sum_re += x[j][2 * k] * h[j][k];
+                sum_im += x[j][2 * k + 1] * h[j][k];
+            }
+            output[n + j] = lv_cmake(sum_re, sum_im);
+        }
+    }
+    *phase = p;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_polyphase_resample_32fc_u_H */
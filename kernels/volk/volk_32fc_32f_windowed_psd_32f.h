@@ -0,0 +1,328 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_32f_windowed_psd_32f
+ *
+ * \b Overview
+ *
+ * Computes the averaged power spectral density of one frame of num_points
+ * time domain samples, num_points being a power of two. The frame is
+ * multiplied by the window and transformed as in volk_32fc_x2_fft_32fc. The
+ * power of each bin,
+ *
+ * power[k] = |fftOutput[k]|^2 / (normalizationFactor^2 * rbw)
+ *
+ * is averaged exponentially into the state,
+ *
+ * average[k] += alpha * (power[k] - average[k])
+ *
+ * and the result is written in dB, 10 * log10(average[k]), the same scaling
+ * as volk_32fc_s32f_x2_power_spectral_density_32f. Bins are in FFT order,
+ * DC first. The log is computed as in volk_32f_log2_32f, so a zero average
+ * gives -382.3 dB instead of -inf.
+ *
+ * The SIMD versions apply the window in the bit reversal pass of the FFT and
+ * compute power, average and log in a single pass over the transform, so a
+ * frame that fits in cache is read from memory once.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_windowed_psd_32f(float* logPowerOutput, float* average,
+ * lv_32fc_t* fftOutput, const lv_32fc_t* input, const float* window, const lv_32fc_t*
+ * twiddles, const float normalizationFactor, const float rbw, const float alpha,
+ * unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li average: The averaged linear power of the previous frames. Start from
+ * zeros, or use alpha = 1 for the first frame.
+ * \li input: The time domain samples, must not alias fftOutput.
+ * \li window: The window, num_points values.
+ * \li twiddles: The forward FFT twiddle factors, see volk_32fc_x2_fft_32fc.
+ * \li normalizationFactor: The power is divided by its square.
+ * \li rbw: The resolution bandwidth the power is divided by.
+ * \li alpha: The weight of the new frame in the average, in (0, 1].
+ * \li num_points: The FFT size, a power of two.
+ *
+ * \b Outputs
+ * \li logPowerOutput: The averaged power in dB.
+ * \li average: The updated average, linear power.
+ * \li fftOutput: The transform of the windowed frame.
+ *
+ * \b Example
+ * Average the spectrum of consecutive 4096 point frames with a Hann window.
+ * \code
+ *   unsigned int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* window = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float* average = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float* psd = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   lv_32fc_t* fft = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   volk_fft_plan_t* plan = volk_fft_plan_create(N, VOLK_FFT_FORWARD);
+ *   float wsum = 0.f;
+ *   for (unsigned int n = 0; n < N; n++) {
+ *       window[n] = 0.5f - 0.5f * cosf(2.f * (float)M_PI * n / N);
+ *       wsum += window[n];
+ *       average[n] = 0.f;
+ *   }
+ *
+ *   for (unsigned int f = 0; f < num_frames; f++) {
+ *       volk_32fc_32f_windowed_psd_32f(psd, average, fft, in + f * N, window,
+ *                                      volk_fft_plan_twiddles(plan), wsum, 1.f,
+ *                                      0.1f, N);
+ *       // use psd
+ *   }
+ *
+ *   volk_fft_plan_destroy(plan);
+ *   volk_free(window);
+ *   volk_free(average);
+ *   volk_free(psd);
+ *   volk_free(fft);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_windowed_psd_32f_u_H
+#define INCLUDED_volk_32fc_32f_windowed_psd_32f_u_H
+
+#include <math.h>
+#include <volk/volk_32fc_x2_fft_32fc.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32f_windowed_psd_32f_generic(float* logPowerOutput,
+                                                          float* average,
+                                                          lv_32fc_t* fftOutput,
+                                                          const lv_32fc_t* input,
+                                                          const float* window,
+                                                          const lv_32fc_t* twiddles,
+                                                          const float normalizationFactor,
+                                                          const float rbw,
+                                                          const float alpha,
+                                                          unsigned int num_points)
+{
+    const float scale = 1.f / (normalizationFactor * normalizationFactor * rbw);
+    for (unsigned int i = 0; i < num_points; i++) {
+        fftOutput[i] = input[i] * window[i];
+    }
+    fft_32fc_bitrev(fftOutput, fftOutput, num_points);
+    fft_32fc_radix2_stages(fftOutput, twiddles, 1, num_points);
+
+    for (unsigned int i = 0; i < num_points; i++) {
+        const float re = lv_creal(fftOutput[i]);
+        const float im = lv_cimag(fftOutput[i]);
+        average[i] += alpha * ((re * re + im * im) * scale - average[i]);
+        logPowerOutput[i] = volk_log2to10factor * log2f_non_ieee(average[i]);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void volk_32fc_32f_windowed_psd_32f_u_sse3(float* logPowerOutput,
+                                                         float* average,
+                                                         lv_32fc_t* fftOutput,
+                                                         const lv_32fc_t* input,
+                                                         const float* window,
+                                                         const lv_32fc_t* twiddles,
+                                                         const float normalizationFactor,
+                                                         const float rbw,
+                                                         const float alpha,
+                                                         unsigned int num_points)
+{
+    const float scale = 1.f / (normalizationFactor * normalizationFactor * rbw);
+    if (num_points < 8) {
+        volk_32fc_32f_windowed_psd_32f_generic(logPowerOutput,
+                                               average,
+                                               fftOutput,
+                                               input,
+                                               window,
+                                               twiddles,
+                                               normalizationFactor,
+                                               rbw,
+                                               alpha,
+                                               num_points);
+        return;
+    }
+    fft_32fc_radix8_first(fftOutput, input, window, twiddles, num_points);
+    fft_32fc_stages_sse3((float*)fftOutput, (const float*)twiddles, num_points);
+
+    const float* x = (const float*)fftOutput;
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 valpha = _mm_set1_ps(alpha);
+    const __m128 log2to10 = _mm_set1_ps(volk_log2to10factor);
+    for (unsigned int i = 0; i < num_points; i += 4) {
+        const __m128 mag2 = _mm_magnitudesquared_ps_sse3(_mm_loadu_ps(x + 2 * i),
+                                                         _mm_loadu_ps(x + 2 * i + 4));
+        const __m128 power = _mm_mul_ps(mag2, vscale);
+        __m128 a = _mm_loadu_ps(average + i);
+        a = _mm_add_ps(a, _mm_mul_ps(valpha, _mm_sub_ps(power, a)));
+        _mm_storeu_ps(average + i, a);
+        _mm_storeu_ps(logPowerOutput + i, _mm_mul_ps(_mm_log2_ps_sse3(a), log2to10));
+    }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_fma_intrinsics.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void
+volk_32fc_32f_windowed_psd_32f_u_avx2_fma(float* logPowerOutput,
+                                          float* average,
+                                          lv_32fc_t* fftOutput,
+                                          const lv_32fc_t* input,
+                                          const float* window,
+                                          const lv_32fc_t* twiddles,
+                                          const float normalizationFactor,
+                                          const float rbw,
+                                          const float alpha,
+                                          unsigned int num_points)
+{
+    const float scale = 1.f / (normalizationFactor * normalizationFactor * rbw);
+    if (num_points < 8) {
+        volk_32fc_32f_windowed_psd_32f_generic(logPowerOutput,
+                                               average,
+                                               fftOutput,
+                                               input,
+                                               window,
+                                               twiddles,
+                                               normalizationFactor,
+                                               rbw,
+                                               alpha,
+                                               num_points);
+        return;
+    }
+    fft_32fc_radix8_first(fftOutput, input, window, twiddles, num_points);
+    fft_32fc_stages_avx2_fma((float*)fftOutput, (const float*)twiddles, num_points);
+
+    const float* x = (const float*)fftOutput;
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 valpha = _mm256_set1_ps(alpha);
+    const __m256 log2to10 = _mm256_set1_ps(volk_log2to10factor);
+    for (unsigned int i = 0; i < num_points; i += 8) {
+        const __m256 power = _mm256_mul_ps(
+            _mm256_magnitudesquared_ps(_mm256_loadu_ps(x + 2 * i),
+                                       _mm256_loadu_ps(x + 2 * i + 8)),
+            vscale);
+        __m256 a = _mm256_loadu_ps(average + i);
+        a = _mm256_fmadd_ps(valpha, _mm256_sub_ps(power, a), a);
+        _mm256_storeu_ps(average + i, a);
+        _mm256_storeu_ps(logPowerOutput + i,
+                         _mm256_mul_ps(_mm256_log2_ps_avx2_fma(a), log2to10));
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_32f_windowed_psd_32f_u_avx512f(float* logPowerOutput,
+                                         float* average,
+                                         lv_32fc_t* fftOutput,
+                                         const lv_32fc_t* input,
+                                         const float* window,
+                                         const lv_32fc_t* twiddles,
+                                         const float normalizationFactor,
+                                         const float rbw,
+                                         const float alpha,
+                                         unsigned int num_points)
+{
+    const float scale = 1.f / (normalizationFactor * normalizationFactor * rbw);
+    if (num_points < 16) {
+        volk_32fc_32f_windowed_psd_32f_generic(logPowerOutput,
+                                               average,
+                                               fftOutput,
+                                               input,
+                                               window,
+                                               twiddles,
+                                               normalizationFactor,
+                                               rbw,
+                                               alpha,
+                                               num_points);
+        return;
+    }
+    fft_32fc_radix8_first(fftOutput, input, window, twiddles, num_points);
+    fft_32fc_stages_avx512f((float*)fftOutput, (const float*)twiddles, num_points);
+
+    const float* x = (const float*)fftOutput;
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 valpha = _mm512_set1_ps(alpha);
+    const __m512 log2to10 = _mm512_set1_ps(volk_log2to10factor);
+    for (unsigned int i = 0; i < num_points; i += 16) {
+        const __m512 power = _mm512_mul_ps(
+            _mm512_magnitudesquared_ps_avx512f(_mm512_loadu_ps(x + 2 * i),
+                                               _mm512_loadu_ps(x + 2 * i + 16)),
+            vscale);
+        __m512 a = _mm512_loadu_ps(average + i);
+        a = _mm512_fmadd_ps(valpha, _mm512_sub_ps(power, a), a);
+        _mm512_storeu_ps(average + i, a);
+        _mm512_storeu_ps(logPowerOutput + i,
+                         _mm512_mul_ps(_mm512_log2_ps_avx512f(a), log2to10));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_32f_windowed_psd_32f_neon(float* logPowerOutput,
+                                                       float* average,
+                                                       lv_32fc_t* fftOutput,
+                                                       const lv_32fc_t* input,
+                                                       const float* window,
+                                                       const lv_32fc_t* twiddles,
+                                                       const float normalizationFactor,
+                                                       const float rbw,
+                                                       const float alpha,
+                                                       unsigned int num_points)
+{
+    const float scale = 1.f / (normalizationFactor * normalizationFactor * rbw);
+    if (num_points < 8) {
+        volk_32fc_32f_windowed_psd_32f_generic(logPowerOutput,
+                                               average,
+                                               fftOutput,
+                                               input,
+                                               window,
+                                               twiddles,
+                                               normalizationFactor,
+                                               rbw,
+                                               alpha,
+                                               num_points);
+        return;
+    }
+    fft_32fc_radix8_first(fftOutput, input, window, twiddles, num_points);
+    fft_32fc_stages_neon((float*)fftOutput, (const float*)twiddles, num_points);
+
+    const float* x = (const float*)fftOutput;
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    const float32x4_t valpha = vdupq_n_f32(alpha);
+    for (unsigned int i = 0; i < num_points; i += 4) {
+        const float32x4_t power =
+            vmulq_f32(_vmagnitudesquaredq_f32(vld2q_f32(x + 2 * i)), vscale);
+        float32x4_t a = vld1q_f32(average + i);
+        a = vmlaq_f32(a, valpha, vsubq_f32(power, a));
+        vst1q_f32(average + i, a);
+        vst1q_f32(logPowerOutput + i, vmulq_n_f32(_vlog2q_f32(a), volk_log2to10factor));
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_windowed_psd_32f_u_H */
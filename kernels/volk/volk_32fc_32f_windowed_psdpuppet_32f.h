@@ -0,0 +1,239 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_windowed_psdpuppet_32f_H
+#define INCLUDED_volk_32fc_32f_windowed_psdpuppet_32f_H
+
+#include <string.h>
+#include <volk/volk_32fc_32f_windowed_psd_32f.h>
+#include <volk/volk_32fc_fftpuppet_32fc.h>
+#include <volk/volk_malloc.h>
+
+// Test geometry: two frames of the largest power of two that fits twice into
+// num_points, the first one into a zeroed average with weight one, the second
+// one averaged in with weight VOLK_PSD_PUPPET_ALPHA.
+// The window is the second input, random like the samples.
+#ifndef VOLK_PSD_PUPPET_ALPHA
+#define VOLK_PSD_PUPPET_ALPHA 0.25f
+#define VOLK_PSD_PUPPET_NORM 1.5f
+#define VOLK_PSD_PUPPET_RBW 2.f
+#endif
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32f_windowed_psdpuppet_32f_generic(float* output,
+                                                                const lv_32fc_t* input,
+                                                                const float* window,
+                                                                unsigned int num_points)
+{
+    if (num_points < 2)
+        return;
+    const unsigned int n = volk_fft_puppet_size_32fc(num_points / 2);
+    const lv_32fc_t* twiddles = volk_fft_puppet_twiddles_32fc();
+    float* average = (float*)volk_malloc(n * sizeof(float), volk_get_alignment());
+    lv_32fc_t* fft = (lv_32fc_t*)volk_malloc(n * sizeof(lv_32fc_t), volk_get_alignment());
+    memset(average, 0, n * sizeof(float));
+
+    volk_32fc_32f_windowed_psd_32f_generic(output,
+                                           average,
+                                           fft,
+                                           input,
+                                           window,
+                                           twiddles,
+                                           VOLK_PSD_PUPPET_NORM,
+                                           VOLK_PSD_PUPPET_RBW,
+                                           1.f,
+                                           n);
+    volk_32fc_32f_windowed_psd_32f_generic(output,
+                                           average,
+                                           fft,
+                                           input + n,
+                                           window,
+                                           twiddles,
+                                           VOLK_PSD_PUPPET_NORM,
+                                           VOLK_PSD_PUPPET_RBW,
+                                           VOLK_PSD_PUPPET_ALPHA,
+                                           n);
+
+    volk_free(average);
+    volk_free(fft);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+
+static inline void volk_32fc_32f_windowed_psdpuppet_32f_u_sse3(float* output,
+                                                               const lv_32fc_t* input,
+                                                               const float* window,
+                                                               unsigned int num_points)
+{
+    if (num_points < 2)
+        return;
+    const unsigned int n = volk_fft_puppet_size_32fc(num_points / 2);
+    const lv_32fc_t* twiddles = volk_fft_puppet_twiddles_32fc();
+    float* average = (float*)volk_malloc(n * sizeof(float), volk_get_alignment());
+    lv_32fc_t* fft = (lv_32fc_t*)volk_malloc(n * sizeof(lv_32fc_t), volk_get_alignment());
+    memset(average, 0, n * sizeof(float));
+
+    volk_32fc_32f_windowed_psd_32f_u_sse3(output,
+                                          average,
+                                          fft,
+                                          input,
+                                          window,
+                                          twiddles,
+                                          VOLK_PSD_PUPPET_NORM,
+                                          VOLK_PSD_PUPPET_RBW,
+                                          1.f,
+                                          n);
+    volk_32fc_32f_windowed_psd_32f_u_sse3(output,
+                                          average,
+                                          fft,
+                                          input + n,
+                                          window,
+                                          twiddles,
+                                          VOLK_PSD_PUPPET_NORM,
+                                          VOLK_PSD_PUPPET_RBW,
+                                          VOLK_PSD_PUPPET_ALPHA,
+                                          n);
+
+    volk_free(average);
+    volk_free(fft);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void
+volk_32fc_32f_windowed_psdpuppet_32f_u_avx2_fma(float* output,
+                                                const lv_32fc_t* input,
+                                                const float* window,
+                                                unsigned int num_points)
+{
+    if (num_points < 2)
+        return;
+    const unsigned int n = volk_fft_puppet_size_32fc(num_points / 2);
+    const lv_32fc_t* twiddles = volk_fft_puppet_twiddles_32fc();
+    float* average = (float*)volk_malloc(n * sizeof(float), volk_get_alignment());
+    lv_32fc_t* fft = (lv_32fc_t*)volk_malloc(n * sizeof(lv_32fc_t), volk_get_alignment());
+    memset(average, 0, n * sizeof(float));
+
+    volk_32fc_32f_windowed_psd_32f_u_avx2_fma(output,
+                                              average,
+                                              fft,
+                                              input,
+                                              window,
+                                              twiddles,
+                                              VOLK_PSD_PUPPET_NORM,
+                                              VOLK_PSD_PUPPET_RBW,
+                                              1.f,
+                                              n);
+    volk_32fc_32f_windowed_psd_32f_u_avx2_fma(output,
+                                              average,
+                                              fft,
+                                              input + n,
+                                              window,
+                                              twiddles,
+                                              VOLK_PSD_PUPPET_NORM,
+                                              VOLK_PSD_PUPPET_RBW,
+                                              VOLK_PSD_PUPPET_ALPHA,
+                                              n);
+
+    volk_free(average);
+    volk_free(fft);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_32f_windowed_psdpuppet_32f_u_avx512f(float* output,
+                                                                  const lv_32fc_t* input,
+                                                                  const float* window,
+                                                                  unsigned int num_points)
+{
+    if (num_points < 2)
+        return;
+    const unsigned int n = volk_fft_puppet_size_32fc(num_points / 2);
+    const lv_32fc_t* twiddles = volk_fft_puppet_twiddles_32fc();
+    float* average = (float*)volk_malloc(n * sizeof(float), volk_get_alignment());
+    lv_32fc_t* fft = (lv_32fc_t*)volk_malloc(n * sizeof(lv_32fc_t), volk_get_alignment());
+    memset(average, 0, n * sizeof(float));
+
+    volk_32fc_32f_windowed_psd_32f_u_avx512f(output,
+                                             average,
+                                             fft,
+                                             input,
+                                             window,
+                                             twiddles,
+                                             VOLK_PSD_PUPPET_NORM,
+                                             VOLK_PSD_PUPPET_RBW,
+                                             1.f,
+                                             n);
+    volk_32fc_32f_windowed_psd_32f_u_avx512f(output,
+                                             average,
+                                             fft,
+                                             input + n,
+                                             window,
+                                             twiddles,
+                                             VOLK_PSD_PUPPET_NORM,
+                                             VOLK_PSD_PUPPET_RBW,
+                                             VOLK_PSD_PUPPET_ALPHA,
+                                             n);
+
+    volk_free(average);
+    volk_free(fft);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_32f_windowed_psdpuppet_32f_neon(float* output,
+                                                             const lv_32fc_t* input,
+                                                             const float* window,
+                                                             unsigned int num_points)
+{
+    if (num_points < 2)
+        return;
+    const unsigned int n = volk_fft_puppet_size_32fc(num_points / 2);
+    const lv_32fc_t* twiddles = volk_fft_puppet_twiddles_32fc();
+    float* average = (float*)volk_malloc(n * sizeof(float), volk_get_alignment());
+    lv_32fc_t* fft = (lv_32fc_t*)volk_malloc(n * sizeof(lv_32fc_t), volk_get_alignment());
+    memset(average, 0, n * sizeof(float));
+
+    volk_32fc_32f_windowed_psd_32f_neon(output,
+                                        average,
+                                        fft,
+                                        input,
+                                        window,
+                                        twiddles,
+                                        VOLK_PSD_PUPPET_NORM,
+                                        VOLK_PSD_PUPPET_RBW,
+                                        1.f,
+                                        n);
+    volk_32fc_32f_windowed_psd_32f_neon(output,
+                                        average,
+                                        fft,
+                                        input + n,
+                                        window,
+                                        twiddles,
+                                        VOLK_PSD_PUPPET_NORM,
+                                        VOLK_PSD_PUPPET_RBW,
+                                        VOLK_PSD_PUPPET_ALPHA,
+                                        n);
+
+    volk_free(average);
+    volk_free(fft);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_windowed_psdpuppet_32f_H */
@@ -0,0 +1,136 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_convert_16fc
+ *
+ * \b Overview
+ *
+ * Converts complex floats into complex half precision floats, rounding to
+ * nearest even. Values beyond the half precision range become infinities.
+ *
+ * The 16 bit values are IEEE 754 half precision floats (binary16) held in
+ * uint16_t, see volk/volk_float16.h. A complex value is two of them, the real
+ * part first.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_convert_16fc(uint16_t* outputVector, const lv_32fc_t* inputVector,
+ *                             unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The complex floats.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex half precision floats, 2 * num_points values.
+ *
+ * \b Example
+ * Store a block of IQ samples in half precision.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   uint16_t* out = (uint16_t*)volk_malloc(sizeof(uint16_t) * 2 * N, alignment);
+ *
+ *   // fill in
+ *
+ *   volk_32fc_convert_16fc(out, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_convert_16fc_a_H
+#define INCLUDED_volk_32fc_convert_16fc_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_32f_convert_16f.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_convert_16fc_generic(uint16_t* outputVector,
+                                                  const lv_32fc_t* inputVector,
+                                                  unsigned int num_points)
+{
+    volk_32f_convert_16f_generic(outputVector, (const float*)inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_F16C
+
+static inline void volk_32fc_convert_16fc_a_f16c(uint16_t* outputVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_32f_convert_16f_a_f16c(outputVector, (const float*)inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_F16C */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_convert_16fc_a_avx512f(uint16_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_32f_convert_16f_a_avx512f(
+        outputVector, (const float*)inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_convert_16fc_a_H */
+
+#ifndef INCLUDED_volk_32fc_convert_16fc_u_H
+#define INCLUDED_volk_32fc_convert_16fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_32f_convert_16f.h>
+
+#ifdef LV_HAVE_F16C
+
+static inline void volk_32fc_convert_16fc_u_f16c(uint16_t* outputVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_32f_convert_16f_u_f16c(outputVector, (const float*)inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_F16C */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_convert_16fc_u_avx512f(uint16_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_32f_convert_16f_u_avx512f(
+        outputVector, (const float*)inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32fc_convert_16fc_neonv8(uint16_t* outputVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_32f_convert_16f_neonv8(outputVector, (const float*)inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_convert_16fc_u_H */
@@ -0,0 +1,120 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32fc_fftpuppet_32fc_H
+#define INCLUDED_volk_32fc_fftpuppet_32fc_H
+
+#include <math.h>
+#include <volk/volk_32fc_x2_fft_32fc.h>
+#include <volk/volk_malloc.h>
+
+// Test geometry: a forward transform of the largest power of two not above
+// num_points or VOLK_FFT_PUPPET_MAX_POINTS.
+#ifndef VOLK_FFT_PUPPET_MAX_POINTS
+#define VOLK_FFT_PUPPET_MAX_POINTS 65536
+#endif
+
+static inline unsigned int volk_fft_puppet_size_32fc(unsigned int num_points)
+{
+    unsigned int n = 1;
+    while (2 * n <= num_points && 2 * n <= VOLK_FFT_PUPPET_MAX_POINTS) {
+        n *= 2;
+    }
+    return n;
+}
+
+// Forward twiddles of the largest size, computed on first use; those of every
+// smaller size are the start of the table.
+static inline const lv_32fc_t* volk_fft_puppet_twiddles_32fc(void)
+{
+    static lv_32fc_t* twiddles = NULL;
+    if (!twiddles) {
+        twiddles = (lv_32fc_t*)volk_malloc(
+            VOLK_FFT_PUPPET_MAX_POINTS * sizeof(lv_32fc_t), volk_get_alignment());
+        for (unsigned int h = 1; h < VOLK_FFT_PUPPET_MAX_POINTS; h *= 2) {
+            for (unsigned int j = 0; j < h; j++) {
+                const double arg = -M_PI * j / h;
+                twiddles[h - 1 + j] = lv_cmake((float)cos(arg), (float)sin(arg));
+            }
+        }
+    }
+    return twiddles;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_fftpuppet_32fc_generic(lv_32fc_t* output,
+                                                    const lv_32fc_t* input,
+                                                    unsigned int num_points)
+{
+    volk_32fc_x2_fft_32fc_generic(output,
+                                  input,
+                                  volk_fft_puppet_twiddles_32fc(),
+                                  volk_fft_puppet_size_32fc(num_points));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+
+static inline void volk_32fc_fftpuppet_32fc_u_sse3(lv_32fc_t* output,
+                                                   const lv_32fc_t* input,
+                                                   unsigned int num_points)
+{
+    volk_32fc_x2_fft_32fc_u_sse3(output,
+                                 input,
+                                 volk_fft_puppet_twiddles_32fc(),
+                                 volk_fft_puppet_size_32fc(num_points));
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32fc_fftpuppet_32fc_u_avx2_fma(lv_32fc_t* output,
+                                                       const lv_32fc_t* input,
+                                                       unsigned int num_points)
+{
+    volk_32fc_x2_fft_32fc_u_avx2_fma(output,
+                                     input,
+                                     volk_fft_puppet_twiddles_32fc(),
+                                     volk_fft_puppet_size_32fc(num_points));
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_fftpuppet_32fc_u_avx512f(lv_32fc_t* output,
+                                                      const lv_32fc_t* input,
+                                                      unsigned int num_points)
+{
+    volk_32fc_x2_fft_32fc_u_avx512f(output,
+                                    input,
+                                    volk_fft_puppet_twiddles_32fc(),
+                                    volk_fft_puppet_size_32fc(num_points));
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_fftpuppet_32fc_neon(lv_32fc_t* output,
+                                                 const lv_32fc_t* input,
+                                                 unsigned int num_points)
+{
+    volk_32fc_x2_fft_32fc_neon(output,
+                               input,
+                               volk_fft_puppet_twiddles_32fc(),
+                               volk_fft_puppet_size_32fc(num_points));
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_fftpuppet_32fc_H */
@@ -0,0 +1,432 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_index_max_64u
+ *
+ * \b Overview
+ *
+ * Returns Argmax_i mag(x[i]). Finds and returns the index which contains the first
+ * maximum magnitude for complex points in the given vector. Unlike
+ * volk_32fc_index_max_32u(), the index and the number of points are 64 bits
+ * wide, for vectors of 2^32 points and more.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_index_max_64u(uint64_t* target, const lv_32fc_t* src0,
+ *                               uint64_t num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li src0: The complex input vector.
+ * \li num_points: The number of samples.
+ *
+ * \b Outputs
+ * \li target: The index of the point with maximum magnitude.
+ *
+ * \b Example
+ * \code
+ *   int N = 10;
+ *   uint32_t alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   uint64_t index;
+ *
+ *   for(uint32_t ii = 0; ii < N; ++ii){
+ *       in[ii] = lv_cmake((float)ii - 4.f, 1.f);
+ *   }
+ *
+ *   volk_32fc_index_max_64u(&index, in, N);
+ *
+ *   printf("index of maximum magnitude = %" PRIu64 "\n", index);
+ *
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_index_max_64u_a_H
+#define INCLUDED_volk_32fc_index_max_64u_a_H
+
+#include <inttypes.h>
+#include <float.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+// The vector loops keep 32-bit lane indices, restarted every block of this many points
+#ifndef VOLK_INDEX_64U_BLOCK_POINTS
+#define VOLK_INDEX_64U_BLOCK_POINTS (UINT64_C(1) << 31)
+#endif
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_32fc_index_max_64u_generic(uint64_t* target,
+                                                   const lv_32fc_t* src0,
+                                                   uint64_t num_points)
+{
+    float max = 0.f;
+    uint64_t index = 0;
+
+    for (uint64_t i = 0; i < num_points; ++i) {
+        const float sq_dist =
+            lv_creal(src0[i]) * lv_creal(src0[i]) + lv_cimag(src0[i]) * lv_cimag(src0[i]);
+        if (sq_dist > max) {
+            index = i;
+            max = sq_dist;
+        }
+    }
+    target[0] = index;
+}
+
+#endif /*LV_HAVE_GENERIC*/
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32fc_index_max_64u_a_avx2(uint64_t* target,
+                                                  const lv_32fc_t* src0,
+                                                  uint64_t num_points)
+{
+    const uint64_t vectorPoints = num_points - num_points % 8;
+    const __m256i indexIncrementValues = _mm256_set1_epi32(8);
+    __VOLK_ATTR_ALIGNED(32) float maxValuesBuffer[8];
+    __VOLK_ATTR_ALIGNED(32) uint32_t maxIndexesBuffer[8];
+
+    float max = 0.f;
+    uint64_t index = 0;
+
+    for (uint64_t block = 0; block < vectorPoints;
+         block += VOLK_INDEX_64U_BLOCK_POINTS) {
+        uint64_t blockPoints = vectorPoints - block;
+        if (blockPoints > VOLK_INDEX_64U_BLOCK_POINTS) {
+            blockPoints = VOLK_INDEX_64U_BLOCK_POINTS;
+        }
+        const lv_32fc_t* inputPtr = src0 + block;
+        __m256 maxValues = _mm256_set1_ps(max);
+        __m256i maxValuesIndex = _mm256_setzero_si256();
+        __m256i currentIndexes = _mm256_set_epi32(7, 6, 3, 2, 5, 4, 1, 0);
+
+        for (uint64_t number = 0; number < blockPoints; number += 8) {
+            const __m256 in0 = _mm256_load_ps((const float*)inputPtr);
+            const __m256 in1 = _mm256_load_ps((const float*)(inputPtr + 4));
+            inputPtr += 8;
+            vector_32fc_index_max_variant0(in0,
+                                           in1,
+                                           &maxValues,
+                                           &maxValuesIndex,
+                                           &currentIndexes,
+                                           indexIncrementValues);
+        }
+
+        // the first of the maxima of the lanes, as an index into src0
+        _mm256_store_ps(maxValuesBuffer, maxValues);
+        _mm256_store_si256((__m256i*)maxIndexesBuffer, maxValuesIndex);
+        for (int i = 0; i < 8; i++) {
+            const uint64_t candidate = block + maxIndexesBuffer[i];
+            if (maxValuesBuffer[i] > max ||
+                (maxValuesBuffer[i] == max && candidate < index)) {
+                max = maxValuesBuffer[i];
+                index = candidate;
+            }
+        }
+    }
+
+    for (uint64_t number = vectorPoints; number < num_points; number++) {
+        const float sq_dist = lv_creal(src0[number]) * lv_creal(src0[number]) +
+                              lv_cimag(src0[number]) * lv_cimag(src0[number]);
+        if (sq_dist > max) {
+            index = number;
+            max = sq_dist;
+        }
+    }
+    target[0] = index;
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_index_max_64u_a_avx512f(uint64_t* target,
+                                                     const lv_32fc_t* src0,
+                                                     uint64_t num_points)
+{
+    const uint64_t vectorPoints = num_points - num_points % 16;
+    const __m512i indexIncrementValues = _mm512_set1_epi32(16);
+    __VOLK_ATTR_ALIGNED(64) float maxValuesBuffer[16];
+    __VOLK_ATTR_ALIGNED(64) uint32_t maxIndexesBuffer[16];
+
+    float max = 0.f;
+    uint64_t index = 0;
+
+    for (uint64_t block = 0; block < vectorPoints;
+         block += VOLK_INDEX_64U_BLOCK_POINTS) {
+        uint64_t blockPoints = vectorPoints - block;
+        if (blockPoints > VOLK_INDEX_64U_BLOCK_POINTS) {
+            blockPoints = VOLK_INDEX_64U_BLOCK_POINTS;
+        }
+        const lv_32fc_t* inputPtr = src0 + block;
+        __m512 maxValues = _mm512_set1_ps(max);
+        __m512i maxValuesIndex = _mm512_setzero_si512();
+        __m512i currentIndexes =
+            _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+        for (uint64_t number = 0; number < blockPoints; number += 16) {
+            const __m512 currentValues = _mm512_magnitudesquared_ps_avx512f(
+                _mm512_load_ps((const float*)inputPtr),
+                _mm512_load_ps((const float*)(inputPtr + 8)));
+            inputPtr += 16;
+            const __mmask16 compareResults =
+                _mm512_cmp_ps_mask(currentValues, maxValues, _CMP_GT_OS);
+            maxValuesIndex = _mm512_mask_blend_epi32(
+                compareResults, maxValuesIndex, currentIndexes);
+            maxValues =
+                _mm512_mask_blend_ps(compareResults, maxValues, currentValues);
+            currentIndexes = _mm512_add_epi32(currentIndexes, indexIncrementValues);
+        }
+
+        // the first of the maxima of the lanes, as an index into src0
+        _mm512_store_ps(maxValuesBuffer, maxValues);
+        _mm512_store_si512((__m512i*)maxIndexesBuffer, maxValuesIndex);
+        for (int i = 0; i < 16; i++) {
+            const uint64_t candidate = block + maxIndexesBuffer[i];
+            if (maxValuesBuffer[i] > max ||
+                (maxValuesBuffer[i] == max && candidate < index)) {
+                max = maxValuesBuffer[i];
+                index = candidate;
+            }
+        }
+    }
+
+    for (uint64_t number = vectorPoints; number < num_points; number++) {
+        const float sq_dist = lv_creal(src0[number]) * lv_creal(src0[number]) +
+                              lv_cimag(src0[number]) * lv_cimag(src0[number]);
+        if (sq_dist > max) {
+            index = number;
+            max = sq_dist;
+        }
+    }
+    target[0] = index;
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
+#endif /*INCLUDED_volk_32fc_index_max_64u_a_H*/
+
+#ifndef INCLUDED_volk_32fc_index_max_64u_u_H
+#define INCLUDED_volk_32fc_index_max_64u_u_H
+
+#include <inttypes.h>
+#include <float.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+// The vector loops keep 32-bit lane indices, restarted every block of this many points
+#ifndef VOLK_INDEX_64U_BLOCK_POINTS
+#define VOLK_INDEX_64U_BLOCK_POINTS (UINT64_C(1) << 31)
+#endif
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32fc_index_max_64u_u_avx2(uint64_t* target,
+                                                  const lv_32fc_t* src0,
+                                                  uint64_t num_points)
+{
+    const uint64_t vectorPoints = num_points - num_points % 8;
+    const __m256i indexIncrementValues = _mm256_set1_epi32(8);
+    __VOLK_ATTR_ALIGNED(32) float maxValuesBuffer[8];
+    __VOLK_ATTR_ALIGNED(32) uint32_t maxIndexesBuffer[8];
+
+    float max = 0.f;
+    uint64_t index = 0;
+
+    for (uint64_t block = 0; block < vectorPoints;
+         block += VOLK_INDEX_64U_BLOCK_POINTS) {
+        uint64_t blockPoints = vectorPoints - block;
+        if (blockPoints > VOLK_INDEX_64U_BLOCK_POINTS) {
+            blockPoints = VOLK_INDEX_64U_BLOCK_POINTS;
+        }
+        const lv_32fc_t* inputPtr = src0 + block;
+        __m256 maxValues = _mm256_set1_ps(max);
+        __m256i maxValuesIndex = _mm256_setzero_si256();
+        __m256i currentIndexes = _mm256_set_epi32(7, 6, 3, 2, 5, 4, 1, 0);
+
+        for (uint64_t number = 0; number < blockPoints; number += 8) {
+            const __m256 in0 = _mm256_loadu_ps((const float*)inputPtr);
+            const __m256 in1 = _mm256_loadu_ps((const float*)(inputPtr + 4));
+            inputPtr += 8;
+            vector_32fc_index_max_variant0(in0,
+                                           in1,
+                                           &maxValues,
+                                           &maxValuesIndex,
+                                           &currentIndexes,
+                                           indexIncrementValues);
+        }
+
+        // the first of the maxima of the lanes, as an index into src0
+        _mm256_store_ps(maxValuesBuffer, maxValues);
+        _mm256_store_si256((__m256i*)maxIndexesBuffer, maxValuesIndex);
+        for (int i = 0; i < 8; i++) {
+            const uint64_t candidate = block + maxIndexesBuffer[i];
+            if (maxValuesBuffer[i] > max ||
+                (maxValuesBuffer[i] == max && candidate < index)) {
+                max = maxValuesBuffer[i];
+                index = candidate;
+            }
+        }
+    }
+
+    for (uint64_t number = vectorPoints; number < num_points; number++) {
+        const float sq_dist = lv_creal(src0[number]) * lv_creal(src0[number]) +
+                              lv_cimag(src0[number]) * lv_cimag(src0[number]);
+        if (sq_dist > max) {
+            index = number;
+            max = sq_dist;
+        }
+    }
+    target[0] = index;
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_index_max_64u_u_avx512f(uint64_t* target,
+                                                     const lv_32fc_t* src0,
+                                                     uint64_t num_points)
+{
+    const uint64_t vectorPoints = num_points - num_points % 16;
+    const __m512i indexIncrementValues = _mm512_set1_epi32(16);
+    __VOLK_ATTR_ALIGNED(64) float maxValuesBuffer[16];
+    __VOLK_ATTR_ALIGNED(64) uint32_t maxIndexesBuffer[16];
+
+    float max = 0.f;
+    uint64_t index = 0;
+
+    for (uint64_t block = 0; block < vectorPoints;
+         block += VOLK_INDEX_64U_BLOCK_POINTS) {
+        uint64_t blockPoints = vectorPoints - block;
+        if (blockPoints > VOLK_INDEX_64U_BLOCK_POINTS) {
+            blockPoints = VOLK_INDEX_64U_BLOCK_POINTS;
+        }
+        const lv_32fc_t* inputPtr = src0 + block;
+        __m512 maxValues = _mm512_set1_ps(max);
+        __m512i maxValuesIndex = _mm512_setzero_si512();
+        __m512i currentIndexes =
+            _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+        for (uint64_t number = 0; number < blockPoints; number += 16) {
+            const __m512 currentValues = _mm512_magnitudesquared_ps_avx512f(
+                _mm512_loadu_ps((const float*)inputPtr),
+                _mm512_loadu_ps((const float*)(inputPtr + 8)));
+            inputPtr += 16;
+            const __mmask16 compareResults =
+                _mm512_cmp_ps_mask(currentValues, maxValues, _CMP_GT_OS);
+            maxValuesIndex = _mm512_mask_blend_epi32(
+                compareResults, maxValuesIndex, currentIndexes);
+            maxValues =
+                _mm512_mask_blend_ps(compareResults, maxValues, currentValues);
+            currentIndexes = _mm512_add_epi32(currentIndexes, indexIncrementValues);
+        }
+
+        // the first of the maxima of the lanes, as an index into src0
+        _mm512_store_ps(maxValuesBuffer, maxValues);
+        _mm512_store_si512((__m512i*)maxIndexesBuffer, maxValuesIndex);
+        for (int i = 0; i < 16; i++) {
+            const uint64_t candidate = block + maxIndexesBuffer[i];
+            if (maxValuesBuffer[i] > max ||
+                (maxValuesBuffer[i] == max && candidate < index)) {
+                max = maxValuesBuffer[i];
+                index = candidate;
+            }
+        }
+    }
+
+    for (uint64_t number = vectorPoints; number < num_points; number++) {
+        const float sq_dist = lv_creal(src0[number]) * lv_creal(src0[number]) +
+                              lv_cimag(src0[number]) * lv_cimag(src0[number]);
+        if (sq_dist > max) {
+            index = number;
+            max = sq_dist;
+        }
+    }
+    target[0] = index;
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_index_max_64u_neon(uint64_t* target,
+                                                const lv_32fc_t* src0,
+                                                uint64_t num_points)
+{
+    const uint64_t vectorPoints = num_points - num_points % 4;
+    const uint32x4_t indexIncrementValues = vdupq_n_u32(4);
+    const uint32_t laneIndexes[4] = { 0, 1, 2, 3 };
+    float maxValuesBuffer[4];
+    uint32_t maxIndexesBuffer[4];
+
+    float max = 0.f;
+    uint64_t index = 0;
+
+    for (uint64_t block = 0; block < vectorPoints;
+         block += VOLK_INDEX_64U_BLOCK_POINTS) {
+        uint64_t blockPoints = vectorPoints - block;
+        if (blockPoints > VOLK_INDEX_64U_BLOCK_POINTS) {
+            blockPoints = VOLK_INDEX_64U_BLOCK_POINTS;
+        }
+        const lv_32fc_t* inputPtr = src0 + block;
+        float32x4_t maxValues = vdupq_n_f32(max);
+        uint32x4_t maxValuesIndex = vdupq_n_u32(0);
+        uint32x4_t currentIndexes = vld1q_u32(laneIndexes);
+
+        for (uint64_t number = 0; number < blockPoints; number += 4) {
+            const float32x4_t currentValues =
+                _vmagnitudesquaredq_f32(vld2q_f32((const float*)inputPtr));
+            inputPtr += 4;
+            const uint32x4_t compareResults = vcgtq_f32(currentValues, maxValues);
+            maxValuesIndex =
+                vbslq_u32(compareResults, currentIndexes, maxValuesIndex);
+            maxValues = vbslq_f32(compareResults, currentValues, maxValues);
+            currentIndexes = vaddq_u32(currentIndexes, indexIncrementValues);
+        }
+
+        // the first of the maxima of the lanes, as an index into src0
+        vst1q_f32(maxValuesBuffer, maxValues);
+        vst1q_u32(maxIndexesBuffer, maxValuesIndex);
+        for (int i = 0; i < 4; i++) {
+            const uint64_t candidate = block + maxIndexesBuffer[i];
+            if (maxValuesBuffer[i] > max ||
+                (maxValuesBuffer[i] == max && candidate < index)) {
+                max = maxValuesBuffer[i];
+                index = candidate;
+            }
+        }
+    }
+
+    for (uint64_t number = vectorPoints; number < num_points; number++) {
+        const float sq_dist = lv_creal(src0[number]) * lv_creal(src0[number]) +
+                              lv_cimag(src0[number]) * lv_cimag(src0[number]);
+        if (sq_dist > max) {
+            index = number;
+            max = sq_dist;
+        }
+    }
+    target[0] = index;
+}
+
+#endif /*LV_HAVE_NEON*/
+
+#endif /*INCLUDED_volk_32fc_index_max_64u_u_H*/
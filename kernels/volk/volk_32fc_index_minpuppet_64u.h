@@ -0,0 +1,84 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32fc_index_minpuppet_64u_H
+#define INCLUDED_volk_32fc_index_minpuppet_64u_H
+
+#include <volk/volk_32fc_index_min_64u.h>
+
+// The kernel takes a uint64_t length, the test harness passes an
+// unsigned int one.
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_index_minpuppet_64u_generic(uint64_t* target,
+                                                         const lv_32fc_t* src0,
+                                                         unsigned int num_points)
+{
+    volk_32fc_index_min_64u_generic(target, src0, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32fc_index_minpuppet_64u_a_avx2(uint64_t* target,
+                                                        const lv_32fc_t* src0,
+                                                        unsigned int num_points)
+{
+    volk_32fc_index_min_64u_a_avx2(target, src0, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32fc_index_minpuppet_64u_u_avx2(uint64_t* target,
+                                                        const lv_32fc_t* src0,
+                                                        unsigned int num_points)
+{
+    volk_32fc_index_min_64u_u_avx2(target, src0, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_index_minpuppet_64u_a_avx512f(uint64_t* target,
+                                                           const lv_32fc_t* src0,
+                                                           unsigned int num_points)
+{
+    volk_32fc_index_min_64u_a_avx512f(target, src0, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_index_minpuppet_64u_u_avx512f(uint64_t* target,
+                                                           const lv_32fc_t* src0,
+                                                           unsigned int num_points)
+{
+    volk_32fc_index_min_64u_u_avx512f(target, src0, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_index_minpuppet_64u_neon(uint64_t* target,
+                                                      const lv_32fc_t* src0,
+                                                      unsigned int num_points)
+{
+    volk_32fc_index_min_64u_neon(target, src0, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_index_minpuppet_64u_H */
@@ -0,0 +1,178 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_magnitude_strided_32f
+ *
+ * \b Overview
+ *
+ * Calculates the magnitude of the points of a strided complex vector and
+ * stores them in a strided float vector:
+ *
+ * mag[i * out_stride] = |in[i * in_stride]|
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_magnitude_strided_32f(float* magnitudeVector, const lv_32fc_t*
+ * complexVector, unsigned int out_stride, unsigned int in_stride, unsigned int
+ * num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li complexVector: The complex input vector.
+ * \li out_stride: Distance in floats between consecutive output points.
+ * \li in_stride: Distance in complex points between consecutive input points.
+ * \li num_points: The number of points to process.
+ *
+ * \b Outputs
+ * \li magnitudeVector: The output magnitudes.
+ *
+ * \b Example
+ * Magnitudes of all 4 channels of an interleaved buffer, written interleaved.
+ * \code
+ *   int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* frames = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * 4 * N, alignment);
+ *   float* mag = (float*)volk_malloc(sizeof(float) * 4 * N, alignment);
+ *
+ *   // fill frames
+ *
+ *   for (unsigned int ch = 0; ch < 4; ++ch) {
+ *       volk_32fc_magnitude_strided_32f(mag + ch, frames + ch, 4, 4, N);
+ *   }
+ *
+ *   volk_free(frames);
+ *   volk_free(mag);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_magnitude_strided_32f_u_H
+#define INCLUDED_volk_32fc_magnitude_strided_32f_u_H
+
+#include <math.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_magnitude_strided_32f_generic(float* magnitudeVector,
+                                                           const lv_32fc_t* complexVector,
+                                                           unsigned int out_stride,
+                                                           unsigned int in_stride,
+                                                           unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        const float real = lv_creal(*complexVector);
+        const float imag = lv_cimag(*complexVector);
+        *magnitudeVector = sqrtf((real * real) + (imag * imag));
+        magnitudeVector += out_stride;
+        complexVector += in_stride;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+#include <volk/volk_sse_intrinsics.h>
+
+static inline void volk_32fc_magnitude_strided_32f_u_sse(float* magnitudeVector,
+                                                         const lv_32fc_t* complexVector,
+                                                         unsigned int out_stride,
+                                                         unsigned int in_stride,
+                                                         unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const float* in = (const float*)complexVector;
+        const __m128 cplxValue0 = _mm_loadu_strided_pc(in, in_stride);
+        const __m128 cplxValue1 =
+            _mm_loadu_strided_pc(in + 4 * (size_t)in_stride, in_stride);
+        _mm_storeu_strided_ps(
+            magnitudeVector, out_stride, _mm_magnitude_ps(cplxValue0, cplxValue1));
+        complexVector += 4 * (size_t)in_stride;
+        magnitudeVector += 4 * (size_t)out_stride;
+    }
+
+    volk_32fc_magnitude_strided_32f_generic(magnitudeVector,
+                                            complexVector,
+                                            out_stride,
+                                            in_stride,
+                                            num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32fc_magnitude_strided_32f_u_avx2(float* magnitudeVector,
+                                                          const lv_32fc_t* complexVector,
+                                                          unsigned int out_stride,
+                                                          unsigned int in_stride,
+                                                          unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256i in_index = _mm256_stride_index(in_stride);
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const float* in = (const float*)complexVector;
+        const __m256 cplxValue0 = _mm256_loadu_strided_pc(in, in_stride, in_index);
+        const __m256 cplxValue1 =
+            _mm256_loadu_strided_pc(in + 8 * (size_t)in_stride, in_stride, in_index);
+        const __m256 result =
+            _mm256_sqrt_ps(_mm256_magnitudesquared_ps_avx2(cplxValue0, cplxValue1));
+        _mm256_storeu_strided_ps(magnitudeVector, out_stride, result);
+        complexVector += 8 * (size_t)in_stride;
+        magnitudeVector += 8 * (size_t)out_stride;
+    }
+
+    volk_32fc_magnitude_strided_32f_generic(magnitudeVector,
+                                            complexVector,
+                                            out_stride,
+                                            in_stride,
+                                            num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_magnitude_strided_32f_neon(float* magnitudeVector,
+                                                        const lv_32fc_t* complexVector,
+                                                        unsigned int out_stride,
+                                                        unsigned int in_stride,
+                                                        unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const float32x4x2_t cplxValue =
+            _vld2q_strided_f32((const float*)complexVector, in_stride);
+        _vst1q_strided_f32(magnitudeVector,
+                           out_stride,
+                           _vsqrtq_f32(_vmagnitudesquaredq_f32(cplxValue)));
+        complexVector += 4 * (size_t)in_stride;
+        magnitudeVector += 4 * (size_t)out_stride;
+    }
+
+    volk_32fc_magnitude_strided_32f_generic(magnitudeVector,
+                                            complexVector,
+                                            out_stride,
+                                            in_stride,
+                                            num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_magnitude_strided_32f_u_H */
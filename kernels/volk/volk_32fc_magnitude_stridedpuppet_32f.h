@@ -0,0 +1,88 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32fc_magnitude_stridedpuppet_32f_H
+#define INCLUDED_volk_32fc_magnitude_stridedpuppet_32f_H
+
+#include <volk/volk_32fc_magnitude_strided_32f.h>
+
+// Test geometry: outputs every VOLK_STRIDED_PUPPET_OUT points, the first input
+// every VOLK_STRIDED_PUPPET_IN points and the second one contiguous, as many
+// points as fit into num_points.
+#ifndef VOLK_STRIDED_PUPPET_IN
+#define VOLK_STRIDED_PUPPET_IN 3
+#define VOLK_STRIDED_PUPPET_OUT 2
+#define VOLK_STRIDED_PUPPET_COUNT(num_points) ((num_points) / VOLK_STRIDED_PUPPET_IN)
+#endif
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_magnitude_stridedpuppet_32f_generic(float* magnitudeVector,
+                                              const lv_32fc_t* complexVector,
+                                              unsigned int num_points)
+{
+    volk_32fc_magnitude_strided_32f_generic(magnitudeVector,
+                                            complexVector,
+                                            VOLK_STRIDED_PUPPET_OUT,
+                                            VOLK_STRIDED_PUPPET_IN,
+                                            VOLK_STRIDED_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+
+static inline void
+volk_32fc_magnitude_stridedpuppet_32f_u_sse(float* magnitudeVector,
+                                            const lv_32fc_t* complexVector,
+                                            unsigned int num_points)
+{
+    volk_32fc_magnitude_strided_32f_u_sse(magnitudeVector,
+                                          complexVector,
+                                          VOLK_STRIDED_PUPPET_OUT,
+                                          VOLK_STRIDED_PUPPET_IN,
+                                          VOLK_STRIDED_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void
+volk_32fc_magnitude_stridedpuppet_32f_u_avx2(float* magnitudeVector,
+                                             const lv_32fc_t* complexVector,
+                                             unsigned int num_points)
+{
+    volk_32fc_magnitude_strided_32f_u_avx2(magnitudeVector,
+                                           complexVector,
+                                           VOLK_STRIDED_PUPPET_OUT,
+                                           VOLK_STRIDED_PUPPET_IN,
+                                           VOLK_STRIDED_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32fc_magnitude_stridedpuppet_32f_neon(float* magnitudeVector,
+                                           const lv_32fc_t* complexVector,
+                                           unsigned int num_points)
+{
+    volk_32fc_magnitude_strided_32f_neon(magnitudeVector,
+                                         complexVector,
+                                         VOLK_STRIDED_PUPPET_OUT,
+                                         VOLK_STRIDED_PUPPET_IN,
+                                         VOLK_STRIDED_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_magnitude_stridedpuppet_32f_H */
@@ -0,0 +1,398 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_rotator_bank_32fc
+ *
+ * \b Overview
+ *
+ * Mixes one input vector with a bank of \p num_channels oscillators, each with
+ * its own phase increment and phase, as \p num_channels calls of
+ * volk_32fc_s32fc_x2_rotator_32fc would. Channel c writes to
+ * outVector + c * out_stride. With a \p decimation above 1, each output is the
+ * sum of \p decimation consecutive rotated samples (integrate and dump), so
+ * num_points / decimation outputs are written per channel. Trailing samples
+ * that do not fill an output are not consumed and do not advance the phases.
+ *
+ * The input is processed in blocks of about ROTATOR_RELOAD samples that all
+ * channels run over before moving on, so it is read from memory only once.
+ * The SIMD versions keep four channels in the lanes of a vector and broadcast
+ * each input sample to them. The phases are renormalized after every block,
+ * or after every output if \p decimation exceeds ROTATOR_RELOAD, and are
+ * written back so that consecutive calls continue the oscillations.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_rotator_bank_32fc(lv_32fc_t* outVector,
+ *                                  const lv_32fc_t* inVector,
+ *                                  const lv_32fc_t* phase_inc,
+ *                                  lv_32fc_t* phase,
+ *                                  unsigned int out_stride,
+ *                                  unsigned int num_channels,
+ *                                  unsigned int decimation,
+ *                                  unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li inVector: The vector to be rotated.
+ * \li phase_inc: num_channels rotational velocities, expected to have unit
+ *     magnitude.
+ * \li phase: num_channels initial phases, updated to the phases after the last
+ *     consumed sample.
+ * \li out_stride: distance in points between the outputs of consecutive channels.
+ * \li num_channels: The number of oscillators.
+ * \li decimation: The number of rotated samples summed into each output, at
+ *     least 1.
+ * \li num_points: The number of values in inVector.
+ *
+ * \b Outputs
+ * \li outVector: The output of channel 0, followed by the other channels every
+ *     out_stride points.
+ *
+ * \b Example
+ * Shift a wideband signal by 64 frequencies spaced 1/64 apart.
+ * \code
+ *   unsigned int N = 8192, channels = 64;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t* out =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N * channels, alignment);
+ *   lv_32fc_t* phase_inc =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * channels, alignment);
+ *   lv_32fc_t* phase = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * channels, alignment);
+ *
+ *   // fill in with samples
+ *
+ *   for (unsigned int c = 0; c < channels; ++c) {
+ *       const float frequency = -2.f * M_PI * c / channels;
+ *       phase_inc[c] = lv_cmake(std::cos(frequency), std::sin(frequency));
+ *       phase[c] = lv_cmake(1.f, 0.f);
+ *   }
+ *
+ *   volk_32fc_rotator_bank_32fc(out, in, phase_inc, phase, N, channels, 1, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ *   volk_free(phase_inc);
+ *   volk_free(phase);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_rotator_bank_32fc_u_H
+#define INCLUDED_volk_32fc_rotator_bank_32fc_u_H
+
+#include <math.h>
+#include <stddef.h>
+#include <volk/volk_32fc_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_complex.h>
+
+// Number of outputs per renormalization block
+#define ROTATOR_BANK_BLOCK(decimation) \
+    ((decimation) < ROTATOR_RELOAD ? ROTATOR_RELOAD / (decimation) : 1)
+
+/*
+ * Runs one channel over num_outputs outputs of a block and renormalizes its
+ * phase; the generic version and the channels left over by the SIMD ones.
+ */
+static inline void volk_32fc_rotator_bank_32fc_block(lv_32fc_t* outVector,
+                                                     const lv_32fc_t* inVector,
+                                                     const lv_32fc_t phase_inc,
+                                                     lv_32fc_t* phase,
+                                                     unsigned int decimation,
+                                                     unsigned int num_outputs)
+{
+    lv_32fc_t p = *phase;
+    unsigned int i, j;
+
+    for (i = 0; i < num_outputs; ++i) {
+        lv_32fc_t acc = lv_cmake(0.f, 0.f);
+        for (j = 0; j < decimation; ++j) {
+            acc += *inVector++ * p;
+            p *= phase_inc;
+        }
+        *outVector++ = acc;
+    }
+
+    (*phase) = p / hypotf(lv_creal(p), lv_cimag(p));
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_rotator_bank_32fc_generic(lv_32fc_t* outVector,
+                                                       const lv_32fc_t* inVector,
+                                                       const lv_32fc_t* phase_inc,
+                                                       lv_32fc_t* phase,
+                                                       unsigned int out_stride,
+                                                       unsigned int num_channels,
+                                                       unsigned int decimation,
+                                                       unsigned int num_points)
+{
+    const unsigned int num_outputs = num_points / decimation;
+    const unsigned int block = ROTATOR_BANK_BLOCK(decimation);
+    unsigned int i, c;
+
+    for (i = 0; i < num_outputs; i += block) {
+        const unsigned int outputs = (num_outputs - i < block) ? num_outputs - i : block;
+        for (c = 0; c < num_channels; ++c) {
+            volk_32fc_rotator_bank_32fc_block(outVector + (size_t)c * out_stride + i,
+                                              inVector + (size_t)i * decimation,
+                                              phase_inc[c],
+                                              phase + c,
+                                              decimation,
+                                              outputs);
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_rotator_bank_32fc_u_avx(lv_32fc_t* outVector,
+                                                     const lv_32fc_t* inVector,
+                                                     const lv_32fc_t* phase_inc,
+                                                     lv_32fc_t* phase,
+                                                     unsigned int out_stride,
+                                                     unsigned int num_channels,
+                                                     unsigned int decimation,
+                                                     unsigned int num_points)
+{
+    const unsigned int num_outputs = num_points / decimation;
+    const unsigned int block = ROTATOR_BANK_BLOCK(decimation);
+    const unsigned int quarter_channels = num_channels / 4;
+    const size_t stride = (size_t)out_stride;
+    unsigned int i, c, k, n;
+    __m256 x0, x1, x2, x3, acc0, acc1, acc2, acc3;
+
+    for (i = 0; i < num_outputs; i += block) {
+        const unsigned int outputs = (num_outputs - i < block) ? num_outputs - i : block;
+        const lv_32fc_t* inBlock = inVector + (size_t)i * decimation;
+
+        for (c = 0; c < 4 * quarter_channels; c += 4) {
+            lv_32fc_t* cPtr = outVector + c * stride + i;
+            const lv_32fc_t* aPtr = inBlock;
+
+            // four phase chains, each advanced over every fourth sample
+            const __m256 inc = _mm256_loadu_ps((const float*)(phase_inc + c));
+            const __m256 inc2 = _mm256_complexmul_ps(inc, inc);
+            const __m256 inc4 = _mm256_complexmul_ps(inc2, inc2);
+            __m256 p0 = _mm256_loadu_ps((const float*)(phase + c));
+            __m256 p1 = _mm256_complexmul_ps(p0, inc);
+            __m256 p2 = _mm256_complexmul_ps(p0, inc2);
+            __m256 p3 = _mm256_complexmul_ps(p1, inc2);
+
+            if (decimation == 1) {
+                for (n = 0; n + 4 <= outputs; n += 4) {
+                    x0 = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)aPtr));
+                    x1 = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)(aPtr + 1)));
+                    x2 = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)(aPtr + 2)));
+                    x3 = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)(aPtr + 3)));
+                    x0 = _mm256_complexmul_ps(x0, p0);
+                    x1 = _mm256_complexmul_ps(x1, p1);
+                    x2 = _mm256_complexmul_ps(x2, p2);
+                    x3 = _mm256_complexmul_ps(x3, p3);
+                    p0 = _mm256_complexmul_ps(p0, inc4);
+                    p1 = _mm256_complexmul_ps(p1, inc4);
+                    p2 = _mm256_complexmul_ps(p2, inc4);
+                    p3 = _mm256_complexmul_ps(p3, inc4);
+
+                    // sample-major to channel-major
+                    _mm256_complex_transpose4_ps(&x0, &x1, &x2, &x3);
+                    _mm256_storeu_ps((float*)(cPtr + n), x0);
+                    _mm256_storeu_ps((float*)(cPtr + stride + n), x1);
+                    _mm256_storeu_ps((float*)(cPtr + 2 * stride + n), x2);
+                    _mm256_storeu_ps((float*)(cPtr + 3 * stride + n), x3);
+                    aPtr += 4;
+                }
+                for (; n < outputs; ++n) {
+                    x0 = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)aPtr));
+                    x0 = _mm256_complexmul_ps(x0, p0);
+                    p0 = _mm256_complexmul_ps(p0, inc);
+                    _mm256_storeu_complex_lanes_ps((float*)(cPtr + n), 2 * stride, x0);
+                    aPtr++;
+                }
+            } else {
+                for (n = 0; n < outputs; ++n) {
+                    acc0 = _mm256_setzero_ps();
+                    acc1 = _mm256_setzero_ps();
+                    acc2 = _mm256_setzero_ps();
+                    acc3 = _mm256_setzero_ps();
+                    for (k = 0; k + 4 <= decimation; k += 4) {
+                        x0 = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)aPtr));
+                        x1 = _mm256_castpd_ps(
+                            _mm256_broadcast_sd((const double*)(aPtr + 1)));
+                        x2 = _mm256_castpd_ps(
+                            _mm256_broadcast_sd((const double*)(aPtr + 2)));
+                        x3 = _mm256_castpd_ps(
+                            _mm256_broadcast_sd((const double*)(aPtr + 3)));
+                        acc0 = _mm256_add_ps(acc0, _mm256_complexmul_ps(x0, p0));
+                        acc1 = _mm256_add_ps(acc1, _mm256_complexmul_ps(x1, p1));
+                        acc2 = _mm256_add_ps(acc2, _mm256_complexmul_ps(x2, p2));
+                        acc3 = _mm256_add_ps(acc3, _mm256_complexmul_ps(x3, p3));
+                        p0 = _mm256_complexmul_ps(p0, inc4);
+                        p1 = _mm256_complexmul_ps(p1, inc4);
+                        p2 = _mm256_complexmul_ps(p2, inc4);
+                        p3 = _mm256_complexmul_ps(p3, inc4);
+                        aPtr += 4;
+                    }
+                    if (k < decimation) {
+                        // finish the output on the first chain, then realign the others
+                        for (; k < decimation; ++k) {
+                            x0 = _mm256_castpd_ps(
+                                _mm256_broadcast_sd((const double*)aPtr));
+                            acc0 = _mm256_add_ps(acc0, _mm256_complexmul_ps(x0, p0));
+                            p0 = _mm256_complexmul_ps(p0, inc);
+                            aPtr++;
+                        }
+                        p1 = _mm256_complexmul_ps(p0, inc);
+                        p2 = _mm256_complexmul_ps(p0, inc2);
+                        p3 = _mm256_complexmul_ps(p1, inc2);
+                    }
+                    acc0 = _mm256_add_ps(acc0, acc1);
+                    acc0 = _mm256_add_ps(acc0, _mm256_add_ps(acc2, acc3));
+                    _mm256_storeu_complex_lanes_ps((float*)(cPtr + n), 2 * stride, acc0);
+                }
+            }
+
+            // renormalize so rounding errors do not change the magnitude
+            _mm256_storeu_ps((float*)(phase + c), _mm256_normalize_ps(p0));
+        }
+
+        for (; c < num_channels; ++c) {
+            volk_32fc_rotator_bank_32fc_block(outVector + c * stride + i,
+                                              inBlock,
+                                              phase_inc[c],
+                                              phase + c,
+                                              decimation,
+                                              outputs);
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_rotator_bank_32fc_neon(lv_32fc_t* outVector,
+                                                    const lv_32fc_t* inVector,
+                                                    const lv_32fc_t* phase_inc,
+                                                    lv_32fc_t* phase,
+                                                    unsigned int out_stride,
+                                                    unsigned int num_channels,
+                                                    unsigned int decimation,
+                                                    unsigned int num_points)
+{
+    const unsigned int num_outputs = num_points / decimation;
+    const unsigned int block = ROTATOR_BANK_BLOCK(decimation);
+    const unsigned int quarter_channels = num_channels / 4;
+    const size_t stride = (size_t)out_stride;
+    unsigned int i, c, k, n, m;
+    float32x4x2_t x[4], acc[4], p[4], inc[3];
+
+    for (i = 0; i < num_outputs; i += block) {
+        const unsigned int outputs = (num_outputs - i < block) ? num_outputs - i : block;
+        const lv_32fc_t* inBlock = inVector + (size_t)i * decimation;
+
+        for (c = 0; c < 4 * quarter_channels; c += 4) {
+            lv_32fc_t* cPtr = outVector + c * stride + i;
+            const float* aPtr = (const float*)inBlock;
+
+            // inc[0..2] hold the increments over one, two and four samples
+            inc[0] = vld2q_f32((const float*)(phase_inc + c));
+            inc[1] = _vmultiply_complexq_f32(inc[0], inc[0]);
+            inc[2] = _vmultiply_complexq_f32(inc[1], inc[1]);
+            p[0] = vld2q_f32((const float*)(phase + c));
+            p[1] = _vmultiply_complexq_f32(p[0], inc[0]);
+            p[2] = _vmultiply_complexq_f32(p[0], inc[1]);
+            p[3] = _vmultiply_complexq_f32(p[1], inc[1]);
+
+            if (decimation == 1) {
+                for (n = 0; n + 4 <= outputs; n += 4) {
+                    for (m = 0; m < 4; ++m) {
+                        x[m].val[0] = vdupq_n_f32(aPtr[2 * m]);
+                        x[m].val[1] = vdupq_n_f32(aPtr[2 * m + 1]);
+                        x[m] = _vmultiply_complexq_f32(x[m], p[m]);
+                        p[m] = _vmultiply_complexq_f32(p[m], inc[2]);
+                        _vst2q_lanes_f32((float*)(cPtr + n + m), 2 * stride, x[m]);
+                    }
+                    aPtr += 8;
+                }
+                for (; n < outputs; ++n) {
+                    x[0].val[0] = vdupq_n_f32(aPtr[0]);
+                    x[0].val[1] = vdupq_n_f32(aPtr[1]);
+                    x[0] = _vmultiply_complexq_f32(x[0], p[0]);
+                    p[0] = _vmultiply_complexq_f32(p[0], inc[0]);
+                    _vst2q_lanes_f32((float*)(cPtr + n), 2 * stride, x[0]);
+                    aPtr += 2;
+                }
+            } else {
+                for (n = 0; n < outputs; ++n) {
+                    for (m = 0; m < 4; ++m) {
+                        acc[m].val[0] = vdupq_n_f32(0.f);
+                        acc[m].val[1] = vdupq_n_f32(0.f);
+                    }
+                    for (k = 0; k + 4 <= decimation; k += 4) {
+                        for (m = 0; m < 4; ++m) {
+                            x[m].val[0] = vdupq_n_f32(aPtr[2 * m]);
+                            x[m].val[1] = vdupq_n_f32(aPtr[2 * m + 1]);
+                            x[m] = _vmultiply_complexq_f32(x[m], p[m]);
+                            acc[m].val[0] = vaddq_f32(acc[m].val[0], x[m].val[0]);
+                            acc[m].val[1] = vaddq_f32(acc[m].val[1], x[m].val[1]);
+                            p[m] = _vmultiply_complexq_f32(p[m], inc[2]);
+                        }
+                        aPtr += 8;
+                    }
+                    if (k < decimation) {
+                        // finish the output on the first chain, then realign the others
+                        for (; k < decimation; ++k) {
+                            x[0].val[0] = vdupq_n_f32(aPtr[0]);
+                            x[0].val[1] = vdupq_n_f32(aPtr[1]);
+                            x[0] = _vmultiply_complexq_f32(x[0], p[0]);
+                            acc[0].val[0] = vaddq_f32(acc[0].val[0], x[0].val[0]);
+                            acc[0].val[1] = vaddq_f32(acc[0].val[1], x[0].val[1]);
+                            p[0] = _vmultiply_complexq_f32(p[0], inc[0]);
+                            aPtr += 2;
+                        }
+                        p[1] = _vmultiply_complexq_f32(p[0], inc[0]);
+                        p[2] = _vmultiply_complexq_f32(p[0], inc[1]);
+                        p[3] = _vmultiply_complexq_f32(p[1], inc[1]);
+                    }
+                    for (m = 1; m < 4; ++m) {
+                        acc[0].val[0] = vaddq_f32(acc[0].val[0], acc[m].val[0]);
+                        acc[0].val[1] = vaddq_f32(acc[0].val[1], acc[m].val[1]);
+                    }
+                    _vst2q_lanes_f32((float*)(cPtr + n), 2 * stride, acc[0]);
+                }
+            }
+
+            // renormalize so rounding errors do not change the magnitude
+            const float32x4_t inv_mag = _vinvsqrtq_f32(_vmagnitudesquaredq_f32(p[0]));
+            p[0].val[0] = vmulq_f32(p[0].val[0], inv_mag);
+            p[0].val[1] = vmulq_f32(p[0].val[1], inv_mag);
+            vst2q_f32((float*)(phase + c), p[0]);
+        }
+
+        for (; c < num_channels; ++c) {
+            volk_32fc_rotator_bank_32fc_block(outVector + c * stride + i,
+                                              inBlock,
+                                              phase_inc[c],
+                                              phase + c,
+                                              decimation,
+                                              outputs);
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_rotator_bank_32fc_u_H */
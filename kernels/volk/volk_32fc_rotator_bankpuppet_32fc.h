@@ -0,0 +1,123 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32fc_rotator_bankpuppet_32fc_H
+#define INCLUDED_volk_32fc_rotator_bankpuppet_32fc_H
+
+#include <math.h>
+#include <volk/volk_32fc_rotator_bank_32fc.h>
+#include <volk/volk_complex.h>
+
+// Test geometry: VOLK_ROTATOR_BANK_PUPPET_CHANNELS channels, so that one is
+// left over by the SIMD versions, over num_points / VOLK_ROTATOR_BANK_PUPPET_SPAN
+// samples, once for each decimation, with the outputs packed one after another.
+#ifndef VOLK_ROTATOR_BANK_PUPPET_CHANNELS
+#define VOLK_ROTATOR_BANK_PUPPET_CHANNELS 11
+#define VOLK_ROTATOR_BANK_PUPPET_SPAN 17
+
+static inline void volk_32fc_rotator_bankpuppet_32fc_phases(lv_32fc_t* phase_inc,
+                                                           lv_32fc_t* phase)
+{
+    unsigned int c;
+    for (c = 0; c < VOLK_ROTATOR_BANK_PUPPET_CHANNELS; ++c) {
+        const float frequency = 0.05f * (float)c - 0.3f;
+        phase_inc[c] = lv_cmake(cosf(frequency), sinf(frequency));
+        phase[c] = lv_cmake(cosf(0.7f * (float)c), sinf(0.7f * (float)c));
+    }
+}
+#endif
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_rotator_bankpuppet_32fc_generic(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             unsigned int num_points)
+{
+    static const unsigned int decimations[4] = { 1, 3, 8, 700 };
+    const unsigned int n = num_points / VOLK_ROTATOR_BANK_PUPPET_SPAN;
+    lv_32fc_t phase_inc[VOLK_ROTATOR_BANK_PUPPET_CHANNELS];
+    lv_32fc_t phase[VOLK_ROTATOR_BANK_PUPPET_CHANNELS];
+    unsigned int i;
+
+    for (i = 0; i < 4; ++i) {
+        const unsigned int outputs = n / decimations[i];
+        volk_32fc_rotator_bankpuppet_32fc_phases(phase_inc, phase);
+        volk_32fc_rotator_bank_32fc_generic(outVector,
+                                            inVector,
+                                            phase_inc,
+                                            phase,
+                                            outputs,
+                                            VOLK_ROTATOR_BANK_PUPPET_CHANNELS,
+                                            decimations[i],
+                                            n);
+        outVector += VOLK_ROTATOR_BANK_PUPPET_CHANNELS * outputs;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_rotator_bankpuppet_32fc_u_avx(lv_32fc_t* outVector,
+                                                           const lv_32fc_t* inVector,
+                                                           unsigned int num_points)
+{
+    static const unsigned int decimations[4] = { 1, 3, 8, 700 };
+    const unsigned int n = num_points / VOLK_ROTATOR_BANK_PUPPET_SPAN;
+    lv_32fc_t phase_inc[VOLK_ROTATOR_BANK_PUPPET_CHANNELS];
+    lv_32fc_t phase[VOLK_ROTATOR_BANK_PUPPET_CHANNELS];
+    unsigned int i;
+
+    for (i = 0; i < 4; ++i) {
+        const unsigned int outputs = n / decimations[i];
+        volk_32fc_rotator_bankpuppet_32fc_phases(phase_inc, phase);
+        volk_32fc_rotator_bank_32fc_u_avx(outVector,
+                                          inVector,
+                                          phase_inc,
+                                          phase,
+                                          outputs,
+                                          VOLK_ROTATOR_BANK_PUPPET_CHANNELS,
+                                          decimations[i],
+                                          n);
+        outVector += VOLK_ROTATOR_BANK_PUPPET_CHANNELS * outputs;
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_rotator_bankpuppet_32fc_neon(lv_32fc_t* outVector,
+                                                          const lv_32fc_t* inVector,
+                                                          unsigned int num_points)
+{
+    static const unsigned int decimations[4] = { 1, 3, 8, 700 };
+    const unsigned int n = num_points / VOLK_ROTATOR_BANK_PUPPET_SPAN;
+    lv_32fc_t phase_inc[VOLK_ROTATOR_BANK_PUPPET_CHANNELS];
+    lv_32fc_t phase[VOLK_ROTATOR_BANK_PUPPET_CHANNELS];
+    unsigned int i;
+
+    for (i = 0; i < 4; ++i) {
+        const unsigned int outputs = n / decimations[i];
+        volk_32fc_rotator_bankpuppet_32fc_phases(phase_inc, phase);
+        volk_32fc_rotator_bank_32fc_neon(outVector,
+                                         inVector,
+                                         phase_inc,
+                                         phase,
+                                         outputs,
+                                         VOLK_ROTATOR_BANK_PUPPET_CHANNELS,
+                                         decimations[i],
+                                         n);
+        outVector += VOLK_ROTATOR_BANK_PUPPET_CHANNELS * outputs;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_rotator_bankpuppet_32fc_H */
@@ -204,5 +204,197 @@ static inline void volk_32fc_s32f_atan2_32f_generic(float* outputVector,
 }
 #endif /* LV_HAVE_GENERIC */
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_fma_intrinsics.h>
+
+static inline void volk_32fc_s32f_atan2_32f_a_avx2_fma(float* outputVector,
+                                                       const lv_32fc_t* complexVector,
+                                                       const float normalizeFactor,
+                                                       unsigned int num_points)
+{
+    const float* inPtr = (const float*)complexVector;
+    float* outPtr = outputVector;
+    const float invNormalizeFactor = 1.0 / normalizeFactor;
+    const __m256 vinvNormalizeFactor = _mm256_set1_ps(invNormalizeFactor);
+    const unsigned int eighthPoints = num_points / 8;
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m256 z0 = _mm256_load_ps(inPtr);
+        const __m256 z1 = _mm256_load_ps(inPtr + 8);
+        // real and imaginary parts of the values 0, 1, 4, 5, 2, 3, 6, 7
+        const __m256 x = _mm256_shuffle_ps(z0, z1, 0x88);
+        const __m256 y = _mm256_shuffle_ps(z0, z1, 0xDD);
+        __m256 result =
+            _mm256_mul_ps(_mm256_atan2_ps_avx2_fma(y, x), vinvNormalizeFactor);
+        result = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(result), 0xD8));
+        _mm256_store_ps(outPtr, result);
+        inPtr += 16;
+        outPtr += 8;
+    }
+
+    for (unsigned int number = eighthPoints * 8; number < num_points; number++) {
+        const float real = *inPtr++;
+        const float imag = *inPtr++;
+        *outPtr++ = atan2f(imag, real) * invNormalizeFactor;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32f_atan2_32f_a_avx512f(float* outputVector,
+                                                      const lv_32fc_t* complexVector,
+                                                      const float normalizeFactor,
+                                                      unsigned int num_points)
+{
+    const float* inPtr = (const float*)complexVector;
+    float* outPtr = outputVector;
+    const float invNormalizeFactor = 1.0 / normalizeFactor;
+    const __m512 vinvNormalizeFactor = _mm512_set1_ps(invNormalizeFactor);
+    const __m512i real_idx =
+        _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i imag_idx =
+        _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 z0 = _mm512_load_ps(inPtr);
+        const __m512 z1 = _mm512_load_ps(inPtr + 16);
+        const __m512 x = _mm512_permutex2var_ps(z0, real_idx, z1);
+        const __m512 y = _mm512_permutex2var_ps(z0, imag_idx, z1);
+        _mm512_store_ps(
+            outPtr, _mm512_mul_ps(_mm512_atan2_ps_avx512f(y, x), vinvNormalizeFactor));
+        inPtr += 32;
+        outPtr += 16;
+    }
+
+    for (unsigned int number = sixteenthPoints * 16; number < num_points; number++) {
+        const float real = *inPtr++;
+        const float imag = *inPtr++;
+        *outPtr++ = atan2f(imag, real) * invNormalizeFactor;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s32f_atan2_32f_neon(float* outputVector,
+                                                 const lv_32fc_t* complexVector,
+                                                 const float normalizeFactor,
+                                                 unsigned int num_points)
+{
+    const float* inPtr = (const float*)complexVector;
+    float* outPtr = outputVector;
+    const float invNormalizeFactor = 1.0 / normalizeFactor;
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const float32x4x2_t z = vld2q_f32(inPtr);
+        vst1q_f32(outPtr,
+                  vmulq_n_f32(_vatan2q_f32(z.val[1], z.val[0]), invNormalizeFactor));
+        inPtr += 8;
+        outPtr += 4;
+    }
+
+    for (unsigned int number = quarterPoints * 4; number < num_points; number++) {
+        const float real = *inPtr++;
+        const float imag = *inPtr++;
+        *outPtr++ = atan2f(imag, real) * invNormalizeFactor;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
 
 #endif /* INCLUDED_volk_32fc_s32f_atan2_32f_a_H */
+
+#ifndef INCLUDED_volk_32fc_s32f_atan2_32f_u_H
+#define INCLUDED_volk_32fc_s32f_atan2_32f_u_H
+
+#include <math.h>
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_fma_intrinsics.h>
+
+static inline void volk_32fc_s32f_atan2_32f_u_avx2_fma(float* outputVector,
+                                                       const lv_32fc_t* complexVector,
+                                                       const float normalizeFactor,
+                                                       unsigned int num_points)
+{
+    const float* inPtr = (const float*)complexVector;
+    float* outPtr = outputVector;
+    const float invNormalizeFactor = 1.0 / normalizeFactor;
+    const __m256 vinvNormalizeFactor = _mm256_set1_ps(invNormalizeFactor);
+    const unsigned int eighthPoints = num_points / 8;
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m256 z0 = _mm256_loadu_ps(inPtr);
+        const __m256 z1 = _mm256_loadu_ps(inPtr + 8);
+        // real and imaginary parts of the values 0, 1, 4, 5, 2, 3, 6, 7
+        const __m256 x = _mm256_shuffle_ps(z0, z1, 0x88);
+        const __m256 y = _mm256_shuffle_ps(z0, z1, 0xDD);
+        __m256 result =
+            _mm256_mul_ps(_mm256_atan2_ps_avx2_fma(y, x), vinvNormalizeFactor);
+        result = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(result), 0xD8));
+        _mm256_storeu_ps(outPtr, result);
+        inPtr += 16;
+        outPtr += 8;
+    }
+
+    for (unsigned int number = eighthPoints * 8; number < num_points; number++) {
+        const float real = *inPtr++;
+        const float imag = *inPtr++;
+        *outPtr++ = atan2f(imag, real) * invNormalizeFactor;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32f_atan2_32f_u_avx512f(float* outputVector,
+                                                      const lv_32fc_t* complexVector,
+                                                      const float normalizeFactor,
+                                                      unsigned int num_points)
+{
+    const float* inPtr = (const float*)complexVector;
+    float* outPtr = outputVector;
+    const float invNormalizeFactor = 1.0 / normalizeFactor;
+    const __m512 vinvNormalizeFactor = _mm512_set1_ps(invNormalizeFactor);
+    const __m512i real_idx =
+        _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i imag_idx =
+        _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 z0 = _mm512_loadu_ps(inPtr);
+        const __m512 z1 = _mm512_loadu_ps(inPtr + 16);
+        const __m512 x = _mm512_permutex2var_ps(z0, real_idx, z1);
+        const __m512 y = _mm512_permutex2var_ps(z0, imag_idx, z1);
+        _mm512_storeu_ps(
+            outPtr, _mm512_mul_ps(_mm512_atan2_ps_avx512f(y, x), vinvNormalizeFactor));
+        inPtr += 32;
+        outPtr += 16;
+    }
+
+    for (unsigned int number = sixteenthPoints * 16; number < num_points; number++) {
+        const float real = *inPtr++;
+        const float imag = *inPtr++;
+        *outPtr++ = atan2f(imag, real) * invNormalizeFactor;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_s32f_atan2_32f_u_H */
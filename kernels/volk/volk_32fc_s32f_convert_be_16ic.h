@@ -0,0 +1,426 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_s32f_convert_be_16ic
+ *
+ * \b Overview
+ *
+ * Converts complex floats multiplied by a scalar into complex 16 bit integers
+ * in big endian (network) byte order, for transmitting VITA-49 and similar
+ * packet formats. Values are rounded to the nearest integer and saturated to
+ * the 16 bit range before the bytes are swapped.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_convert_be_16ic(lv_16sc_t* outputVector,
+ *                                     const lv_32fc_t* inputVector,
+ *                                     const float scalar, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The complex floats.
+ * \li scalar: The value the samples are multiplied by, 32767 for full scale.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The big endian complex 16 bit integers.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 2048;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_16sc_t* out = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = lv_cmake(cosf(0.1f * ii), sinf(0.1f * ii));
+ *   }
+ *
+ *   volk_32fc_s32f_convert_be_16ic(out, in, 32767.f, N);
+ *
+ *   // copy out into the packet payload
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_convert_be_16ic_a_H
+#define INCLUDED_volk_32fc_s32f_convert_be_16ic_a_H
+
+#include <inttypes.h>
+#include <limits.h>
+#include <math.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_convert_be_16ic_generic(lv_16sc_t* outputVector,
+                                                          const lv_32fc_t* inputVector,
+                                                          const float scalar,
+                                                          unsigned int num_points)
+{
+    const float* inputPtr = (const float*)inputVector;
+    uint16_t* outputPtr = (uint16_t*)outputVector;
+    const float min_val = (float)SHRT_MIN;
+    const float max_val = (float)SHRT_MAX;
+
+    for (unsigned int number = 0; number < num_points * 2; number++) {
+        float value = *inputPtr++ * scalar;
+        if (value > max_val)
+            value = max_val;
+        else if (value < min_val)
+            value = min_val;
+        const uint16_t sample = (uint16_t)(int16_t)rintf(value);
+        *outputPtr++ = (uint16_t)((sample << 8) | (sample >> 8));
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_32fc_s32f_convert_be_16ic_a_ssse3(lv_16sc_t* outputVector,
+                                                          const lv_32fc_t* inputVector,
+                                                          const float scalar,
+                                                          unsigned int num_points)
+{
+    const float* inputPtr = (const float*)inputVector;
+    uint16_t* outputPtr = (uint16_t*)outputVector;
+    const float min_val = (float)SHRT_MIN;
+    const float max_val = (float)SHRT_MAX;
+    const unsigned int quarterPoints = num_points / 4;
+    const __m128 vScalar = _mm_set1_ps(scalar);
+    const __m128 minVal = _mm_set1_ps(min_val);
+    const __m128 maxVal = _mm_set1_ps(max_val);
+    const __m128i swap =
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    unsigned int number = 0;
+
+    for (; number < quarterPoints; number++) {
+        __m128 low = _mm_load_ps(inputPtr);
+        __m128 high = _mm_load_ps(inputPtr + 4);
+        inputPtr += 8;
+
+        low = _mm_min_ps(_mm_max_ps(_mm_mul_ps(low, vScalar), minVal), maxVal);
+        high = _mm_min_ps(_mm_max_ps(_mm_mul_ps(high, vScalar), minVal), maxVal);
+        const __m128i values =
+            _mm_packs_epi32(_mm_cvtps_epi32(low), _mm_cvtps_epi32(high));
+        _mm_store_si128((__m128i*)outputPtr, _mm_shuffle_epi8(values, swap));
+        outputPtr += 8;
+    }
+
+    for (number = quarterPoints * 8; number < num_points * 2; number++) {
+        float value = *inputPtr++ * scalar;
+        if (value > max_val)
+            value = max_val;
+        else if (value < min_val)
+            value = min_val;
+        const uint16_t sample = (uint16_t)(int16_t)rintf(value);
+        *outputPtr++ = (uint16_t)((sample << 8) | (sample >> 8));
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_convert_be_16ic_a_avx2(lv_16sc_t* outputVector,
+                                                         const lv_32fc_t* inputVector,
+                                                         const float scalar,
+                                                         unsigned int num_points)
+{
+    const float* inputPtr = (const float*)inputVector;
+    uint16_t* outputPtr = (uint16_t*)outputVector;
+    const float min_val = (float)SHRT_MIN;
+    const float max_val = (float)SHRT_MAX;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 vScalar = _mm256_set1_ps(scalar);
+    const __m256 minVal = _mm256_set1_ps(min_val);
+    const __m256 maxVal = _mm256_set1_ps(max_val);
+    const __m256i swap = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        __m256 low = _mm256_load_ps(inputPtr);
+        __m256 high = _mm256_load_ps(inputPtr + 8);
+        inputPtr += 16;
+
+        low = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(low, vScalar), minVal), maxVal);
+        high = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(high, vScalar), minVal), maxVal);
+        __m256i values =
+            _mm256_packs_epi32(_mm256_cvtps_epi32(low), _mm256_cvtps_epi32(high));
+        // undo the interleaving of the 128 bit lanes by the pack
+        values = _mm256_permute4x64_epi64(values, 0xd8);
+        _mm256_store_si256((__m256i*)outputPtr, _mm256_shuffle_epi8(values, swap));
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 16; number < num_points * 2; number++) {
+        float value = *inputPtr++ * scalar;
+        if (value > max_val)
+            value = max_val;
+        else if (value < min_val)
+            value = min_val;
+        const uint16_t sample = (uint16_t)(int16_t)rintf(value);
+        *outputPtr++ = (uint16_t)((sample << 8) | (sample >> 8));
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_convert_be_16ic_a_avx512f(lv_16sc_t* outputVector,
+                                                            const lv_32fc_t* inputVector,
+                                                            const float scalar,
+                                                            unsigned int num_points)
+{
+    const float* inputPtr = (const float*)inputVector;
+    uint16_t* outputPtr = (uint16_t*)outputVector;
+    const float min_val = (float)SHRT_MIN;
+    const float max_val = (float)SHRT_MAX;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 vScalar = _mm512_set1_ps(scalar);
+    const __m512 minVal = _mm512_set1_ps(min_val);
+    const __m512 maxVal = _mm512_set1_ps(max_val);
+    const __m256i swap = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m512 low = _mm512_load_ps(inputPtr);
+        __m512 high = _mm512_load_ps(inputPtr + 16);
+        inputPtr += 32;
+
+        low = _mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(low, vScalar), minVal), maxVal);
+        high = _mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(high, vScalar), minVal), maxVal);
+        const __m256i lowValues = _mm512_cvtepi32_epi16(_mm512_cvtps_epi32(low));
+        const __m256i highValues = _mm512_cvtepi32_epi16(_mm512_cvtps_epi32(high));
+        _mm256_store_si256((__m256i*)outputPtr, _mm256_shuffle_epi8(lowValues, swap));
+        _mm256_store_si256((__m256i*)(outputPtr + 16),
+                           _mm256_shuffle_epi8(highValues, swap));
+        outputPtr += 32;
+    }
+
+    for (number = sixteenthPoints * 32; number < num_points * 2; number++) {
+        float value = *inputPtr++ * scalar;
+        if (value > max_val)
+            value = max_val;
+        else if (value < min_val)
+            value = min_val;
+        const uint16_t sample = (uint16_t)(int16_t)rintf(value);
+        *outputPtr++ = (uint16_t)((sample << 8) | (sample >> 8));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_s32f_convert_be_16ic_a_H */
+
+#ifndef INCLUDED_volk_32fc_s32f_convert_be_16ic_u_H
+#define INCLUDED_volk_32fc_s32f_convert_be_16ic_u_H
+
+#include <inttypes.h>
+#include <limits.h>
+#include <math.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_32fc_s32f_convert_be_16ic_u_ssse3(lv_16sc_t* outputVector,
+                                                          const lv_32fc_t* inputVector,
+                                                          const float scalar,
+                                                          unsigned int num_points)
+{
+    const float* inputPtr = (const float*)inputVector;
+    uint16_t* outputPtr = (uint16_t*)outputVector;
+    const float min_val = (float)SHRT_MIN;
+    const float max_val = (float)SHRT_MAX;
+    const unsigned int quarterPoints = num_points / 4;
+    const __m128 vScalar = _mm_set1_ps(scalar);
+    const __m128 minVal = _mm_set1_ps(min_val);
+    const __m128 maxVal = _mm_set1_ps(max_val);
+    const __m128i swap =
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    unsigned int number = 0;
+
+    for (; number < quarterPoints; number++) {
+        __m128 low = _mm_loadu_ps(inputPtr);
+        __m128 high = _mm_loadu_ps(inputPtr + 4);
+        inputPtr += 8;
+
+        low = _mm_min_ps(_mm_max_ps(_mm_mul_ps(low, vScalar), minVal), maxVal);
+        high = _mm_min_ps(_mm_max_ps(_mm_mul_ps(high, vScalar), minVal), maxVal);
+        const __m128i values =
+            _mm_packs_epi32(_mm_cvtps_epi32(low), _mm_cvtps_epi32(high));
+        _mm_storeu_si128((__m128i*)outputPtr, _mm_shuffle_epi8(values, swap));
+        outputPtr += 8;
+    }
+
+    for (number = quarterPoints * 8; number < num_points * 2; number++) {
+        float value = *inputPtr++ * scalar;
+        if (value > max_val)
+            value = max_val;
+        else if (value < min_val)
+            value = min_val;
+        const uint16_t sample = (uint16_t)(int16_t)rintf(value);
+        *outputPtr++ = (uint16_t)((sample << 8) | (sample >> 8));
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_convert_be_16ic_u_avx2(lv_16sc_t* outputVector,
+                                                         const lv_32fc_t* inputVector,
+                                                         const float scalar,
+                                                         unsigned int num_points)
+{
+    const float* inputPtr = (const float*)inputVector;
+    uint16_t* outputPtr = (uint16_t*)outputVector;
+    const float min_val = (float)SHRT_MIN;
+    const float max_val = (float)SHRT_MAX;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 vScalar = _mm256_set1_ps(scalar);
+    const __m256 minVal = _mm256_set1_ps(min_val);
+    const __m256 maxVal = _mm256_set1_ps(max_val);
+    const __m256i swap = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        __m256 low = _mm256_loadu_ps(inputPtr);
+        __m256 high = _mm256_loadu_ps(inputPtr + 8);
+        inputPtr += 16;
+
+        low = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(low, vScalar), minVal), maxVal);
+        high = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(high, vScalar), minVal), maxVal);
+        __m256i values =
+            _mm256_packs_epi32(_mm256_cvtps_epi32(low), _mm256_cvtps_epi32(high));
+        // undo the interleaving of the 128 bit lanes by the pack
+        values = _mm256_permute4x64_epi64(values, 0xd8);
+        _mm256_storeu_si256((__m256i*)outputPtr, _mm256_shuffle_epi8(values, swap));
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 16; number < num_points * 2; number++) {
+        float value = *inputPtr++ * scalar;
+        if (value > max_val)
+            value = max_val;
+        else if (value < min_val)
+            value = min_val;
+        const uint16_t sample = (uint16_t)(int16_t)rintf(value);
+        *outputPtr++ = (uint16_t)((sample << 8) | (sample >> 8));
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_convert_be_16ic_u_avx512f(lv_16sc_t* outputVector,
+                                                            const lv_32fc_t* inputVector,
+                                                            const float scalar,
+                                                            unsigned int num_points)
+{
+    const float* inputPtr = (const float*)inputVector;
+    uint16_t* outputPtr = (uint16_t*)outputVector;
+    const float min_val = (float)SHRT_MIN;
+    const float max_val = (float)SHRT_MAX;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 vScalar = _mm512_set1_ps(scalar);
+    const __m512 minVal = _mm512_set1_ps(min_val);
+    const __m512 maxVal = _mm512_set1_ps(max_val);
+    const __m256i swap = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m512 low = _mm512_loadu_ps(inputPtr);
+        __m512 high = _mm512_loadu_ps(inputPtr + 16);
+        inputPtr += 32;
+
+        low = _mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(low, vScalar), minVal), maxVal);
+        high = _mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(high, vScalar), minVal), maxVal);
+        const __m256i lowValues = _mm512_cvtepi32_epi16(_mm512_cvtps_epi32(low));
+        const __m256i highValues = _mm512_cvtepi32_epi16(_mm512_cvtps_epi32(high));
+        _mm256_storeu_si256((__m256i*)outputPtr, _mm256_shuffle_epi8(lowValues, swap));
+        _mm256_storeu_si256((__m256i*)(outputPtr + 16),
+                           _mm256_shuffle_epi8(highValues, swap));
+        outputPtr += 32;
+    }
+
+    for (number = sixteenthPoints * 32; number < num_points * 2; number++) {
+        float value = *inputPtr++ * scalar;
+        if (value > max_val)
+            value = max_val;
+        else if (value < min_val)
+            value = min_val;
+        const uint16_t sample = (uint16_t)(int16_t)rintf(value);
+        *outputPtr++ = (uint16_t)((sample << 8) | (sample >> 8));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32fc_s32f_convert_be_16ic_neonv8(lv_16sc_t* outputVector,
+                                                         const lv_32fc_t* inputVector,
+                                                         const float scalar,
+                                                         unsigned int num_points)
+{
+    const float* inputPtr = (const float*)inputVector;
+    uint16_t* outputPtr = (uint16_t*)outputVector;
+    const float min_val = (float)SHRT_MIN;
+    const float max_val = (float)SHRT_MAX;
+    const unsigned int quarterPoints = num_points / 4;
+    const float32x4_t minVal = vdupq_n_f32(min_val);
+    const float32x4_t maxVal = vdupq_n_f32(max_val);
+    unsigned int number = 0;
+
+    for (; number < quarterPoints; number++) {
+        float32x4_t low = vld1q_f32(inputPtr);
+        float32x4_t high = vld1q_f32(inputPtr + 4);
+        inputPtr += 8;
+
+        low = vmaxq_f32(vminq_f32(vmulq_n_f32(low, scalar), maxVal), minVal);
+        high = vmaxq_f32(vminq_f32(vmulq_n_f32(high, scalar), maxVal), minVal);
+        // round to nearest even like rintf
+        const int16x8_t values = vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(low)),
+                                              vqmovn_s32(vcvtnq_s32_f32(high)));
+        vst1q_u8((uint8_t*)outputPtr, vrev16q_u8(vreinterpretq_u8_s16(values)));
+        outputPtr += 8;
+    }
+
+    for (number = quarterPoints * 8; number < num_points * 2; number++) {
+        float value = *inputPtr++ * scalar;
+        if (value > max_val)
+            value = max_val;
+        else if (value < min_val)
+            value = min_val;
+        const uint16_t sample = (uint16_t)(int16_t)rintf(value);
+        *outputPtr++ = (uint16_t)((sample << 8) | (sample >> 8));
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_s32f_convert_be_16ic_u_H */
@@ -16,6 +16,10 @@
  * and stores the results in the return vector. The output is scaled
  * and converted to 16-bit shorts.
  *
+ * The AVX2, AVX-512 and NEON implementations use polynomial approximations of
+ * the logarithm, exponential, arctangent and sine/cosine, and agree with the
+ * generic one to about 1e-5 relative.
+ *
  * <b>Dispatcher Prototype</b>
  * \code
  * void volk_32fc_s32f_power_32fc(lv_32fc_t* cVector, const lv_32fc_t* aVector, const
@@ -47,13 +51,14 @@
 #include <stdio.h>
 
 //! raise a complex float to a real float power
+//! the argument is kept in double, a power > 1 would magnify its rounding error
 static inline lv_32fc_t __volk_s32fc_s32f_power_s32fc_a(const lv_32fc_t exp,
                                                         const float power)
 {
-    const float arg = power * atan2f(lv_creal(exp), lv_cimag(exp));
+    const double arg = power * atan2((double)lv_creal(exp), (double)lv_cimag(exp));
     const float mag =
         powf(lv_creal(exp) * lv_creal(exp) + lv_cimag(exp) * lv_cimag(exp), power / 2);
-    return mag * lv_cmake(-cosf(arg), sinf(arg));
+    return mag * lv_cmake((float)-cos(arg), (float)sin(arg));
 }
 
 #ifdef LV_HAVE_SSE
@@ -136,6 +141,113 @@ static inline void volk_32fc_s32f_power_32fc_a_sse(lv_32fc_t* cVector,
 }
 #endif /* LV_HAVE_SSE */
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_fma_intrinsics.h>
+
+static inline void volk_32fc_s32f_power_32fc_a_avx2_fma(lv_32fc_t* cVector,
+                                                        const lv_32fc_t* aVector,
+                                                        const float power,
+                                                        unsigned int num_points)
+{
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const __m256 vPower = _mm256_set1_ps(power);
+    // |a|^power = (|a|^2)^(power / 2)
+    const __m256 vHalfPower = _mm256_set1_ps(power * 0.5f);
+
+    for (; number < eighthPoints; number++) {
+        const __m256 cplxValue1 = _mm256_load_ps((const float*)aPtr);
+        const __m256 cplxValue2 = _mm256_load_ps((const float*)(aPtr + 4));
+
+        // the real and imaginary parts, in the same order within each 128-bit lane
+        const __m256 iValue = _mm256_shuffle_ps(cplxValue1, cplxValue2, 0x88);
+        const __m256 qValue = _mm256_shuffle_ps(cplxValue1, cplxValue2, 0xDD);
+
+        // argument and magnitude as in __volk_s32fc_s32f_power_s32fc_a()
+        const __m256 arg = _mm256_atan2_cephes_ps_avx2_fma(iValue, qValue, vPower);
+        const __m256 magSq =
+            _mm256_fmadd_ps(iValue, iValue, _mm256_mul_ps(qValue, qValue));
+        const __m256 magnitude = _mm256_pow_ps_avx2_fma(magSq, vHalfPower);
+
+        __m256 sine, cosine;
+        _mm256_sincos_ps_avx2_fma(arg, &sine, &cosine);
+        const __m256 re =
+            _mm256_mul_ps(_mm256_sub_ps(_mm256_setzero_ps(), cosine), magnitude);
+        const __m256 im = _mm256_mul_ps(sine, magnitude);
+
+        _mm256_store_ps((float*)cPtr, _mm256_unpacklo_ps(re, im));
+        _mm256_store_ps((float*)(cPtr + 4), _mm256_unpackhi_ps(re, im));
+
+        aPtr += 8;
+        cPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        *cPtr++ = __volk_s32fc_s32f_power_s32fc_a((*aPtr++), power);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA for aligned */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32f_power_32fc_a_avx512f(lv_32fc_t* cVector,
+                                                       const lv_32fc_t* aVector,
+                                                       const float power,
+                                                       unsigned int num_points)
+{
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const __m512 vPower = _mm512_set1_ps(power);
+    // |a|^power = (|a|^2)^(power / 2)
+    const __m512 vHalfPower = _mm512_set1_ps(power * 0.5f);
+
+    for (; number < sixteenthPoints; number++) {
+        const __m512 cplxValue1 = _mm512_load_ps((const float*)aPtr);
+        const __m512 cplxValue2 = _mm512_load_ps((const float*)(aPtr + 8));
+
+        // the real and imaginary parts, in the same order within each 128-bit lane
+        const __m512 iValue = _mm512_shuffle_ps(cplxValue1, cplxValue2, 0x88);
+        const __m512 qValue = _mm512_shuffle_ps(cplxValue1, cplxValue2, 0xDD);
+
+        // argument and magnitude as in __volk_s32fc_s32f_power_s32fc_a()
+        const __m512 arg = _mm512_atan2_cephes_ps_avx512f(iValue, qValue, vPower);
+        const __m512 magSq =
+            _mm512_fmadd_ps(iValue, iValue, _mm512_mul_ps(qValue, qValue));
+        const __m512 magnitude = _mm512_pow_ps_avx512f(magSq, vHalfPower);
+
+        __m512 sine, cosine;
+        _mm512_sincos_ps_avx512f(arg, &sine, &cosine);
+        const __m512 re =
+            _mm512_mul_ps(_mm512_sub_ps(_mm512_setzero_ps(), cosine), magnitude);
+        const __m512 im = _mm512_mul_ps(sine, magnitude);
+
+        _mm512_store_ps((float*)cPtr, _mm512_unpacklo_ps(re, im));
+        _mm512_store_ps((float*)(cPtr + 8), _mm512_unpackhi_ps(re, im));
+
+        aPtr += 16;
+        cPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *cPtr++ = __volk_s32fc_s32f_power_s32fc_a((*aPtr++), power);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F for aligned */
 
 #ifdef LV_HAVE_GENERIC
 
@@ -155,5 +267,167 @@ static inline void volk_32fc_s32f_power_32fc_generic(lv_32fc_t* cVector,
 
 #endif /* LV_HAVE_GENERIC */
 
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s32f_power_32fc_neon(lv_32fc_t* cVector,
+                                                  const lv_32fc_t* aVector,
+                                                  const float power,
+                                                  unsigned int num_points)
+{
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float32x4_t vPower = vdupq_n_f32(power);
+    // |a|^power = (|a|^2)^(power / 2)
+    const float32x4_t vHalfPower = vdupq_n_f32(power * 0.5f);
+
+    for (; number < quarterPoints; number++) {
+        const float32x4x2_t aVal = vld2q_f32((const float*)aPtr);
+
+        // argument and magnitude as in __volk_s32fc_s32f_power_s32fc_a()
+        const float32x4_t arg = _vatan2q_cephes_f32(aVal.val[0], aVal.val[1], vPower);
+        const float32x4_t magnitude =
+            _vpowq_f32(_vmagnitudesquaredq_f32(aVal), vHalfPower);
+
+        const float32x4x2_t sincos = _vsincosq_f32(arg);
+        float32x4x2_t cVal;
+        cVal.val[0] = vmulq_f32(vnegq_f32(sincos.val[1]), magnitude);
+        cVal.val[1] = vmulq_f32(sincos.val[0], magnitude);
+        vst2q_f32((float*)cPtr, cVal);
+
+        aPtr += 4;
+        cPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *cPtr++ = __volk_s32fc_s32f_power_s32fc_a((*aPtr++), power);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
 
 #endif /* INCLUDED_volk_32fc_s32f_power_32fc_a_H */
+
+#ifndef INCLUDED_volk_32fc_s32f_power_32fc_u_H
+#define INCLUDED_volk_32fc_s32f_power_32fc_u_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_fma_intrinsics.h>
+
+static inline void volk_32fc_s32f_power_32fc_u_avx2_fma(lv_32fc_t* cVector,
+                                                        const lv_32fc_t* aVector,
+                                                        const float power,
+                                                        unsigned int num_points)
+{
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const __m256 vPower = _mm256_set1_ps(power);
+    // |a|^power = (|a|^2)^(power / 2)
+    const __m256 vHalfPower = _mm256_set1_ps(power * 0.5f);
+
+    for (; number < eighthPoints; number++) {
+        const __m256 cplxValue1 = _mm256_loadu_ps((const float*)aPtr);
+        const __m256 cplxValue2 = _mm256_loadu_ps((const float*)(aPtr + 4));
+
+        // the real and imaginary parts, in the same order within each 128-bit lane
+        const __m256 iValue = _mm256_shuffle_ps(cplxValue1, cplxValue2, 0x88);
+        const __m256 qValue = _mm256_shuffle_ps(cplxValue1, cplxValue2, 0xDD);
+
+        // argument and magnitude as in __volk_s32fc_s32f_power_s32fc_a()
+        const __m256 arg = _mm256_atan2_cephes_ps_avx2_fma(iValue, qValue, vPower);
+        const __m256 magSq =
+            _mm256_fmadd_ps(iValue, iValue, _mm256_mul_ps(qValue, qValue));
+        const __m256 magnitude = _mm256_pow_ps_avx2_fma(magSq, vHalfPower);
+
+        __m256 sine, cosine;
+        _mm256_sincos_ps_avx2_fma(arg, &sine, &cosine);
+        const __m256 re =
+            _mm256_mul_ps(_mm256_sub_ps(_mm256_setzero_ps(), cosine), magnitude);
+        const __m256 im = _mm256_mul_ps(sine, magnitude);
+
+        _mm256_storeu_ps((float*)cPtr, _mm256_unpacklo_ps(re, im));
+        _mm256_storeu_ps((float*)(cPtr + 4), _mm256_unpackhi_ps(re, im));
+
+        aPtr += 8;
+        cPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        *cPtr++ = __volk_s32fc_s32f_power_s32fc_a((*aPtr++), power);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA for unaligned */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32f_power_32fc_u_avx512f(lv_32fc_t* cVector,
+                                                       const lv_32fc_t* aVector,
+                                                       const float power,
+                                                       unsigned int num_points)
+{
+    lv_32fc_t* cPtr = cVector;
+    const lv_32fc_t* aPtr = aVector;
+
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const __m512 vPower = _mm512_set1_ps(power);
+    // |a|^power = (|a|^2)^(power / 2)
+    const __m512 vHalfPower = _mm512_set1_ps(power * 0.5f);
+
+    for (; number < sixteenthPoints; number++) {
+        const __m512 cplxValue1 = _mm512_loadu_ps((const float*)aPtr);
+        const __m512 cplxValue2 = _mm512_loadu_ps((const float*)(aPtr + 8));
+
+        // the real and imaginary parts, in the same order within each 128-bit lane
+        const __m512 iValue = _mm512_shuffle_ps(cplxValue1, cplxValue2, 0x88);
+        const __m512 qValue = _mm512_shuffle_ps(cplxValue1, cplxValue2, 0xDD);
+
+        // argument and magnitude as in __volk_s32fc_s32f_power_s32fc_a()
+        const __m512 arg = _mm512_atan2_cephes_ps_avx512f(iValue, qValue, vPower);
+        const __m512 magSq =
+            _mm512_fmadd_ps(iValue, iValue, _mm512_mul_ps(qValue, qValue));
+        const __m512 magnitude = _mm512_pow_ps_avx512f(magSq, vHalfPower);
+
+        __m512 sine, cosine;
+        _mm512_sincos_ps_avx512f(arg, &sine, &cosine);
+        const __m512 re =
+            _mm512_mul_ps(_mm512_sub_ps(_mm512_setzero_ps(), cosine), magnitude);
+        const __m512 im = _mm512_mul_ps(sine, magnitude);
+
+        _mm512_storeu_ps((float*)cPtr, _mm512_unpacklo_ps(re, im));
+        _mm512_storeu_ps((float*)(cPtr + 8), _mm512_unpackhi_ps(re, im));
+
+        aPtr += 16;
+        cPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *cPtr++ = __volk_s32fc_s32f_power_s32fc_a((*aPtr++), power);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F for unaligned */
+
+#endif /* INCLUDED_volk_32fc_s32f_power_32fc_u_H */
@@ -45,6 +45,81 @@ volk_32fc_s32f_power_spectral_densitypuppet_32f_a_sse3(float* logPowerOutput,
 #endif /* LV_HAVE_SSE3 */
 
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32fc_s32f_power_spectral_densitypuppet_32f_a_avx2_fma(
+    float* logPowerOutput,
+    const lv_32fc_t* complexFFTInput,
+    const float normalizationFactor,
+    unsigned int num_points)
+{
+    volk_32fc_s32f_x2_power_spectral_density_32f_a_avx2_fma(
+        logPowerOutput, complexFFTInput, normalizationFactor, 2.5, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32fc_s32f_power_spectral_densitypuppet_32f_u_avx2_fma(
+    float* logPowerOutput,
+    const lv_32fc_t* complexFFTInput,
+    const float normalizationFactor,
+    unsigned int num_points)
+{
+    volk_32fc_s32f_x2_power_spectral_density_32f_u_avx2_fma(
+        logPowerOutput, complexFFTInput, normalizationFactor, 2.5, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_s32f_power_spectral_densitypuppet_32f_a_avx512f(
+    float* logPowerOutput,
+    const lv_32fc_t* complexFFTInput,
+    const float normalizationFactor,
+    unsigned int num_points)
+{
+    volk_32fc_s32f_x2_power_spectral_density_32f_a_avx512f(
+        logPowerOutput, complexFFTInput, normalizationFactor, 2.5, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_s32f_power_spectral_densitypuppet_32f_u_avx512f(
+    float* logPowerOutput,
+    const lv_32fc_t* complexFFTInput,
+    const float normalizationFactor,
+    unsigned int num_points)
+{
+    volk_32fc_s32f_x2_power_spectral_density_32f_u_avx512f(
+        logPowerOutput, complexFFTInput, normalizationFactor, 2.5, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32fc_s32f_power_spectral_densitypuppet_32f_neon(float* logPowerOutput,
+                                                     const lv_32fc_t* complexFFTInput,
+                                                     const float normalizationFactor,
+                                                     unsigned int num_points)
+{
+    volk_32fc_s32f_x2_power_spectral_density_32f_neon(
+        logPowerOutput, complexFFTInput, normalizationFactor, 2.5, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+
 #ifdef LV_HAVE_GENERIC
 
 static inline void
@@ -224,6 +224,142 @@ volk_32fc_s32f_x2_power_spectral_density_32f_a_sse3(float* logPowerOutput,
 }
 #endif /* LV_HAVE_SSE3 */
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_fma_intrinsics.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_x2_power_spectral_density_32f_a_avx2_fma(float* logPowerOutput,
+                                                        const lv_32fc_t* complexFFTInput,
+                                                        const float normalizationFactor,
+                                                        const float rbw,
+                                                        unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* destPtr = logPowerOutput;
+    unsigned int number = 0;
+    const float iScale = 1.0 / (normalizationFactor * normalizationFactor * rbw);
+    const unsigned int eighthPoints = num_points / 8;
+
+    const __m256 scale = _mm256_set1_ps(iScale);
+    const __m256 log2to10 = _mm256_set1_ps(volk_log2to10factor);
+    for (; number < eighthPoints; number++) {
+        const __m256 input1 = _mm256_load_ps(inputPtr);
+        const __m256 input2 = _mm256_load_ps(inputPtr + 8);
+        // (r*r) + (i*i) for each complex value, normalized
+        __m256 power = _mm256_magnitudesquared_ps(input1, input2);
+        power = _mm256_mul_ps(power, scale);
+
+        // 10 * log10(x) = (10 / log2(10)) * log2(x)
+        power = _mm256_mul_ps(_mm256_log2_ps_avx2_fma(power), log2to10);
+        _mm256_store_ps(destPtr, power);
+
+        inputPtr += 16;
+        destPtr += 8;
+    }
+
+    // Calculate the FFT for any remaining points
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        const float real = *inputPtr++;
+        const float imag = *inputPtr++;
+
+        *destPtr++ = volk_log2to10factor *
+                     log2f_non_ieee(((real * real) + (imag * imag)) * iScale);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_x2_power_spectral_density_32f_a_avx512f(float* logPowerOutput,
+                                                       const lv_32fc_t* complexFFTInput,
+                                                       const float normalizationFactor,
+                                                       const float rbw,
+                                                       unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* destPtr = logPowerOutput;
+    unsigned int number = 0;
+    const float iScale = 1.0 / (normalizationFactor * normalizationFactor * rbw);
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const __m512 scale = _mm512_set1_ps(iScale);
+    const __m512 log2to10 = _mm512_set1_ps(volk_log2to10factor);
+    for (; number < sixteenthPoints; number++) {
+        const __m512 input1 = _mm512_load_ps(inputPtr);
+        const __m512 input2 = _mm512_load_ps(inputPtr + 16);
+        // (r*r) + (i*i) for each complex value, normalized
+        __m512 power = _mm512_magnitudesquared_ps_avx512f(input1, input2);
+        power = _mm512_mul_ps(power, scale);
+
+        // 10 * log10(x) = (10 / log2(10)) * log2(x)
+        power = _mm512_mul_ps(_mm512_log2_ps_avx512f(power), log2to10);
+        _mm512_store_ps(destPtr, power);
+
+        inputPtr += 32;
+        destPtr += 16;
+    }
+
+    // Calculate the FFT for any remaining points
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        const float real = *inputPtr++;
+        const float imag = *inputPtr++;
+
+        *destPtr++ = volk_log2to10factor *
+                     log2f_non_ieee(((real * real) + (imag * imag)) * iScale);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_x2_power_spectral_density_32f_neon(float* logPowerOutput,
+                                                  const lv_32fc_t* complexFFTInput,
+                                                  const float normalizationFactor,
+                                                  const float rbw,
+                                                  unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* destPtr = logPowerOutput;
+    unsigned int number = 0;
+    const float iScale = 1.0 / (normalizationFactor * normalizationFactor * rbw);
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float32x4_t scale = vdupq_n_f32(iScale);
+    for (; number < quarterPoints; number++) {
+        // (r*r) + (i*i) for each complex value, normalized
+        float32x4_t power = _vmagnitudesquaredq_f32(vld2q_f32(inputPtr));
+        power = vmulq_f32(power, scale);
+
+        // 10 * log10(x) = (10 / log2(10)) * log2(x)
+        power = vmulq_n_f32(_vlog2q_f32(power), volk_log2to10factor);
+        vst1q_f32(destPtr, power);
+
+        inputPtr += 8;
+        destPtr += 4;
+    }
+
+    // Calculate the FFT for any remaining points
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        const float real = *inputPtr++;
+        const float imag = *inputPtr++;
+
+        *destPtr++ = volk_log2to10factor *
+                     log2f_non_ieee(((real * real) + (imag * imag)) * iScale);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
 
 #ifdef LV_HAVE_GENERIC
 
@@ -245,3 +381,104 @@ volk_32fc_s32f_x2_power_spectral_density_32f_generic(float* logPowerOutput,
 #endif /* LV_HAVE_GENERIC */
 
 #endif /* INCLUDED_volk_32fc_s32f_x2_power_spectral_density_32f_a_H */
+
+#ifndef INCLUDED_volk_32fc_s32f_x2_power_spectral_density_32f_u_H
+#define INCLUDED_volk_32fc_s32f_x2_power_spectral_density_32f_u_H
+
+#include <inttypes.h>
+#include <math.h>
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_fma_intrinsics.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_x2_power_spectral_density_32f_u_avx2_fma(float* logPowerOutput,
+                                                        const lv_32fc_t* complexFFTInput,
+                                                        const float normalizationFactor,
+                                                        const float rbw,
+                                                        unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* destPtr = logPowerOutput;
+    unsigned int number = 0;
+    const float iScale = 1.0 / (normalizationFactor * normalizationFactor * rbw);
+    const unsigned int eighthPoints = num_points / 8;
+
+    const __m256 scale = _mm256_set1_ps(iScale);
+    const __m256 log2to10 = _mm256_set1_ps(volk_log2to10factor);
+    for (; number < eighthPoints; number++) {
+        const __m256 input1 = _mm256_loadu_ps(inputPtr);
+        const __m256 input2 = _mm256_loadu_ps(inputPtr + 8);
+        // (r*r) + (i*i) for each complex value, normalized
+        __m256 power = _mm256_magnitudesquared_ps(input1, input2);
+        power = _mm256_mul_ps(power, scale);
+
+        // 10 * log10(x) = (10 / log2(10)) * log2(x)
+        power = _mm256_mul_ps(_mm256_log2_ps_avx2_fma(power), log2to10);
+        _mm256_storeu_ps(destPtr, power);
+
+        inputPtr += 16;
+        destPtr += 8;
+    }
+
+    // Calculate the FFT for any remaining points
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        const float real = *inputPtr++;
+        const float imag = *inputPtr++;
+
+        *destPtr++ = volk_log2to10factor *
+                     log2f_non_ieee(((real * real) + (imag * imag)) * iScale);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void
+volk_32fc_s32f_x2_power_spectral_density_32f_u_avx512f(float* logPowerOutput,
+                                                       const lv_32fc_t* complexFFTInput,
+                                                       const float normalizationFactor,
+                                                       const float rbw,
+                                                       unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* destPtr = logPowerOutput;
+    unsigned int number = 0;
+    const float iScale = 1.0 / (normalizationFactor * normalizationFactor * rbw);
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const __m512 scale = _mm512_set1_ps(iScale);
+    const __m512 log2to10 = _mm512_set1_ps(volk_log2to10factor);
+    for (; number < sixteenthPoints; number++) {
+        const __m512 input1 = _mm512_loadu_ps(inputPtr);
+        const __m512 input2 = _mm512_loadu_ps(inputPtr + 16);
+        // (r*r) + (i*i) for each complex value, normalized
+        __m512 power = _mm512_magnitudesquared_ps_avx512f(input1, input2);
+        power = _mm512_mul_ps(power, scale);
+
+        // 10 * log10(x) = (10 / log2(10)) * log2(x)
+        power = _mm512_mul_ps(_mm512_log2_ps_avx512f(power), log2to10);
+        _mm512_storeu_ps(destPtr, power);
+
+        inputPtr += 32;
+        destPtr += 16;
+    }
+
+    // Calculate the FFT for any remaining points
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        const float real = *inputPtr++;
+        const float imag = *inputPtr++;
+
+        *destPtr++ = volk_log2to10factor *
+                     log2f_non_ieee(((real * real) + (imag * imag)) * iScale);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_s32f_x2_power_spectral_density_32f_u_H */
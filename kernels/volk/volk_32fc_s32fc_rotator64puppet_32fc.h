@@ -0,0 +1,127 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32fc_s32fc_rotator64puppet_32fc_H
+#define INCLUDED_volk_32fc_s32fc_rotator64puppet_32fc_H
+
+#include <math.h>
+#include <volk/volk_32fc_s64fc_x2_rotator_32fc.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32fc_rotator64puppet_32fc_generic(lv_32fc_t* outVector,
+                                                                const lv_32fc_t* inVector,
+                                                                const lv_32fc_t phase_inc,
+                                                                unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, .95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    const lv_64fc_t phase_inc_n =
+        lv_cmake((double)lv_creal(phase_inc), (double)lv_cimag(phase_inc)) /
+        hypot(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32fc_s64fc_x2_rotator_32fc_generic(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_s32fc_rotator64puppet_32fc_a_avx(lv_32fc_t* outVector,
+                                                              const lv_32fc_t* inVector,
+                                                              const lv_32fc_t phase_inc,
+                                                              unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, .95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    const lv_64fc_t phase_inc_n =
+        lv_cmake((double)lv_creal(phase_inc), (double)lv_cimag(phase_inc)) /
+        hypot(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32fc_s64fc_x2_rotator_32fc_a_avx(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_s32fc_rotator64puppet_32fc_a_avx512f(lv_32fc_t* outVector,
+                                               const lv_32fc_t* inVector,
+                                               const lv_32fc_t phase_inc,
+                                               unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, .95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    const lv_64fc_t phase_inc_n =
+        lv_cmake((double)lv_creal(phase_inc), (double)lv_cimag(phase_inc)) /
+        hypot(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32fc_s64fc_x2_rotator_32fc_a_avx512f(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_s32fc_rotator64puppet_32fc_u_avx(lv_32fc_t* outVector,
+                                                              const lv_32fc_t* inVector,
+                                                              const lv_32fc_t phase_inc,
+                                                              unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, .95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    const lv_64fc_t phase_inc_n =
+        lv_cmake((double)lv_creal(phase_inc), (double)lv_cimag(phase_inc)) /
+        hypot(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32fc_s64fc_x2_rotator_32fc_u_avx(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_s32fc_rotator64puppet_32fc_u_avx512f(lv_32fc_t* outVector,
+                                               const lv_32fc_t* inVector,
+                                               const lv_32fc_t phase_inc,
+                                               unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, .95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    const lv_64fc_t phase_inc_n =
+        lv_cmake((double)lv_creal(phase_inc), (double)lv_cimag(phase_inc)) /
+        hypot(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32fc_s64fc_x2_rotator_32fc_u_avx512f(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_s32fc_rotator64puppet_32fc_neon(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             const lv_32fc_t phase_inc,
+                                                             unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, .95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    const lv_64fc_t phase_inc_n =
+        lv_cmake((double)lv_creal(phase_inc), (double)lv_cimag(phase_inc)) /
+        hypot(lv_creal(phase_inc), lv_cimag(phase_inc));
+    volk_32fc_s64fc_x2_rotator_32fc_neon(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32fc_rotator64puppet_32fc_H */
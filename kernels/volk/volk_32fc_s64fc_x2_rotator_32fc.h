@@ -0,0 +1,502 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_s64fc_x2_rotator_32fc
+ *
+ * \b Overview
+ *
+ * Rotates the input vector at a fixed rate per sample from an initial phase,
+ * like volk_32fc_s32fc_x2_rotator_32fc, but keeps the phase and its increment
+ * in double precision.
+ *
+ * volk_32fc_s32fc_x2_rotator_32fc advances single precision lane phases by
+ * repeated multiplication and only renormalizes their magnitude every
+ * ROTATOR_RELOAD samples, so rounding errors in the angle accumulate over the
+ * whole stream. Here the lane phases are re-derived from the 64 bit phase at
+ * the start of every ROTATOR_RELOAD samples, and the 64 bit phase is advanced
+ * over the block with double precision powers of the increment. The single
+ * precision error is thus confined to one block and the long term phase error
+ * stays at double precision levels, for a small cost per block. Use it for long
+ * coherent integrations where the drift of the single precision rotator
+ * matters.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s64fc_x2_rotator_32fc(lv_32fc_t* outVector,
+ *                                      const lv_32fc_t* inVector,
+ *                                      const lv_64fc_t phase_inc,
+ *                                      lv_64fc_t* phase,
+ *                                      unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li inVector: Vector to be rotated.
+ * \li phase_inc: rotational velocity, expected to have unit magnitude.
+ * \li phase: initial phase offset, updated to the phase after the last sample.
+ * \li num_points: The number of values in inVector to be rotated and stored into
+ * outVector.
+ *
+ * \b Outputs
+ * \li outVector: The vector where the results will be stored.
+ *
+ * \b Example
+ * Shift a tone at f=0.3 (normalized frequency) to f=0.4 and keep the phase
+ * coherent over many calls.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = lv_cmake(std::cos(0.3f * (float)ii), std::sin(0.3f * (float)ii));
+ *   }
+ *   const double frequency = 0.1;
+ *   const lv_64fc_t phase_increment =
+ *       lv_cmake(std::cos(frequency), std::sin(frequency));
+ *   lv_64fc_t phase = lv_cmake(1.0, 0.0);
+ *
+ *   for (unsigned int call = 0; call < 1000; ++call) {
+ *       volk_32fc_s64fc_x2_rotator_32fc(out, in, phase_increment, &phase, N);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s64fc_x2_rotator_32fc_a_H
+#define INCLUDED_volk_32fc_s64fc_x2_rotator_32fc_a_H
+
+#include <math.h>
+#include <volk/volk_32fc_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+/*
+ * The helpers below multiply on real and imaginary parts, which avoids the
+ * library calls C compilers emit for complex products checking for infinities.
+ */
+
+/*
+ * x to the power of n, by squaring.
+ */
+static inline lv_64fc_t volk_32fc_s64fc_x2_rotator_32fc_pow(const lv_64fc_t x,
+                                                            unsigned int n)
+{
+    double re = 1.0, im = 0.0;
+    double x_r = lv_creal(x), x_i = lv_cimag(x);
+    double tmp;
+
+    while (n) {
+        if (n & 1) {
+            tmp = re * x_r - im * x_i;
+            im = re * x_i + im * x_r;
+            re = tmp;
+        }
+        tmp = x_r * x_r - x_i * x_i;
+        x_i = 2.0 * x_r * x_i;
+        x_r = tmp;
+        n >>= 1;
+    }
+    return lv_cmake(re, im);
+}
+
+/*
+ * Multiplies phase by rotation and renormalizes it.
+ */
+static inline void volk_32fc_s64fc_x2_rotator_32fc_rotate(lv_64fc_t* phase,
+                                                          const lv_64fc_t rotation)
+{
+    const double re =
+        lv_creal(*phase) * lv_creal(rotation) - lv_cimag(*phase) * lv_cimag(rotation);
+    const double im =
+        lv_creal(*phase) * lv_cimag(rotation) + lv_cimag(*phase) * lv_creal(rotation);
+    // the magnitude is close to one, no need for hypot() and its scaling
+    const double inv_mag = 1.0 / sqrt(re * re + im * im);
+    (*phase) = lv_cmake(re * inv_mag, im * inv_mag);
+}
+
+/*
+ * Fills lanes with the single precision products of phase and the num_lanes
+ * powers of the increment in powers.
+ */
+static inline void volk_32fc_s64fc_x2_rotator_32fc_lanes(lv_32fc_t* lanes,
+                                                         const lv_64fc_t phase,
+                                                         const lv_64fc_t* powers,
+                                                         unsigned int num_lanes)
+{
+    const double re = lv_creal(phase);
+    const double im = lv_cimag(phase);
+    unsigned int i;
+
+    for (i = 0; i < num_lanes; ++i) {
+        const double p_r = lv_creal(powers[i]);
+        const double p_i = lv_cimag(powers[i]);
+        lanes[i] = lv_cmake((float)(re * p_r - im * p_i), (float)(re * p_i + im * p_r));
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s64fc_x2_rotator_32fc_generic(lv_32fc_t* outVector,
+                                                           const lv_32fc_t* inVector,
+                                                           const lv_64fc_t phase_inc,
+                                                           lv_64fc_t* phase,
+                                                           unsigned int num_points)
+{
+    unsigned int i, j;
+
+    for (i = 0; i < num_points; i += ROTATOR_RELOAD) {
+        const unsigned int block =
+            (num_points - i < ROTATOR_RELOAD) ? num_points - i : ROTATOR_RELOAD;
+        for (j = 0; j < block; ++j) {
+            *outVector++ = *inVector++ * lv_cmake((float)lv_creal(*phase),
+                                                  (float)lv_cimag(*phase));
+            (*phase) *= phase_inc;
+        }
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x2_rotator_32fc_a_avx(lv_32fc_t* outVector,
+                                                         const lv_32fc_t* inVector,
+                                                         const lv_64fc_t phase_inc,
+                                                         lv_64fc_t* phase,
+                                                         unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    lv_64fc_t powers[4];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_Ptr[4];
+    unsigned int i, j;
+
+    for (i = 0; i < 4; ++i) {
+        powers[i] = volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, i);
+    }
+    const lv_64fc_t incr = volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, 4);
+    const lv_64fc_t block_incr =
+        volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, ROTATOR_RELOAD);
+    const lv_32fc_t incr_f = lv_cmake((float)lv_creal(incr), (float)lv_cimag(incr));
+    const __m256 inc_Val = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)&incr_f));
+    __m256 aVal, z, phase_Val;
+
+    const unsigned int quarter_points = num_points / 4;
+    for (i = 0; i < quarter_points; i += ROTATOR_RELOAD_4) {
+        const unsigned int block = (quarter_points - i < ROTATOR_RELOAD_4)
+                                       ? quarter_points - i
+                                       : ROTATOR_RELOAD_4;
+        volk_32fc_s64fc_x2_rotator_32fc_lanes(phase_Ptr, *phase, powers, 4);
+        phase_Val = _mm256_load_ps((float*)phase_Ptr);
+        for (j = 0; j < block; ++j) {
+            aVal = _mm256_load_ps((float*)aPtr);
+
+            z = _mm256_complexmul_ps(aVal, phase_Val);
+            phase_Val = _mm256_complexmul_ps(phase_Val, inc_Val);
+
+            _mm256_store_ps((float*)cPtr, z);
+
+            aPtr += 4;
+            cPtr += 4;
+        }
+        volk_32fc_s64fc_x2_rotator_32fc_rotate(
+            phase,
+            (block == ROTATOR_RELOAD_4)
+                ? block_incr
+                : volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, 4 * block));
+    }
+
+    // the last samples directly from the 64 bit phase
+    for (i = 0; i < num_points % 4; ++i) {
+        *cPtr++ = *aPtr++ * lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= phase_inc;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x2_rotator_32fc_a_avx512f(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             const lv_64fc_t phase_inc,
+                                                             lv_64fc_t* phase,
+                                                             unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    lv_64fc_t powers[8];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_Ptr[8];
+    unsigned int i, j;
+
+    for (i = 0; i < 8; ++i) {
+        powers[i] = volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, i);
+    }
+    const lv_64fc_t incr = volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, 8);
+    const lv_64fc_t block_incr =
+        volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, ROTATOR_RELOAD);
+    const lv_32fc_t incr_f = lv_cmake((float)lv_creal(incr), (float)lv_cimag(incr));
+    const __m128 inc_f = _mm_setr_ps(lv_creal(incr_f), lv_cimag(incr_f), 0.f, 0.f);
+    const __m512 inc_Val = _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_castps_pd(inc_f)));
+    __m512 aVal, z, phase_Val;
+
+    const unsigned int eighth_points = num_points / 8;
+    for (i = 0; i < eighth_points; i += ROTATOR_RELOAD_8) {
+        const unsigned int block = (eighth_points - i < ROTATOR_RELOAD_8)
+                                       ? eighth_points - i
+                                       : ROTATOR_RELOAD_8;
+        volk_32fc_s64fc_x2_rotator_32fc_lanes(phase_Ptr, *phase, powers, 8);
+        phase_Val = _mm512_load_ps((float*)phase_Ptr);
+        for (j = 0; j < block; ++j) {
+            aVal = _mm512_load_ps((float*)aPtr);
+
+            z = _mm512_complexmul_ps_avx512f(aVal, phase_Val);
+            phase_Val = _mm512_complexmul_ps_avx512f(phase_Val, inc_Val);
+
+            _mm512_store_ps((float*)cPtr, z);
+
+            aPtr += 8;
+            cPtr += 8;
+        }
+        volk_32fc_s64fc_x2_rotator_32fc_rotate(
+            phase,
+            (block == ROTATOR_RELOAD_8)
+                ? block_incr
+                : volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, 8 * block));
+    }
+
+    // the last samples directly from the 64 bit phase
+    for (i = 0; i < num_points % 8; ++i) {
+        *cPtr++ = *aPtr++ * lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= phase_inc;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_s64fc_x2_rotator_32fc_a_H */
+
+#ifndef INCLUDED_volk_32fc_s64fc_x2_rotator_32fc_u_H
+#define INCLUDED_volk_32fc_s64fc_x2_rotator_32fc_u_H
+
+#include <math.h>
+#include <volk/volk_32fc_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x2_rotator_32fc_u_avx(lv_32fc_t* outVector,
+                                                         const lv_32fc_t* inVector,
+                                                         const lv_64fc_t phase_inc,
+                                                         lv_64fc_t* phase,
+                                                         unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    lv_64fc_t powers[4];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_Ptr[4];
+    unsigned int i, j;
+
+    for (i = 0; i < 4; ++i) {
+        powers[i] = volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, i);
+    }
+    const lv_64fc_t incr = volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, 4);
+    const lv_64fc_t block_incr =
+        volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, ROTATOR_RELOAD);
+    const lv_32fc_t incr_f = lv_cmake((float)lv_creal(incr), (float)lv_cimag(incr));
+    const __m256 inc_Val = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)&incr_f));
+    __m256 aVal, z, phase_Val;
+
+    const unsigned int quarter_points = num_points / 4;
+    for (i = 0; i < quarter_points; i += ROTATOR_RELOAD_4) {
+        const unsigned int block = (quarter_points - i < ROTATOR_RELOAD_4)
+                                       ? quarter_points - i
+                                       : ROTATOR_RELOAD_4;
+        volk_32fc_s64fc_x2_rotator_32fc_lanes(phase_Ptr, *phase, powers, 4);
+        phase_Val = _mm256_loadu_ps((float*)phase_Ptr);
+        for (j = 0; j < block; ++j) {
+            aVal = _mm256_loadu_ps((float*)aPtr);
+
+            z = _mm256_complexmul_ps(aVal, phase_Val);
+            phase_Val = _mm256_complexmul_ps(phase_Val, inc_Val);
+
+            _mm256_storeu_ps((float*)cPtr, z);
+
+            aPtr += 4;
+            cPtr += 4;
+        }
+        volk_32fc_s64fc_x2_rotator_32fc_rotate(
+            phase,
+            (block == ROTATOR_RELOAD_4)
+                ? block_incr
+                : volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, 4 * block));
+    }
+
+    // the last samples directly from the 64 bit phase
+    for (i = 0; i < num_points % 4; ++i) {
+        *cPtr++ = *aPtr++ * lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= phase_inc;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x2_rotator_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             const lv_64fc_t phase_inc,
+                                                             lv_64fc_t* phase,
+                                                             unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    lv_64fc_t powers[8];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_Ptr[8];
+    unsigned int i, j;
+
+    for (i = 0; i < 8; ++i) {
+        powers[i] = volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, i);
+    }
+    const lv_64fc_t incr = volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, 8);
+    const lv_64fc_t block_incr =
+        volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, ROTATOR_RELOAD);
+    const lv_32fc_t incr_f = lv_cmake((float)lv_creal(incr), (float)lv_cimag(incr));
+    const __m128 inc_f = _mm_setr_ps(lv_creal(incr_f), lv_cimag(incr_f), 0.f, 0.f);
+    const __m512 inc_Val = _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_castps_pd(inc_f)));
+    __m512 aVal, z, phase_Val;
+
+    const unsigned int eighth_points = num_points / 8;
+    for (i = 0; i < eighth_points; i += ROTATOR_RELOAD_8) {
+        const unsigned int block = (eighth_points - i < ROTATOR_RELOAD_8)
+                                       ? eighth_points - i
+                                       : ROTATOR_RELOAD_8;
+        volk_32fc_s64fc_x2_rotator_32fc_lanes(phase_Ptr, *phase, powers, 8);
+        phase_Val = _mm512_loadu_ps((float*)phase_Ptr);
+        for (j = 0; j < block; ++j) {
+            aVal = _mm512_loadu_ps((float*)aPtr);
+
+            z = _mm512_complexmul_ps_avx512f(aVal, phase_Val);
+            phase_Val = _mm512_complexmul_ps_avx512f(phase_Val, inc_Val);
+
+            _mm512_storeu_ps((float*)cPtr, z);
+
+            aPtr += 8;
+            cPtr += 8;
+        }
+        volk_32fc_s64fc_x2_rotator_32fc_rotate(
+            phase,
+            (block == ROTATOR_RELOAD_8)
+                ? block_incr
+                : volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, 8 * block));
+    }
+
+    // the last samples directly from the 64 bit phase
+    for (i = 0; i < num_points % 8; ++i) {
+        *cPtr++ = *aPtr++ * lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= phase_inc;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x2_rotator_32fc_neon(lv_32fc_t* outVector,
+                                                        const lv_32fc_t* inVector,
+                                                        const lv_64fc_t phase_inc,
+                                                        lv_64fc_t* phase,
+                                                        unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    lv_64fc_t powers[4];
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t phase_Ptr[4];
+    unsigned int i, j;
+
+    for (i = 0; i < 4; ++i) {
+        powers[i] = volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, i);
+    }
+    const lv_64fc_t incr = volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, 4);
+    const lv_64fc_t block_incr =
+        volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, ROTATOR_RELOAD);
+    const lv_32fc_t incr_f = lv_cmake((float)lv_creal(incr), (float)lv_cimag(incr));
+    const lv_32fc_t incr_Ptr[4] = { incr_f, incr_f, incr_f, incr_f };
+    const float32x4x2_t incr_vec = vld2q_f32((float*)incr_Ptr);
+    float32x4x2_t input_vec, phase_vec;
+
+    const unsigned int quarter_points = num_points / 4;
+    for (i = 0; i < quarter_points; i += ROTATOR_RELOAD_4) {
+        const unsigned int block = (quarter_points - i < ROTATOR_RELOAD_4)
+                                       ? quarter_points - i
+                                       : ROTATOR_RELOAD_4;
+        volk_32fc_s64fc_x2_rotator_32fc_lanes(phase_Ptr, *phase, powers, 4);
+        phase_vec = vld2q_f32((float*)phase_Ptr);
+        for (j = 0; j < block; ++j) {
+            input_vec = vld2q_f32((float*)aPtr);
+
+            vst2q_f32((float*)cPtr, _vmultiply_complexq_f32(input_vec, phase_vec));
+            phase_vec = _vmultiply_complexq_f32(phase_vec, incr_vec);
+
+            aPtr += 4;
+            cPtr += 4;
+        }
+        volk_32fc_s64fc_x2_rotator_32fc_rotate(
+            phase,
+            (block == ROTATOR_RELOAD_4)
+                ? block_incr
+                : volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, 4 * block));
+    }
+
+    // the last samples directly from the 64 bit phase
+    for (i = 0; i < num_points % 4; ++i) {
+        *cPtr++ = *aPtr++ * lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= phase_inc;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s64fc_x2_rotator_32fc_u_H */
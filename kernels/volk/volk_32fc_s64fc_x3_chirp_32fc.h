@@ -0,0 +1,436 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_s64fc_x3_chirp_32fc
+ *
+ * \b Overview
+ *
+ * Multiplies the input vector by the linear frequency modulated chirp of
+ * volk_s64fc_x3_chirp_32fc, without storing the chirp in between. With the
+ * conjugates of the start frequency and the rate this dechirps a received
+ * chirp into a tone, as in FMCW radar or LoRa demodulation.
+ *
+ * The state is kept in double precision and re-anchored every CHIRP_RELOAD
+ * samples, see volk_s64fc_x3_chirp_32fc.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s64fc_x3_chirp_32fc(lv_32fc_t* outVector,
+ *                                    const lv_32fc_t* inVector,
+ *                                    const lv_64fc_t chirp_rate,
+ *                                    lv_64fc_t* phase_inc,
+ *                                    lv_64fc_t* phase,
+ *                                    unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li inVector: Vector to be multiplied by the chirp.
+ * \li chirp_rate: rotation of the frequency per sample, expected to have unit
+ * magnitude.
+ * \li phase_inc: frequency of the first sample, updated to the frequency after
+ * the last one.
+ * \li phase: phase of the first sample, updated to the phase after the last one.
+ * \li num_points: The number of values in inVector.
+ *
+ * \b Outputs
+ * \li outVector: The vector where the results will be stored.
+ *
+ * \b Example
+ * Dechirp a chirp with the conjugate chirp, leaving a constant.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   const double start = -0.5 * M_PI;
+ *   const double rate = M_PI / N;
+ *   lv_64fc_t phase_inc = lv_cmake(std::cos(start), std::sin(start));
+ *   lv_64fc_t phase = lv_cmake(1.0, 0.0);
+ *   volk_s64fc_x3_chirp_32fc(
+ *       in, lv_cmake(std::cos(rate), std::sin(rate)), &phase_inc, &phase, N);
+ *
+ *   phase_inc = lv_cmake(std::cos(start), -std::sin(start));
+ *   phase = lv_cmake(1.0, 0.0);
+ *   volk_32fc_s64fc_x3_chirp_32fc(
+ *       out, in, lv_cmake(std::cos(rate), -std::sin(rate)), &phase_inc, &phase, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s64fc_x3_chirp_32fc_a_H
+#define INCLUDED_volk_32fc_s64fc_x3_chirp_32fc_a_H
+
+#include <volk/volk_s64fc_x3_chirp_32fc.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s64fc_x3_chirp_32fc_generic(lv_32fc_t* outVector,
+                                                         const lv_32fc_t* inVector,
+                                                         const lv_64fc_t chirp_rate,
+                                                         lv_64fc_t* phase_inc,
+                                                         lv_64fc_t* phase,
+                                                         unsigned int num_points)
+{
+    unsigned int i, j;
+
+    for (i = 0; i < num_points; i += CHIRP_RELOAD) {
+        const unsigned int block =
+            (num_points - i < CHIRP_RELOAD) ? num_points - i : CHIRP_RELOAD;
+        for (j = 0; j < block; ++j) {
+            *outVector++ = *inVector++ * lv_cmake((float)lv_creal(*phase),
+                                                  (float)lv_cimag(*phase));
+            (*phase) *= (*phase_inc);
+            (*phase_inc) *= chirp_rate;
+        }
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+        (*phase_inc) /= hypot(lv_creal(*phase_inc), lv_cimag(*phase_inc));
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x3_chirp_32fc_a_avx(lv_32fc_t* outVector,
+                                                       const lv_32fc_t* inVector,
+                                                       const lv_64fc_t chirp_rate,
+                                                       lv_64fc_t* phase_inc,
+                                                       lv_64fc_t* phase,
+                                                       unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    volk_s64fc_x3_chirp_32fc_state_t state;
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_Ptr[4];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t step_Ptr[4];
+    unsigned int i, j;
+
+    volk_s64fc_x3_chirp_32fc_init(&state, *phase_inc, chirp_rate, 4);
+    const lv_64fc_t rate = volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, 4 * 4);
+    const lv_32fc_t rate_f = lv_cmake((float)lv_creal(rate), (float)lv_cimag(rate));
+    const __m256 rate_Val = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)&rate_f));
+    __m256 aVal, z, phase_Val, step_Val;
+
+    const unsigned int quarter_points = num_points / 4;
+    for (i = 0; i < quarter_points; i += CHIRP_RELOAD_4) {
+        const unsigned int block = (quarter_points - i < CHIRP_RELOAD_4)
+                                       ? quarter_points - i
+                                       : CHIRP_RELOAD_4;
+        volk_s64fc_x3_chirp_32fc_lanes(&state, phase_Ptr, step_Ptr, *phase);
+        phase_Val = _mm256_load_ps((float*)phase_Ptr);
+        step_Val = _mm256_load_ps((float*)step_Ptr);
+        for (j = 0; j < block; ++j) {
+            aVal = _mm256_load_ps((float*)aPtr);
+
+            z = _mm256_complexmul_ps(aVal, phase_Val);
+            phase_Val = _mm256_complexmul_ps(phase_Val, step_Val);
+            step_Val = _mm256_complexmul_ps(step_Val, rate_Val);
+
+            _mm256_store_ps((float*)cPtr, z);
+
+            aPtr += 4;
+            cPtr += 4;
+        }
+        volk_s64fc_x3_chirp_32fc_advance(
+            &state, phase, phase_inc, chirp_rate, 4 * block);
+    }
+
+    // the last samples directly from the 64 bit state
+    for (i = 0; i < num_points % 4; ++i) {
+        *cPtr++ = *aPtr++ * lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= (*phase_inc);
+        (*phase_inc) *= chirp_rate;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+        (*phase_inc) /= hypot(lv_creal(*phase_inc), lv_cimag(*phase_inc));
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x3_chirp_32fc_a_avx512f(lv_32fc_t* outVector,
+                                                           const lv_32fc_t* inVector,
+                                                           const lv_64fc_t chirp_rate,
+                                                           lv_64fc_t* phase_inc,
+                                                           lv_64fc_t* phase,
+                                                           unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    volk_s64fc_x3_chirp_32fc_state_t state;
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_Ptr[8];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t step_Ptr[8];
+    unsigned int i, j;
+
+    volk_s64fc_x3_chirp_32fc_init(&state, *phase_inc, chirp_rate, 8);
+    const lv_64fc_t rate = volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, 8 * 8);
+    const lv_32fc_t rate_f = lv_cmake((float)lv_creal(rate), (float)lv_cimag(rate));
+    const __m128 rate_s = _mm_setr_ps(lv_creal(rate_f), lv_cimag(rate_f), 0.f, 0.f);
+    const __m512 rate_Val =
+        _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_castps_pd(rate_s)));
+    __m512 aVal, z, phase_Val, step_Val;
+
+    const unsigned int eighth_points = num_points / 8;
+    for (i = 0; i < eighth_points; i += CHIRP_RELOAD_8) {
+        const unsigned int block = (eighth_points - i < CHIRP_RELOAD_8)
+                                       ? eighth_points - i
+                                       : CHIRP_RELOAD_8;
+        volk_s64fc_x3_chirp_32fc_lanes(&state, phase_Ptr, step_Ptr, *phase);
+        phase_Val = _mm512_load_ps((float*)phase_Ptr);
+        step_Val = _mm512_load_ps((float*)step_Ptr);
+        for (j = 0; j < block; ++j) {
+            aVal = _mm512_load_ps((float*)aPtr);
+
+            z = _mm512_complexmul_ps_avx512f(aVal, phase_Val);
+            phase_Val = _mm512_complexmul_ps_avx512f(phase_Val, step_Val);
+            step_Val = _mm512_complexmul_ps_avx512f(step_Val, rate_Val);
+
+            _mm512_store_ps((float*)cPtr, z);
+
+            aPtr += 8;
+            cPtr += 8;
+        }
+        volk_s64fc_x3_chirp_32fc_advance(
+            &state, phase, phase_inc, chirp_rate, 8 * block);
+    }
+
+    // the last samples directly from the 64 bit state
+    for (i = 0; i < num_points % 8; ++i) {
+        *cPtr++ = *aPtr++ * lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= (*phase_inc);
+        (*phase_inc) *= chirp_rate;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+        (*phase_inc) /= hypot(lv_creal(*phase_inc), lv_cimag(*phase_inc));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_s64fc_x3_chirp_32fc_a_H */
+
+#ifndef INCLUDED_volk_32fc_s64fc_x3_chirp_32fc_u_H
+#define INCLUDED_volk_32fc_s64fc_x3_chirp_32fc_u_H
+
+#include <volk/volk_s64fc_x3_chirp_32fc.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x3_chirp_32fc_u_avx(lv_32fc_t* outVector,
+                                                       const lv_32fc_t* inVector,
+                                                       const lv_64fc_t chirp_rate,
+                                                       lv_64fc_t* phase_inc,
+                                                       lv_64fc_t* phase,
+                                                       unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    volk_s64fc_x3_chirp_32fc_state_t state;
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_Ptr[4];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t step_Ptr[4];
+    unsigned int i, j;
+
+    volk_s64fc_x3_chirp_32fc_init(&state, *phase_inc, chirp_rate, 4);
+    const lv_64fc_t rate = volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, 4 * 4);
+    const lv_32fc_t rate_f = lv_cmake((float)lv_creal(rate), (float)lv_cimag(rate));
+    const __m256 rate_Val = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)&rate_f));
+    __m256 aVal, z, phase_Val, step_Val;
+
+    const unsigned int quarter_points = num_points / 4;
+    for (i = 0; i < quarter_points; i += CHIRP_RELOAD_4) {
+        const unsigned int block = (quarter_points - i < CHIRP_RELOAD_4)
+                                       ? quarter_points - i
+                                       : CHIRP_RELOAD_4;
+        volk_s64fc_x3_chirp_32fc_lanes(&state, phase_Ptr, step_Ptr, *phase);
+        phase_Val = _mm256_loadu_ps((float*)phase_Ptr);
+        step_Val = _mm256_loadu_ps((float*)step_Ptr);
+        for (j = 0; j < block; ++j) {
+            aVal = _mm256_loadu_ps((float*)aPtr);
+
+            z = _mm256_complexmul_ps(aVal, phase_Val);
+            phase_Val = _mm256_complexmul_ps(phase_Val, step_Val);
+            step_Val = _mm256_complexmul_ps(step_Val, rate_Val);
+
+            _mm256_storeu_ps((float*)cPtr, z);
+
+            aPtr += 4;
+            cPtr += 4;
+        }
+        volk_s64fc_x3_chirp_32fc_advance(
+            &state, phase, phase_inc, chirp_rate, 4 * block);
+    }
+
+    // the last samples directly from the 64 bit state
+    for (i = 0; i < num_points % 4; ++i) {
+        *cPtr++ = *aPtr++ * lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= (*phase_inc);
+        (*phase_inc) *= chirp_rate;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+        (*phase_inc) /= hypot(lv_creal(*phase_inc), lv_cimag(*phase_inc));
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x3_chirp_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                           const lv_32fc_t* inVector,
+                                                           const lv_64fc_t chirp_rate,
+                                                           lv_64fc_t* phase_inc,
+                                                           lv_64fc_t* phase,
+                                                           unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    volk_s64fc_x3_chirp_32fc_state_t state;
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_Ptr[8];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t step_Ptr[8];
+    unsigned int i, j;
+
+    volk_s64fc_x3_chirp_32fc_init(&state, *phase_inc, chirp_rate, 8);
+    const lv_64fc_t rate = volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, 8 * 8);
+    const lv_32fc_t rate_f = lv_cmake((float)lv_creal(rate), (float)lv_cimag(rate));
+    const __m128 rate_s = _mm_setr_ps(lv_creal(rate_f), lv_cimag(rate_f), 0.f, 0.f);
+    const __m512 rate_Val =
+        _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_castps_pd(rate_s)));
+    __m512 aVal, z, phase_Val, step_Val;
+
+    const unsigned int eighth_points = num_points / 8;
+    for (i = 0; i < eighth_points; i += CHIRP_RELOAD_8) {
+        const unsigned int block = (eighth_points - i < CHIRP_RELOAD_8)
+                                       ? eighth_points - i
+                                       : CHIRP_RELOAD_8;
+        volk_s64fc_x3_chirp_32fc_lanes(&state, phase_Ptr, step_Ptr, *phase);
+        phase_Val = _mm512_loadu_ps((float*)phase_Ptr);
+        step_Val = _mm512_loadu_ps((float*)step_Ptr);
+        for (j = 0; j < block; ++j) {
+            aVal = _mm512_loadu_ps((float*)aPtr);
+
+            z = _mm512_complexmul_ps_avx512f(aVal, phase_Val);
+            phase_Val = _mm512_complexmul_ps_avx512f(phase_Val, step_Val);
+            step_Val = _mm512_complexmul_ps_avx512f(step_Val, rate_Val);
+
+            _mm512_storeu_ps((float*)cPtr, z);
+
+            aPtr += 8;
+            cPtr += 8;
+        }
+        volk_s64fc_x3_chirp_32fc_advance(
+            &state, phase, phase_inc, chirp_rate, 8 * block);
+    }
+
+    // the last samples directly from the 64 bit state
+    for (i = 0; i < num_points % 8; ++i) {
+        *cPtr++ = *aPtr++ * lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= (*phase_inc);
+        (*phase_inc) *= chirp_rate;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+        (*phase_inc) /= hypot(lv_creal(*phase_inc), lv_cimag(*phase_inc));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x3_chirp_32fc_neon(lv_32fc_t* outVector,
+                                                      const lv_32fc_t* inVector,
+                                                      const lv_64fc_t chirp_rate,
+                                                      lv_64fc_t* phase_inc,
+                                                      lv_64fc_t* phase,
+                                                      unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    volk_s64fc_x3_chirp_32fc_state_t state;
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t phase_Ptr[4];
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t step_Ptr[4];
+    unsigned int i, j;
+
+    volk_s64fc_x3_chirp_32fc_init(&state, *phase_inc, chirp_rate, 4);
+    const lv_64fc_t rate = volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, 4 * 4);
+    const lv_32fc_t rate_f = lv_cmake((float)lv_creal(rate), (float)lv_cimag(rate));
+    const lv_32fc_t rate_Ptr[4] = { rate_f, rate_f, rate_f, rate_f };
+    const float32x4x2_t rate_vec = vld2q_f32((float*)rate_Ptr);
+    float32x4x2_t input_vec, phase_vec, step_vec;
+
+    const unsigned int quarter_points = num_points / 4;
+    for (i = 0; i < quarter_points; i += CHIRP_RELOAD_4) {
+        const unsigned int block = (quarter_points - i < CHIRP_RELOAD_4)
+                                       ? quarter_points - i
+                                       : CHIRP_RELOAD_4;
+        volk_s64fc_x3_chirp_32fc_lanes(&state, phase_Ptr, step_Ptr, *phase);
+        phase_vec = vld2q_f32((float*)phase_Ptr);
+        step_vec = vld2q_f32((float*)step_Ptr);
+        for (j = 0; j < block; ++j) {
+            input_vec = vld2q_f32((float*)aPtr);
+
+            vst2q_f32((float*)cPtr, _vmultiply_complexq_f32(input_vec, phase_vec));
+            phase_vec = _vmultiply_complexq_f32(phase_vec, step_vec);
+            step_vec = _vmultiply_complexq_f32(step_vec, rate_vec);
+
+            aPtr += 4;
+            cPtr += 4;
+        }
+        volk_s64fc_x3_chirp_32fc_advance(
+            &state, phase, phase_inc, chirp_rate, 4 * block);
+    }
+
+    // the last samples directly from the 64 bit state
+    for (i = 0; i < num_points % 4; ++i) {
+        *cPtr++ = *aPtr++ * lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= (*phase_inc);
+        (*phase_inc) *= chirp_rate;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+        (*phase_inc) /= hypot(lv_creal(*phase_inc), lv_cimag(*phase_inc));
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s64fc_x3_chirp_32fc_u_H */
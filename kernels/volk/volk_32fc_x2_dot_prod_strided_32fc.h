@@ -0,0 +1,208 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_x2_dot_prod_strided_32fc
+ *
+ * \b Overview
+ *
+ * Computes the dot product of two strided complex vectors:
+ *
+ * result = sum(input[i * input_stride] * taps[i * taps_stride])
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_dot_prod_strided_32fc(lv_32fc_t* result, const lv_32fc_t* input,
+ * const lv_32fc_t* taps, unsigned int input_stride, unsigned int taps_stride, unsigned
+ * int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: First vector of input points.
+ * \li taps: Second vector of input points.
+ * \li input_stride: Distance in complex points between consecutive points of input.
+ * \li taps_stride: Distance in complex points between consecutive points of taps.
+ * \li num_points: The number of points to process.
+ *
+ * \b Outputs
+ * \li result: The dot product.
+ *
+ * \b Example
+ * Correlate antenna 5 of a [time][antenna] matrix of 16 antennas with a
+ * reference sequence.
+ * \code
+ *   int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* x = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * 16 * N, alignment);
+ *   lv_32fc_t* taps = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t result;
+ *
+ *   // fill x and taps
+ *
+ *   volk_32fc_x2_dot_prod_strided_32fc(&result, x + 5, taps, 16, 1, N);
+ *
+ *   volk_free(x);
+ *   volk_free(taps);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_dot_prod_strided_32fc_u_H
+#define INCLUDED_volk_32fc_x2_dot_prod_strided_32fc_u_H
+
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_dot_prod_strided_32fc_generic(lv_32fc_t* result,
+                                                              const lv_32fc_t* input,
+                                                              const lv_32fc_t* taps,
+                                                              unsigned int input_stride,
+                                                              unsigned int taps_stride,
+                                                              unsigned int num_points)
+{
+    lv_32fc_t dotProduct = lv_cmake(0.f, 0.f);
+    for (unsigned int number = 0; number < num_points; number++) {
+        dotProduct += (*input) * (*taps);
+        input += input_stride;
+        taps += taps_stride;
+    }
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+#include <volk/volk_sse_intrinsics.h>
+
+static inline void volk_32fc_x2_dot_prod_strided_32fc_u_sse3(lv_32fc_t* result,
+                                                             const lv_32fc_t* input,
+                                                             const lv_32fc_t* taps,
+                                                             unsigned int input_stride,
+                                                             unsigned int taps_stride,
+                                                             unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+
+    __m128 dotProdVal = _mm_setzero_ps();
+    for (unsigned int number = 0; number < halfPoints; number++) {
+        const __m128 x = _mm_loadu_strided_pc((const float*)input, input_stride);
+        const __m128 y = _mm_loadu_strided_pc((const float*)taps, taps_stride);
+        dotProdVal = _mm_add_ps(dotProdVal, _mm_complexmul_ps(x, y));
+        input += 2 * (size_t)input_stride;
+        taps += 2 * (size_t)taps_stride;
+    }
+
+    __VOLK_ATTR_ALIGNED(16) lv_32fc_t dotProductVector[2];
+    _mm_store_ps((float*)dotProductVector, dotProdVal);
+
+    lv_32fc_t dotProduct = dotProductVector[0] + dotProductVector[1];
+
+    for (unsigned int number = halfPoints * 2; number < num_points; number++) {
+        dotProduct += (*input) * (*taps);
+        input += input_stride;
+        taps += taps_stride;
+    }
+
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32fc_x2_dot_prod_strided_32fc_u_avx2(lv_32fc_t* result,
+                                                             const lv_32fc_t* input,
+                                                             const lv_32fc_t* taps,
+                                                             unsigned int input_stride,
+                                                             unsigned int taps_stride,
+                                                             unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const __m256i input_index = _mm256_stride_index(input_stride);
+    const __m256i taps_index = _mm256_stride_index(taps_stride);
+
+    __m256 dotProdVal = _mm256_setzero_ps();
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const __m256 x =
+            _mm256_loadu_strided_pc((const float*)input, input_stride, input_index);
+        const __m256 y =
+            _mm256_loadu_strided_pc((const float*)taps, taps_stride, taps_index);
+        dotProdVal = _mm256_add_ps(dotProdVal, _mm256_complexmul_ps(x, y));
+        input += 4 * (size_t)input_stride;
+        taps += 4 * (size_t)taps_stride;
+    }
+
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t dotProductVector[4];
+    _mm256_store_ps((float*)dotProductVector, dotProdVal);
+
+    lv_32fc_t dotProduct = dotProductVector[0] + dotProductVector[1] +
+                           dotProductVector[2] + dotProductVector[3];
+
+    for (unsigned int number = quarterPoints * 4; number < num_points; number++) {
+        dotProduct += (*input) * (*taps);
+        input += input_stride;
+        taps += taps_stride;
+    }
+
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_x2_dot_prod_strided_32fc_neon(lv_32fc_t* result,
+                                                           const lv_32fc_t* input,
+                                                           const lv_32fc_t* taps,
+                                                           unsigned int input_stride,
+                                                           unsigned int taps_stride,
+                                                           unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    float32x4x2_t dotProdVal;
+    dotProdVal.val[0] = vdupq_n_f32(0.f);
+    dotProdVal.val[1] = vdupq_n_f32(0.f);
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const float32x4x2_t x = _vld2q_strided_f32((const float*)input, input_stride);
+        const float32x4x2_t y = _vld2q_strided_f32((const float*)taps, taps_stride);
+        // re += xr * yr - xi * yi, im += xr * yi + xi * yr
+        dotProdVal.val[0] = vmlaq_f32(dotProdVal.val[0], x.val[0], y.val[0]);
+        dotProdVal.val[0] = vmlsq_f32(dotProdVal.val[0], x.val[1], y.val[1]);
+        dotProdVal.val[1] = vmlaq_f32(dotProdVal.val[1], x.val[0], y.val[1]);
+        dotProdVal.val[1] = vmlaq_f32(dotProdVal.val[1], x.val[1], y.val[0]);
+        input += 4 * (size_t)input_stride;
+        taps += 4 * (size_t)taps_stride;
+    }
+
+    lv_32fc_t dotProductVector[4];
+    vst2q_f32((float*)dotProductVector, dotProdVal);
+
+    lv_32fc_t dotProduct = dotProductVector[0] + dotProductVector[1] +
+                           dotProductVector[2] + dotProductVector[3];
+
+    for (unsigned int number = quarterPoints * 4; number < num_points; number++) {
+        dotProduct += (*input) * (*taps);
+        input += input_stride;
+        taps += taps_stride;
+    }
+
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_dot_prod_strided_32fc_u_H */
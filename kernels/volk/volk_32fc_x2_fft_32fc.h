@@ -0,0 +1,638 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_x2_fft_32fc
+ *
+ * \b Overview
+ *
+ * Computes the unnormalized discrete Fourier transform of num_points complex
+ * samples, num_points being a power of two:
+ *
+ * output[k] = sum(input[n] * exp(s * 2 * pi * i * n * k / num_points))
+ *
+ * The direction s is set by the twiddle factors: they hold the N - 1 values
+ * exp(s * 2 * pi * i * j / (2 * h)) for j in [0, h), one run for each h =
+ * 1, 2, 4, ..., num_points / 2 in that order, so the run for h starts at
+ * twiddles[h - 1]. Use s = -1 for the forward and s = +1 for the inverse
+ * transform. The table of a size is the start of the table of any larger
+ * size. volk_fft_plan_create() in volk/volk_fft.h computes and keeps the
+ * table.
+ *
+ * output may be the same buffer as input for an in-place transform. The
+ * SIMD versions are meant for sizes up to 65536 points.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_fft_32fc(lv_32fc_t* output, const lv_32fc_t* input, const
+ * lv_32fc_t* twiddles, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: The time domain samples.
+ * \li twiddles: The twiddle factors, num_points - 1 values.
+ * \li num_points: The transform size, a power of two.
+ *
+ * \b Outputs
+ * \li output: The transformed samples, may alias input.
+ *
+ * \b Example
+ * Forward transform of 1024 samples in place, through a plan.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* buf = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   volk_fft_plan_t* plan = volk_fft_plan_create(N, VOLK_FFT_FORWARD);
+ *
+ *   // fill buf
+ *
+ *   volk_32fc_x2_fft_32fc(buf, buf, volk_fft_plan_twiddles(plan), N);
+ *
+ *   volk_fft_plan_destroy(plan);
+ *   volk_free(buf);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_fft_32fc_u_H
+#define INCLUDED_volk_32fc_x2_fft_32fc_u_H
+
+#include <stddef.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+// Reverses the low bits of i, bits <= 32
+static inline unsigned int fft_32fc_bitrev_index(unsigned int i, unsigned int bits)
+{
+    static const unsigned char rev4[16] = { 0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+                                            0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf };
+    unsigned int r = 0, k = 0;
+    for (; k < bits; k += 4) {
+        r = (r << 4) | rev4[(i >> k) & 0xf];
+    }
+    return r >> (k - bits);
+}
+
+// Number of radix-2 stages of a power of two transform
+static inline unsigned int fft_32fc_log2(unsigned int num_points)
+{
+    unsigned int m = 0;
+    while ((1u << m) < num_points) {
+        m++;
+    }
+    return m;
+}
+
+// Gathers input[bitrev(i)] into output[i], swaps in place when output == input.
+static inline void
+fft_32fc_bitrev(lv_32fc_t* output, const lv_32fc_t* input, unsigned int num_points)
+{
+    if (num_points < 2) {
+        output[0] = input[0];
+        return;
+    }
+    const unsigned int bits = fft_32fc_log2(num_points);
+    for (unsigned int i = 0; i < num_points; i++) {
+        const unsigned int r = fft_32fc_bitrev_index(i, bits);
+        if (output != input) {
+            output[i] = input[r];
+        } else if (i < r) {
+            const lv_32fc_t tmp = output[i];
+            output[i] = output[r];
+            output[r] = tmp;
+        }
+    }
+}
+
+// Radix-2 butterflies of the stages h, 2h, ..., num_points / 2, in place on
+// bit reversed data.
+static inline void fft_32fc_radix2_stages(lv_32fc_t* data,
+                                          const lv_32fc_t* twiddles,
+                                          unsigned int h,
+                                          unsigned int num_points)
+{
+    float* d = (float*)data;
+    for (; h < num_points; h *= 2) {
+        const float* w = (const float*)(twiddles + h - 1);
+        for (unsigned int b = 0; b < num_points; b += 2 * h) {
+            for (unsigned int j = 0; j < h; j++) {
+                float* x0 = d + 2 * (b + j);
+                float* x1 = d + 2 * (b + j + h);
+                const float tr = x1[0] * w[2 * j] - x1[1] * w[2 * j + 1];
+                const float ti = x1[0] * w[2 * j + 1] + x1[1] * w[2 * j];
+                x1[0] = x0[0] - tr;
+                x1[1] = x0[1] - ti;
+                x0[0] += tr;
+                x0[1] += ti;
+            }
+        }
+    }
+}
+
+// The first three stages (h = 1, 2, 4) for num_points >= 8, fused with the bit
+// reversal and the multiplication by window, if not NULL, when output != input.
+// In place, the input must already be bit reversed and window is ignored. The
+// twiddles of j = 0 are 1 and skipped.
+static inline void fft_32fc_radix8_first(lv_32fc_t* output,
+                                         const lv_32fc_t* input,
+                                         const float* window,
+                                         const lv_32fc_t* twiddles,
+                                         unsigned int num_points)
+{
+    static const unsigned int rev3[8] = { 0, 4, 2, 6, 1, 5, 3, 7 };
+    const unsigned int eighth = num_points / 8;
+    const unsigned int bits = fft_32fc_log2(eighth);
+    const float* w = (const float*)twiddles;
+    // stage 2 twiddle, then stage 4 twiddles of j = 1, 2, 3
+    const float w2r = w[4], w2i = w[5];
+    const float w41r = w[8], w41i = w[9];
+    const float w42r = w[10], w42i = w[11];
+    const float w43r = w[12], w43i = w[13];
+
+    for (unsigned int q = 0; q < eighth; q++) {
+        lv_32fc_t x[8];
+        if (output == input) {
+            for (unsigned int k = 0; k < 8; k++) {
+                x[k] = output[8 * q + k];
+            }
+        } else {
+            // input[bitrev(8q + k)] = input[bitrev3(k) * eighth + bitrev(q)]
+            const unsigned int r = fft_32fc_bitrev_index(q, bits);
+            for (unsigned int k = 0; k < 8; k++) {
+                const unsigned int i = rev3[k] * eighth + r;
+                x[k] = window ? input[i] * window[i] : input[i];
+            }
+        }
+        float re[8], im[8];
+        for (unsigned int k = 0; k < 8; k++) {
+            re[k] = lv_creal(x[k]);
+            im[k] = lv_cimag(x[k]);
+        }
+
+        // stage 1
+        for (unsigned int k = 0; k < 8; k += 2) {
+            const float tr = re[k + 1], ti = im[k + 1];
+            re[k + 1] = re[k] - tr;
+            im[k + 1] = im[k] - ti;
+            re[k] += tr;
+            im[k] += ti;
+        }
+
+        // stage 2, twiddles 1 and w2
+        for (unsigned int k = 0; k < 8; k += 4) {
+            float tr = re[k + 2], ti = im[k + 2];
+            re[k + 2] = re[k] - tr;
+            im[k + 2] = im[k] - ti;
+            re[k] += tr;
+            im[k] += ti;
+
+            tr = re[k + 3] * w2r - im[k + 3] * w2i;
+            ti = re[k + 3] * w2i + im[k + 3] * w2r;
+            re[k + 3] = re[k + 1] - tr;
+            im[k + 3] = im[k + 1] - ti;
+            re[k + 1] += tr;
+            im[k + 1] += ti;
+        }
+
+        // stage 4, twiddles 1, w41, w42 and w43
+        const float tr[4] = { re[4],
+                              re[5] * w41r - im[5] * w41i,
+                              re[6] * w42r - im[6] * w42i,
+                              re[7] * w43r - im[7] * w43i };
+        const float ti[4] = { im[4],
+                              re[5] * w41i + im[5] * w41r,
+                              re[6] * w42i + im[6] * w42r,
+                              re[7] * w43i + im[7] * w43r };
+        for (unsigned int k = 0; k < 4; k++) {
+            output[8 * q + k] = lv_cmake(re[k] + tr[k], im[k] + ti[k]);
+            output[8 * q + k + 4] = lv_cmake(re[k] - tr[k], im[k] - ti[k]);
+        }
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_fft_32fc_generic(lv_32fc_t* output,
+                                                 const lv_32fc_t* input,
+                                                 const lv_32fc_t* twiddles,
+                                                 unsigned int num_points)
+{
+    fft_32fc_bitrev(output, input, num_points);
+    fft_32fc_radix2_stages(output, twiddles, 1, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void
+fft_32fc_stages_sse3(float* d, const float* twiddles, unsigned int num_points);
+
+static inline void volk_32fc_x2_fft_32fc_u_sse3(lv_32fc_t* output,
+                                                const lv_32fc_t* input,
+                                                const lv_32fc_t* twiddles,
+                                                unsigned int num_points)
+{
+    if (num_points < 8) {
+        fft_32fc_bitrev(output, input, num_points);
+        fft_32fc_radix2_stages(output, twiddles, 1, num_points);
+        return;
+    }
+    if (output == input) {
+        fft_32fc_bitrev(output, input, num_points);
+    }
+    fft_32fc_radix8_first(output, input, NULL, twiddles, num_points);
+    fft_32fc_stages_sse3((float*)output, (const float*)twiddles, num_points);
+}
+
+/*
+ * Runs the stages h = 8, 16, ..., num_points / 2 of volk_32fc_x2_fft_32fc in
+ * place, once the first three are done: radix-4 passes, after one radix-2
+ * stage if their number is odd. num_points is a power of two of at least 8.
+ */
+static inline void
+fft_32fc_stages_sse3(float* d, const float* twiddles, unsigned int num_points)
+{
+    unsigned int stages = 0;
+    for (unsigned int n = num_points / 8; n > 1; n /= 2) {
+        stages++;
+    }
+    unsigned int h = 8;
+
+
+    // one radix-2 stage if the rest does not split into radix-4 passes
+    if (stages & 1) {
+        const float* w = twiddles + 2 * (h - 1);
+        for (unsigned int b = 0; b < num_points; b += 2 * h) {
+            for (unsigned int j = 0; j < h; j += 2) {
+                float* p = d + 2 * (b + j);
+                const __m128 x0 = _mm_loadu_ps(p);
+                const __m128 x1 =
+                    _mm_complexmul_ps(_mm_loadu_ps(p + 2 * h), _mm_loadu_ps(w + 2 * j));
+                _mm_storeu_ps(p, _mm_add_ps(x0, x1));
+                _mm_storeu_ps(p + 2 * h, _mm_sub_ps(x0, x1));
+            }
+        }
+        h *= 2;
+    }
+
+    // radix-4 passes, each doing the stages h and 2h
+    for (; 4 * h <= num_points; h *= 4) {
+        const float* w1 = twiddles + 2 * (h - 1);
+        const float* w2 = twiddles + 2 * (2 * h - 1);
+        const float* w3 = twiddles + 2 * (3 * h - 1);
+        for (unsigned int b = 0; b < num_points; b += 4 * h) {
+            for (unsigned int j = 0; j < h; j += 2) {
+                float* p = d + 2 * (b + j);
+                const __m128 tw1 = _mm_loadu_ps(w1 + 2 * j);
+                const __m128 x0 = _mm_loadu_ps(p);
+                const __m128 x1 = _mm_complexmul_ps(_mm_loadu_ps(p + 2 * h), tw1);
+                const __m128 x2 = _mm_loadu_ps(p + 4 * h);
+                const __m128 x3 = _mm_complexmul_ps(_mm_loadu_ps(p + 6 * h), tw1);
+
+                const __m128 y0 = _mm_add_ps(x0, x1);
+                const __m128 y1 = _mm_sub_ps(x0, x1);
+                const __m128 y2 = _mm_complexmul_ps(_mm_add_ps(x2, x3),
+                                                    _mm_loadu_ps(w2 + 2 * j));
+                const __m128 y3 = _mm_complexmul_ps(_mm_sub_ps(x2, x3),
+                                                    _mm_loadu_ps(w3 + 2 * j));
+
+                _mm_storeu_ps(p, _mm_add_ps(y0, y2));
+                _mm_storeu_ps(p + 2 * h, _mm_add_ps(y1, y3));
+                _mm_storeu_ps(p + 4 * h, _mm_sub_ps(y0, y2));
+                _mm_storeu_ps(p + 6 * h, _mm_sub_ps(y1, y3));
+            }
+        }
+    }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void fft_32fc_stages_avx2_fma(float* d,
+                                            const float* twiddles,
+                                            unsigned int num_points);
+
+static inline void volk_32fc_x2_fft_32fc_u_avx2_fma(lv_32fc_t* output,
+                                                    const lv_32fc_t* input,
+                                                    const lv_32fc_t* twiddles,
+                                                    unsigned int num_points)
+{
+    if (num_points < 8) {
+        fft_32fc_bitrev(output, input, num_points);
+        fft_32fc_radix2_stages(output, twiddles, 1, num_points);
+        return;
+    }
+    if (output == input) {
+        fft_32fc_bitrev(output, input, num_points);
+    }
+    fft_32fc_radix8_first(output, input, NULL, twiddles, num_points);
+    fft_32fc_stages_avx2_fma((float*)output, (const float*)twiddles, num_points);
+}
+
+/*
+ * Runs the stages h = 8, 16, ..., num_points / 2 of volk_32fc_x2_fft_32fc in
+ * place, once the first three are done: radix-4 passes, after one radix-2
+ * stage if their number is odd. num_points is a power of two of at least 8.
+ */
+static inline void fft_32fc_stages_avx2_fma(float* d,
+                                            const float* twiddles,
+                                            unsigned int num_points)
+{
+    unsigned int stages = 0;
+    for (unsigned int n = num_points / 8; n > 1; n /= 2) {
+        stages++;
+    }
+    unsigned int h = 8;
+
+
+    // complex products x * w as fmaddsub(x, re(w), swap(x) * im(w))
+    if (stages & 1) {
+        const float* w = twiddles + 2 * (h - 1);
+        for (unsigned int b = 0; b < num_points; b += 2 * h) {
+            for (unsigned int j = 0; j < h; j += 4) {
+                float* p = d + 2 * (b + j);
+                const __m256 tw = _mm256_loadu_ps(w + 2 * j);
+                const __m256 x0 = _mm256_loadu_ps(p);
+                __m256 x1 = _mm256_loadu_ps(p + 2 * h);
+                x1 = _mm256_fmaddsub_ps(
+                    x1,
+                    _mm256_moveldup_ps(tw),
+                    _mm256_mul_ps(_mm256_permute_ps(x1, 0xB1), _mm256_movehdup_ps(tw)));
+                _mm256_storeu_ps(p, _mm256_add_ps(x0, x1));
+                _mm256_storeu_ps(p + 2 * h, _mm256_sub_ps(x0, x1));
+            }
+        }
+        h *= 2;
+    }
+
+    for (; 4 * h <= num_points; h *= 4) {
+        const float* w1 = twiddles + 2 * (h - 1);
+        const float* w2 = twiddles + 2 * (2 * h - 1);
+        const float* w3 = twiddles + 2 * (3 * h - 1);
+        for (unsigned int b = 0; b < num_points; b += 4 * h) {
+            for (unsigned int j = 0; j < h; j += 4) {
+                float* p = d + 2 * (b + j);
+                const __m256 tw1 = _mm256_loadu_ps(w1 + 2 * j);
+                const __m256 tw2 = _mm256_loadu_ps(w2 + 2 * j);
+                const __m256 tw3 = _mm256_loadu_ps(w3 + 2 * j);
+                const __m256 w1r = _mm256_moveldup_ps(tw1);
+                const __m256 w1i = _mm256_movehdup_ps(tw1);
+
+                const __m256 x0 = _mm256_loadu_ps(p);
+                __m256 x1 = _mm256_loadu_ps(p + 2 * h);
+                const __m256 x2 = _mm256_loadu_ps(p + 4 * h);
+                __m256 x3 = _mm256_loadu_ps(p + 6 * h);
+                x1 = _mm256_fmaddsub_ps(
+                    x1, w1r, _mm256_mul_ps(_mm256_permute_ps(x1, 0xB1), w1i));
+                x3 = _mm256_fmaddsub_ps(
+                    x3, w1r, _mm256_mul_ps(_mm256_permute_ps(x3, 0xB1), w1i));
+
+                const __m256 y0 = _mm256_add_ps(x0, x1);
+                const __m256 y1 = _mm256_sub_ps(x0, x1);
+                __m256 y2 = _mm256_add_ps(x2, x3);
+                __m256 y3 = _mm256_sub_ps(x2, x3);
+                y2 = _mm256_fmaddsub_ps(
+                    y2,
+                    _mm256_moveldup_ps(tw2),
+                    _mm256_mul_ps(_mm256_permute_ps(y2, 0xB1), _mm256_movehdup_ps(tw2)));
+                y3 = _mm256_fmaddsub_ps(
+                    y3,
+                    _mm256_moveldup_ps(tw3),
+                    _mm256_mul_ps(_mm256_permute_ps(y3, 0xB1), _mm256_movehdup_ps(tw3)));
+
+                _mm256_storeu_ps(p, _mm256_add_ps(y0, y2));
+                _mm256_storeu_ps(p + 2 * h, _mm256_add_ps(y1, y3));
+                _mm256_storeu_ps(p + 4 * h, _mm256_sub_ps(y0, y2));
+                _mm256_storeu_ps(p + 6 * h, _mm256_sub_ps(y1, y3));
+            }
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void fft_32fc_stages_avx512f(float* d,
+                                           const float* twiddles,
+                                           unsigned int num_points);
+
+static inline void volk_32fc_x2_fft_32fc_u_avx512f(lv_32fc_t* output,
+                                                   const lv_32fc_t* input,
+                                                   const lv_32fc_t* twiddles,
+                                                   unsigned int num_points)
+{
+    if (num_points < 8) {
+        fft_32fc_bitrev(output, input, num_points);
+        fft_32fc_radix2_stages(output, twiddles, 1, num_points);
+        return;
+    }
+    if (output == input) {
+        fft_32fc_bitrev(output, input, num_points);
+    }
+    fft_32fc_radix8_first(output, input, NULL, twiddles, num_points);
+    fft_32fc_stages_avx512f((float*)output, (const float*)twiddles, num_points);
+}
+
+/*
+ * Runs the stages h = 8, 16, ..., num_points / 2 of volk_32fc_x2_fft_32fc in
+ * place, once the first three are done: radix-4 passes, after one radix-2
+ * stage if their number is odd. num_points is a power of two of at least 8.
+ */
+static inline void fft_32fc_stages_avx512f(float* d,
+                                           const float* twiddles,
+                                           unsigned int num_points)
+{
+    unsigned int stages = 0;
+    for (unsigned int n = num_points / 8; n > 1; n /= 2) {
+        stages++;
+    }
+    unsigned int h = 8;
+
+
+    // complex products x * w as fmaddsub(x, re(w), swap(x) * im(w))
+    if (stages & 1) {
+        const float* w = twiddles + 2 * (h - 1);
+        for (unsigned int b = 0; b < num_points; b += 2 * h) {
+            for (unsigned int j = 0; j < h; j += 8) {
+                float* p = d + 2 * (b + j);
+                const __m512 tw = _mm512_loadu_ps(w + 2 * j);
+                const __m512 x0 = _mm512_loadu_ps(p);
+                __m512 x1 = _mm512_loadu_ps(p + 2 * h);
+                x1 = _mm512_fmaddsub_ps(
+                    x1,
+                    _mm512_moveldup_ps(tw),
+                    _mm512_mul_ps(_mm512_permute_ps(x1, 0xB1), _mm512_movehdup_ps(tw)));
+                _mm512_storeu_ps(p, _mm512_add_ps(x0, x1));
+                _mm512_storeu_ps(p + 2 * h, _mm512_sub_ps(x0, x1));
+            }
+        }
+        h *= 2;
+    }
+
+    for (; 4 * h <= num_points; h *= 4) {
+        const float* w1 = twiddles + 2 * (h - 1);
+        const float* w2 = twiddles + 2 * (2 * h - 1);
+        const float* w3 = twiddles + 2 * (3 * h - 1);
+        for (unsigned int b = 0; b < num_points; b += 4 * h) {
+            for (unsigned int j = 0; j < h; j += 8) {
+                float* p = d + 2 * (b + j);
+                const __m512 tw1 = _mm512_loadu_ps(w1 + 2 * j);
+                const __m512 tw2 = _mm512_loadu_ps(w2 + 2 * j);
+                const __m512 tw3 = _mm512_loadu_ps(w3 + 2 * j);
+                const __m512 w1r = _mm512_moveldup_ps(tw1);
+                const __m512 w1i = _mm512_movehdup_ps(tw1);
+
+                const __m512 x0 = _mm512_loadu_ps(p);
+                __m512 x1 = _mm512_loadu_ps(p + 2 * h);
+                const __m512 x2 = _mm512_loadu_ps(p + 4 * h);
+                __m512 x3 = _mm512_loadu_ps(p + 6 * h);
+                x1 = _mm512_fmaddsub_ps(
+                    x1, w1r, _mm512_mul_ps(_mm512_permute_ps(x1, 0xB1), w1i));
+                x3 = _mm512_fmaddsub_ps(
+                    x3, w1r, _mm512_mul_ps(_mm512_permute_ps(x3, 0xB1), w1i));
+
+                const __m512 y0 = _mm512_add_ps(x0, x1);
+                const __m512 y1 = _mm512_sub_ps(x0, x1);
+                __m512 y2 = _mm512_add_ps(x2, x3);
+                __m512 y3 = _mm512_sub_ps(x2, x3);
+                y2 = _mm512_fmaddsub_ps(
+                    y2,
+                    _mm512_moveldup_ps(tw2),
+                    _mm512_mul_ps(_mm512_permute_ps(y2, 0xB1), _mm512_movehdup_ps(tw2)));
+                y3 = _mm512_fmaddsub_ps(
+                    y3,
+                    _mm512_moveldup_ps(tw3),
+                    _mm512_mul_ps(_mm512_permute_ps(y3, 0xB1), _mm512_movehdup_ps(tw3)));
+
+                _mm512_storeu_ps(p, _mm512_add_ps(y0, y2));
+                _mm512_storeu_ps(p + 2 * h, _mm512_add_ps(y1, y3));
+                _mm512_storeu_ps(p + 4 * h, _mm512_sub_ps(y0, y2));
+                _mm512_storeu_ps(p + 6 * h, _mm512_sub_ps(y1, y3));
+            }
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void fft_32fc_stages_neon(float* d,
+                                        const float* twiddles,
+                                        unsigned int num_points);
+
+static inline void volk_32fc_x2_fft_32fc_neon(lv_32fc_t* output,
+                                              const lv_32fc_t* input,
+                                              const lv_32fc_t* twiddles,
+                                              unsigned int num_points)
+{
+    if (num_points < 8) {
+        fft_32fc_bitrev(output, input, num_points);
+        fft_32fc_radix2_stages(output, twiddles, 1, num_points);
+        return;
+    }
+    if (output == input) {
+        fft_32fc_bitrev(output, input, num_points);
+    }
+    fft_32fc_radix8_first(output, input, NULL, twiddles, num_points);
+    fft_32fc_stages_neon((float*)output, (const float*)twiddles, num_points);
+}
+
+/*
+ * Runs the stages h = 8, 16, ..., num_points / 2 of volk_32fc_x2_fft_32fc in
+ * place, once the first three are done: radix-4 passes, after one radix-2
+ * stage if their number is odd. num_points is a power of two of at least 8.
+ */
+static inline void fft_32fc_stages_neon(float* d,
+                                        const float* twiddles,
+                                        unsigned int num_points)
+{
+    unsigned int stages = 0;
+    for (unsigned int n = num_points / 8; n > 1; n /= 2) {
+        stages++;
+    }
+    unsigned int h = 8;
+
+
+    // four points per vector, deinterleaved into real and imaginary parts
+    if (stages & 1) {
+        const float* w = twiddles + 2 * (h - 1);
+        for (unsigned int b = 0; b < num_points; b += 2 * h) {
+            for (unsigned int j = 0; j < h; j += 4) {
+                float* p = d + 2 * (b + j);
+                const float32x4x2_t x0 = vld2q_f32(p);
+                const float32x4x2_t x1 =
+                    _vmultiply_complexq_f32(vld2q_f32(p + 2 * h), vld2q_f32(w + 2 * j));
+                float32x4x2_t z0, z1;
+                z0.val[0] = vaddq_f32(x0.val[0], x1.val[0]);
+                z0.val[1] = vaddq_f32(x0.val[1], x1.val[1]);
+                z1.val[0] = vsubq_f32(x0.val[0], x1.val[0]);
+                z1.val[1] = vsubq_f32(x0.val[1], x1.val[1]);
+                vst2q_f32(p, z0);
+                vst2q_f32(p + 2 * h, z1);
+            }
+        }
+        h *= 2;
+    }
+
+    for (; 4 * h <= num_points; h *= 4) {
+        const float* w1 = twiddles + 2 * (h - 1);
+        const float* w2 = twiddles + 2 * (2 * h - 1);
+        const float* w3 = twiddles + 2 * (3 * h - 1);
+        for (unsigned int b = 0; b < num_points; b += 4 * h) {
+            for (unsigned int j = 0; j < h; j += 4) {
+                float* p = d + 2 * (b + j);
+                const float32x4x2_t tw1 = vld2q_f32(w1 + 2 * j);
+                const float32x4x2_t x0 = vld2q_f32(p);
+                const float32x4x2_t x1 =
+                    _vmultiply_complexq_f32(vld2q_f32(p + 2 * h), tw1);
+                const float32x4x2_t x2 = vld2q_f32(p + 4 * h);
+                const float32x4x2_t x3 =
+                    _vmultiply_complexq_f32(vld2q_f32(p + 6 * h), tw1);
+
+                float32x4x2_t y0, y1, y2, y3;
+                y0.val[0] = vaddq_f32(x0.val[0], x1.val[0]);
+                y0.val[1] = vaddq_f32(x0.val[1], x1.val[1]);
+                y1.val[0] = vsubq_f32(x0.val[0], x1.val[0]);
+                y1.val[1] = vsubq_f32(x0.val[1], x1.val[1]);
+                y2.val[0] = vaddq_f32(x2.val[0], x3.val[0]);
+                y2.val[1] = vaddq_f32(x2.val[1], x3.val[1]);
+                y3.val[0] = vsubq_f32(x2.val[0], x3.val[0]);
+                y3.val[1] = vsubq_f32(x2.val[1], x3.val[1]);
+                y2 = _vmultiply_complexq_f32(y2, vld2q_f32(w2 + 2 * j));
+                y3 = _vmultiply_complexq_f32(y3, vld2q_f32(w3 + 2 * j));
+
+                float32x4x2_t z0, z1, z2, z3;
+                z0.val[0] = vaddq_f32(y0.val[0], y2.val[0]);
+                z0.val[1] = vaddq_f32(y0.val[1], y2.val[1]);
+                z1.val[0] = vaddq_f32(y1.val[0], y3.val[0]);
+                z1.val[1] = vaddq_f32(y1.val[1], y3.val[1]);
+                z2.val[0] = vsubq_f32(y0.val[0], y2.val[0]);
+                z2.val[1] = vsubq_f32(y0.val[1], y2.val[1]);
+                z3.val[0] = vsubq_f32(y1.val[0], y3.val[0]);
+                z3.val[1] = vsubq_f32(y1.val[1], y3.val[1]);
+                vst2q_f32(p, z0);
+                vst2q_f32(p + 2 * h, z1);
+                vst2q_f32(p + 4 * h, z2);
+                vst2q_f32(p + 6 * h, z3);
+            }
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_fft_32fc_u_H */
@@ -0,0 +1,359 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_x2_fir_decim_32fc
+ *
+ * \b Overview
+ *
+ * Runs a FIR filter with complex taps over a complex input and keeps every
+ * \p decimation-th output:
+ *
+ * output[n] = sum(input[n * decimation + k] * taps[k]) for k in [0, num_taps)
+ *
+ * The taps are applied in the same order as in volk_32fc_x2_dot_prod_32fc, so
+ * pass them reversed to get the convolution. The input has to hold
+ * (num_points - 1) * decimation + num_taps samples.
+ *
+ * The SIMD versions compute several outputs per pass over the taps, so every
+ * tap load is shared by a whole block of outputs.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_fir_decim_32fc(lv_32fc_t* output, const lv_32fc_t* input, const
+ * lv_32fc_t* taps, unsigned int num_taps, unsigned int decimation, unsigned int
+ * num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: The complex input samples.
+ * \li taps: The complex filter taps.
+ * \li num_taps: The number of taps.
+ * \li decimation: The distance in input samples between consecutive outputs.
+ * \li num_points: The number of outputs to compute.
+ *
+ * \b Outputs
+ * \li output: The filtered and decimated samples.
+ *
+ * \b Example
+ * Select a channel with a frequency shifted low pass filter and decimate by 5.
+ * \code
+ *   unsigned int num_taps = 101;
+ *   unsigned int decim = 5;
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(
+ *       sizeof(lv_32fc_t) * ((N - 1) * decim + num_taps), alignment);
+ *   lv_32fc_t* taps = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * num_taps, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   // fill taps and in
+ *
+ *   volk_32fc_x2_fir_decim_32fc(out, in, taps, num_taps, decim, N);
+ *
+ *   volk_free(in);
+ *   volk_free(taps);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_fir_decim_32fc_u_H
+#define INCLUDED_volk_32fc_x2_fir_decim_32fc_u_H
+
+#include <stddef.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_fir_decim_32fc_generic(lv_32fc_t* output,
+                                                       const lv_32fc_t* input,
+                                                       const lv_32fc_t* taps,
+                                                       unsigned int num_taps,
+                                                       unsigned int decimation,
+                                                       unsigned int num_points)
+{
+    for (unsigned int n = 0; n < num_points; n++) {
+        const lv_32fc_t* in = input + (size_t)n * decimation;
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (unsigned int k = 0; k < num_taps; k++) {
+            sum += in[k] * taps[k];
+        }
+        output[n] = sum;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+
+static inline void volk_32fc_x2_fir_decim_32fc_u_sse3(lv_32fc_t* output,
+                                                      const lv_32fc_t* input,
+                                                      const lv_32fc_t* taps,
+                                                      unsigned int num_taps,
+                                                      unsigned int decimation,
+                                                      unsigned int num_points)
+{
+    const unsigned int halfTaps = num_taps / 2;
+
+    // four outputs per pass over the taps. Each output accumulates x * re(t)
+    // and swap(x) * im(t) separately, they are combined once at the end.
+    for (unsigned int n = 0; n < num_points; n += 4) {
+        const unsigned int outputs = num_points - n < 4 ? num_points - n : 4;
+        const lv_32fc_t* in[4];
+        __m128 acc_re[4];
+        __m128 acc_im[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            // short last block: repeat its last output, the result is dropped
+            const unsigned int nj = n + (j < outputs ? j : outputs - 1);
+            in[j] = input + (size_t)nj * decimation;
+            acc_re[j] = _mm_setzero_ps();
+            acc_im[j] = _mm_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < halfTaps; k++) {
+            const __m128 t = _mm_loadu_ps((const float*)(taps + 2 * k));
+            const __m128 t_re = _mm_moveldup_ps(t); // tr0|tr0|tr1|tr1
+            const __m128 t_im = _mm_movehdup_ps(t); // ti0|ti0|ti1|ti1
+            for (unsigned int j = 0; j < 4; j++) {
+                const __m128 x = _mm_loadu_ps((const float*)(in[j] + 2 * k));
+                acc_re[j] = _mm_add_ps(acc_re[j], _mm_mul_ps(x, t_re));
+                acc_im[j] = _mm_add_ps(
+                    acc_im[j], _mm_mul_ps(_mm_shuffle_ps(x, x, 0xB1), t_im));
+            }
+        }
+
+        __m128 z[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            z[j] = _mm_addsub_ps(acc_re[j], acc_im[j]);
+        }
+        // each z holds two partial complex sums
+        __VOLK_ATTR_ALIGNED(16) lv_32fc_t sums[4];
+        _mm_store_ps((float*)sums,
+                     _mm_add_ps(_mm_movelh_ps(z[0], z[1]), _mm_movehl_ps(z[1], z[0])));
+        _mm_store_ps((float*)(sums + 2),
+                     _mm_add_ps(_mm_movelh_ps(z[2], z[3]), _mm_movehl_ps(z[3], z[2])));
+
+        for (unsigned int j = 0; j < outputs; j++) {
+            lv_32fc_t sum = sums[j];
+            if (num_taps & 1) {
+                sum += in[j][num_taps - 1] * taps[num_taps - 1];
+            }
+            output[n + j] = sum;
+        }
+    }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_x2_fir_decim_32fc_u_avx2_fma(lv_32fc_t* output,
+                                                          const lv_32fc_t* input,
+                                                          const lv_32fc_t* taps,
+                                                          unsigned int num_taps,
+                                                          unsigned int decimation,
+                                                          unsigned int num_points)
+{
+    const unsigned int quarterTaps = num_taps / 4;
+    const __m256i tail = _mm256_tail_mask(2 * (num_taps - quarterTaps * 4));
+
+    // four outputs per pass over the taps. Each output accumulates x * re(t)
+    // and swap(x) * im(t) separately, they are combined once at the end.
+    for (unsigned int n = 0; n < num_points; n += 4) {
+        const unsigned int outputs = num_points - n < 4 ? num_points - n : 4;
+        const float* in[4];
+        __m256 acc_re[4];
+        __m256 acc_im[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            // short last block: repeat its last output, the result is dropped
+            const unsigned int nj = n + (j < outputs ? j : outputs - 1);
+            in[j] = (const float*)(input + (size_t)nj * decimation);
+            acc_re[j] = _mm256_setzero_ps();
+            acc_im[j] = _mm256_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < quarterTaps; k++) {
+            const __m256 t = _mm256_loadu_ps((const float*)(taps + 4 * k));
+            const __m256 t_re = _mm256_moveldup_ps(t);
+            const __m256 t_im = _mm256_movehdup_ps(t);
+            for (unsigned int j = 0; j < 4; j++) {
+                const __m256 x = _mm256_loadu_ps(in[j] + 8 * k);
+                acc_re[j] = _mm256_fmadd_ps(x, t_re, acc_re[j]);
+                acc_im[j] = _mm256_fmadd_ps(_mm256_permute_ps(x, 0xB1), t_im, acc_im[j]);
+            }
+        }
+        if (num_taps & 3) {
+            const __m256 t =
+                _mm256_maskload_ps((const float*)(taps + 4 * quarterTaps), tail);
+            const __m256 t_re = _mm256_moveldup_ps(t);
+            const __m256 t_im = _mm256_movehdup_ps(t);
+            for (unsigned int j = 0; j < 4; j++) {
+                const __m256 x = _mm256_maskload_ps(in[j] + 8 * quarterTaps, tail);
+                acc_re[j] = _mm256_fmadd_ps(x, t_re, acc_re[j]);
+                acc_im[j] = _mm256_fmadd_ps(_mm256_permute_ps(x, 0xB1), t_im, acc_im[j]);
+            }
+        }
+
+        __VOLK_ATTR_ALIGNED(32) lv_32fc_t sums[4];
+        _mm256_store_ps((float*)sums,
+                        _mm256_complex_transpose_sum4_ps(
+                            _mm256_addsub_ps(acc_re[0], acc_im[0]),
+                            _mm256_addsub_ps(acc_re[1], acc_im[1]),
+                            _mm256_addsub_ps(acc_re[2], acc_im[2]),
+                            _mm256_addsub_ps(acc_re[3], acc_im[3])));
+        for (unsigned int j = 0; j < outputs; j++) {
+            output[n + j] = sums[j];
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_x2_fir_decim_32fc_u_avx512f(lv_32fc_t* output,
+                                                         const lv_32fc_t* input,
+                                                         const lv_32fc_t* taps,
+                                                         unsigned int num_taps,
+                                                         unsigned int decimation,
+                                                         unsigned int num_points)
+{
+    const unsigned int eighthTaps = num_taps / 8;
+    const __mmask16 tail = (__mmask16)((1u << (2 * (num_taps - eighthTaps * 8))) - 1);
+    const __m512 ones = _mm512_set1_ps(1.f);
+
+    // four outputs per pass over the taps. Each output accumulates x * re(t)
+    // and swap(x) * im(t) separately, they are combined once at the end.
+    for (unsigned int n = 0; n < num_points; n += 4) {
+        const unsigned int outputs = num_points - n < 4 ? num_points - n : 4;
+        const float* in[4];
+        __m512 acc_re[4];
+        __m512 acc_im[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            // short last block: repeat its last output, the result is dropped
+            const unsigned int nj = n + (j < outputs ? j : outputs - 1);
+            in[j] = (const float*)(input + (size_t)nj * decimation);
+            acc_re[j] = _mm512_setzero_ps();
+            acc_im[j] = _mm512_setzero_ps();
+        }
+
+        for (unsigned int k = 0; k < eighthTaps; k++) {
+            const __m512 t = _mm512_loadu_ps((const float*)(taps + 8 * k));
+            const __m512 t_re = _mm512_moveldup_ps(t);
+            const __m512 t_im = _mm512_movehdup_ps(t);
+            for (unsigned int j = 0; j < 4; j++) {
+                const __m512 x = _mm512_loadu_ps(in[j] + 16 * k);
+                acc_re[j] = _mm512_fmadd_ps(x, t_re, acc_re[j]);
+                acc_im[j] = _mm512_fmadd_ps(_mm512_permute_ps(x, 0xB1), t_im, acc_im[j]);
+            }
+        }
+        if (tail) {
+            const __m512 t =
+                _mm512_maskz_loadu_ps(tail, (const float*)(taps + 8 * eighthTaps));
+            const __m512 t_re = _mm512_moveldup_ps(t);
+            const __m512 t_im = _mm512_movehdup_ps(t);
+            for (unsigned int j = 0; j < 4; j++) {
+                const __m512 x = _mm512_maskz_loadu_ps(tail, in[j] + 16 * eighthTaps);
+                acc_re[j] = _mm512_fmadd_ps(x, t_re, acc_re[j]);
+                acc_im[j] = _mm512_fmadd_ps(_mm512_permute_ps(x, 0xB1), t_im, acc_im[j]);
+            }
+        }
+
+        // combine (there is no 512-bit addsub), fold to four complex sums,
+        // then sum all four together
+        __m256 half[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            const __m512 z = _mm512_fmaddsub_ps(acc_re[j], ones, acc_im[j]);
+            half[j] = _mm256_add_ps(
+                _mm512_castps512_ps256(z),
+                _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(z), 1)));
+        }
+        __VOLK_ATTR_ALIGNED(32) lv_32fc_t sums[4];
+        _mm256_store_ps(
+            (float*)sums,
+            _mm256_complex_transpose_sum4_ps(half[0], half[1], half[2], half[3]));
+        for (unsigned int j = 0; j < outputs; j++) {
+            output[n + j] = sums[j];
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_x2_fir_decim_32fc_neon(lv_32fc_t* output,
+                                                    const lv_32fc_t* input,
+                                                    const lv_32fc_t* taps,
+                                                    unsigned int num_taps,
+                                                    unsigned int decimation,
+                                                    unsigned int num_points)
+{
+    const unsigned int quarterTaps = num_taps / 4;
+
+    // four outputs per pass over the taps, separate real and imaginary
+    // accumulators for each
+    for (unsigned int n = 0; n < num_points; n += 4) {
+        const unsigned int outputs = num_points - n < 4 ? num_points - n : 4;
+        const lv_32fc_t* in[4];
+        float32x4_t acc_re[4];
+        float32x4_t acc_im[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            // short last block: repeat its last output, the result is dropped
+            const unsigned int nj = n + (j < outputs ? j : outputs - 1);
+            in[j] = input + (size_t)nj * decimation;
+            acc_re[j] = vdupq_n_f32(0);
+            acc_im[j] = vdupq_n_f32(0);
+        }
+
+        for (unsigned int k = 0; k < quarterTaps; k++) {
+            const float32x4x2_t t = vld2q_f32((const float*)(taps + 4 * k));
+            for (unsigned int j = 0; j < 4; j++) {
+                const float32x4x2_t x = vld2q_f32((const float*)(in[j] + 4 * k));
+                acc_re[j] = vmlaq_f32(acc_re[j], x.val[0], t.val[0]);
+                acc_re[j] = vmlsq_f32(acc_re[j], x.val[1], t.val[1]);
+                acc_im[j] = vmlaq_f32(acc_im[j], x.val[0], t.val[1]);
+                acc_im[j] = vmlaq_f32(acc_im[j], x.val[1], t.val[0]);
+            }
+        }
+
+        float32x2_t half_re[4];
+        float32x2_t half_im[4];
+        for (unsigned int j = 0; j < 4; j++) {
+            half_re[j] = vadd_f32(vget_low_f32(acc_re[j]), vget_high_f32(acc_re[j]));
+            half_im[j] = vadd_f32(vget_low_f32(acc_im[j]), vget_high_f32(acc_im[j]));
+        }
+        float32x4x2_t sum;
+        sum.val[0] = vcombine_f32(vpadd_f32(half_re[0], half_re[1]),
+                                  vpadd_f32(half_re[2], half_re[3]));
+        sum.val[1] = vcombine_f32(vpadd_f32(half_im[0], half_im[1]),
+                                  vpadd_f32(half_im[2], half_im[3]));
+        __VOLK_ATTR_ALIGNED(16) lv_32fc_t sums[4];
+        vst2q_f32((float*)sums, sum);
+
+        for (unsigned int j = 0; j < outputs; j++) {
+            lv_32fc_t s = sums[j];
+            for (unsigned int k = quarterTaps * 4; k < num_taps; k++) {
+                s += in[j][k] * taps[k];
+            }
+            output[n + j] = s;
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_fir_decim_32fc_u_H */
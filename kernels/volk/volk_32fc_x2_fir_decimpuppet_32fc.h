@@ -0,0 +1,111 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_fir_decimpuppet_32fc_H
+#define INCLUDED_volk_32fc_x2_fir_decimpuppet_32fc_H
+
+#include <volk/volk_32fc_x2_fir_decim_32fc.h>
+
+// Test geometry: a VOLK_FIR_PUPPET_TAPS tap filter decimating by
+// VOLK_FIR_PUPPET_DECIM, as many outputs as the input of num_points holds.
+#ifndef VOLK_FIR_PUPPET_TAPS
+#define VOLK_FIR_PUPPET_TAPS 37
+#define VOLK_FIR_PUPPET_DECIM 3
+#define VOLK_FIR_PUPPET_COUNT(num_points) \
+    ((num_points) < VOLK_FIR_PUPPET_TAPS    \
+         ? 0                                \
+         : ((num_points)-VOLK_FIR_PUPPET_TAPS) / VOLK_FIR_PUPPET_DECIM + 1)
+#endif
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_fir_decimpuppet_32fc_generic(lv_32fc_t* output,
+                                                             const lv_32fc_t* input,
+                                                             const lv_32fc_t* taps,
+                                                             unsigned int num_points)
+{
+    volk_32fc_x2_fir_decim_32fc_generic(output,
+                                        input,
+                                        taps,
+                                        VOLK_FIR_PUPPET_TAPS,
+                                        VOLK_FIR_PUPPET_DECIM,
+                                        VOLK_FIR_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+
+static inline void volk_32fc_x2_fir_decimpuppet_32fc_u_sse3(lv_32fc_t* output,
+                                                            const lv_32fc_t* input,
+                                                            const lv_32fc_t* taps,
+                                                            unsigned int num_points)
+{
+    volk_32fc_x2_fir_decim_32fc_u_sse3(output,
+                                       input,
+                                       taps,
+                                       VOLK_FIR_PUPPET_TAPS,
+                                       VOLK_FIR_PUPPET_DECIM,
+                                       VOLK_FIR_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32fc_x2_fir_decimpuppet_32fc_u_avx2_fma(lv_32fc_t* output,
+                                                                const lv_32fc_t* input,
+                                                                const lv_32fc_t* taps,
+                                                                unsigned int num_points)
+{
+    volk_32fc_x2_fir_decim_32fc_u_avx2_fma(output,
+                                           input,
+                                           taps,
+                                           VOLK_FIR_PUPPET_TAPS,
+                                           VOLK_FIR_PUPPET_DECIM,
+                                           VOLK_FIR_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_x2_fir_decimpuppet_32fc_u_avx512f(lv_32fc_t* output,
+                                                               const lv_32fc_t* input,
+                                                               const lv_32fc_t* taps,
+                                                               unsigned int num_points)
+{
+    volk_32fc_x2_fir_decim_32fc_u_avx512f(output,
+                                          input,
+                                          taps,
+                                          VOLK_FIR_PUPPET_TAPS,
+                                          VOLK_FIR_PUPPET_DECIM,
+                                          VOLK_FIR_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_x2_fir_decimpuppet_32fc_neon(lv_32fc_t* output,
+                                                          const lv_32fc_t* input,
+                                                          const lv_32fc_t* taps,
+                                                          unsigned int num_points)
+{
+    volk_32fc_x2_fir_decim_32fc_neon(output,
+                                     input,
+                                     taps,
+                                     VOLK_FIR_PUPPET_TAPS,
+                                     VOLK_FIR_PUPPET_DECIM,
+                                     VOLK_FIR_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_fir_decimpuppet_32fc_H */
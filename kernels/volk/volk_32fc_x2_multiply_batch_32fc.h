@@ -0,0 +1,240 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_x2_multiply_batch_32fc
+ *
+ * \b Overview
+ *
+ * Multiplies \p num_batches pairs of complex vectors of \p num_points points
+ * elementwise in one call. Batch b reads the vectors starting at
+ * aVector + b * a_stride and bVector + b * b_stride and writes to
+ * cVector + b * c_stride. A stride of 0 for \p bVector applies the same
+ * vector (e.g. equalizer coefficients) to every batch. This avoids the
+ * per-call overhead of volk_32fc_x2_multiply_32fc for many short vectors.
+ * The SIMD versions fill their registers with several batches when the
+ * vectors hold one or two points. For longer vectors the AVX version handles
+ * the tail of each vector with masked loads and stores, while the NEON
+ * version runs volk_32fc_x2_multiply_32fc_neon on one batch at a time.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_multiply_batch_32fc(lv_32fc_t* cVector, const lv_32fc_t* aVector,
+ * const lv_32fc_t* bVector, unsigned int c_stride, unsigned int a_stride, unsigned int
+ * b_stride, unsigned int num_batches, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: first input vector of batch 0.
+ * \li bVector: second input vector of batch 0.
+ * \li c_stride: distance in points between consecutive output vectors.
+ * \li a_stride: distance in points between consecutive aVector vectors.
+ * \li b_stride: distance in points between consecutive bVector vectors.
+ * \li num_batches: number of vector pairs.
+ * \li num_points: number of points in each vector.
+ *
+ * \b Outputs
+ * \li cVector: output vector of batch 0.
+ *
+ * \b Example
+ * Equalize 14 OFDM symbols of 72 subcarriers with one set of coefficients.
+ * \code
+ *   unsigned int nsc = 72, nsym = 14;
+ *   size_t alignment = volk_get_alignment();
+ *   lv_32fc_t* sym = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * nsc * nsym, alignment);
+ *   lv_32fc_t* eq = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * nsc, alignment);
+ *
+ *   // fill sym and eq
+ *
+ *   volk_32fc_x2_multiply_batch_32fc(sym, sym, eq, nsc, nsc, 0, nsym, nsc);
+ *
+ *   volk_free(sym);
+ *   volk_free(eq);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_multiply_batch_32fc_u_H
+#define INCLUDED_volk_32fc_x2_multiply_batch_32fc_u_H
+
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_multiply_batch_32fc_generic(lv_32fc_t* cVector,
+                                                            const lv_32fc_t* aVector,
+                                                            const lv_32fc_t* bVector,
+                                                            unsigned int c_stride,
+                                                            unsigned int a_stride,
+                                                            unsigned int b_stride,
+                                                            unsigned int num_batches,
+                                                            unsigned int num_points)
+{
+    for (unsigned int b = 0; b < num_batches; b++) {
+        lv_32fc_t* c = cVector + (size_t)b * c_stride;
+        const lv_32fc_t* a = aVector + (size_t)b * a_stride;
+        const lv_32fc_t* bb = bVector + (size_t)b * b_stride;
+        for (unsigned int i = 0; i < num_points; i++) {
+            c[i] = a[i] * bb[i];
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_x2_multiply_batch_32fc_u_avx(lv_32fc_t* cVector,
+                                                          const lv_32fc_t* aVector,
+                                                          const lv_32fc_t* bVector,
+                                                          unsigned int c_stride,
+                                                          unsigned int a_stride,
+                                                          unsigned int b_stride,
+                                                          unsigned int num_batches,
+                                                          unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const __m256i tail = _mm256_tail_mask(2 * (num_points - quarterPoints * 4));
+    unsigned int b = 0;
+
+    // vectors of one or two points: fill the four complex lanes with four or
+    // two batches instead of masking most of them off
+    const size_t as = a_stride, bs = b_stride, cs = c_stride;
+    if (num_points == 2) {
+        for (; b + 2 <= num_batches; b += 2) {
+            const float* a = (const float*)(aVector + b * as);
+            const float* bb = (const float*)(bVector + b * bs);
+            float* c = (float*)(cVector + b * cs);
+            const __m256 x = _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm_loadu_ps(a)), _mm_loadu_ps(a + 2 * as), 1);
+            const __m256 y = _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm_loadu_ps(bb)), _mm_loadu_ps(bb + 2 * bs), 1);
+            const __m256 z = _mm256_complexmul_ps(x, y);
+            _mm_storeu_ps(c, _mm256_castps256_ps128(z));
+            _mm_storeu_ps(c + 2 * cs, _mm256_extractf128_ps(z, 1));
+        }
+    } else if (num_points == 1) {
+        const __m128 zero = _mm_setzero_ps();
+        for (; b + 4 <= num_batches; b += 4) {
+            const __m64* a = (const __m64*)(aVector + b * as);
+            const __m64* bb = (const __m64*)(bVector + b * bs);
+            __m64* c = (__m64*)(cVector + b * cs);
+            // one __m64 per complex point
+            const __m128 xlo = _mm_loadh_pi(_mm_loadl_pi(zero, a), a + as);
+            const __m128 xhi = _mm_loadh_pi(_mm_loadl_pi(zero, a + 2 * as), a + 3 * as);
+            const __m128 ylo = _mm_loadh_pi(_mm_loadl_pi(zero, bb), bb + bs);
+            const __m128 yhi = _mm_loadh_pi(_mm_loadl_pi(zero, bb + 2 * bs), bb + 3 * bs);
+            const __m256 z = _mm256_complexmul_ps(
+                _mm256_insertf128_ps(_mm256_castps128_ps256(xlo), xhi, 1),
+                _mm256_insertf128_ps(_mm256_castps128_ps256(ylo), yhi, 1));
+            const __m128 zlo = _mm256_castps256_ps128(z);
+            const __m128 zhi = _mm256_extractf128_ps(z, 1);
+            _mm_storel_pi(c, zlo);
+            _mm_storeh_pi(c + cs, zlo);
+            _mm_storel_pi(c + 2 * cs, zhi);
+            _mm_storeh_pi(c + 3 * cs, zhi);
+        }
+    }
+
+    for (; b < num_batches; b++) {
+        float* c = (float*)(cVector + (size_t)b * c_stride);
+        const float* a = (const float*)(aVector + (size_t)b * a_stride);
+        const float* bb = (const float*)(bVector + (size_t)b * b_stride);
+
+        for (unsigned int number = 0; number < quarterPoints; number++) {
+            const __m256 x = _mm256_loadu_ps(a);
+            const __m256 y = _mm256_loadu_ps(bb);
+            _mm256_storeu_ps(c, _mm256_complexmul_ps(x, y));
+            a += 8;
+            bb += 8;
+            c += 8;
+        }
+        if (num_points & 3) {
+            const __m256 x = _mm256_maskload_ps(a, tail);
+            const __m256 y = _mm256_maskload_ps(bb, tail);
+            _mm256_maskstore_ps(c, tail, _mm256_complexmul_ps(x, y));
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_32fc_x2_multiply_32fc.h>
+
+static inline void volk_32fc_x2_multiply_batch_32fc_neon(lv_32fc_t* cVector,
+                                                         const lv_32fc_t* aVector,
+                                                         const lv_32fc_t* bVector,
+                                                         unsigned int c_stride,
+                                                         unsigned int a_stride,
+                                                         unsigned int b_stride,
+                                                         unsigned int num_batches,
+                                                         unsigned int num_points)
+{
+    unsigned int b = 0;
+
+    // vectors of one or two points: take the four points of a register from
+    // four or two batches
+    if (num_points == 1 || num_points == 2) {
+        const unsigned int group = 4 / num_points;
+        for (; b + group <= num_batches; b += group) {
+            const float* a[4];
+            const float* bb[4];
+            float* c[4];
+            for (unsigned int j = 0; j < group; j++) {
+                a[j] = (const float*)(aVector + (size_t)(b + j) * a_stride);
+                bb[j] = (const float*)(bVector + (size_t)(b + j) * b_stride);
+                c[j] = (float*)(cVector + (size_t)(b + j) * c_stride);
+            }
+            float32x4_t x01, x23, y01, y23;
+            if (num_points == 2) {
+                x01 = vld1q_f32(a[0]);
+                x23 = vld1q_f32(a[1]);
+                y01 = vld1q_f32(bb[0]);
+                y23 = vld1q_f32(bb[1]);
+            } else {
+                x01 = vcombine_f32(vld1_f32(a[0]), vld1_f32(a[1]));
+                x23 = vcombine_f32(vld1_f32(a[2]), vld1_f32(a[3]));
+                y01 = vcombine_f32(vld1_f32(bb[0]), vld1_f32(bb[1]));
+                y23 = vcombine_f32(vld1_f32(bb[2]), vld1_f32(bb[3]));
+            }
+            // real parts in val[0], imaginary parts in val[1]
+            const float32x4x2_t x = vuzpq_f32(x01, x23);
+            const float32x4x2_t y = vuzpq_f32(y01, y23);
+            const float32x4_t re =
+                vmlsq_f32(vmulq_f32(x.val[0], y.val[0]), x.val[1], y.val[1]);
+            const float32x4_t im =
+                vmlaq_f32(vmulq_f32(x.val[0], y.val[1]), x.val[1], y.val[0]);
+            const float32x4x2_t z = vzipq_f32(re, im);
+            if (num_points == 2) {
+                vst1q_f32(c[0], z.val[0]);
+                vst1q_f32(c[1], z.val[1]);
+            } else {
+                vst1_f32(c[0], vget_low_f32(z.val[0]));
+                vst1_f32(c[1], vget_high_f32(z.val[0]));
+                vst1_f32(c[2], vget_low_f32(z.val[1]));
+                vst1_f32(c[3], vget_high_f32(z.val[1]));
+            }
+        }
+    }
+
+    for (; b < num_batches; b++) {
+        volk_32fc_x2_multiply_32fc_neon(cVector + (size_t)b * c_stride,
+                                        aVector + (size_t)b * a_stride,
+                                        bVector + (size_t)b * b_stride,
+                                        num_points);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_multiply_batch_32fc_u_H */
@@ -0,0 +1,97 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_multiply_batchpuppet_32fc_H
+#define INCLUDED_volk_32fc_x2_multiply_batchpuppet_32fc_H
+
+#include <volk/volk_32fc_x2_multiply_batch_32fc.h>
+
+// Test geometry: vectors of VOLK_BATCH_PUPPET_LEN points that start every
+// VOLK_BATCH_PUPPET_STRIDE points, as many as fit into num_points.
+#ifndef VOLK_BATCH_PUPPET_LEN
+#define VOLK_BATCH_PUPPET_LEN 23
+#define VOLK_BATCH_PUPPET_STRIDE 27
+#define VOLK_BATCH_PUPPET_COUNT(num_points) \
+    ((num_points) < VOLK_BATCH_PUPPET_LEN   \
+         ? 0                                \
+         : ((num_points)-VOLK_BATCH_PUPPET_LEN) / VOLK_BATCH_PUPPET_STRIDE + 1)
+#endif
+
+typedef void (*volk_batch_puppet_multiply_fn)(lv_32fc_t*,
+                                              const lv_32fc_t*,
+                                              const lv_32fc_t*,
+                                              unsigned int,
+                                              unsigned int,
+                                              unsigned int,
+                                              unsigned int,
+                                              unsigned int);
+
+// Runs fn over three regions of num_points: vectors of one point (every
+// other point, sharing one bVector point), vectors of two points (every third
+// point) and the VOLK_BATCH_PUPPET_LEN geometry above (sharing one bVector).
+static inline void volk_batch_puppet_multiply(volk_batch_puppet_multiply_fn fn,
+                                              lv_32fc_t* cVector,
+                                              const lv_32fc_t* aVector,
+                                              const lv_32fc_t* bVector,
+                                              unsigned int num_points)
+{
+    const unsigned int quarter = num_points / 4;
+    fn(cVector, aVector, bVector, 2, 2, 0, quarter / 2, 1);
+    fn(cVector + quarter, aVector + quarter, bVector + quarter, 3, 3, 3, quarter / 3, 2);
+    fn(cVector + 2 * quarter,
+       aVector + 2 * quarter,
+       bVector + 2 * quarter,
+       VOLK_BATCH_PUPPET_STRIDE,
+       VOLK_BATCH_PUPPET_STRIDE,
+       0,
+       VOLK_BATCH_PUPPET_COUNT(num_points - 2 * quarter),
+       VOLK_BATCH_PUPPET_LEN);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_x2_multiply_batchpuppet_32fc_generic(lv_32fc_t* cVector,
+                                               const lv_32fc_t* aVector,
+                                               const lv_32fc_t* bVector,
+                                               unsigned int num_points)
+{
+    volk_batch_puppet_multiply(
+        volk_32fc_x2_multiply_batch_32fc_generic, cVector, aVector, bVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_x2_multiply_batchpuppet_32fc_u_avx(lv_32fc_t* cVector,
+                                                                const lv_32fc_t* aVector,
+                                                                const lv_32fc_t* bVector,
+                                                                unsigned int num_points)
+{
+    volk_batch_puppet_multiply(
+        volk_32fc_x2_multiply_batch_32fc_u_avx, cVector, aVector, bVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_x2_multiply_batchpuppet_32fc_neon(lv_32fc_t* cVector,
+                                                               const lv_32fc_t* aVector,
+                                                               const lv_32fc_t* bVector,
+                                                               unsigned int num_points)
+{
+    volk_batch_puppet_multiply(
+        volk_32fc_x2_multiply_batch_32fc_neon, cVector, aVector, bVector, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_multiply_batchpuppet_32fc_H */
@@ -0,0 +1,200 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_x2_multiply_conjugate_strided_32fc
+ *
+ * \b Overview
+ *
+ * Multiplies a strided complex vector by the complex conjugate of another
+ * strided vector element by element:
+ *
+ * c[i * c_stride] = a[i * a_stride] * conj(b[i * b_stride])
+ *
+ * This reads and writes channels of interleaved multi-channel buffers in
+ * place, without deinterleaving them into temporaries first.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_multiply_conjugate_strided_32fc(lv_32fc_t* cVector, const lv_32fc_t*
+ * aVector, const lv_32fc_t* bVector, unsigned int c_stride, unsigned int a_stride,
+ * unsigned int b_stride, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: First vector of input points.
+ * \li bVector: Second vector of input points.
+ * \li c_stride: Distance in complex points between consecutive output points.
+ * \li a_stride: Distance in complex points between consecutive points of aVector.
+ * \li b_stride: Distance in complex points between consecutive points of bVector.
+ * \li num_points: The number of points to process.
+ *
+ * \b Outputs
+ * \li cVector: The output vector.
+ *
+ * \b Example
+ * Correlate channel 2 of an 8 channel interleaved buffer with a reference.
+ * \code
+ *   int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* frames = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * 8 * N, alignment);
+ *   lv_32fc_t* ref = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   // fill frames and ref
+ *
+ *   volk_32fc_x2_multiply_conjugate_strided_32fc(out, frames + 2, ref, 1, 8, 1, N);
+ *
+ *   volk_free(frames);
+ *   volk_free(ref);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_multiply_conjugate_strided_32fc_u_H
+#define INCLUDED_volk_32fc_x2_multiply_conjugate_strided_32fc_u_H
+
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_x2_multiply_conjugate_strided_32fc_generic(lv_32fc_t* cVector,
+                                                     const lv_32fc_t* aVector,
+                                                     const lv_32fc_t* bVector,
+                                                     unsigned int c_stride,
+                                                     unsigned int a_stride,
+                                                     unsigned int b_stride,
+                                                     unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        *cVector = (*aVector) * lv_conj(*bVector);
+        cVector += c_stride;
+        aVector += a_stride;
+        bVector += b_stride;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+#include <volk/volk_sse_intrinsics.h>
+
+static inline void
+volk_32fc_x2_multiply_conjugate_strided_32fc_u_sse3(lv_32fc_t* cVector,
+                                                    const lv_32fc_t* aVector,
+                                                    const lv_32fc_t* bVector,
+                                                    unsigned int c_stride,
+                                                    unsigned int a_stride,
+                                                    unsigned int b_stride,
+                                                    unsigned int num_points)
+{
+    const unsigned int halfPoints = num_points / 2;
+
+    for (unsigned int number = 0; number < halfPoints; number++) {
+        const __m128 x = _mm_loadu_strided_pc((const float*)aVector, a_stride);
+        const __m128 y = _mm_loadu_strided_pc((const float*)bVector, b_stride);
+        const __m128 z = _mm_complexconjugatemul_ps(x, y);
+        _mm_storeu_strided_pc((float*)cVector, c_stride, z);
+        aVector += 2 * (size_t)a_stride;
+        bVector += 2 * (size_t)b_stride;
+        cVector += 2 * (size_t)c_stride;
+    }
+
+    volk_32fc_x2_multiply_conjugate_strided_32fc_generic(cVector,
+                                                         aVector,
+                                                         bVector,
+                                                         c_stride,
+                                                         a_stride,
+                                                         b_stride,
+                                                         num_points - halfPoints * 2);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void
+volk_32fc_x2_multiply_conjugate_strided_32fc_u_avx2(lv_32fc_t* cVector,
+                                                    const lv_32fc_t* aVector,
+                                                    const lv_32fc_t* bVector,
+                                                    unsigned int c_stride,
+                                                    unsigned int a_stride,
+                                                    unsigned int b_stride,
+                                                    unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const __m256i a_index = _mm256_stride_index(a_stride);
+    const __m256i b_index = _mm256_stride_index(b_stride);
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const __m256 x =
+            _mm256_loadu_strided_pc((const float*)aVector, a_stride, a_index);
+        const __m256 y =
+            _mm256_loadu_strided_pc((const float*)bVector, b_stride, b_index);
+        const __m256 z = _mm256_complexconjugatemul_ps(x, y);
+        _mm256_storeu_strided_pc((float*)cVector, c_stride, z);
+        aVector += 4 * (size_t)a_stride;
+        bVector += 4 * (size_t)b_stride;
+        cVector += 4 * (size_t)c_stride;
+    }
+
+    volk_32fc_x2_multiply_conjugate_strided_32fc_generic(cVector,
+                                                         aVector,
+                                                         bVector,
+                                                         c_stride,
+                                                         a_stride,
+                                                         b_stride,
+                                                         num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_32fc_x2_multiply_conjugate_strided_32fc_neon(lv_32fc_t* cVector,
+                                                  const lv_32fc_t* aVector,
+                                                  const lv_32fc_t* bVector,
+                                                  unsigned int c_stride,
+                                                  unsigned int a_stride,
+                                                  unsigned int b_stride,
+                                                  unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const float32x4x2_t x = _vld2q_strided_f32((const float*)aVector, a_stride);
+        float32x4x2_t y = _vld2q_strided_f32((const float*)bVector, b_stride);
+        y.val[1] = vnegq_f32(y.val[1]);
+        _vst2q_strided_f32((float*)cVector, c_stride, _vmultiply_complexq_f32(x, y));
+        aVector += 4 * (size_t)a_stride;
+        bVector += 4 * (size_t)b_stride;
+        cVector += 4 * (size_t)c_stride;
+    }
+
+    volk_32fc_x2_multiply_conjugate_strided_32fc_generic(cVector,
+                                                         aVector,
+                                                         bVector,
+                                                         c_stride,
+                                                         a_stride,
+                                                         b_stride,
+                                                         num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_multiply_conjugate_strided_32fc_u_H */
@@ -0,0 +1,100 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_multiply_stridedpuppet_32fc_H
+#define INCLUDED_volk_32fc_x2_multiply_stridedpuppet_32fc_H
+
+#include <volk/volk_32fc_x2_multiply_strided_32fc.h>
+
+// Test geometry: outputs every VOLK_STRIDED_PUPPET_OUT points, the first input
+// every VOLK_STRIDED_PUPPET_IN points and the second one contiguous, as many
+// points as fit into num_points.
+#ifndef VOLK_STRIDED_PUPPET_IN
+#define VOLK_STRIDED_PUPPET_IN 3
+#define VOLK_STRIDED_PUPPET_OUT 2
+#define VOLK_STRIDED_PUPPET_COUNT(num_points) ((num_points) / VOLK_STRIDED_PUPPET_IN)
+#endif
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_x2_multiply_stridedpuppet_32fc_generic(lv_32fc_t* cVector,
+                                                 const lv_32fc_t* aVector,
+                                                 const lv_32fc_t* bVector,
+                                                 unsigned int num_points)
+{
+    volk_32fc_x2_multiply_strided_32fc_generic(cVector,
+                                               aVector,
+                                               bVector,
+                                               VOLK_STRIDED_PUPPET_OUT,
+                                               VOLK_STRIDED_PUPPET_IN,
+                                               1,
+                                               VOLK_STRIDED_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+
+static inline void
+volk_32fc_x2_multiply_stridedpuppet_32fc_u_sse3(lv_32fc_t* cVector,
+                                                const lv_32fc_t* aVector,
+                                                const lv_32fc_t* bVector,
+                                                unsigned int num_points)
+{
+    volk_32fc_x2_multiply_strided_32fc_u_sse3(cVector,
+                                              aVector,
+                                              bVector,
+                                              VOLK_STRIDED_PUPPET_OUT,
+                                              VOLK_STRIDED_PUPPET_IN,
+                                              1,
+                                              VOLK_STRIDED_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void
+volk_32fc_x2_multiply_stridedpuppet_32fc_u_avx2(lv_32fc_t* cVector,
+                                                const lv_32fc_t* aVector,
+                                                const lv_32fc_t* bVector,
+                                                unsigned int num_points)
+{
+    volk_32fc_x2_multiply_strided_32fc_u_avx2(cVector,
+                                              aVector,
+                                              bVector,
+                                              VOLK_STRIDED_PUPPET_OUT,
+                                              VOLK_STRIDED_PUPPET_IN,
+                                              1,
+                                              VOLK_STRIDED_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32fc_x2_multiply_stridedpuppet_32fc_neon(lv_32fc_t* cVector,
+                                              const lv_32fc_t* aVector,
+                                              const lv_32fc_t* bVector,
+                                              unsigned int num_points)
+{
+    volk_32fc_x2_multiply_strided_32fc_neon(cVector,
+                                            aVector,
+                                            bVector,
+                                            VOLK_STRIDED_PUPPET_OUT,
+                                            VOLK_STRIDED_PUPPET_IN,
+                                            1,
+                                            VOLK_STRIDED_PUPPET_COUNT(num_points));
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_multiply_stridedpuppet_32fc_H */
@@ -0,0 +1,311 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_x2_s32f_phase_diff_32f
+ *
+ * \b Overview
+ *
+ * Computes the phase difference between two complex vectors, the argument of
+ * a[i] * conj(b[i]), multiplied by a scale factor. With b the input delayed by
+ * one sample this is a quadrature (FM) demodulator in a single pass.
+ *
+ * The SIMD versions compute atan2 with the polynomial of the
+ * volk_32fc_s32f_atan2_32f versions, with a relative error below 1e-6.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_s32f_phase_diff_32f(float* outputVector, const lv_32fc_t* aVector,
+ * const lv_32fc_t* bVector, const float scale, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: The first input vector.
+ * \li bVector: The second input vector, conjugated.
+ * \li scale: The factor the phase differences in radians are multiplied by.
+ * \li num_points: The number of values in each input vector.
+ *
+ * \b Outputs
+ * \li outputVector: arg(aVector[i] * conj(bVector[i])) * scale, in [-pi, pi] * scale.
+ *
+ * \b Example
+ * FM demodulate a block of samples, keeping the last sample of the previous
+ * block in front of the buffer.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * (N + 1), alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float sample_rate = 240e3f;
+ *   float deviation = 75e3f;
+ *   float gain = sample_rate / (2.f * (float)M_PI * deviation);
+ *
+ *   in[0] = lv_cmake(1.f, 0.f);
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       // a tone at a quarter of the deviation
+ *       float phase = 2.f * (float)M_PI * 0.25f * deviation / sample_rate * (ii + 1);
+ *       in[ii + 1] = lv_cmake(cosf(phase), sinf(phase));
+ *   }
+ *
+ *   volk_32fc_x2_s32f_phase_diff_32f(out, in + 1, in, gain, N);
+ *
+ *   for (unsigned int ii = 0; ii < 10; ++ii) {
+ *       printf("out[%u] = %1.3f\n", ii, out[ii]); // 0.25
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_s32f_phase_diff_32f_a_H
+#define INCLUDED_volk_32fc_x2_s32f_phase_diff_32f_a_H
+
+#include <math.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_s32f_phase_diff_32f_generic(float* outputVector,
+                                                            const lv_32fc_t* aVector,
+                                                            const lv_32fc_t* bVector,
+                                                            const float scale,
+                                                            unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        const lv_32fc_t z = aVector[number] * lv_conj(bVector[number]);
+        outputVector[number] = atan2f(lv_cimag(z), lv_creal(z)) * scale;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_fma_intrinsics.h>
+
+static inline void volk_32fc_x2_s32f_phase_diff_32f_a_avx2_fma(float* outputVector,
+                                                               const lv_32fc_t* aVector,
+                                                               const lv_32fc_t* bVector,
+                                                               const float scale,
+                                                               unsigned int num_points)
+{
+    const float* aPtr = (const float*)aVector;
+    const float* bPtr = (const float*)bVector;
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const unsigned int eighthPoints = num_points / 8;
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m256 a0 = _mm256_load_ps(aPtr + 16 * number);
+        const __m256 a1 = _mm256_load_ps(aPtr + 16 * number + 8);
+        const __m256 b0 = _mm256_load_ps(bPtr + 16 * number);
+        const __m256 b1 = _mm256_load_ps(bPtr + 16 * number + 8);
+        // real and imaginary parts of the values 0, 1, 4, 5, 2, 3, 6, 7
+        const __m256 ar = _mm256_shuffle_ps(a0, a1, 0x88);
+        const __m256 ai = _mm256_shuffle_ps(a0, a1, 0xDD);
+        const __m256 br = _mm256_shuffle_ps(b0, b1, 0x88);
+        const __m256 bi = _mm256_shuffle_ps(b0, b1, 0xDD);
+
+        // a * conj(b)
+        const __m256 x = _mm256_fmadd_ps(ar, br, _mm256_mul_ps(ai, bi));
+        const __m256 y = _mm256_fmsub_ps(ai, br, _mm256_mul_ps(ar, bi));
+
+        __m256 result = _mm256_mul_ps(_mm256_atan2_ps_avx2_fma(y, x), vscale);
+        result = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(result), 0xD8));
+        _mm256_store_ps(outputVector + 8 * number, result);
+    }
+
+    volk_32fc_x2_s32f_phase_diff_32f_generic(outputVector + eighthPoints * 8,
+                                             aVector + eighthPoints * 8,
+                                             bVector + eighthPoints * 8,
+                                             scale,
+                                             num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_s32f_phase_diff_32f_a_avx512f(float* outputVector,
+                                                              const lv_32fc_t* aVector,
+                                                              const lv_32fc_t* bVector,
+                                                              const float scale,
+                                                              unsigned int num_points)
+{
+    const float* aPtr = (const float*)aVector;
+    const float* bPtr = (const float*)bVector;
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512i real_idx =
+        _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i imag_idx =
+        _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 a0 = _mm512_load_ps(aPtr + 32 * number);
+        const __m512 a1 = _mm512_load_ps(aPtr + 32 * number + 16);
+        const __m512 b0 = _mm512_load_ps(bPtr + 32 * number);
+        const __m512 b1 = _mm512_load_ps(bPtr + 32 * number + 16);
+        const __m512 ar = _mm512_permutex2var_ps(a0, real_idx, a1);
+        const __m512 ai = _mm512_permutex2var_ps(a0, imag_idx, a1);
+        const __m512 br = _mm512_permutex2var_ps(b0, real_idx, b1);
+        const __m512 bi = _mm512_permutex2var_ps(b0, imag_idx, b1);
+
+        // a * conj(b)
+        const __m512 x = _mm512_fmadd_ps(ar, br, _mm512_mul_ps(ai, bi));
+        const __m512 y = _mm512_fmsub_ps(ai, br, _mm512_mul_ps(ar, bi));
+
+        _mm512_store_ps(outputVector + 16 * number,
+                        _mm512_mul_ps(_mm512_atan2_ps_avx512f(y, x), vscale));
+    }
+
+    volk_32fc_x2_s32f_phase_diff_32f_generic(outputVector + sixteenthPoints * 16,
+                                             aVector + sixteenthPoints * 16,
+                                             bVector + sixteenthPoints * 16,
+                                             scale,
+                                             num_points - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_x2_s32f_phase_diff_32f_neon(float* outputVector,
+                                                         const lv_32fc_t* aVector,
+                                                         const lv_32fc_t* bVector,
+                                                         const float scale,
+                                                         unsigned int num_points)
+{
+    const float* aPtr = (const float*)aVector;
+    const float* bPtr = (const float*)bVector;
+    const unsigned int quarterPoints = num_points / 4;
+
+    for (unsigned int number = 0; number < quarterPoints; number++) {
+        const float32x4x2_t a = vld2q_f32(aPtr + 8 * number);
+        const float32x4x2_t b = vld2q_f32(bPtr + 8 * number);
+
+        // a * conj(b)
+        const float32x4_t x =
+            vmlaq_f32(vmulq_f32(a.val[0], b.val[0]), a.val[1], b.val[1]);
+        const float32x4_t y =
+            vmlsq_f32(vmulq_f32(a.val[1], b.val[0]), a.val[0], b.val[1]);
+
+        vst1q_f32(outputVector + 4 * number, vmulq_n_f32(_vatan2q_f32(y, x), scale));
+    }
+
+    volk_32fc_x2_s32f_phase_diff_32f_generic(outputVector + quarterPoints * 4,
+                                             aVector + quarterPoints * 4,
+                                             bVector + quarterPoints * 4,
+                                             scale,
+                                             num_points - quarterPoints * 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_s32f_phase_diff_32f_a_H */
+
+#ifndef INCLUDED_volk_32fc_x2_s32f_phase_diff_32f_u_H
+#define INCLUDED_volk_32fc_x2_s32f_phase_diff_32f_u_H
+
+#include <math.h>
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+#include <volk/volk_avx2_fma_intrinsics.h>
+
+static inline void volk_32fc_x2_s32f_phase_diff_32f_u_avx2_fma(float* outputVector,
+                                                               const lv_32fc_t* aVector,
+                                                               const lv_32fc_t* bVector,
+                                                               const float scale,
+                                                               unsigned int num_points)
+{
+    const float* aPtr = (const float*)aVector;
+    const float* bPtr = (const float*)bVector;
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const unsigned int eighthPoints = num_points / 8;
+
+    for (unsigned int number = 0; number < eighthPoints; number++) {
+        const __m256 a0 = _mm256_loadu_ps(aPtr + 16 * number);
+        const __m256 a1 = _mm256_loadu_ps(aPtr + 16 * number + 8);
+        const __m256 b0 = _mm256_loadu_ps(bPtr + 16 * number);
+        const __m256 b1 = _mm256_loadu_ps(bPtr + 16 * number + 8);
+        // real and imaginary parts of the values 0, 1, 4, 5, 2, 3, 6, 7
+        const __m256 ar = _mm256_shuffle_ps(a0, a1, 0x88);
+        const __m256 ai = _mm256_shuffle_ps(a0, a1, 0xDD);
+        const __m256 br = _mm256_shuffle_ps(b0, b1, 0x88);
+        const __m256 bi = _mm256_shuffle_ps(b0, b1, 0xDD);
+
+        // a * conj(b)
+        const __m256 x = _mm256_fmadd_ps(ar, br, _mm256_mul_ps(ai, bi));
+        const __m256 y = _mm256_fmsub_ps(ai, br, _mm256_mul_ps(ar, bi));
+
+        __m256 result = _mm256_mul_ps(_mm256_atan2_ps_avx2_fma(y, x), vscale);
+        result = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(result), 0xD8));
+        _mm256_storeu_ps(outputVector + 8 * number, result);
+    }
+
+    volk_32fc_x2_s32f_phase_diff_32f_generic(outputVector + eighthPoints * 8,
+                                             aVector + eighthPoints * 8,
+                                             bVector + eighthPoints * 8,
+                                             scale,
+                                             num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_x2_s32f_phase_diff_32f_u_avx512f(float* outputVector,
+                                                              const lv_32fc_t* aVector,
+                                                              const lv_32fc_t* bVector,
+                                                              const float scale,
+                                                              unsigned int num_points)
+{
+    const float* aPtr = (const float*)aVector;
+    const float* bPtr = (const float*)bVector;
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512i real_idx =
+        _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i imag_idx =
+        _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    for (unsigned int number = 0; number < sixteenthPoints; number++) {
+        const __m512 a0 = _mm512_loadu_ps(aPtr + 32 * number);
+        const __m512 a1 = _mm512_loadu_ps(aPtr + 32 * number + 16);
+        const __m512 b0 = _mm512_loadu_ps(bPtr + 32 * number);
+        const __m512 b1 = _mm512_loadu_ps(bPtr + 32 * number + 16);
+        const __m512 ar = _mm512_permutex2var_ps(a0, real_idx, a1);
+        const __m512 ai = _mm512_permutex2var_ps(a0, imag_idx, a1);
+        const __m512 br = _mm512_permutex2var_ps(b0, real_idx, b1);
+        const __m512 bi = _mm512_permutex2var_ps(b0, imag_idx, b1);
+
+        // a * conj(b)
+        const __m512 x = _mm512_fmadd_ps(ar, br, _mm512_mul_ps(ai, bi));
+        const __m512 y = _mm512_fmsub_ps(ai, br, _mm512_mul_ps(ar, bi));
+
+        _mm512_storeu_ps(outputVector + 16 * number,
+                         _mm512_mul_ps(_mm512_atan2_ps_avx512f(y, x), vscale));
+    }
+
+    volk_32fc_x2_s32f_phase_diff_32f_generic(outputVector + sixteenthPoints * 16,
+                                             aVector + sixteenthPoints * 16,
+                                             bVector + sixteenthPoints * 16,
+                                             scale,
+                                             num_points - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_32fc_x2_s32f_phase_diff_32f_u_H */
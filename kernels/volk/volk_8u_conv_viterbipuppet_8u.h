@@ -0,0 +1,173 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_8u_conv_viterbipuppet_8u_H
+#define INCLUDED_volk_8u_conv_viterbipuppet_8u_H
+
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_8u_x4_conv_viterbi_8u.h>
+
+typedef void (*volk_8u_conv_viterbipuppet_8u_decoder_t)(unsigned char*,
+                                                        unsigned char*,
+                                                        const unsigned char*,
+                                                        unsigned char*,
+                                                        const unsigned char*,
+                                                        unsigned int,
+                                                        unsigned int,
+                                                        unsigned int);
+
+/*
+ * The codes under test, one per constraint length: k, the rate and the generator
+ * polynomials, 0 marking unused ones.
+ */
+static const int volk_8u_conv_viterbipuppet_8u_codes[5][6] = {
+    { 5, 2, 023, 035, 0, 0 },       { 6, 3, 047, 053, 075, 0 },
+    { 7, 4, 0117, 0127, 0155, 0171 }, { 8, 2, 0371, 0247, 0, 0 },
+    { 9, 3, 0557, 0663, 0711, 0 },
+};
+
+static inline int volk_8u_conv_viterbipuppet_8u_parity(int x)
+{
+    int p = 0;
+    while (x) {
+        p ^= x & 1;
+        x >>= 1;
+    }
+    return p;
+}
+
+/*
+ * Decodes the same number of bits with each of the codes, one after the other, so
+ * that their symbols fit into num_points. Writes one decoded bit per byte of dec.
+ */
+static inline void
+volk_8u_conv_viterbipuppet_8u_run(unsigned char* dec,
+                                  const unsigned char* syms,
+                                  unsigned int num_points,
+                                  volk_8u_conv_viterbipuppet_8u_decoder_t decoder)
+{
+    const size_t alignment = volk_get_alignment();
+    unsigned int nbits, c, i, j, s;
+    unsigned int num_symbols = 0;
+
+    for (c = 0; c < 5; ++c) {
+        num_symbols += volk_8u_conv_viterbipuppet_8u_codes[c][1];
+    }
+    nbits = num_points / num_symbols;
+    memset(dec, 0, num_points);
+
+    for (c = 0; c < 5; ++c) {
+        const int* code = volk_8u_conv_viterbipuppet_8u_codes[c];
+        const unsigned int k = code[0];
+        const unsigned int rate = code[1];
+        const unsigned int num_states = 1 << (k - 1);
+        unsigned char* X = (unsigned char*)volk_malloc(2 * num_states, alignment);
+        unsigned char* Y = X + num_states;
+        unsigned char* Branchtab =
+            (unsigned char*)volk_malloc(rate * num_states / 2, alignment);
+        unsigned char* D =
+            (unsigned char*)volk_malloc(nbits * num_states / 8, alignment);
+        unsigned int state = 0;
+
+        for (j = 0; j < rate; ++j) {
+            const int poly = code[2 + j];
+            for (i = 0; i < num_states / 2; ++i) {
+                Branchtab[j * num_states / 2 + i] =
+                    volk_8u_conv_viterbipuppet_8u_parity((2 * i) & poly) ? 255 : 0;
+            }
+        }
+
+        // start from state 0
+        memset(X, 63, num_states);
+        X[0] = 0;
+
+        decoder(Y, X, syms, D, Branchtab, k, rate, nbits);
+
+        for (i = 1; i < num_states; ++i) {
+            if (X[i] < X[state]) {
+                state = i;
+            }
+        }
+
+        for (s = nbits; s-- > 0;) {
+            const unsigned char* d = D + s * num_states / 8;
+            dec[s] = state & 1;
+            state = (state >> 1) | (((d[state / 8] >> (state % 8)) & 1) << (k - 2));
+        }
+
+        syms += nbits * rate;
+        dec += nbits;
+        volk_free(X);
+        volk_free(Branchtab);
+        volk_free(D);
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_conv_viterbipuppet_8u_generic(unsigned char* dec,
+                                                         const unsigned char* syms,
+                                                         unsigned int num_points)
+{
+    volk_8u_conv_viterbipuppet_8u_run(
+        dec, syms, num_points, volk_8u_x4_conv_viterbi_8u_generic);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_8u_conv_viterbipuppet_8u_sse2(unsigned char* dec,
+                                                      const unsigned char* syms,
+                                                      unsigned int num_points)
+{
+    volk_8u_conv_viterbipuppet_8u_run(
+        dec, syms, num_points, volk_8u_x4_conv_viterbi_8u_sse2);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_conv_viterbipuppet_8u_avx2(unsigned char* dec,
+                                                      const unsigned char* syms,
+                                                      unsigned int num_points)
+{
+    volk_8u_conv_viterbipuppet_8u_run(
+        dec, syms, num_points, volk_8u_x4_conv_viterbi_8u_avx2);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512BW
+
+static inline void volk_8u_conv_viterbipuppet_8u_avx512bw(unsigned char* dec,
+                                                          const unsigned char* syms,
+                                                          unsigned int num_points)
+{
+    volk_8u_conv_viterbipuppet_8u_run(
+        dec, syms, num_points, volk_8u_x4_conv_viterbi_8u_avx512bw);
+}
+
+#endif /* LV_HAVE_AVX512BW */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_8u_conv_viterbipuppet_8u_neon(unsigned char* dec,
+                                                      const unsigned char* syms,
+                                                      unsigned int num_points)
+{
+    volk_8u_conv_viterbipuppet_8u_run(
+        dec, syms, num_points, volk_8u_x4_conv_viterbi_8u_neon);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_conv_viterbipuppet_8u_H */
@@ -0,0 +1,554 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_s32f_unpack_sc12_32fc
+ *
+ * \b Overview
+ *
+ * Unpacks complex samples in the packed sc12 format into complex floats,
+ * dividing them by a scalar.
+ *
+ * The packed sc12 format stores each complex sample in three bytes, as the
+ * little endian 24 bit word (Q << 12) | I, with I and Q in 12 bit two's
+ * complement.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_s32f_unpack_sc12_32fc(lv_32fc_t* outputVector, const uint8_t* inputVector,
+ *                                    const float scalar, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The packed samples, 3 * num_points bytes.
+ * \li scalar: The value the samples are divided by, 2048 for full scale.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex floats.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(3 * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   // read 3 * N bytes into in
+ *
+ *   volk_8u_s32f_unpack_sc12_32fc(out, in, 2048.f, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_s32f_unpack_sc12_32fc_a_H
+#define INCLUDED_volk_8u_s32f_unpack_sc12_32fc_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_s32f_unpack_sc12_32fc_generic(lv_32fc_t* outputVector,
+                                                         const uint8_t* inputVector,
+                                                         const float scalar,
+                                                         unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+
+    for (unsigned int number = 0; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (float)((int16_t)((byte1 << 12) | (byte0 << 4)) >> 4) * iScalar;
+        *outputPtr++ = (float)((int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_8u_s32f_unpack_sc12_32fc_a_ssse3(lv_32fc_t* outputVector,
+                                                         const uint8_t* inputVector,
+                                                         const float scalar,
+                                                         unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m128 invScalar = _mm_set1_ps(iScalar);
+    // gather the two bytes holding each part into a 16 bit lane, the real part then
+    // sits in the low 12 bits and the imaginary part in the high 12 bits
+    const __m128i lowShuffle =
+        _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+    const __m128i highShuffle =
+        _mm_setr_epi8(4, 5, 5, 6, 7, 8, 8, 9, 10, 11, 11, 12, 13, 14, 14, 15);
+    // shift the real parts up to the sign bit
+    const __m128i align = _mm_set1_epi32(0x00010010);
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        __m128i low = _mm_loadu_si128((const __m128i*)inputPtr);
+        __m128i high = _mm_loadu_si128((const __m128i*)(inputPtr + 8));
+        inputPtr += 24;
+
+        low = _mm_mullo_epi16(_mm_shuffle_epi8(low, lowShuffle), align);
+        high = _mm_mullo_epi16(_mm_shuffle_epi8(high, highShuffle), align);
+        const __m128i ints[4] = { _mm_unpacklo_epi16(zero, low),
+                                  _mm_unpackhi_epi16(zero, low),
+                                  _mm_unpacklo_epi16(zero, high),
+                                  _mm_unpackhi_epi16(zero, high) };
+        __m128 values;
+
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[0], 20));
+        _mm_store_ps(outputPtr, _mm_mul_ps(values, invScalar));
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[1], 20));
+        _mm_store_ps(outputPtr + 4, _mm_mul_ps(values, invScalar));
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[2], 20));
+        _mm_store_ps(outputPtr + 8, _mm_mul_ps(values, invScalar));
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[3], 20));
+        _mm_store_ps(outputPtr + 12, _mm_mul_ps(values, invScalar));
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (float)((int16_t)((byte1 << 12) | (byte0 << 4)) >> 4) * iScalar;
+        *outputPtr++ = (float)((int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_s32f_unpack_sc12_32fc_a_avx2(lv_32fc_t* outputVector,
+                                                        const uint8_t* inputVector,
+                                                        const float scalar,
+                                                        unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m256 invScalar = _mm256_set1_ps(iScalar);
+    // move 12 bytes, four samples, into each 128 bit lane
+    const __m256i lowSpread = _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6);
+    const __m256i highSpread = _mm256_setr_epi32(2, 3, 4, 5, 5, 6, 7, 7);
+    // gather the two bytes holding each part into a 16 bit lane, the real part then
+    // sits in the low 12 bits and the imaginary part in the high 12 bits
+    const __m256i shuffle = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11));
+    // shift the real parts up to the sign bit
+    const __m256i align = _mm256_set1_epi32(0x00010010);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m256i low = _mm256_loadu_si256((const __m256i*)inputPtr);
+        __m256i high = _mm256_loadu_si256((const __m256i*)(inputPtr + 16));
+        inputPtr += 48;
+
+        low = _mm256_permutevar8x32_epi32(low, lowSpread);
+        high = _mm256_permutevar8x32_epi32(high, highSpread);
+        low = _mm256_shuffle_epi8(low, shuffle);
+        high = _mm256_shuffle_epi8(high, shuffle);
+        low = _mm256_srai_epi16(_mm256_mullo_epi16(low, align), 4);
+        high = _mm256_srai_epi16(_mm256_mullo_epi16(high, align), 4);
+        const __m128i ints[4] = { _mm256_castsi256_si128(low),
+                                  _mm256_extracti128_si256(low, 1),
+                                  _mm256_castsi256_si128(high),
+                                  _mm256_extracti128_si256(high, 1) };
+        __m256 values;
+
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[0]));
+        _mm256_store_ps(outputPtr, _mm256_mul_ps(values, invScalar));
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[1]));
+        _mm256_store_ps(outputPtr + 8, _mm256_mul_ps(values, invScalar));
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[2]));
+        _mm256_store_ps(outputPtr + 16, _mm256_mul_ps(values, invScalar));
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[3]));
+        _mm256_store_ps(outputPtr + 24, _mm256_mul_ps(values, invScalar));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (float)((int16_t)((byte1 << 12) | (byte0 << 4)) >> 4) * iScalar;
+        *outputPtr++ = (float)((int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512VBMI
+#include <immintrin.h>
+
+static inline void volk_8u_s32f_unpack_sc12_32fc_a_avx512vbmi(lv_32fc_t* outputVector,
+                                                              const uint8_t* inputVector,
+                                                              const float scalar,
+                                                              unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 invScalar = _mm512_set1_ps(iScalar);
+    // the two bytes holding each part go into the upper half of a 32 bit lane, for
+    // the first and the last 8 of the 16 samples in 48 bytes
+    const __m512i lowShuffle = _mm512_setr_epi32(0x01000000,
+                                                 0x02010000,
+                                                 0x04030000,
+                                                 0x05040000,
+                                                 0x07060000,
+                                                 0x08070000,
+                                                 0x0a090000,
+                                                 0x0b0a0000,
+                                                 0x0d0c0000,
+                                                 0x0e0d0000,
+                                                 0x100f0000,
+                                                 0x11100000,
+                                                 0x13120000,
+                                                 0x14130000,
+                                                 0x16150000,
+                                                 0x17160000);
+    const __m512i highShuffle = _mm512_setr_epi32(0x19180000,
+                                                  0x1a190000,
+                                                  0x1c1b0000,
+                                                  0x1d1c0000,
+                                                  0x1f1e0000,
+                                                  0x201f0000,
+                                                  0x22210000,
+                                                  0x23220000,
+                                                  0x25240000,
+                                                  0x26250000,
+                                                  0x28270000,
+                                                  0x29280000,
+                                                  0x2b2a0000,
+                                                  0x2c2b0000,
+                                                  0x2e2d0000,
+                                                  0x2f2e0000);
+    // shift the real parts up to the sign bit
+    const __m512i align = _mm512_set1_epi64(4);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const __m512i bytes = _mm512_maskz_loadu_epi8(0xffffffffffffULL, inputPtr);
+        inputPtr += 48;
+
+        __m512i ints;
+        ints = _mm512_sllv_epi32(_mm512_permutexvar_epi8(lowShuffle, bytes), align);
+        _mm512_store_ps(outputPtr,
+                        _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srai_epi32(ints, 20)),
+                                      invScalar));
+        ints = _mm512_sllv_epi32(_mm512_permutexvar_epi8(highShuffle, bytes), align);
+        _mm512_store_ps(outputPtr + 16,
+                        _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srai_epi32(ints, 20)),
+                                      invScalar));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (float)((int16_t)((byte1 << 12) | (byte0 << 4)) >> 4) * iScalar;
+        *outputPtr++ = (float)((int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX512VBMI */
+
+#endif /* INCLUDED_volk_8u_s32f_unpack_sc12_32fc_a_H */
+
+#ifndef INCLUDED_volk_8u_s32f_unpack_sc12_32fc_u_H
+#define INCLUDED_volk_8u_s32f_unpack_sc12_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_8u_s32f_unpack_sc12_32fc_u_ssse3(lv_32fc_t* outputVector,
+                                                         const uint8_t* inputVector,
+                                                         const float scalar,
+                                                         unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m128 invScalar = _mm_set1_ps(iScalar);
+    // gather the two bytes holding each part into a 16 bit lane, the real part then
+    // sits in the low 12 bits and the imaginary part in the high 12 bits
+    const __m128i lowShuffle =
+        _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+    const __m128i highShuffle =
+        _mm_setr_epi8(4, 5, 5, 6, 7, 8, 8, 9, 10, 11, 11, 12, 13, 14, 14, 15);
+    // shift the real parts up to the sign bit
+    const __m128i align = _mm_set1_epi32(0x00010010);
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        __m128i low = _mm_loadu_si128((const __m128i*)inputPtr);
+        __m128i high = _mm_loadu_si128((const __m128i*)(inputPtr + 8));
+        inputPtr += 24;
+
+        low = _mm_mullo_epi16(_mm_shuffle_epi8(low, lowShuffle), align);
+        high = _mm_mullo_epi16(_mm_shuffle_epi8(high, highShuffle), align);
+        const __m128i ints[4] = { _mm_unpacklo_epi16(zero, low),
+                                  _mm_unpackhi_epi16(zero, low),
+                                  _mm_unpacklo_epi16(zero, high),
+                                  _mm_unpackhi_epi16(zero, high) };
+        __m128 values;
+
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[0], 20));
+        _mm_storeu_ps(outputPtr, _mm_mul_ps(values, invScalar));
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[1], 20));
+        _mm_storeu_ps(outputPtr + 4, _mm_mul_ps(values, invScalar));
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[2], 20));
+        _mm_storeu_ps(outputPtr + 8, _mm_mul_ps(values, invScalar));
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[3], 20));
+        _mm_storeu_ps(outputPtr + 12, _mm_mul_ps(values, invScalar));
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (float)((int16_t)((byte1 << 12) | (byte0 << 4)) >> 4) * iScalar;
+        *outputPtr++ = (float)((int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_s32f_unpack_sc12_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                        const uint8_t* inputVector,
+                                                        const float scalar,
+                                                        unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m256 invScalar = _mm256_set1_ps(iScalar);
+    // move 12 bytes, four samples, into each 128 bit lane
+    const __m256i lowSpread = _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6);
+    const __m256i highSpread = _mm256_setr_epi32(2, 3, 4, 5, 5, 6, 7, 7);
+    // gather the two bytes holding each part into a 16 bit lane, the real part then
+    // sits in the low 12 bits and the imaginary part in the high 12 bits
+    const __m256i shuffle = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11));
+    // shift the real parts up to the sign bit
+    const __m256i align = _mm256_set1_epi32(0x00010010);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m256i low = _mm256_loadu_si256((const __m256i*)inputPtr);
+        __m256i high = _mm256_loadu_si256((const __m256i*)(inputPtr + 16));
+        inputPtr += 48;
+
+        low = _mm256_permutevar8x32_epi32(low, lowSpread);
+        high = _mm256_permutevar8x32_epi32(high, highSpread);
+        low = _mm256_shuffle_epi8(low, shuffle);
+        high = _mm256_shuffle_epi8(high, shuffle);
+        low = _mm256_srai_epi16(_mm256_mullo_epi16(low, align), 4);
+        high = _mm256_srai_epi16(_mm256_mullo_epi16(high, align), 4);
+        const __m128i ints[4] = { _mm256_castsi256_si128(low),
+                                  _mm256_extracti128_si256(low, 1),
+                                  _mm256_castsi256_si128(high),
+                                  _mm256_extracti128_si256(high, 1) };
+        __m256 values;
+
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[0]));
+        _mm256_storeu_ps(outputPtr, _mm256_mul_ps(values, invScalar));
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[1]));
+        _mm256_storeu_ps(outputPtr + 8, _mm256_mul_ps(values, invScalar));
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[2]));
+        _mm256_storeu_ps(outputPtr + 16, _mm256_mul_ps(values, invScalar));
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[3]));
+        _mm256_storeu_ps(outputPtr + 24, _mm256_mul_ps(values, invScalar));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (float)((int16_t)((byte1 << 12) | (byte0 << 4)) >> 4) * iScalar;
+        *outputPtr++ = (float)((int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512VBMI
+#include <immintrin.h>
+
+static inline void volk_8u_s32f_unpack_sc12_32fc_u_avx512vbmi(lv_32fc_t* outputVector,
+                                                              const uint8_t* inputVector,
+                                                              const float scalar,
+                                                              unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 invScalar = _mm512_set1_ps(iScalar);
+    // the two bytes holding each part go into the upper half of a 32 bit lane, for
+    // the first and the last 8 of the 16 samples in 48 bytes
+    const __m512i lowShuffle = _mm512_setr_epi32(0x01000000,
+                                                 0x02010000,
+                                                 0x04030000,
+                                                 0x05040000,
+                                                 0x07060000,
+                                                 0x08070000,
+                                                 0x0a090000,
+                                                 0x0b0a0000,
+                                                 0x0d0c0000,
+                                                 0x0e0d0000,
+                                                 0x100f0000,
+                                                 0x11100000,
+                                                 0x13120000,
+                                                 0x14130000,
+                                                 0x16150000,
+                                                 0x17160000);
+    const __m512i highShuffle = _mm512_setr_epi32(0x19180000,
+                                                  0x1a190000,
+                                                  0x1c1b0000,
+                                                  0x1d1c0000,
+                                                  0x1f1e0000,
+                                                  0x201f0000,
+                                                  0x22210000,
+                                                  0x23220000,
+                                                  0x25240000,
+                                                  0x26250000,
+                                                  0x28270000,
+                                                  0x29280000,
+                                                  0x2b2a0000,
+                                                  0x2c2b0000,
+                                                  0x2e2d0000,
+                                                  0x2f2e0000);
+    // shift the real parts up to the sign bit
+    const __m512i align = _mm512_set1_epi64(4);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const __m512i bytes = _mm512_maskz_loadu_epi8(0xffffffffffffULL, inputPtr);
+        inputPtr += 48;
+
+        __m512i ints;
+        ints = _mm512_sllv_epi32(_mm512_permutexvar_epi8(lowShuffle, bytes), align);
+        _mm512_storeu_ps(outputPtr,
+                        _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srai_epi32(ints, 20)),
+                                      invScalar));
+        ints = _mm512_sllv_epi32(_mm512_permutexvar_epi8(highShuffle, bytes), align);
+        _mm512_storeu_ps(outputPtr + 16,
+                        _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srai_epi32(ints, 20)),
+                                      invScalar));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (float)((int16_t)((byte1 << 12) | (byte0 << 4)) >> 4) * iScalar;
+        *outputPtr++ = (float)((int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX512VBMI */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_s32f_unpack_sc12_32fc_neon(lv_32fc_t* outputVector,
+                                                      const uint8_t* inputVector,
+                                                      const float scalar,
+                                                      unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        const uint8x8x3_t bytes = vld3_u8(inputPtr);
+        inputPtr += 24;
+
+        const uint16x8_t real =
+            vorrq_u16(vmovl_u8(bytes.val[0]), vshll_n_u8(bytes.val[1], 8));
+        const uint16x8_t imag =
+            vorrq_u16(vmovl_u8(bytes.val[1]), vshll_n_u8(bytes.val[2], 8));
+        const int16x8_t realInts =
+            vshrq_n_s16(vshlq_n_s16(vreinterpretq_s16_u16(real), 4), 4);
+        const int16x8_t imagInts = vshrq_n_s16(vreinterpretq_s16_u16(imag), 4);
+        float32x4x2_t values;
+
+        values.val[0] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(realInts)));
+        values.val[1] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(imagInts)));
+        values.val[0] = vmulq_n_f32(values.val[0], iScalar);
+        values.val[1] = vmulq_n_f32(values.val[1], iScalar);
+        vst2q_f32(outputPtr, values);
+        values.val[0] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(realInts)));
+        values.val[1] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(imagInts)));
+        values.val[0] = vmulq_n_f32(values.val[0], iScalar);
+        values.val[1] = vmulq_n_f32(values.val[1], iScalar);
+        vst2q_f32(outputPtr + 8, values);
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (float)((int16_t)((byte1 << 12) | (byte0 << 4)) >> 4) * iScalar;
+        *outputPtr++ = (float)((int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_s32f_unpack_sc12_32fc_u_H */
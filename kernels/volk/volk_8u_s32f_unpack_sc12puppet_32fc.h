@@ -0,0 +1,120 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_8u_s32f_unpack_sc12puppet_32fc_H
+#define INCLUDED_volk_8u_s32f_unpack_sc12puppet_32fc_H
+
+#include <volk/volk_8u_s32f_unpack_sc12_32fc.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_s32f_unpack_sc12puppet_32fc_generic(lv_32fc_t* outputVector,
+                                                               const uint8_t* inputVector,
+                                                               const float scalar,
+                                                               unsigned int num_points)
+{
+    volk_8u_s32f_unpack_sc12_32fc_generic(
+        outputVector, inputVector, scalar, num_points / 3);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSSE3
+
+static inline void volk_8u_s32f_unpack_sc12puppet_32fc_a_ssse3(lv_32fc_t* outputVector,
+                                                               const uint8_t* inputVector,
+                                                               const float scalar,
+                                                               unsigned int num_points)
+{
+    volk_8u_s32f_unpack_sc12_32fc_a_ssse3(
+        outputVector, inputVector, scalar, num_points / 3);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_SSSE3
+
+static inline void volk_8u_s32f_unpack_sc12puppet_32fc_u_ssse3(lv_32fc_t* outputVector,
+                                                               const uint8_t* inputVector,
+                                                               const float scalar,
+                                                               unsigned int num_points)
+{
+    volk_8u_s32f_unpack_sc12_32fc_u_ssse3(
+        outputVector, inputVector, scalar, num_points / 3);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_s32f_unpack_sc12puppet_32fc_a_avx2(lv_32fc_t* outputVector,
+                                                              const uint8_t* inputVector,
+                                                              const float scalar,
+                                                              unsigned int num_points)
+{
+    volk_8u_s32f_unpack_sc12_32fc_a_avx2(
+        outputVector, inputVector, scalar, num_points / 3);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_s32f_unpack_sc12puppet_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                              const uint8_t* inputVector,
+                                                              const float scalar,
+                                                              unsigned int num_points)
+{
+    volk_8u_s32f_unpack_sc12_32fc_u_avx2(
+        outputVector, inputVector, scalar, num_points / 3);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512VBMI
+
+static inline void
+volk_8u_s32f_unpack_sc12puppet_32fc_a_avx512vbmi(lv_32fc_t* outputVector,
+                                                 const uint8_t* inputVector,
+                                                 const float scalar,
+                                                 unsigned int num_points)
+{
+    volk_8u_s32f_unpack_sc12_32fc_a_avx512vbmi(
+        outputVector, inputVector, scalar, num_points / 3);
+}
+
+#endif /* LV_HAVE_AVX512VBMI */
+
+#ifdef LV_HAVE_AVX512VBMI
+
+static inline void
+volk_8u_s32f_unpack_sc12puppet_32fc_u_avx512vbmi(lv_32fc_t* outputVector,
+                                                 const uint8_t* inputVector,
+                                                 const float scalar,
+                                                 unsigned int num_points)
+{
+    volk_8u_s32f_unpack_sc12_32fc_u_avx512vbmi(
+        outputVector, inputVector, scalar, num_points / 3);
+}
+
+#endif /* LV_HAVE_AVX512VBMI */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_8u_s32f_unpack_sc12puppet_32fc_neon(lv_32fc_t* outputVector,
+                                                            const uint8_t* inputVector,
+                                                            const float scalar,
+                                                            unsigned int num_points)
+{
+    volk_8u_s32f_unpack_sc12_32fc_neon(outputVector, inputVector, scalar, num_points / 3);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_s32f_unpack_sc12puppet_32fc_H */
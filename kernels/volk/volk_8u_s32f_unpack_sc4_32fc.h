@@ -0,0 +1,434 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_s32f_unpack_sc4_32fc
+ *
+ * \b Overview
+ *
+ * Unpacks complex samples in the packed sc4 format into complex floats,
+ * dividing them by a scalar.
+ *
+ * The packed sc4 format stores each complex sample in one byte, I in the low
+ * and Q in the high nibble, both in 4 bit two's complement.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_s32f_unpack_sc4_32fc(lv_32fc_t* outputVector, const uint8_t* inputVector,
+ *                                   const float scalar, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The packed samples, one byte each.
+ * \li scalar: The value the samples are divided by, 8 for full scale.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex floats.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   // read N bytes into in
+ *
+ *   volk_8u_s32f_unpack_sc4_32fc(out, in, 8.f, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_s32f_unpack_sc4_32fc_a_H
+#define INCLUDED_volk_8u_s32f_unpack_sc4_32fc_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_s32f_unpack_sc4_32fc_generic(lv_32fc_t* outputVector,
+                                                        const uint8_t* inputVector,
+                                                        const float scalar,
+                                                        unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+
+    for (unsigned int number = 0; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (float)((int8_t)(byte << 4) >> 4) * iScalar;
+        *outputPtr++ = (float)((int8_t)byte >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_8u_s32f_unpack_sc4_32fc_a_sse2(lv_32fc_t* outputVector,
+                                                       const uint8_t* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m128 invScalar = _mm_set1_ps(iScalar);
+    // with each byte in both halves of a 32 bit lane, shift the real part up to the
+    // sign bit of the low half, the imaginary part already is at the top of the high
+    const __m128i align = _mm_set1_epi32(0x00010010);
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        const __m128i bytes = _mm_loadl_epi64((const __m128i*)inputPtr);
+        inputPtr += 8;
+
+        const __m128i words = _mm_unpacklo_epi8(zero, bytes);
+        const __m128i low = _mm_mullo_epi16(_mm_unpacklo_epi16(words, words), align);
+        const __m128i high = _mm_mullo_epi16(_mm_unpackhi_epi16(words, words), align);
+        const __m128i ints[4] = { _mm_unpacklo_epi16(zero, low),
+                                  _mm_unpackhi_epi16(zero, low),
+                                  _mm_unpacklo_epi16(zero, high),
+                                  _mm_unpackhi_epi16(zero, high) };
+        __m128 values;
+
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[0], 28));
+        _mm_store_ps(outputPtr, _mm_mul_ps(values, invScalar));
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[1], 28));
+        _mm_store_ps(outputPtr + 4, _mm_mul_ps(values, invScalar));
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[2], 28));
+        _mm_store_ps(outputPtr + 8, _mm_mul_ps(values, invScalar));
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[3], 28));
+        _mm_store_ps(outputPtr + 12, _mm_mul_ps(values, invScalar));
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (float)((int8_t)(byte << 4) >> 4) * iScalar;
+        *outputPtr++ = (float)((int8_t)byte >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_s32f_unpack_sc4_32fc_a_avx2(lv_32fc_t* outputVector,
+                                                       const uint8_t* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m256 invScalar = _mm256_set1_ps(iScalar);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const __m128i bytes = _mm_load_si128((const __m128i*)inputPtr);
+        inputPtr += 16;
+
+        // put the real part at the top of the low and the imaginary part at the top
+        // of the high half of each 32 bit lane
+        __m256i low = _mm256_cvtepu8_epi32(bytes);
+        __m256i high = _mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8));
+        low = _mm256_or_si256(_mm256_slli_epi32(low, 12), _mm256_slli_epi32(low, 24));
+        high = _mm256_or_si256(_mm256_slli_epi32(high, 12), _mm256_slli_epi32(high, 24));
+        low = _mm256_srai_epi16(low, 12);
+        high = _mm256_srai_epi16(high, 12);
+        const __m128i ints[4] = { _mm256_castsi256_si128(low),
+                                  _mm256_extracti128_si256(low, 1),
+                                  _mm256_castsi256_si128(high),
+                                  _mm256_extracti128_si256(high, 1) };
+        __m256 values;
+
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[0]));
+        _mm256_store_ps(outputPtr, _mm256_mul_ps(values, invScalar));
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[1]));
+        _mm256_store_ps(outputPtr + 8, _mm256_mul_ps(values, invScalar));
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[2]));
+        _mm256_store_ps(outputPtr + 16, _mm256_mul_ps(values, invScalar));
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[3]));
+        _mm256_store_ps(outputPtr + 24, _mm256_mul_ps(values, invScalar));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (float)((int8_t)(byte << 4) >> 4) * iScalar;
+        *outputPtr++ = (float)((int8_t)byte >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8u_s32f_unpack_sc4_32fc_a_avx512bw(lv_32fc_t* outputVector,
+                                                           const uint8_t* inputVector,
+                                                           const float scalar,
+                                                           unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 invScalar = _mm512_set1_ps(iScalar);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const __m128i bytes = _mm_load_si128((const __m128i*)inputPtr);
+        inputPtr += 16;
+
+        // put the real part at the top of the low and the imaginary part at the top
+        // of the high half of each 32 bit lane
+        __m512i ints = _mm512_cvtepu8_epi32(bytes);
+        ints = _mm512_or_si512(_mm512_slli_epi32(ints, 12), _mm512_slli_epi32(ints, 24));
+        ints = _mm512_srai_epi16(ints, 12);
+        const __m256i low = _mm512_castsi512_si256(ints);
+        const __m256i high = _mm512_extracti64x4_epi64(ints, 1);
+        __m512 values;
+
+        values = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(low));
+        _mm512_store_ps(outputPtr, _mm512_mul_ps(values, invScalar));
+        values = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(high));
+        _mm512_store_ps(outputPtr + 16, _mm512_mul_ps(values, invScalar));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (float)((int8_t)(byte << 4) >> 4) * iScalar;
+        *outputPtr++ = (float)((int8_t)byte >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX512BW */
+
+#endif /* INCLUDED_volk_8u_s32f_unpack_sc4_32fc_a_H */
+
+#ifndef INCLUDED_volk_8u_s32f_unpack_sc4_32fc_u_H
+#define INCLUDED_volk_8u_s32f_unpack_sc4_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_8u_s32f_unpack_sc4_32fc_u_sse2(lv_32fc_t* outputVector,
+                                                       const uint8_t* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m128 invScalar = _mm_set1_ps(iScalar);
+    // with each byte in both halves of a 32 bit lane, shift the real part up to the
+    // sign bit of the low half, the imaginary part already is at the top of the high
+    const __m128i align = _mm_set1_epi32(0x00010010);
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        const __m128i bytes = _mm_loadl_epi64((const __m128i*)inputPtr);
+        inputPtr += 8;
+
+        const __m128i words = _mm_unpacklo_epi8(zero, bytes);
+        const __m128i low = _mm_mullo_epi16(_mm_unpacklo_epi16(words, words), align);
+        const __m128i high = _mm_mullo_epi16(_mm_unpackhi_epi16(words, words), align);
+        const __m128i ints[4] = { _mm_unpacklo_epi16(zero, low),
+                                  _mm_unpackhi_epi16(zero, low),
+                                  _mm_unpacklo_epi16(zero, high),
+                                  _mm_unpackhi_epi16(zero, high) };
+        __m128 values;
+
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[0], 28));
+        _mm_storeu_ps(outputPtr, _mm_mul_ps(values, invScalar));
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[1], 28));
+        _mm_storeu_ps(outputPtr + 4, _mm_mul_ps(values, invScalar));
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[2], 28));
+        _mm_storeu_ps(outputPtr + 8, _mm_mul_ps(values, invScalar));
+        values = _mm_cvtepi32_ps(_mm_srai_epi32(ints[3], 28));
+        _mm_storeu_ps(outputPtr + 12, _mm_mul_ps(values, invScalar));
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (float)((int8_t)(byte << 4) >> 4) * iScalar;
+        *outputPtr++ = (float)((int8_t)byte >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_s32f_unpack_sc4_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                       const uint8_t* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m256 invScalar = _mm256_set1_ps(iScalar);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const __m128i bytes = _mm_loadu_si128((const __m128i*)inputPtr);
+        inputPtr += 16;
+
+        // put the real part at the top of the low and the imaginary part at the top
+        // of the high half of each 32 bit lane
+        __m256i low = _mm256_cvtepu8_epi32(bytes);
+        __m256i high = _mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8));
+        low = _mm256_or_si256(_mm256_slli_epi32(low, 12), _mm256_slli_epi32(low, 24));
+        high = _mm256_or_si256(_mm256_slli_epi32(high, 12), _mm256_slli_epi32(high, 24));
+        low = _mm256_srai_epi16(low, 12);
+        high = _mm256_srai_epi16(high, 12);
+        const __m128i ints[4] = { _mm256_castsi256_si128(low),
+                                  _mm256_extracti128_si256(low, 1),
+                                  _mm256_castsi256_si128(high),
+                                  _mm256_extracti128_si256(high, 1) };
+        __m256 values;
+
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[0]));
+        _mm256_storeu_ps(outputPtr, _mm256_mul_ps(values, invScalar));
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[1]));
+        _mm256_storeu_ps(outputPtr + 8, _mm256_mul_ps(values, invScalar));
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[2]));
+        _mm256_storeu_ps(outputPtr + 16, _mm256_mul_ps(values, invScalar));
+        values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(ints[3]));
+        _mm256_storeu_ps(outputPtr + 24, _mm256_mul_ps(values, invScalar));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (float)((int8_t)(byte << 4) >> 4) * iScalar;
+        *outputPtr++ = (float)((int8_t)byte >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8u_s32f_unpack_sc4_32fc_u_avx512bw(lv_32fc_t* outputVector,
+                                                           const uint8_t* inputVector,
+                                                           const float scalar,
+                                                           unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 invScalar = _mm512_set1_ps(iScalar);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const __m128i bytes = _mm_loadu_si128((const __m128i*)inputPtr);
+        inputPtr += 16;
+
+        // put the real part at the top of the low and the imaginary part at the top
+        // of the high half of each 32 bit lane
+        __m512i ints = _mm512_cvtepu8_epi32(bytes);
+        ints = _mm512_or_si512(_mm512_slli_epi32(ints, 12), _mm512_slli_epi32(ints, 24));
+        ints = _mm512_srai_epi16(ints, 12);
+        const __m256i low = _mm512_castsi512_si256(ints);
+        const __m256i high = _mm512_extracti64x4_epi64(ints, 1);
+        __m512 values;
+
+        values = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(low));
+        _mm512_storeu_ps(outputPtr, _mm512_mul_ps(values, invScalar));
+        values = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(high));
+        _mm512_storeu_ps(outputPtr + 16, _mm512_mul_ps(values, invScalar));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (float)((int8_t)(byte << 4) >> 4) * iScalar;
+        *outputPtr++ = (float)((int8_t)byte >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX512BW */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_s32f_unpack_sc4_32fc_neon(lv_32fc_t* outputVector,
+                                                     const uint8_t* inputVector,
+                                                     const float scalar,
+                                                     unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const uint8_t* inputPtr = inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        const int8x8_t bytes = vreinterpret_s8_u8(vld1_u8(inputPtr));
+        inputPtr += 8;
+
+        const int16x8_t real = vmovl_s8(vshr_n_s8(vshl_n_s8(bytes, 4), 4));
+        const int16x8_t imag = vmovl_s8(vshr_n_s8(bytes, 4));
+        float32x4x2_t values;
+
+        values.val[0] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(real)));
+        values.val[1] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(imag)));
+        values.val[0] = vmulq_n_f32(values.val[0], iScalar);
+        values.val[1] = vmulq_n_f32(values.val[1], iScalar);
+        vst2q_f32(outputPtr, values);
+        values.val[0] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(real)));
+        values.val[1] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(imag)));
+        values.val[0] = vmulq_n_f32(values.val[0], iScalar);
+        values.val[1] = vmulq_n_f32(values.val[1], iScalar);
+        vst2q_f32(outputPtr + 8, values);
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (float)((int8_t)(byte << 4) >> 4) * iScalar;
+        *outputPtr++ = (float)((int8_t)byte >> 4) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_s32f_unpack_sc4_32fc_u_H */
@@ -0,0 +1,422 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_unpack_sc12_16ic
+ *
+ * \b Overview
+ *
+ * Unpacks complex samples in the packed sc12 format into 16 bit complex
+ * integers, sign extending both parts.
+ *
+ * The packed sc12 format stores each complex sample in three bytes, as the
+ * little endian 24 bit word (Q << 12) | I, with I and Q in 12 bit two's
+ * complement.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_unpack_sc12_16ic(lv_16sc_t* outputVector, const uint8_t* inputVector,
+ *                               unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The packed samples, 3 * num_points bytes.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex 16 bit integers, in [-2048, 2047].
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(3 * N, alignment);
+ *   lv_16sc_t* out = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t) * N, alignment);
+ *
+ *   // read 3 * N bytes into in
+ *
+ *   volk_8u_unpack_sc12_16ic(out, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_unpack_sc12_16ic_a_H
+#define INCLUDED_volk_8u_unpack_sc12_16ic_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_unpack_sc12_16ic_generic(lv_16sc_t* outputVector,
+                                                    const uint8_t* inputVector,
+                                                    unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+
+    for (unsigned int number = 0; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (int16_t)((byte1 << 12) | (byte0 << 4)) >> 4;
+        *outputPtr++ = (int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_8u_unpack_sc12_16ic_a_ssse3(lv_16sc_t* outputVector,
+                                                    const uint8_t* inputVector,
+                                                    unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    // gather the two bytes holding each part into a 16 bit lane, the real part then
+    // sits in the low 12 bits and the imaginary part in the high 12 bits
+    const __m128i lowShuffle =
+        _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+    const __m128i highShuffle =
+        _mm_setr_epi8(4, 5, 5, 6, 7, 8, 8, 9, 10, 11, 11, 12, 13, 14, 14, 15);
+    // shift the real parts up to the sign bit
+    const __m128i align = _mm_set1_epi32(0x00010010);
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        __m128i low = _mm_loadu_si128((const __m128i*)inputPtr);
+        __m128i high = _mm_loadu_si128((const __m128i*)(inputPtr + 8));
+        inputPtr += 24;
+
+        low = _mm_mullo_epi16(_mm_shuffle_epi8(low, lowShuffle), align);
+        high = _mm_mullo_epi16(_mm_shuffle_epi8(high, highShuffle), align);
+        _mm_store_si128((__m128i*)outputPtr, _mm_srai_epi16(low, 4));
+        _mm_store_si128((__m128i*)(outputPtr + 8), _mm_srai_epi16(high, 4));
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (int16_t)((byte1 << 12) | (byte0 << 4)) >> 4;
+        *outputPtr++ = (int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4;
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_unpack_sc12_16ic_a_avx2(lv_16sc_t* outputVector,
+                                                   const uint8_t* inputVector,
+                                                   unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    // move 12 bytes, four samples, into each 128 bit lane
+    const __m256i lowSpread = _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6);
+    const __m256i highSpread = _mm256_setr_epi32(2, 3, 4, 5, 5, 6, 7, 7);
+    // gather the two bytes holding each part into a 16 bit lane, the real part then
+    // sits in the low 12 bits and the imaginary part in the high 12 bits
+    const __m256i shuffle = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11));
+    // shift the real parts up to the sign bit
+    const __m256i align = _mm256_set1_epi32(0x00010010);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m256i low = _mm256_loadu_si256((const __m256i*)inputPtr);
+        __m256i high = _mm256_loadu_si256((const __m256i*)(inputPtr + 16));
+        inputPtr += 48;
+
+        low = _mm256_permutevar8x32_epi32(low, lowSpread);
+        high = _mm256_permutevar8x32_epi32(high, highSpread);
+        low = _mm256_shuffle_epi8(low, shuffle);
+        high = _mm256_shuffle_epi8(high, shuffle);
+        low = _mm256_srai_epi16(_mm256_mullo_epi16(low, align), 4);
+        high = _mm256_srai_epi16(_mm256_mullo_epi16(high, align), 4);
+        _mm256_store_si256((__m256i*)outputPtr, low);
+        _mm256_store_si256((__m256i*)(outputPtr + 16), high);
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (int16_t)((byte1 << 12) | (byte0 << 4)) >> 4;
+        *outputPtr++ = (int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512VBMI
+#include <immintrin.h>
+
+static inline void volk_8u_unpack_sc12_16ic_a_avx512vbmi(lv_16sc_t* outputVector,
+                                                         const uint8_t* inputVector,
+                                                         unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    // the two bytes holding each part of the 16 samples in 48 bytes
+    const __m512i shuffle = _mm512_setr_epi32(0x02010100,
+                                              0x05040403,
+                                              0x08070706,
+                                              0x0b0a0a09,
+                                              0x0e0d0d0c,
+                                              0x1110100f,
+                                              0x14131312,
+                                              0x17161615,
+                                              0x1a191918,
+                                              0x1d1c1c1b,
+                                              0x201f1f1e,
+                                              0x23222221,
+                                              0x26252524,
+                                              0x29282827,
+                                              0x2c2b2b2a,
+                                              0x2f2e2e2d);
+    // shift the real parts up to the sign bit
+    const __m512i align = _mm512_set1_epi32(0x00010010);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m512i values = _mm512_maskz_loadu_epi8(0xffffffffffffULL, inputPtr);
+        inputPtr += 48;
+
+        values = _mm512_mullo_epi16(_mm512_permutexvar_epi8(shuffle, values), align);
+        _mm512_store_si512(outputPtr, _mm512_srai_epi16(values, 4));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (int16_t)((byte1 << 12) | (byte0 << 4)) >> 4;
+        *outputPtr++ = (int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4;
+    }
+}
+
+#endif /* LV_HAVE_AVX512VBMI */
+
+#endif /* INCLUDED_volk_8u_unpack_sc12_16ic_a_H */
+
+#ifndef INCLUDED_volk_8u_unpack_sc12_16ic_u_H
+#define INCLUDED_volk_8u_unpack_sc12_16ic_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_8u_unpack_sc12_16ic_u_ssse3(lv_16sc_t* outputVector,
+                                                    const uint8_t* inputVector,
+                                                    unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    // gather the two bytes holding each part into a 16 bit lane, the real part then
+    // sits in the low 12 bits and the imaginary part in the high 12 bits
+    const __m128i lowShuffle =
+        _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+    const __m128i highShuffle =
+        _mm_setr_epi8(4, 5, 5, 6, 7, 8, 8, 9, 10, 11, 11, 12, 13, 14, 14, 15);
+    // shift the real parts up to the sign bit
+    const __m128i align = _mm_set1_epi32(0x00010010);
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        __m128i low = _mm_loadu_si128((const __m128i*)inputPtr);
+        __m128i high = _mm_loadu_si128((const __m128i*)(inputPtr + 8));
+        inputPtr += 24;
+
+        low = _mm_mullo_epi16(_mm_shuffle_epi8(low, lowShuffle), align);
+        high = _mm_mullo_epi16(_mm_shuffle_epi8(high, highShuffle), align);
+        _mm_storeu_si128((__m128i*)outputPtr, _mm_srai_epi16(low, 4));
+        _mm_storeu_si128((__m128i*)(outputPtr + 8), _mm_srai_epi16(high, 4));
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (int16_t)((byte1 << 12) | (byte0 << 4)) >> 4;
+        *outputPtr++ = (int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4;
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_unpack_sc12_16ic_u_avx2(lv_16sc_t* outputVector,
+                                                   const uint8_t* inputVector,
+                                                   unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    // move 12 bytes, four samples, into each 128 bit lane
+    const __m256i lowSpread = _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6);
+    const __m256i highSpread = _mm256_setr_epi32(2, 3, 4, 5, 5, 6, 7, 7);
+    // gather the two bytes holding each part into a 16 bit lane, the real part then
+    // sits in the low 12 bits and the imaginary part in the high 12 bits
+    const __m256i shuffle = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11));
+    // shift the real parts up to the sign bit
+    const __m256i align = _mm256_set1_epi32(0x00010010);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m256i low = _mm256_loadu_si256((const __m256i*)inputPtr);
+        __m256i high = _mm256_loadu_si256((const __m256i*)(inputPtr + 16));
+        inputPtr += 48;
+
+        low = _mm256_permutevar8x32_epi32(low, lowSpread);
+        high = _mm256_permutevar8x32_epi32(high, highSpread);
+        low = _mm256_shuffle_epi8(low, shuffle);
+        high = _mm256_shuffle_epi8(high, shuffle);
+        low = _mm256_srai_epi16(_mm256_mullo_epi16(low, align), 4);
+        high = _mm256_srai_epi16(_mm256_mullo_epi16(high, align), 4);
+        _mm256_storeu_si256((__m256i*)outputPtr, low);
+        _mm256_storeu_si256((__m256i*)(outputPtr + 16), high);
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (int16_t)((byte1 << 12) | (byte0 << 4)) >> 4;
+        *outputPtr++ = (int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512VBMI
+#include <immintrin.h>
+
+static inline void volk_8u_unpack_sc12_16ic_u_avx512vbmi(lv_16sc_t* outputVector,
+                                                         const uint8_t* inputVector,
+                                                         unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    // the two bytes holding each part of the 16 samples in 48 bytes
+    const __m512i shuffle = _mm512_setr_epi32(0x02010100,
+                                              0x05040403,
+                                              0x08070706,
+                                              0x0b0a0a09,
+                                              0x0e0d0d0c,
+                                              0x1110100f,
+                                              0x14131312,
+                                              0x17161615,
+                                              0x1a191918,
+                                              0x1d1c1c1b,
+                                              0x201f1f1e,
+                                              0x23222221,
+                                              0x26252524,
+                                              0x29282827,
+                                              0x2c2b2b2a,
+                                              0x2f2e2e2d);
+    // shift the real parts up to the sign bit
+    const __m512i align = _mm512_set1_epi32(0x00010010);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        __m512i values = _mm512_maskz_loadu_epi8(0xffffffffffffULL, inputPtr);
+        inputPtr += 48;
+
+        values = _mm512_mullo_epi16(_mm512_permutexvar_epi8(shuffle, values), align);
+        _mm512_storeu_si512(outputPtr, _mm512_srai_epi16(values, 4));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (int16_t)((byte1 << 12) | (byte0 << 4)) >> 4;
+        *outputPtr++ = (int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4;
+    }
+}
+
+#endif /* LV_HAVE_AVX512VBMI */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_unpack_sc12_16ic_neon(lv_16sc_t* outputVector,
+                                                 const uint8_t* inputVector,
+                                                 unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        const uint8x8x3_t bytes = vld3_u8(inputPtr);
+        inputPtr += 24;
+
+        const uint16x8_t real =
+            vorrq_u16(vmovl_u8(bytes.val[0]), vshll_n_u8(bytes.val[1], 8));
+        const uint16x8_t imag =
+            vorrq_u16(vmovl_u8(bytes.val[1]), vshll_n_u8(bytes.val[2], 8));
+        int16x8x2_t values;
+        values.val[0] = vshrq_n_s16(vshlq_n_s16(vreinterpretq_s16_u16(real), 4), 4);
+        values.val[1] = vshrq_n_s16(vreinterpretq_s16_u16(imag), 4);
+        vst2q_s16(outputPtr, values);
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        const uint16_t byte0 = inputPtr[0];
+        const uint16_t byte1 = inputPtr[1];
+        const uint16_t byte2 = inputPtr[2];
+        inputPtr += 3;
+        *outputPtr++ = (int16_t)((byte1 << 12) | (byte0 << 4)) >> 4;
+        *outputPtr++ = (int16_t)((byte2 << 8) | (byte1 & 0xf0)) >> 4;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_unpack_sc12_16ic_u_H */
@@ -0,0 +1,103 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_8u_unpack_sc12puppet_16ic_H
+#define INCLUDED_volk_8u_unpack_sc12puppet_16ic_H
+
+#include <volk/volk_8u_unpack_sc12_16ic.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_unpack_sc12puppet_16ic_generic(lv_16sc_t* outputVector,
+                                                          const uint8_t* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_8u_unpack_sc12_16ic_generic(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSSE3
+
+static inline void volk_8u_unpack_sc12puppet_16ic_a_ssse3(lv_16sc_t* outputVector,
+                                                          const uint8_t* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_8u_unpack_sc12_16ic_a_ssse3(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_SSSE3
+
+static inline void volk_8u_unpack_sc12puppet_16ic_u_ssse3(lv_16sc_t* outputVector,
+                                                          const uint8_t* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_8u_unpack_sc12_16ic_u_ssse3(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_unpack_sc12puppet_16ic_a_avx2(lv_16sc_t* outputVector,
+                                                         const uint8_t* inputVector,
+                                                         unsigned int num_points)
+{
+    volk_8u_unpack_sc12_16ic_a_avx2(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_unpack_sc12puppet_16ic_u_avx2(lv_16sc_t* outputVector,
+                                                         const uint8_t* inputVector,
+                                                         unsigned int num_points)
+{
+    volk_8u_unpack_sc12_16ic_u_avx2(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512VBMI
+
+static inline void volk_8u_unpack_sc12puppet_16ic_a_avx512vbmi(lv_16sc_t* outputVector,
+                                                               const uint8_t* inputVector,
+                                                               unsigned int num_points)
+{
+    volk_8u_unpack_sc12_16ic_a_avx512vbmi(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_AVX512VBMI */
+
+#ifdef LV_HAVE_AVX512VBMI
+
+static inline void volk_8u_unpack_sc12puppet_16ic_u_avx512vbmi(lv_16sc_t* outputVector,
+                                                               const uint8_t* inputVector,
+                                                               unsigned int num_points)
+{
+    volk_8u_unpack_sc12_16ic_u_avx512vbmi(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_AVX512VBMI */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_8u_unpack_sc12puppet_16ic_neon(lv_16sc_t* outputVector,
+                                                       const uint8_t* inputVector,
+                                                       unsigned int num_points)
+{
+    volk_8u_unpack_sc12_16ic_neon(outputVector, inputVector, num_points / 3);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_unpack_sc12puppet_16ic_H */
@@ -0,0 +1,359 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_unpack_sc4_16ic
+ *
+ * \b Overview
+ *
+ * Unpacks complex samples in the packed sc4 format into 16 bit complex integers,
+ * sign extending both parts.
+ *
+ * The packed sc4 format stores each complex sample in one byte, I in the low
+ * and Q in the high nibble, both in 4 bit two's complement.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_unpack_sc4_16ic(lv_16sc_t* outputVector, const uint8_t* inputVector,
+ *                              unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The packed samples, one byte each.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex 16 bit integers, in [-8, 7].
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(N, alignment);
+ *   lv_16sc_t* out = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t) * N, alignment);
+ *
+ *   // read N bytes into in
+ *
+ *   volk_8u_unpack_sc4_16ic(out, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_unpack_sc4_16ic_a_H
+#define INCLUDED_volk_8u_unpack_sc4_16ic_a_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_unpack_sc4_16ic_generic(lv_16sc_t* outputVector,
+                                                   const uint8_t* inputVector,
+                                                   unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+
+    for (unsigned int number = 0; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (int8_t)(byte << 4) >> 4;
+        *outputPtr++ = (int8_t)byte >> 4;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_8u_unpack_sc4_16ic_a_sse2(lv_16sc_t* outputVector,
+                                                  const uint8_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    // with each byte in both halves of a 32 bit lane, shift the real part up to the
+    // sign bit of the low half, the imaginary part already is at the top of the high
+    const __m128i align = _mm_set1_epi32(0x00010010);
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const __m128i bytes = _mm_load_si128((const __m128i*)inputPtr);
+        inputPtr += 16;
+
+        const __m128i low = _mm_unpacklo_epi8(zero, bytes);
+        const __m128i high = _mm_unpackhi_epi8(zero, bytes);
+        __m128i values;
+
+        values = _mm_mullo_epi16(_mm_unpacklo_epi16(low, low), align);
+        _mm_store_si128((__m128i*)outputPtr, _mm_srai_epi16(values, 12));
+        values = _mm_mullo_epi16(_mm_unpackhi_epi16(low, low), align);
+        _mm_store_si128((__m128i*)(outputPtr + 8), _mm_srai_epi16(values, 12));
+        values = _mm_mullo_epi16(_mm_unpacklo_epi16(high, high), align);
+        _mm_store_si128((__m128i*)(outputPtr + 16), _mm_srai_epi16(values, 12));
+        values = _mm_mullo_epi16(_mm_unpackhi_epi16(high, high), align);
+        _mm_store_si128((__m128i*)(outputPtr + 24), _mm_srai_epi16(values, 12));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (int8_t)(byte << 4) >> 4;
+        *outputPtr++ = (int8_t)byte >> 4;
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_unpack_sc4_16ic_a_avx2(lv_16sc_t* outputVector,
+                                                  const uint8_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const __m128i bytes = _mm_load_si128((const __m128i*)inputPtr);
+        inputPtr += 16;
+
+        // put the real part at the top of the low and the imaginary part at the top
+        // of the high half of each 32 bit lane
+        __m256i low = _mm256_cvtepu8_epi32(bytes);
+        __m256i high = _mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8));
+        low = _mm256_or_si256(_mm256_slli_epi32(low, 12), _mm256_slli_epi32(low, 24));
+        high = _mm256_or_si256(_mm256_slli_epi32(high, 12), _mm256_slli_epi32(high, 24));
+        _mm256_store_si256((__m256i*)outputPtr, _mm256_srai_epi16(low, 12));
+        _mm256_store_si256((__m256i*)(outputPtr + 16), _mm256_srai_epi16(high, 12));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (int8_t)(byte << 4) >> 4;
+        *outputPtr++ = (int8_t)byte >> 4;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8u_unpack_sc4_16ic_a_avx512bw(lv_16sc_t* outputVector,
+                                                      const uint8_t* inputVector,
+                                                      unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int thirtysecondPoints = num_points / 32;
+    unsigned int number = 0;
+
+    for (; number < thirtysecondPoints; number++) {
+        const __m256i bytes = _mm256_load_si256((const __m256i*)inputPtr);
+        inputPtr += 32;
+
+        // put the real part at the top of the low and the imaginary part at the top
+        // of the high half of each 32 bit lane
+        __m512i low = _mm512_cvtepu8_epi32(_mm256_castsi256_si128(bytes));
+        __m512i high = _mm512_cvtepu8_epi32(_mm256_extracti128_si256(bytes, 1));
+        low = _mm512_or_si512(_mm512_slli_epi32(low, 12), _mm512_slli_epi32(low, 24));
+        high = _mm512_or_si512(_mm512_slli_epi32(high, 12), _mm512_slli_epi32(high, 24));
+        _mm512_store_si512(outputPtr, _mm512_srai_epi16(low, 12));
+        _mm512_store_si512(outputPtr + 32, _mm512_srai_epi16(high, 12));
+        outputPtr += 64;
+    }
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (int8_t)(byte << 4) >> 4;
+        *outputPtr++ = (int8_t)byte >> 4;
+    }
+}
+
+#endif /* LV_HAVE_AVX512BW */
+
+#endif /* INCLUDED_volk_8u_unpack_sc4_16ic_a_H */
+
+#ifndef INCLUDED_volk_8u_unpack_sc4_16ic_u_H
+#define INCLUDED_volk_8u_unpack_sc4_16ic_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_8u_unpack_sc4_16ic_u_sse2(lv_16sc_t* outputVector,
+                                                  const uint8_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    // with each byte in both halves of a 32 bit lane, shift the real part up to the
+    // sign bit of the low half, the imaginary part already is at the top of the high
+    const __m128i align = _mm_set1_epi32(0x00010010);
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const __m128i bytes = _mm_loadu_si128((const __m128i*)inputPtr);
+        inputPtr += 16;
+
+        const __m128i low = _mm_unpacklo_epi8(zero, bytes);
+        const __m128i high = _mm_unpackhi_epi8(zero, bytes);
+        __m128i values;
+
+        values = _mm_mullo_epi16(_mm_unpacklo_epi16(low, low), align);
+        _mm_storeu_si128((__m128i*)outputPtr, _mm_srai_epi16(values, 12));
+        values = _mm_mullo_epi16(_mm_unpackhi_epi16(low, low), align);
+        _mm_storeu_si128((__m128i*)(outputPtr + 8), _mm_srai_epi16(values, 12));
+        values = _mm_mullo_epi16(_mm_unpacklo_epi16(high, high), align);
+        _mm_storeu_si128((__m128i*)(outputPtr + 16), _mm_srai_epi16(values, 12));
+        values = _mm_mullo_epi16(_mm_unpackhi_epi16(high, high), align);
+        _mm_storeu_si128((__m128i*)(outputPtr + 24), _mm_srai_epi16(values, 12));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (int8_t)(byte << 4) >> 4;
+        *outputPtr++ = (int8_t)byte >> 4;
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_unpack_sc4_16ic_u_avx2(lv_16sc_t* outputVector,
+                                                  const uint8_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const __m128i bytes = _mm_loadu_si128((const __m128i*)inputPtr);
+        inputPtr += 16;
+
+        // put the real part at the top of the low and the imaginary part at the top
+        // of the high half of each 32 bit lane
+        __m256i low = _mm256_cvtepu8_epi32(bytes);
+        __m256i high = _mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8));
+        low = _mm256_or_si256(_mm256_slli_epi32(low, 12), _mm256_slli_epi32(low, 24));
+        high = _mm256_or_si256(_mm256_slli_epi32(high, 12), _mm256_slli_epi32(high, 24));
+        _mm256_storeu_si256((__m256i*)outputPtr, _mm256_srai_epi16(low, 12));
+        _mm256_storeu_si256((__m256i*)(outputPtr + 16), _mm256_srai_epi16(high, 12));
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (int8_t)(byte << 4) >> 4;
+        *outputPtr++ = (int8_t)byte >> 4;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8u_unpack_sc4_16ic_u_avx512bw(lv_16sc_t* outputVector,
+                                                      const uint8_t* inputVector,
+                                                      unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int thirtysecondPoints = num_points / 32;
+    unsigned int number = 0;
+
+    for (; number < thirtysecondPoints; number++) {
+        const __m256i bytes = _mm256_loadu_si256((const __m256i*)inputPtr);
+        inputPtr += 32;
+
+        // put the real part at the top of the low and the imaginary part at the top
+        // of the high half of each 32 bit lane
+        __m512i low = _mm512_cvtepu8_epi32(_mm256_castsi256_si128(bytes));
+        __m512i high = _mm512_cvtepu8_epi32(_mm256_extracti128_si256(bytes, 1));
+        low = _mm512_or_si512(_mm512_slli_epi32(low, 12), _mm512_slli_epi32(low, 24));
+        high = _mm512_or_si512(_mm512_slli_epi32(high, 12), _mm512_slli_epi32(high, 24));
+        _mm512_storeu_si512(outputPtr, _mm512_srai_epi16(low, 12));
+        _mm512_storeu_si512(outputPtr + 32, _mm512_srai_epi16(high, 12));
+        outputPtr += 64;
+    }
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (int8_t)(byte << 4) >> 4;
+        *outputPtr++ = (int8_t)byte >> 4;
+    }
+}
+
+#endif /* LV_HAVE_AVX512BW */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_unpack_sc4_16ic_neon(lv_16sc_t* outputVector,
+                                                const uint8_t* inputVector,
+                                                unsigned int num_points)
+{
+    const uint8_t* inputPtr = inputVector;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const int8x16_t bytes = vreinterpretq_s8_u8(vld1q_u8(inputPtr));
+        inputPtr += 16;
+
+        const int8x16_t real = vshrq_n_s8(vshlq_n_s8(bytes, 4), 4);
+        const int8x16_t imag = vshrq_n_s8(bytes, 4);
+        int16x8x2_t values;
+
+        values.val[0] = vmovl_s8(vget_low_s8(real));
+        values.val[1] = vmovl_s8(vget_low_s8(imag));
+        vst2q_s16(outputPtr, values);
+        values.val[0] = vmovl_s8(vget_high_s8(real));
+        values.val[1] = vmovl_s8(vget_high_s8(imag));
+        vst2q_s16(outputPtr + 16, values);
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        const uint8_t byte = *inputPtr++;
+        *outputPtr++ = (int8_t)(byte << 4) >> 4;
+        *outputPtr++ = (int8_t)byte >> 4;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_unpack_sc4_16ic_u_H */
@@ -0,0 +1,635 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_x4_conv_viterbi_8u
+ *
+ * \b Overview
+ *
+ * Runs the add-compare-select steps of a Viterbi decoder for a rate 1/rate
+ * convolutional code with constraint length k, with 5 <= k <= 9 and
+ * 2 <= rate <= 4, e.g. the K=9 rate 1/2 and 1/3 codes of IS-95 or the K=7
+ * rate 1/3 code of LTE. volk_8u_x4_conv_k7_r2_8u only handles K=7 rate 1/2.
+ *
+ * The 2^(k-1) states are numbered by the last k-1 input bits, the newest one
+ * in the lowest bit, so states i and i + 2^(k-2) both lead to states 2i and
+ * 2i+1. The kernel relies on the two branches into a state having complementary
+ * outputs, which holds when every generator polynomial has its lowest and
+ * highest bits set.
+ *
+ * Path metrics are 8 bit and saturating. Every step subtracts the smallest
+ * metric of the step before, so the best path stays close to zero, and the
+ * metric of a branch is at most 63. Branch metrics are the sum over the rate
+ * symbols of (symbol ^ branch) >> 3 for rate 1/2 and >> 4 for rates 1/3 and 1/4.
+ * All versions compute the same metrics and decisions, ties going to the state
+ * with the highest bit set.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_x4_conv_viterbi_8u(unsigned char* Y,
+ *                                 unsigned char* X,
+ *                                 const unsigned char* syms,
+ *                                 unsigned char* dec,
+ *                                 const unsigned char* Branchtab,
+ *                                 unsigned int k,
+ *                                 unsigned int rate,
+ *                                 unsigned int nbits);
+ * \endcode
+ *
+ * \b Inputs
+ * \li Y: scratch space for 2^(k-1) path metrics.
+ * \li X: the 2^(k-1) path metrics to start from, usually 0 for the start state
+ * and 63 for the others. Receives the final path metrics.
+ * \li syms: nbits * rate soft symbols, 0 for a certain 0 and 255 for a certain 1.
+ * \li Branchtab: rate * 2^(k-2) expected symbols. Entry j * 2^(k-2) + i is 255 if
+ * parity((2 * i) & poly[j]) is 1 and 0 otherwise.
+ * \li k: The constraint length.
+ * \li rate: The number of symbols per bit.
+ * \li nbits: The number of decoded bits, i.e. of trellis steps.
+ *
+ * \b Outputs
+ * \li dec: nbits * 2^(k-1) decision bits, 2^(k-4) bytes per step. Bit s of a step,
+ * counted from the lowest bit of its first byte, is set if state s was reached
+ * from the predecessor with the highest bit set.
+ *
+ * \b Example
+ * Decode a K=9 rate 1/3 code. Trace back from the state with the smallest
+ * final metric: the decoded bit of step n is the lowest bit of the state after
+ * step n, and the state before step n is (state >> 1) | (decision << (k - 2)).
+ * \code
+ *   const unsigned int k = 9, rate = 3, nbits = 1000;
+ *   const unsigned int num_states = 1 << (k - 1);
+ *   const int polys[3] = { 0557, 0663, 0711 };
+ *   unsigned int alignment = volk_get_alignment();
+ *   unsigned char* X = (unsigned char*)volk_malloc(num_states, alignment);
+ *   unsigned char* Y = (unsigned char*)volk_malloc(num_states, alignment);
+ *   unsigned char* branchtab =
+ *       (unsigned char*)volk_malloc(rate * num_states / 2, alignment);
+ *   unsigned char* dec = (unsigned char*)volk_malloc(nbits * num_states / 8, alignment);
+ *   unsigned char* syms = (unsigned char*)volk_malloc(nbits * rate, alignment);
+ *
+ *   for (unsigned int j = 0; j < rate; ++j) {
+ *       for (unsigned int i = 0; i < num_states / 2; ++i) {
+ *           branchtab[j * num_states / 2 + i] =
+ *               __builtin_parity((2 * i) & polys[j]) ? 255 : 0;
+ *       }
+ *   }
+ *   // ... fill syms from the demodulator
+ *   memset(X, 63, num_states);
+ *   X[0] = 0;
+ *
+ *   volk_8u_x4_conv_viterbi_8u(Y, X, syms, dec, branchtab, k, rate, nbits);
+ *
+ *   volk_free(X);
+ *   volk_free(Y);
+ *   volk_free(branchtab);
+ *   volk_free(dec);
+ *   volk_free(syms);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_x4_conv_viterbi_8u_H
+#define INCLUDED_volk_8u_x4_conv_viterbi_8u_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_common.h>
+
+/*
+ * Right shift of each (symbol ^ branch) so that a branch metric is at most 63.
+ */
+static inline int volk_8u_x4_conv_viterbi_8u_shift(unsigned int rate)
+{
+    return (rate > 2) ? 4 : 3;
+}
+
+static inline unsigned char volk_8u_x4_conv_viterbi_8u_min(const unsigned char* metrics,
+                                                           unsigned int num_states)
+{
+    unsigned char min = metrics[0];
+    unsigned int i;
+
+    for (i = 1; i < num_states; ++i) {
+        if (metrics[i] < min) {
+            min = metrics[i];
+        }
+    }
+    return min;
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_x4_conv_viterbi_8u_generic(unsigned char* Y,
+                                                      unsigned char* X,
+                                                      const unsigned char* syms,
+                                                      unsigned char* dec,
+                                                      const unsigned char* Branchtab,
+                                                      unsigned int k,
+                                                      unsigned int rate,
+                                                      unsigned int nbits)
+{
+    const unsigned int num_states = 1 << (k - 1);
+    const unsigned int half = num_states / 2;
+    const int shift = volk_8u_x4_conv_viterbi_8u_shift(rate);
+    const unsigned int max_metric = rate * (255 >> shift);
+    unsigned char bias = volk_8u_x4_conv_viterbi_8u_min(X, num_states);
+    unsigned char* old_metrics = X;
+    unsigned char* new_metrics = Y;
+    unsigned char* tmp;
+    unsigned int s, i, j;
+
+    for (s = 0; s < nbits; ++s) {
+        unsigned char min = 255;
+        memset(dec, 0, num_states / 8);
+        for (i = 0; i < half; ++i) {
+            unsigned int metric = 0;
+            for (j = 0; j < rate; ++j) {
+                metric += (Branchtab[j * half + i] ^ syms[j]) >> shift;
+            }
+            const unsigned int a = old_metrics[i] - bias;
+            const unsigned int b = old_metrics[i + half] - bias;
+            unsigned int m0 = a + metric;
+            unsigned int m1 = b + (max_metric - metric);
+            unsigned int m2 = a + (max_metric - metric);
+            unsigned int m3 = b + metric;
+            m0 = (m0 > 255) ? 255 : m0;
+            m1 = (m1 > 255) ? 255 : m1;
+            m2 = (m2 > 255) ? 255 : m2;
+            m3 = (m3 > 255) ? 255 : m3;
+
+            const int decision0 = m1 <= m0;
+            const int decision1 = m3 <= m2;
+            new_metrics[2 * i] = decision0 ? m1 : m0;
+            new_metrics[2 * i + 1] = decision1 ? m3 : m2;
+            dec[i / 4] |= (decision0 | decision1 << 1) << ((2 * i) & 7);
+
+            if (new_metrics[2 * i] < min) {
+                min = new_metrics[2 * i];
+            }
+            if (new_metrics[2 * i + 1] < min) {
+                min = new_metrics[2 * i + 1];
+            }
+        }
+        bias = min;
+        syms += rate;
+        dec += num_states / 8;
+
+        tmp = old_metrics;
+        old_metrics = new_metrics;
+        new_metrics = tmp;
+    }
+
+    if (nbits & 1) {
+        memcpy(X, Y, num_states);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_8u_x4_conv_viterbi_8u_sse2(unsigned char* Y,
+                                                   unsigned char* X,
+                                                   const unsigned char* syms,
+                                                   unsigned char* dec,
+                                                   const unsigned char* Branchtab,
+                                                   unsigned int k,
+                                                   unsigned int rate,
+                                                   unsigned int nbits)
+{
+    const unsigned int num_states = 1 << (k - 1);
+    const unsigned int half = num_states / 2;
+    const int shift = volk_8u_x4_conv_viterbi_8u_shift(rate);
+    const __m128i shift_count = _mm_cvtsi32_si128(shift);
+    const __m128i mask = _mm_set1_epi8((char)(255 >> shift));
+    const __m128i max_metric = _mm_set1_epi8((char)(rate * (255 >> shift)));
+    unsigned char bias = volk_8u_x4_conv_viterbi_8u_min(X, num_states);
+    unsigned char* old_metrics = X;
+    unsigned char* new_metrics = Y;
+    unsigned char* tmp;
+    __m128i sym[4];
+    __m128i a, b, t, metric, metric_c, m0, m1, m2, m3, s0, s1, d0, d1;
+    __m128i bias_vec, min_vec;
+    unsigned int s, i, j;
+
+    for (s = 0; s < nbits; ++s) {
+        for (j = 0; j < rate; ++j) {
+            sym[j] = _mm_set1_epi8((char)syms[j]);
+        }
+        bias_vec = _mm_set1_epi8((char)bias);
+
+        if (half < 16) {
+            // k = 5, the 8 butterflies fill the low halves
+            a = _mm_subs_epu8(_mm_loadl_epi64((const __m128i*)old_metrics), bias_vec);
+            b = _mm_subs_epu8(_mm_loadl_epi64((const __m128i*)(old_metrics + half)),
+                              bias_vec);
+            metric = _mm_setzero_si128();
+            for (j = 0; j < rate; ++j) {
+                t = _mm_xor_si128(
+                    _mm_loadl_epi64((const __m128i*)(Branchtab + j * half)), sym[j]);
+                metric = _mm_add_epi8(metric,
+                                      _mm_and_si128(_mm_srl_epi16(t, shift_count), mask));
+            }
+            metric_c = _mm_sub_epi8(max_metric, metric);
+
+            m0 = _mm_adds_epu8(a, metric);
+            m1 = _mm_adds_epu8(b, metric_c);
+            m2 = _mm_adds_epu8(a, metric_c);
+            m3 = _mm_adds_epu8(b, metric);
+            s0 = _mm_min_epu8(m0, m1);
+            s1 = _mm_min_epu8(m2, m3);
+            d0 = _mm_cmpeq_epi8(s0, m1);
+            d1 = _mm_cmpeq_epi8(s1, m3);
+
+            min_vec = _mm_unpacklo_epi8(s0, s1);
+            _mm_storeu_si128((__m128i*)new_metrics, min_vec);
+            ((uint16_t*)dec)[0] = _mm_movemask_epi8(_mm_unpacklo_epi8(d0, d1));
+        } else {
+            min_vec = _mm_set1_epi8((char)255);
+            for (i = 0; i < half; i += 16) {
+                a = _mm_subs_epu8(_mm_loadu_si128((const __m128i*)(old_metrics + i)),
+                                  bias_vec);
+                b = _mm_subs_epu8(
+                    _mm_loadu_si128((const __m128i*)(old_metrics + half + i)), bias_vec);
+                metric = _mm_setzero_si128();
+                for (j = 0; j < rate; ++j) {
+                    t = _mm_xor_si128(
+                        _mm_loadu_si128((const __m128i*)(Branchtab + j * half + i)),
+                        sym[j]);
+                    metric = _mm_add_epi8(
+                        metric, _mm_and_si128(_mm_srl_epi16(t, shift_count), mask));
+                }
+                metric_c = _mm_sub_epi8(max_metric, metric);
+
+                m0 = _mm_adds_epu8(a, metric);
+                m1 = _mm_adds_epu8(b, metric_c);
+                m2 = _mm_adds_epu8(a, metric_c);
+                m3 = _mm_adds_epu8(b, metric);
+                s0 = _mm_min_epu8(m0, m1);
+                s1 = _mm_min_epu8(m2, m3);
+                d0 = _mm_cmpeq_epi8(s0, m1);
+                d1 = _mm_cmpeq_epi8(s1, m3);
+
+                _mm_storeu_si128((__m128i*)(new_metrics + 2 * i),
+                                 _mm_unpacklo_epi8(s0, s1));
+                _mm_storeu_si128((__m128i*)(new_metrics + 2 * i + 16),
+                                 _mm_unpackhi_epi8(s0, s1));
+                ((uint16_t*)dec)[i / 8] = _mm_movemask_epi8(_mm_unpacklo_epi8(d0, d1));
+                ((uint16_t*)dec)[i / 8 + 1] =
+                    _mm_movemask_epi8(_mm_unpackhi_epi8(d0, d1));
+                min_vec = _mm_min_epu8(min_vec, _mm_min_epu8(s0, s1));
+            }
+        }
+        min_vec = _mm_min_epu8(min_vec, _mm_srli_si128(min_vec, 8));
+        min_vec = _mm_min_epu8(min_vec, _mm_srli_si128(min_vec, 4));
+        min_vec = _mm_min_epu8(min_vec, _mm_srli_si128(min_vec, 2));
+        min_vec = _mm_min_epu8(min_vec, _mm_srli_si128(min_vec, 1));
+        bias = (unsigned char)_mm_cvtsi128_si32(min_vec);
+        syms += rate;
+        dec += num_states / 8;
+
+        tmp = old_metrics;
+        old_metrics = new_metrics;
+        new_metrics = tmp;
+    }
+
+    if (nbits & 1) {
+        memcpy(X, Y, num_states);
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_x4_conv_viterbi_8u_avx2(unsigned char* Y,
+                                                   unsigned char* X,
+                                                   const unsigned char* syms,
+                                                   unsigned char* dec,
+                                                   const unsigned char* Branchtab,
+                                                   unsigned int k,
+                                                   unsigned int rate,
+                                                   unsigned int nbits)
+{
+    const unsigned int num_states = 1 << (k - 1);
+    const unsigned int half = num_states / 2;
+
+    if (half < 32) {
+        // k < 7 does not fill a vector
+        volk_8u_x4_conv_viterbi_8u_sse2(Y, X, syms, dec, Branchtab, k, rate, nbits);
+        return;
+    }
+
+    const int shift = volk_8u_x4_conv_viterbi_8u_shift(rate);
+    const __m128i shift_count = _mm_cvtsi32_si128(shift);
+    const __m256i mask = _mm256_set1_epi8((char)(255 >> shift));
+    const __m256i max_metric = _mm256_set1_epi8((char)(rate * (255 >> shift)));
+    unsigned char bias = volk_8u_x4_conv_viterbi_8u_min(X, num_states);
+    unsigned char* old_metrics = X;
+    unsigned char* new_metrics = Y;
+    unsigned char* tmp;
+    __m256i sym[4];
+    __m256i a, b, t, metric, metric_c, m0, m1, m2, m3, s0, s1, d0, d1, lo, hi;
+    __m256i bias_vec, min_vec;
+    __m128i min_lane;
+    unsigned int s, i, j;
+
+    for (s = 0; s < nbits; ++s) {
+        for (j = 0; j < rate; ++j) {
+            sym[j] = _mm256_set1_epi8((char)syms[j]);
+        }
+        bias_vec = _mm256_set1_epi8((char)bias);
+        min_vec = _mm256_set1_epi8((char)255);
+
+        for (i = 0; i < half; i += 32) {
+            a = _mm256_subs_epu8(_mm256_loadu_si256((const __m256i*)(old_metrics + i)),
+                                 bias_vec);
+            b = _mm256_subs_epu8(
+                _mm256_loadu_si256((const __m256i*)(old_metrics + half + i)), bias_vec);
+            metric = _mm256_setzero_si256();
+            for (j = 0; j < rate; ++j) {
+                t = _mm256_xor_si256(
+                    _mm256_loadu_si256((const __m256i*)(Branchtab + j * half + i)),
+                    sym[j]);
+                metric = _mm256_add_epi8(
+                    metric, _mm256_and_si256(_mm256_srl_epi16(t, shift_count), mask));
+            }
+            metric_c = _mm256_sub_epi8(max_metric, metric);
+
+            m0 = _mm256_adds_epu8(a, metric);
+            m1 = _mm256_adds_epu8(b, metric_c);
+            m2 = _mm256_adds_epu8(a, metric_c);
+            m3 = _mm256_adds_epu8(b, metric);
+            s0 = _mm256_min_epu8(m0, m1);
+            s1 = _mm256_min_epu8(m2, m3);
+            d0 = _mm256_cmpeq_epi8(s0, m1);
+            d1 = _mm256_cmpeq_epi8(s1, m3);
+
+            // the unpacks interleave within 128 bit lanes, put the lanes in order
+            lo = _mm256_unpacklo_epi8(s0, s1);
+            hi = _mm256_unpackhi_epi8(s0, s1);
+            _mm256_storeu_si256((__m256i*)(new_metrics + 2 * i),
+                                _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256((__m256i*)(new_metrics + 2 * i + 32),
+                                _mm256_permute2x128_si256(lo, hi, 0x31));
+            lo = _mm256_unpacklo_epi8(d0, d1);
+            hi = _mm256_unpackhi_epi8(d0, d1);
+            ((uint32_t*)dec)[i / 16] =
+                _mm256_movemask_epi8(_mm256_permute2x128_si256(lo, hi, 0x20));
+            ((uint32_t*)dec)[i / 16 + 1] =
+                _mm256_movemask_epi8(_mm256_permute2x128_si256(lo, hi, 0x31));
+            min_vec = _mm256_min_epu8(min_vec, _mm256_min_epu8(s0, s1));
+        }
+        min_lane = _mm_min_epu8(_mm256_castsi256_si128(min_vec),
+                                _mm256_extracti128_si256(min_vec, 1));
+        min_lane = _mm_min_epu8(min_lane, _mm_srli_si128(min_lane, 8));
+        min_lane = _mm_min_epu8(min_lane, _mm_srli_si128(min_lane, 4));
+        min_lane = _mm_min_epu8(min_lane, _mm_srli_si128(min_lane, 2));
+        min_lane = _mm_min_epu8(min_lane, _mm_srli_si128(min_lane, 1));
+        bias = (unsigned char)_mm_cvtsi128_si32(min_lane);
+        syms += rate;
+        dec += num_states / 8;
+
+        tmp = old_metrics;
+        old_metrics = new_metrics;
+        new_metrics = tmp;
+    }
+
+    if (nbits & 1) {
+        memcpy(X, Y, num_states);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_8u_x4_conv_viterbi_8u_avx512bw(unsigned char* Y,
+                                                       unsigned char* X,
+                                                       const unsigned char* syms,
+                                                       unsigned char* dec,
+                                                       const unsigned char* Branchtab,
+                                                       unsigned int k,
+                                                       unsigned int rate,
+                                                       unsigned int nbits)
+{
+    const unsigned int num_states = 1 << (k - 1);
+    const unsigned int half = num_states / 2;
+
+    if (half < 64) {
+        // k < 8 does not fill a vector
+        volk_8u_x4_conv_viterbi_8u_avx2(Y, X, syms, dec, Branchtab, k, rate, nbits);
+        return;
+    }
+
+    const int shift = volk_8u_x4_conv_viterbi_8u_shift(rate);
+    const __m128i shift_count = _mm_cvtsi32_si128(shift);
+    const __m512i mask = _mm512_set1_epi8((char)(255 >> shift));
+    const __m512i max_metric = _mm512_set1_epi8((char)(rate * (255 >> shift)));
+    // 128 bit lanes 0 and 1, and 2 and 3, of the unpacked low and high halves
+    const __m512i first = _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11);
+    const __m512i second = _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15);
+    unsigned char bias = volk_8u_x4_conv_viterbi_8u_min(X, num_states);
+    unsigned char* old_metrics = X;
+    unsigned char* new_metrics = Y;
+    unsigned char* tmp;
+    __m512i sym[4];
+    __m512i a, b, t, metric, metric_c, m0, m1, m2, m3, s0, s1, lo, hi, sel_lo, sel_hi;
+    __m512i bias_vec, min_vec;
+    __m256i min_half;
+    __m128i min_lane;
+    unsigned int s, i, j;
+
+    for (s = 0; s < nbits; ++s) {
+        for (j = 0; j < rate; ++j) {
+            sym[j] = _mm512_set1_epi8((char)syms[j]);
+        }
+        bias_vec = _mm512_set1_epi8((char)bias);
+        min_vec = _mm512_set1_epi8((char)255);
+
+        for (i = 0; i < half; i += 64) {
+            a = _mm512_subs_epu8(_mm512_loadu_si512((const void*)(old_metrics + i)),
+                                 bias_vec);
+            b = _mm512_subs_epu8(
+                _mm512_loadu_si512((const void*)(old_metrics + half + i)), bias_vec);
+            metric = _mm512_setzero_si512();
+            for (j = 0; j < rate; ++j) {
+                t = _mm512_xor_si512(
+                    _mm512_loadu_si512((const void*)(Branchtab + j * half + i)), sym[j]);
+                metric = _mm512_add_epi8(
+                    metric, _mm512_and_si512(_mm512_srl_epi16(t, shift_count), mask));
+            }
+            metric_c = _mm512_sub_epi8(max_metric, metric);
+
+            m0 = _mm512_adds_epu8(a, metric);
+            m1 = _mm512_adds_epu8(b, metric_c);
+            m2 = _mm512_adds_epu8(a, metric_c);
+            m3 = _mm512_adds_epu8(b, metric);
+            s0 = _mm512_min_epu8(m0, m1);
+            s1 = _mm512_min_epu8(m2, m3);
+
+            // decisions are taken on the interleaved metrics, so that the mask bits
+            // come out in state order
+            lo = _mm512_unpacklo_epi8(s0, s1);
+            hi = _mm512_unpackhi_epi8(s0, s1);
+            s0 = _mm512_permutex2var_epi64(lo, first, hi);
+            s1 = _mm512_permutex2var_epi64(lo, second, hi);
+            lo = _mm512_unpacklo_epi8(m1, m3);
+            hi = _mm512_unpackhi_epi8(m1, m3);
+            sel_lo = _mm512_permutex2var_epi64(lo, first, hi);
+            sel_hi = _mm512_permutex2var_epi64(lo, second, hi);
+
+            _mm512_storeu_si512((void*)(new_metrics + 2 * i), s0);
+            _mm512_storeu_si512((void*)(new_metrics + 2 * i + 64), s1);
+            ((uint64_t*)dec)[i / 32] = _mm512_cmpeq_epi8_mask(s0, sel_lo);
+            ((uint64_t*)dec)[i / 32 + 1] = _mm512_cmpeq_epi8_mask(s1, sel_hi);
+            min_vec = _mm512_min_epu8(min_vec, _mm512_min_epu8(s0, s1));
+        }
+        min_half = _mm256_min_epu8(_mm512_castsi512_si256(min_vec),
+                                   _mm512_extracti64x4_epi64(min_vec, 1));
+        min_lane = _mm_min_epu8(_mm256_castsi256_si128(min_half),
+                                _mm256_extracti128_si256(min_half, 1));
+        min_lane = _mm_min_epu8(min_lane, _mm_srli_si128(min_lane, 8));
+        min_lane = _mm_min_epu8(min_lane, _mm_srli_si128(min_lane, 4));
+        min_lane = _mm_min_epu8(min_lane, _mm_srli_si128(min_lane, 2));
+        min_lane = _mm_min_epu8(min_lane, _mm_srli_si128(min_lane, 1));
+        bias = (unsigned char)_mm_cvtsi128_si32(min_lane);
+        syms += rate;
+        dec += num_states / 8;
+
+        tmp = old_metrics;
+        old_metrics = new_metrics;
+        new_metrics = tmp;
+    }
+
+    if (nbits & 1) {
+        memcpy(X, Y, num_states);
+    }
+}
+
+#endif /* LV_HAVE_AVX512BW */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_8u_x4_conv_viterbi_8u_neon(unsigned char* Y,
+                                                   unsigned char* X,
+                                                   const unsigned char* syms,
+                                                   unsigned char* dec,
+                                                   const unsigned char* Branchtab,
+                                                   unsigned int k,
+                                                   unsigned int rate,
+                                                   unsigned int nbits)
+{
+    const unsigned int num_states = 1 << (k - 1);
+    const unsigned int half = num_states / 2;
+    const int shift = volk_8u_x4_conv_viterbi_8u_shift(rate);
+    const int8x16_t shift_vec = vdupq_n_s8(-shift);
+    const uint8x16_t max_metric = vdupq_n_u8(rate * (255 >> shift));
+    unsigned char bias = volk_8u_x4_conv_viterbi_8u_min(X, num_states);
+    unsigned char* old_metrics = X;
+    unsigned char* new_metrics = Y;
+    unsigned char* tmp;
+    uint8x16_t sym[4];
+    uint8x16_t a, b, metric, metric_c, m0, m1, m2, m3, d0, d1;
+    uint8x16_t bias_vec, min_vec;
+    uint8x16x2_t out, decisions;
+    uint8x8_t min_half;
+    unsigned int s, i, j;
+
+    for (s = 0; s < nbits; ++s) {
+        for (j = 0; j < rate; ++j) {
+            sym[j] = vdupq_n_u8(syms[j]);
+        }
+        bias_vec = vdupq_n_u8(bias);
+
+        if (half < 16) {
+            // k = 5, 8 butterflies
+            uint8x8_t a8, b8, metric8, metric_c8, n0, n1, n2, n3, s0, s1;
+            uint8x8x2_t out8, decisions8;
+            a8 = vqsub_u8(vld1_u8(old_metrics), vget_low_u8(bias_vec));
+            b8 = vqsub_u8(vld1_u8(old_metrics + half), vget_low_u8(bias_vec));
+            metric8 = vdup_n_u8(0);
+            for (j = 0; j < rate; ++j) {
+                metric8 = vadd_u8(
+                    metric8,
+                    vshl_u8(veor_u8(vld1_u8(Branchtab + j * half), vget_low_u8(sym[j])),
+                            vget_low_s8(shift_vec)));
+            }
+            metric_c8 = vsub_u8(vget_low_u8(max_metric), metric8);
+
+            n0 = vqadd_u8(a8, metric8);
+            n1 = vqadd_u8(b8, metric_c8);
+            n2 = vqadd_u8(a8, metric_c8);
+            n3 = vqadd_u8(b8, metric8);
+            s0 = vmin_u8(n0, n1);
+            s1 = vmin_u8(n2, n3);
+
+            out8.val[0] = s0;
+            out8.val[1] = s1;
+            vst2_u8(new_metrics, out8);
+            decisions8 = vzip_u8(vceq_u8(s0, n1), vceq_u8(s1, n3));
+            ((uint16_t*)dec)[0] = _vmovemaskq_u8(
+                vcombine_u8(decisions8.val[0], decisions8.val[1]));
+            min_half = vmin_u8(s0, s1);
+        } else {
+            min_vec = vdupq_n_u8(255);
+            for (i = 0; i < half; i += 16) {
+                a = vqsubq_u8(vld1q_u8(old_metrics + i), bias_vec);
+                b = vqsubq_u8(vld1q_u8(old_metrics + half + i), bias_vec);
+                metric = vdupq_n_u8(0);
+                for (j = 0; j < rate; ++j) {
+                    metric = vaddq_u8(
+                        metric,
+                        vshlq_u8(veorq_u8(vld1q_u8(Branchtab + j * half + i), sym[j]),
+                                 shift_vec));
+                }
+                metric_c = vsubq_u8(max_metric, metric);
+
+                m0 = vqaddq_u8(a, metric);
+                m1 = vqaddq_u8(b, metric_c);
+                m2 = vqaddq_u8(a, metric_c);
+                m3 = vqaddq_u8(b, metric);
+                out.val[0] = vminq_u8(m0, m1);
+                out.val[1] = vminq_u8(m2, m3);
+                d0 = vceqq_u8(out.val[0], m1);
+                d1 = vceqq_u8(out.val[1], m3);
+
+                vst2q_u8(new_metrics + 2 * i, out);
+                decisions = vzipq_u8(d0, d1);
+                ((uint16_t*)dec)[i / 8] = _vmovemaskq_u8(decisions.val[0]);
+                ((uint16_t*)dec)[i / 8 + 1] = _vmovemaskq_u8(decisions.val[1]);
+                min_vec = vminq_u8(min_vec, vminq_u8(out.val[0], out.val[1]));
+            }
+            min_half = vmin_u8(vget_low_u8(min_vec), vget_high_u8(min_vec));
+        }
+        min_half = vpmin_u8(min_half, min_half);
+        min_half = vpmin_u8(min_half, min_half);
+        min_half = vpmin_u8(min_half, min_half);
+        bias = vget_lane_u8(min_half, 0);
+        syms += rate;
+        dec += num_states / 8;
+
+        tmp = old_metrics;
+        old_metrics = new_metrics;
+        new_metrics = tmp;
+    }
+
+    if (nbits & 1) {
+        memcpy(X, Y, num_states);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_x4_conv_viterbi_8u_H */
@@ -0,0 +1,169 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8uc_s32f_convert_32fc
+ *
+ * \b Overview
+ *
+ * Converts complex unsigned 8 bit samples with the offset binary coding of
+ * RTL-SDR style front ends into complex floats in one pass:
+ *
+ * outputVector[i] = (inputVector[i] - (127.5 + 127.5j)) / scalar
+ *
+ * A scalar of 127.5 maps the input range onto [-1, 1]. To also remove a DC
+ * offset use volk_8uc_s32fc_s32f_convert_32fc.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8uc_s32f_convert_32fc(lv_32fc_t* outputVector, const lv_8uc_t* inputVector,
+ *                                 const float scalar, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The complex unsigned 8 bit samples.
+ * \li scalar: The value the centered samples are divided by.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex floats.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 16384;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_8uc_t* in = (lv_8uc_t*)volk_malloc(sizeof(lv_8uc_t) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   // read samples into in
+ *
+ *   volk_8uc_s32f_convert_32fc(out, in, 127.5f, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8uc_s32f_convert_32fc_a_H
+#define INCLUDED_volk_8uc_s32f_convert_32fc_a_H
+
+#include <volk/volk_8uc_s32fc_s32f_convert_32fc.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8uc_s32f_convert_32fc_generic(lv_32fc_t* outputVector,
+                                                      const lv_8uc_t* inputVector,
+                                                      const float scalar,
+                                                      unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_generic(
+        outputVector, inputVector, lv_cmake(127.5f, 127.5f), scalar, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_8uc_s32f_convert_32fc_a_sse2(lv_32fc_t* outputVector,
+                                                     const lv_8uc_t* inputVector,
+                                                     const float scalar,
+                                                     unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_a_sse2(
+        outputVector, inputVector, lv_cmake(127.5f, 127.5f), scalar, num_points);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8uc_s32f_convert_32fc_a_avx2(lv_32fc_t* outputVector,
+                                                     const lv_8uc_t* inputVector,
+                                                     const float scalar,
+                                                     unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_a_avx2(
+        outputVector, inputVector, lv_cmake(127.5f, 127.5f), scalar, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_8uc_s32f_convert_32fc_a_avx512f(lv_32fc_t* outputVector,
+                                                        const lv_8uc_t* inputVector,
+                                                        const float scalar,
+                                                        unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_a_avx512f(
+        outputVector, inputVector, lv_cmake(127.5f, 127.5f), scalar, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_8uc_s32f_convert_32fc_a_H */
+
+#ifndef INCLUDED_volk_8uc_s32f_convert_32fc_u_H
+#define INCLUDED_volk_8uc_s32f_convert_32fc_u_H
+
+#include <volk/volk_8uc_s32fc_s32f_convert_32fc.h>
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_8uc_s32f_convert_32fc_u_sse2(lv_32fc_t* outputVector,
+                                                     const lv_8uc_t* inputVector,
+                                                     const float scalar,
+                                                     unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_u_sse2(
+        outputVector, inputVector, lv_cmake(127.5f, 127.5f), scalar, num_points);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8uc_s32f_convert_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                     const lv_8uc_t* inputVector,
+                                                     const float scalar,
+                                                     unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_u_avx2(
+        outputVector, inputVector, lv_cmake(127.5f, 127.5f), scalar, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_8uc_s32f_convert_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                        const lv_8uc_t* inputVector,
+                                                        const float scalar,
+                                                        unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_u_avx512f(
+        outputVector, inputVector, lv_cmake(127.5f, 127.5f), scalar, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_8uc_s32f_convert_32fc_neon(lv_32fc_t* outputVector,
+                                                   const lv_8uc_t* inputVector,
+                                                   const float scalar,
+                                                   unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_neon(
+        outputVector, inputVector, lv_cmake(127.5f, 127.5f), scalar, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8uc_s32f_convert_32fc_u_H */
@@ -0,0 +1,121 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_volk_8uc_s32fc_convertpuppet_32fc_H
+#define INCLUDED_volk_8uc_s32fc_convertpuppet_32fc_H
+
+#include <volk/volk_8uc_s32fc_s32f_convert_32fc.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8uc_s32fc_convertpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                             const lv_8uc_t* inputVector,
+                                                             const lv_32fc_t offset,
+                                                             unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_generic(
+        outputVector, inputVector, offset, 127.5f, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_8uc_s32fc_convertpuppet_32fc_a_sse2(lv_32fc_t* outputVector,
+                                                            const lv_8uc_t* inputVector,
+                                                            const lv_32fc_t offset,
+                                                            unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_a_sse2(
+        outputVector, inputVector, offset, 127.5f, num_points);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_8uc_s32fc_convertpuppet_32fc_u_sse2(lv_32fc_t* outputVector,
+                                                            const lv_8uc_t* inputVector,
+                                                            const lv_32fc_t offset,
+                                                            unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_u_sse2(
+        outputVector, inputVector, offset, 127.5f, num_points);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8uc_s32fc_convertpuppet_32fc_a_avx2(lv_32fc_t* outputVector,
+                                                            const lv_8uc_t* inputVector,
+                                                            const lv_32fc_t offset,
+                                                            unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_a_avx2(
+        outputVector, inputVector, offset, 127.5f, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8uc_s32fc_convertpuppet_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                            const lv_8uc_t* inputVector,
+                                                            const lv_32fc_t offset,
+                                                            unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_u_avx2(
+        outputVector, inputVector, offset, 127.5f, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_8uc_s32fc_convertpuppet_32fc_a_avx512f(lv_32fc_t* outputVector,
+                                            const lv_8uc_t* inputVector,
+                                            const lv_32fc_t offset,
+                                            unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_a_avx512f(
+        outputVector, inputVector, offset, 127.5f, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_8uc_s32fc_convertpuppet_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                            const lv_8uc_t* inputVector,
+                                            const lv_32fc_t offset,
+                                            unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_u_avx512f(
+        outputVector, inputVector, offset, 127.5f, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_8uc_s32fc_convertpuppet_32fc_neon(lv_32fc_t* outputVector,
+                                                          const lv_8uc_t* inputVector,
+                                                          const lv_32fc_t offset,
+                                                          unsigned int num_points)
+{
+    volk_8uc_s32fc_s32f_convert_32fc_neon(
+        outputVector, inputVector, offset, 127.5f, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8uc_s32fc_convertpuppet_32fc_H */
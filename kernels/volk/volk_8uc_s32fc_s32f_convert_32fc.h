@@ -0,0 +1,442 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8uc_s32fc_s32f_convert_32fc
+ *
+ * \b Overview
+ *
+ * Converts complex unsigned 8 bit samples, as delivered by RTL-SDR style front
+ * ends, into complex floats, removing an offset and scaling in one pass:
+ *
+ * outputVector[i] = (inputVector[i] - offset) / scalar
+ *
+ * The offset is given separately for the real and imaginary part, in input
+ * units, so a DC estimate can be folded into the nominal 127.5. For the plain
+ * conversion with an offset of 127.5 use volk_8uc_s32f_convert_32fc.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8uc_s32fc_s32f_convert_32fc(lv_32fc_t* outputVector,
+ *                                       const lv_8uc_t* inputVector,
+ *                                       const lv_32fc_t offset, const float scalar,
+ *                                       unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: The complex unsigned 8 bit samples.
+ * \li offset: The value subtracted from every sample.
+ * \li scalar: The value the differences are divided by.
+ * \li num_points: The number of complex data points.
+ *
+ * \b Outputs
+ * \li outputVector: The complex floats.
+ *
+ * \b Example
+ * Convert a block of samples with a running DC estimate removed.
+ * \code
+ *   unsigned int N = 16384;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_8uc_t* in = (lv_8uc_t*)volk_malloc(sizeof(lv_8uc_t) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t dc = lv_cmake(0.f, 0.f);
+ *
+ *   // read samples into in
+ *
+ *   volk_8uc_s32fc_s32f_convert_32fc(out, in, lv_cmake(127.5f, 127.5f) + dc, 127.5f, N);
+ *
+ *   // update dc from the mean of out, times 127.5
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8uc_s32fc_s32f_convert_32fc_a_H
+#define INCLUDED_volk_8uc_s32fc_s32f_convert_32fc_a_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8uc_s32fc_s32f_convert_32fc_generic(lv_32fc_t* outputVector,
+                                                            const lv_8uc_t* inputVector,
+                                                            const lv_32fc_t offset,
+                                                            const float scalar,
+                                                            unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const float offsetReal = lv_creal(offset);
+    const float offsetImag = lv_cimag(offset);
+    const uint8_t* inputPtr = (const uint8_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+
+    for (unsigned int number = 0; number < num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offsetReal) * iScalar;
+        *outputPtr++ = ((float)(*inputPtr++) - offsetImag) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_8uc_s32fc_s32f_convert_32fc_a_sse2(lv_32fc_t* outputVector,
+                                                           const lv_8uc_t* inputVector,
+                                                           const lv_32fc_t offset,
+                                                           const float scalar,
+                                                           unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const float offsetReal = lv_creal(offset);
+    const float offsetImag = lv_cimag(offset);
+    const uint8_t* inputPtr = (const uint8_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m128 invScalar = _mm_set1_ps(iScalar);
+    const __m128 offsetVal = _mm_setr_ps(offsetReal, offsetImag, offsetReal, offsetImag);
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        const __m128i bytes = _mm_load_si128((const __m128i*)inputPtr);
+        inputPtr += 16;
+        const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+        __m128 values;
+
+        values = _mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero));
+        values = _mm_mul_ps(_mm_sub_ps(values, offsetVal), invScalar);
+        _mm_store_ps(outputPtr, values);
+        values = _mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero));
+        values = _mm_mul_ps(_mm_sub_ps(values, offsetVal), invScalar);
+        _mm_store_ps(outputPtr + 4, values);
+        values = _mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero));
+        values = _mm_mul_ps(_mm_sub_ps(values, offsetVal), invScalar);
+        _mm_store_ps(outputPtr + 8, values);
+        values = _mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero));
+        values = _mm_mul_ps(_mm_sub_ps(values, offsetVal), invScalar);
+        _mm_store_ps(outputPtr + 12, values);
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offsetReal) * iScalar;
+        *outputPtr++ = ((float)(*inputPtr++) - offsetImag) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8uc_s32fc_s32f_convert_32fc_a_avx2(lv_32fc_t* outputVector,
+                                                           const lv_8uc_t* inputVector,
+                                                           const lv_32fc_t offset,
+                                                           const float scalar,
+                                                           unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const float offsetReal = lv_creal(offset);
+    const float offsetImag = lv_cimag(offset);
+    const uint8_t* inputPtr = (const uint8_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m256 invScalar = _mm256_set1_ps(iScalar);
+    const __m256 offsetVal = _mm256_setr_ps(offsetReal,
+                                            offsetImag,
+                                            offsetReal,
+                                            offsetImag,
+                                            offsetReal,
+                                            offsetImag,
+                                            offsetReal,
+                                            offsetImag);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const __m256i bytes = _mm256_load_si256((const __m256i*)inputPtr);
+        inputPtr += 32;
+        const __m128i low = _mm256_castsi256_si128(bytes);
+        const __m128i high = _mm256_extracti128_si256(bytes, 1);
+        __m256 values;
+
+        values = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(low));
+        values = _mm256_mul_ps(_mm256_sub_ps(values, offsetVal), invScalar);
+        _mm256_store_ps(outputPtr, values);
+        values = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+        values = _mm256_mul_ps(_mm256_sub_ps(values, offsetVal), invScalar);
+        _mm256_store_ps(outputPtr + 8, values);
+        values = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(high));
+        values = _mm256_mul_ps(_mm256_sub_ps(values, offsetVal), invScalar);
+        _mm256_store_ps(outputPtr + 16, values);
+        values = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+        values = _mm256_mul_ps(_mm256_sub_ps(values, offsetVal), invScalar);
+        _mm256_store_ps(outputPtr + 24, values);
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offsetReal) * iScalar;
+        *outputPtr++ = ((float)(*inputPtr++) - offsetImag) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_8uc_s32fc_s32f_convert_32fc_a_avx512f(lv_32fc_t* outputVector,
+                                                              const lv_8uc_t* inputVector,
+                                                              const lv_32fc_t offset,
+                                                              const float scalar,
+                                                              unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const float offsetReal = lv_creal(offset);
+    const float offsetImag = lv_cimag(offset);
+    const uint8_t* inputPtr = (const uint8_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 invScalar = _mm512_set1_ps(iScalar);
+    const __m512 offsetVal = _mm512_mask_blend_ps(
+        0xaaaa, _mm512_set1_ps(offsetReal), _mm512_set1_ps(offsetImag));
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        for (int i = 0; i < 2; i++) {
+            const __m128i bytes = _mm_load_si128((const __m128i*)inputPtr);
+            inputPtr += 16;
+            const __m512 values = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(bytes));
+            _mm512_store_ps(outputPtr,
+                            _mm512_mul_ps(_mm512_sub_ps(values, offsetVal), invScalar));
+            outputPtr += 16;
+        }
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offsetReal) * iScalar;
+        *outputPtr++ = ((float)(*inputPtr++) - offsetImag) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_8uc_s32fc_s32f_convert_32fc_a_H */
+
+#ifndef INCLUDED_volk_8uc_s32fc_s32f_convert_32fc_u_H
+#define INCLUDED_volk_8uc_s32fc_s32f_convert_32fc_u_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_8uc_s32fc_s32f_convert_32fc_u_sse2(lv_32fc_t* outputVector,
+                                                           const lv_8uc_t* inputVector,
+                                                           const lv_32fc_t offset,
+                                                           const float scalar,
+                                                           unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const float offsetReal = lv_creal(offset);
+    const float offsetImag = lv_cimag(offset);
+    const uint8_t* inputPtr = (const uint8_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m128 invScalar = _mm_set1_ps(iScalar);
+    const __m128 offsetVal = _mm_setr_ps(offsetReal, offsetImag, offsetReal, offsetImag);
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        const __m128i bytes = _mm_loadu_si128((const __m128i*)inputPtr);
+        inputPtr += 16;
+        const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+        __m128 values;
+
+        values = _mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero));
+        values = _mm_mul_ps(_mm_sub_ps(values, offsetVal), invScalar);
+        _mm_storeu_ps(outputPtr, values);
+        values = _mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero));
+        values = _mm_mul_ps(_mm_sub_ps(values, offsetVal), invScalar);
+        _mm_storeu_ps(outputPtr + 4, values);
+        values = _mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero));
+        values = _mm_mul_ps(_mm_sub_ps(values, offsetVal), invScalar);
+        _mm_storeu_ps(outputPtr + 8, values);
+        values = _mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero));
+        values = _mm_mul_ps(_mm_sub_ps(values, offsetVal), invScalar);
+        _mm_storeu_ps(outputPtr + 12, values);
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offsetReal) * iScalar;
+        *outputPtr++ = ((float)(*inputPtr++) - offsetImag) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8uc_s32fc_s32f_convert_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                           const lv_8uc_t* inputVector,
+                                                           const lv_32fc_t offset,
+                                                           const float scalar,
+                                                           unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const float offsetReal = lv_creal(offset);
+    const float offsetImag = lv_cimag(offset);
+    const uint8_t* inputPtr = (const uint8_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m256 invScalar = _mm256_set1_ps(iScalar);
+    const __m256 offsetVal = _mm256_setr_ps(offsetReal,
+                                            offsetImag,
+                                            offsetReal,
+                                            offsetImag,
+                                            offsetReal,
+                                            offsetImag,
+                                            offsetReal,
+                                            offsetImag);
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        const __m256i bytes = _mm256_loadu_si256((const __m256i*)inputPtr);
+        inputPtr += 32;
+        const __m128i low = _mm256_castsi256_si128(bytes);
+        const __m128i high = _mm256_extracti128_si256(bytes, 1);
+        __m256 values;
+
+        values = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(low));
+        values = _mm256_mul_ps(_mm256_sub_ps(values, offsetVal), invScalar);
+        _mm256_storeu_ps(outputPtr, values);
+        values = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+        values = _mm256_mul_ps(_mm256_sub_ps(values, offsetVal), invScalar);
+        _mm256_storeu_ps(outputPtr + 8, values);
+        values = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(high));
+        values = _mm256_mul_ps(_mm256_sub_ps(values, offsetVal), invScalar);
+        _mm256_storeu_ps(outputPtr + 16, values);
+        values = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+        values = _mm256_mul_ps(_mm256_sub_ps(values, offsetVal), invScalar);
+        _mm256_storeu_ps(outputPtr + 24, values);
+        outputPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offsetReal) * iScalar;
+        *outputPtr++ = ((float)(*inputPtr++) - offsetImag) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_8uc_s32fc_s32f_convert_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                              const lv_8uc_t* inputVector,
+                                                              const lv_32fc_t offset,
+                                                              const float scalar,
+                                                              unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const float offsetReal = lv_creal(offset);
+    const float offsetImag = lv_cimag(offset);
+    const uint8_t* inputPtr = (const uint8_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 invScalar = _mm512_set1_ps(iScalar);
+    const __m512 offsetVal = _mm512_mask_blend_ps(
+        0xaaaa, _mm512_set1_ps(offsetReal), _mm512_set1_ps(offsetImag));
+    unsigned int number = 0;
+
+    for (; number < sixteenthPoints; number++) {
+        for (int i = 0; i < 2; i++) {
+            const __m128i bytes = _mm_loadu_si128((const __m128i*)inputPtr);
+            inputPtr += 16;
+            const __m512 values = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(bytes));
+            _mm512_storeu_ps(outputPtr,
+                            _mm512_mul_ps(_mm512_sub_ps(values, offsetVal), invScalar));
+            outputPtr += 16;
+        }
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offsetReal) * iScalar;
+        *outputPtr++ = ((float)(*inputPtr++) - offsetImag) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8uc_s32fc_s32f_convert_32fc_neon(lv_32fc_t* outputVector,
+                                                         const lv_8uc_t* inputVector,
+                                                         const lv_32fc_t offset,
+                                                         const float scalar,
+                                                         unsigned int num_points)
+{
+    const float iScalar = 1.f / scalar;
+    const float offsetReal = lv_creal(offset);
+    const float offsetImag = lv_cimag(offset);
+    const uint8_t* inputPtr = (const uint8_t*)inputVector;
+    float* outputPtr = (float*)outputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const float32x4_t invScalar = vdupq_n_f32(iScalar);
+    const float offsets[4] = { offsetReal, offsetImag, offsetReal, offsetImag };
+    const float32x4_t offsetVal = vld1q_f32(offsets);
+    unsigned int number = 0;
+
+    for (; number < eighthPoints; number++) {
+        const uint8x16_t bytes = vld1q_u8(inputPtr);
+        inputPtr += 16;
+        const uint16x8_t low = vmovl_u8(vget_low_u8(bytes));
+        const uint16x8_t high = vmovl_u8(vget_high_u8(bytes));
+        float32x4_t values;
+
+        values = vcvtq_f32_u32(vmovl_u16(vget_low_u16(low)));
+        vst1q_f32(outputPtr, vmulq_f32(vsubq_f32(values, offsetVal), invScalar));
+        values = vcvtq_f32_u32(vmovl_u16(vget_high_u16(low)));
+        vst1q_f32(outputPtr + 4, vmulq_f32(vsubq_f32(values, offsetVal), invScalar));
+        values = vcvtq_f32_u32(vmovl_u16(vget_low_u16(high)));
+        vst1q_f32(outputPtr + 8, vmulq_f32(vsubq_f32(values, offsetVal), invScalar));
+        values = vcvtq_f32_u32(vmovl_u16(vget_high_u16(high)));
+        vst1q_f32(outputPtr + 12, vmulq_f32(vsubq_f32(values, offsetVal), invScalar));
+        outputPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        *outputPtr++ = ((float)(*inputPtr++) - offsetReal) * iScalar;
+        *outputPtr++ = ((float)(*inputPtr++) - offsetImag) * iScalar;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8uc_s32fc_s32f_convert_32fc_u_H */
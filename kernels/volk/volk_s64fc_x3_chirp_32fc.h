@@ -0,0 +1,524 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_s64fc_x3_chirp_32fc
+ *
+ * \b Overview
+ *
+ * Generates a linear frequency modulated chirp, a unit magnitude signal with a
+ * quadratic phase. Sample n of the output is
+ *
+ * phase * phase_inc^n * chirp_rate^(n (n - 1) / 2)
+ *
+ * so the frequency starts at phase_inc and is rotated by chirp_rate from one
+ * sample to the next.
+ *
+ * The state is kept in double precision and updated to the sample after the
+ * last one, so consecutive calls continue the same chirp. The SIMD versions run
+ * the phases of their lanes as single precision complex recurrences, two
+ * complex products per vector and no sine or cosine, and re-derive them from
+ * the double precision state every CHIRP_RELOAD samples, like
+ * volk_32fc_s64fc_x2_rotator_32fc does for a fixed frequency. The single
+ * precision rounding error therefore stays within one block.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_s64fc_x3_chirp_32fc(lv_32fc_t* outVector,
+ *                               const lv_64fc_t chirp_rate,
+ *                               lv_64fc_t* phase_inc,
+ *                               lv_64fc_t* phase,
+ *                               unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li chirp_rate: rotation of the frequency per sample, expected to have unit
+ * magnitude.
+ * \li phase_inc: frequency of the first sample, updated to the frequency after
+ * the last one.
+ * \li phase: phase of the first sample, updated to the phase after the last one.
+ * \li num_points: The number of samples to generate.
+ *
+ * \b Outputs
+ * \li outVector: The chirp.
+ *
+ * \b Example
+ * Sweep from -0.25 to 0.25 cycles per sample over 10000 samples.
+ * \code
+ *   int N = 10000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   const double start = -0.5 * M_PI;
+ *   const double rate = M_PI / N;
+ *   const lv_64fc_t chirp_rate = lv_cmake(std::cos(rate), std::sin(rate));
+ *   lv_64fc_t phase_inc = lv_cmake(std::cos(start), std::sin(start));
+ *   lv_64fc_t phase = lv_cmake(1.0, 0.0);
+ *
+ *   volk_s64fc_x3_chirp_32fc(out, chirp_rate, &phase_inc, &phase, N);
+ *
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_s64fc_x3_chirp_32fc_a_H
+#define INCLUDED_volk_s64fc_x3_chirp_32fc_a_H
+
+#include <math.h>
+#include <volk/volk_32fc_s64fc_x2_rotator_32fc.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#define CHIRP_RELOAD 128
+#define CHIRP_RELOAD_4 (CHIRP_RELOAD / 4)
+#define CHIRP_RELOAD_8 (CHIRP_RELOAD / 8)
+
+/*
+ * Double precision lane state of the SIMD versions, which is advanced from one
+ * block of CHIRP_RELOAD samples to the next by products that do not depend on
+ * each other, instead of being derived again from phase_inc.
+ */
+typedef struct {
+    // phase of each lane relative to the phase of the block, and its rate
+    lv_64fc_t offsets[8];
+    lv_64fc_t offset_rates[8];
+    // advances each lane by one vector, and its rate
+    lv_64fc_t steps[8];
+    lv_64fc_t step_rate;
+    // advances the phase by one block, and its rate
+    lv_64fc_t block_step;
+    lv_64fc_t block_step_rate;
+    // advances phase_inc by one block
+    lv_64fc_t block_rate;
+    unsigned int num_lanes;
+} volk_s64fc_x3_chirp_32fc_state_t;
+
+static inline lv_64fc_t volk_s64fc_x3_chirp_32fc_mul(const lv_64fc_t a, const lv_64fc_t b)
+{
+    return lv_cmake(lv_creal(a) * lv_creal(b) - lv_cimag(a) * lv_cimag(b),
+                    lv_creal(a) * lv_cimag(b) + lv_cimag(a) * lv_creal(b));
+}
+
+static inline void volk_s64fc_x3_chirp_32fc_init(volk_s64fc_x3_chirp_32fc_state_t* state,
+                                                 const lv_64fc_t phase_inc,
+                                                 const lv_64fc_t chirp_rate,
+                                                 unsigned int num_lanes)
+{
+    const lv_64fc_t rate_n = volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, num_lanes);
+    const lv_64fc_t block_rate =
+        volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, CHIRP_RELOAD);
+    lv_64fc_t inc = phase_inc;
+    lv_64fc_t offset = lv_cmake(1.0, 0.0);
+    lv_64fc_t offset_rate = lv_cmake(1.0, 0.0);
+    unsigned int i;
+
+    for (i = 0; i < num_lanes; ++i) {
+        state->offsets[i] = offset;
+        state->offset_rates[i] = offset_rate;
+        offset = volk_s64fc_x3_chirp_32fc_mul(offset, inc);
+        inc = volk_s64fc_x3_chirp_32fc_mul(inc, chirp_rate);
+        offset_rate = volk_s64fc_x3_chirp_32fc_mul(offset_rate, block_rate);
+    }
+    // offset is phase_inc^n chirp_rate^(n (n - 1) / 2) for n = num_lanes now
+    for (i = 0; i < num_lanes; ++i) {
+        state->steps[i] = offset;
+        offset = volk_s64fc_x3_chirp_32fc_mul(offset, rate_n);
+    }
+    state->step_rate = volk_32fc_s64fc_x2_rotator_32fc_pow(block_rate, num_lanes);
+    state->block_step = volk_s64fc_x3_chirp_32fc_mul(
+        volk_32fc_s64fc_x2_rotator_32fc_pow(phase_inc, CHIRP_RELOAD),
+        volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate,
+                                            CHIRP_RELOAD * (CHIRP_RELOAD - 1) / 2));
+    state->block_step_rate =
+        volk_32fc_s64fc_x2_rotator_32fc_pow(block_rate, CHIRP_RELOAD);
+    state->block_rate = block_rate;
+    state->num_lanes = num_lanes;
+}
+
+/*
+ * Fills lanes with the single precision phases of the block starting at phase,
+ * and steps with what advances each of them by one vector. Moves the state on
+ * to the next block.
+ */
+static inline void volk_s64fc_x3_chirp_32fc_lanes(volk_s64fc_x3_chirp_32fc_state_t* state,
+                                                  lv_32fc_t* lanes,
+                                                  lv_32fc_t* steps,
+                                                  const lv_64fc_t phase)
+{
+    lv_64fc_t p;
+    unsigned int i;
+
+    for (i = 0; i < state->num_lanes; ++i) {
+        p = volk_s64fc_x3_chirp_32fc_mul(phase, state->offsets[i]);
+        lanes[i] = lv_cmake((float)lv_creal(p), (float)lv_cimag(p));
+        p = state->steps[i];
+        steps[i] = lv_cmake((float)lv_creal(p), (float)lv_cimag(p));
+        state->offsets[i] =
+            volk_s64fc_x3_chirp_32fc_mul(state->offsets[i], state->offset_rates[i]);
+        state->steps[i] = volk_s64fc_x3_chirp_32fc_mul(p, state->step_rate);
+    }
+}
+
+/*
+ * Advances phase and phase_inc by n samples, at most CHIRP_RELOAD.
+ */
+static inline void
+volk_s64fc_x3_chirp_32fc_advance(volk_s64fc_x3_chirp_32fc_state_t* state,
+                                 lv_64fc_t* phase,
+                                 lv_64fc_t* phase_inc,
+                                 const lv_64fc_t chirp_rate,
+                                 unsigned int n)
+{
+    if (n == CHIRP_RELOAD) {
+        volk_32fc_s64fc_x2_rotator_32fc_rotate(phase, state->block_step);
+        volk_32fc_s64fc_x2_rotator_32fc_rotate(phase_inc, state->block_rate);
+        state->block_step =
+            volk_s64fc_x3_chirp_32fc_mul(state->block_step, state->block_step_rate);
+    } else {
+        volk_32fc_s64fc_x2_rotator_32fc_rotate(
+            phase,
+            volk_s64fc_x3_chirp_32fc_mul(
+                volk_32fc_s64fc_x2_rotator_32fc_pow(*phase_inc, n),
+                volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, n * (n - 1) / 2)));
+        volk_32fc_s64fc_x2_rotator_32fc_rotate(
+            phase_inc, volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, n));
+    }
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_s64fc_x3_chirp_32fc_generic(lv_32fc_t* outVector,
+                                                    const lv_64fc_t chirp_rate,
+                                                    lv_64fc_t* phase_inc,
+                                                    lv_64fc_t* phase,
+                                                    unsigned int num_points)
+{
+    unsigned int i, j;
+
+    for (i = 0; i < num_points; i += CHIRP_RELOAD) {
+        const unsigned int block =
+            (num_points - i < CHIRP_RELOAD) ? num_points - i : CHIRP_RELOAD;
+        for (j = 0; j < block; ++j) {
+            *outVector++ = lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+            (*phase) *= (*phase_inc);
+            (*phase_inc) *= chirp_rate;
+        }
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+        (*phase_inc) /= hypot(lv_creal(*phase_inc), lv_cimag(*phase_inc));
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_s64fc_x3_chirp_32fc_a_avx(lv_32fc_t* outVector,
+                                                  const lv_64fc_t chirp_rate,
+                                                  lv_64fc_t* phase_inc,
+                                                  lv_64fc_t* phase,
+                                                  unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    volk_s64fc_x3_chirp_32fc_state_t state;
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_Ptr[4];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t step_Ptr[4];
+    unsigned int i, j;
+
+    volk_s64fc_x3_chirp_32fc_init(&state, *phase_inc, chirp_rate, 4);
+    const lv_64fc_t rate = volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, 4 * 4);
+    const lv_32fc_t rate_f = lv_cmake((float)lv_creal(rate), (float)lv_cimag(rate));
+    const __m256 rate_Val = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)&rate_f));
+    __m256 phase_Val, step_Val;
+
+    const unsigned int quarter_points = num_points / 4;
+    for (i = 0; i < quarter_points; i += CHIRP_RELOAD_4) {
+        const unsigned int block = (quarter_points - i < CHIRP_RELOAD_4)
+                                       ? quarter_points - i
+                                       : CHIRP_RELOAD_4;
+        volk_s64fc_x3_chirp_32fc_lanes(&state, phase_Ptr, step_Ptr, *phase);
+        phase_Val = _mm256_load_ps((float*)phase_Ptr);
+        step_Val = _mm256_load_ps((float*)step_Ptr);
+        for (j = 0; j < block; ++j) {
+            _mm256_store_ps((float*)cPtr, phase_Val);
+
+            phase_Val = _mm256_complexmul_ps(phase_Val, step_Val);
+            step_Val = _mm256_complexmul_ps(step_Val, rate_Val);
+
+            cPtr += 4;
+        }
+        volk_s64fc_x3_chirp_32fc_advance(
+            &state, phase, phase_inc, chirp_rate, 4 * block);
+    }
+
+    // the last samples directly from the 64 bit state
+    for (i = 0; i < num_points % 4; ++i) {
+        *cPtr++ = lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= (*phase_inc);
+        (*phase_inc) *= chirp_rate;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+        (*phase_inc) /= hypot(lv_creal(*phase_inc), lv_cimag(*phase_inc));
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_s64fc_x3_chirp_32fc_a_avx512f(lv_32fc_t* outVector,
+                                                      const lv_64fc_t chirp_rate,
+                                                      lv_64fc_t* phase_inc,
+                                                      lv_64fc_t* phase,
+                                                      unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    volk_s64fc_x3_chirp_32fc_state_t state;
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_Ptr[8];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t step_Ptr[8];
+    unsigned int i, j;
+
+    volk_s64fc_x3_chirp_32fc_init(&state, *phase_inc, chirp_rate, 8);
+    const lv_64fc_t rate = volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, 8 * 8);
+    const lv_32fc_t rate_f = lv_cmake((float)lv_creal(rate), (float)lv_cimag(rate));
+    const __m128 rate_s = _mm_setr_ps(lv_creal(rate_f), lv_cimag(rate_f), 0.f, 0.f);
+    const __m512 rate_Val =
+        _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_castps_pd(rate_s)));
+    __m512 phase_Val, step_Val;
+
+    const unsigned int eighth_points = num_points / 8;
+    for (i = 0; i < eighth_points; i += CHIRP_RELOAD_8) {
+        const unsigned int block = (eighth_points - i < CHIRP_RELOAD_8)
+                                       ? eighth_points - i
+                                       : CHIRP_RELOAD_8;
+        volk_s64fc_x3_chirp_32fc_lanes(&state, phase_Ptr, step_Ptr, *phase);
+        phase_Val = _mm512_load_ps((float*)phase_Ptr);
+        step_Val = _mm512_load_ps((float*)step_Ptr);
+        for (j = 0; j < block; ++j) {
+            _mm512_store_ps((float*)cPtr, phase_Val);
+
+            phase_Val = _mm512_complexmul_ps_avx512f(phase_Val, step_Val);
+            step_Val = _mm512_complexmul_ps_avx512f(step_Val, rate_Val);
+
+            cPtr += 8;
+        }
+        volk_s64fc_x3_chirp_32fc_advance(
+            &state, phase, phase_inc, chirp_rate, 8 * block);
+    }
+
+    // the last samples directly from the 64 bit state
+    for (i = 0; i < num_points % 8; ++i) {
+        *cPtr++ = lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= (*phase_inc);
+        (*phase_inc) *= chirp_rate;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+        (*phase_inc) /= hypot(lv_creal(*phase_inc), lv_cimag(*phase_inc));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_s64fc_x3_chirp_32fc_a_H */
+
+#ifndef INCLUDED_volk_s64fc_x3_chirp_32fc_u_H
+#define INCLUDED_volk_s64fc_x3_chirp_32fc_u_H
+
+#include <math.h>
+#include <volk/volk_32fc_s64fc_x2_rotator_32fc.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_s64fc_x3_chirp_32fc_u_avx(lv_32fc_t* outVector,
+                                                  const lv_64fc_t chirp_rate,
+                                                  lv_64fc_t* phase_inc,
+                                                  lv_64fc_t* phase,
+                                                  unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    volk_s64fc_x3_chirp_32fc_state_t state;
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_Ptr[4];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t step_Ptr[4];
+    unsigned int i, j;
+
+    volk_s64fc_x3_chirp_32fc_init(&state, *phase_inc, chirp_rate, 4);
+    const lv_64fc_t rate = volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, 4 * 4);
+    const lv_32fc_t rate_f = lv_cmake((float)lv_creal(rate), (float)lv_cimag(rate));
+    const __m256 rate_Val = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)&rate_f));
+    __m256 phase_Val, step_Val;
+
+    const unsigned int quarter_points = num_points / 4;
+    for (i = 0; i < quarter_points; i += CHIRP_RELOAD_4) {
+        const unsigned int block = (quarter_points - i < CHIRP_RELOAD_4)
+                                       ? quarter_points - i
+                                       : CHIRP_RELOAD_4;
+        volk_s64fc_x3_chirp_32fc_lanes(&state, phase_Ptr, step_Ptr, *phase);
+        phase_Val = _mm256_loadu_ps((float*)phase_Ptr);
+        step_Val = _mm256_loadu_ps((float*)step_Ptr);
+        for (j = 0; j < block; ++j) {
+            _mm256_storeu_ps((float*)cPtr, phase_Val);
+
+            phase_Val = _mm256_complexmul_ps(phase_Val, step_Val);
+            step_Val = _mm256_complexmul_ps(step_Val, rate_Val);
+
+            cPtr += 4;
+        }
+        volk_s64fc_x3_chirp_32fc_advance(
+            &state, phase, phase_inc, chirp_rate, 4 * block);
+    }
+
+    // the last samples directly from the 64 bit state
+    for (i = 0; i < num_points % 4; ++i) {
+        *cPtr++ = lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= (*phase_inc);
+        (*phase_inc) *= chirp_rate;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+        (*phase_inc) /= hypot(lv_creal(*phase_inc), lv_cimag(*phase_inc));
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_s64fc_x3_chirp_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                      const lv_64fc_t chirp_rate,
+                                                      lv_64fc_t* phase_inc,
+                                                      lv_64fc_t* phase,
+                                                      unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    volk_s64fc_x3_chirp_32fc_state_t state;
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_Ptr[8];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t step_Ptr[8];
+    unsigned int i, j;
+
+    volk_s64fc_x3_chirp_32fc_init(&state, *phase_inc, chirp_rate, 8);
+    const lv_64fc_t rate = volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, 8 * 8);
+    const lv_32fc_t rate_f = lv_cmake((float)lv_creal(rate), (float)lv_cimag(rate));
+    const __m128 rate_s = _mm_setr_ps(lv_creal(rate_f), lv_cimag(rate_f), 0.f, 0.f);
+    const __m512 rate_Val =
+        _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_castps_pd(rate_s)));
+    __m512 phase_Val, step_Val;
+
+    const unsigned int eighth_points = num_points / 8;
+    for (i = 0; i < eighth_points; i += CHIRP_RELOAD_8) {
+        const unsigned int block = (eighth_points - i < CHIRP_RELOAD_8)
+                                       ? eighth_points - i
+                                       : CHIRP_RELOAD_8;
+        volk_s64fc_x3_chirp_32fc_lanes(&state, phase_Ptr, step_Ptr, *phase);
+        phase_Val = _mm512_loadu_ps((float*)phase_Ptr);
+        step_Val = _mm512_loadu_ps((float*)step_Ptr);
+        for (j = 0; j < block; ++j) {
+            _mm512_storeu_ps((float*)cPtr, phase_Val);
+
+            phase_Val = _mm512_complexmul_ps_avx512f(phase_Val, step_Val);
+            step_Val = _mm512_complexmul_ps_avx512f(step_Val, rate_Val);
+
+            cPtr += 8;
+        }
+        volk_s64fc_x3_chirp_32fc_advance(
+            &state, phase, phase_inc, chirp_rate, 8 * block);
+    }
+
+    // the last samples directly from the 64 bit state
+    for (i = 0; i < num_points % 8; ++i) {
+        *cPtr++ = lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= (*phase_inc);
+        (*phase_inc) *= chirp_rate;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+        (*phase_inc) /= hypot(lv_creal(*phase_inc), lv_cimag(*phase_inc));
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_s64fc_x3_chirp_32fc_neon(lv_32fc_t* outVector,
+                                                 const lv_64fc_t chirp_rate,
+                                                 lv_64fc_t* phase_inc,
+                                                 lv_64fc_t* phase,
+                                                 unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    volk_s64fc_x3_chirp_32fc_state_t state;
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t phase_Ptr[4];
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t step_Ptr[4];
+    unsigned int i, j;
+
+    volk_s64fc_x3_chirp_32fc_init(&state, *phase_inc, chirp_rate, 4);
+    const lv_64fc_t rate = volk_32fc_s64fc_x2_rotator_32fc_pow(chirp_rate, 4 * 4);
+    const lv_32fc_t rate_f = lv_cmake((float)lv_creal(rate), (float)lv_cimag(rate));
+    const lv_32fc_t rate_Ptr[4] = { rate_f, rate_f, rate_f, rate_f };
+    const float32x4x2_t rate_vec = vld2q_f32((float*)rate_Ptr);
+    float32x4x2_t phase_vec, step_vec;
+
+    const unsigned int quarter_points = num_points / 4;
+    for (i = 0; i < quarter_points; i += CHIRP_RELOAD_4) {
+        const unsigned int block = (quarter_points - i < CHIRP_RELOAD_4)
+                                       ? quarter_points - i
+                                       : CHIRP_RELOAD_4;
+        volk_s64fc_x3_chirp_32fc_lanes(&state, phase_Ptr, step_Ptr, *phase);
+        phase_vec = vld2q_f32((float*)phase_Ptr);
+        step_vec = vld2q_f32((float*)step_Ptr);
+        for (j = 0; j < block; ++j) {
+            vst2q_f32((float*)cPtr, phase_vec);
+
+            phase_vec = _vmultiply_complexq_f32(phase_vec, step_vec);
+            step_vec = _vmultiply_complexq_f32(step_vec, rate_vec);
+
+            cPtr += 4;
+        }
+        volk_s64fc_x3_chirp_32fc_advance(
+            &state, phase, phase_inc, chirp_rate, 4 * block);
+    }
+
+    // the last samples directly from the 64 bit state
+    for (i = 0; i < num_points % 4; ++i) {
+        *cPtr++ = lv_cmake((float)lv_creal(*phase), (float)lv_cimag(*phase));
+        (*phase) *= (*phase_inc);
+        (*phase_inc) *= chirp_rate;
+    }
+    if (i) {
+        (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+        (*phase_inc) /= hypot(lv_creal(*phase_inc), lv_cimag(*phase_inc));
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_s64fc_x3_chirp_32fc_u_H */
@@ -40,11 +40,22 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
 
     volk_test_params_t test_params_power(test_params);
     test_params_power.set_scalar(2.5);
+    test_params_power.set_tol(1e-6);
 
     volk_test_params_t test_params_rotator(test_params);
     test_params_rotator.set_scalar(std::polar(1.0f, 0.1f));
     test_params_rotator.set_tol(1e-3);
 
+    // the 64 bit phase keeps the single precision rounding error within one
+    // ROTATOR_RELOAD block instead of letting it accumulate over the vector
+    volk_test_params_t test_params_rotator64(test_params_rotator);
+    test_params_rotator64.set_tol(1e-5);
+
+    // the chirp lanes carry a second recurrence for their steps, which is why
+    // they are re-anchored every CHIRP_RELOAD samples
+    volk_test_params_t test_params_chirp(test_params_rotator);
+    test_params_chirp.set_tol(1e-4);
+
     std::vector<volk_test_case_t> test_cases;
     QA(VOLK_INIT_PUPP(volk_64u_popcntpuppet_64u, volk_64u_popcnt, test_params))
     QA(VOLK_INIT_PUPP(volk_16u_byteswappuppet_16u, volk_16u_byteswap, test_params))
@@ -54,8 +65,28 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_PUPP(volk_32fc_s32fc_rotatorpuppet_32fc,
                       volk_32fc_s32fc_x2_rotator_32fc,
                       test_params_rotator))
+    QA(VOLK_INIT_PUPP(volk_32fc_s32fc_rotator64puppet_32fc,
+                      volk_32fc_s64fc_x2_rotator_32fc,
+                      test_params_rotator64))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_s32fc_chirpgenpuppet_32fc, volk_s64fc_x3_chirp_32fc, test_params_chirp))
+    QA(VOLK_INIT_PUPP(volk_32fc_s32fc_chirppuppet_32fc,
+                      volk_32fc_s64fc_x3_chirp_32fc,
+                      test_params_chirp))
+    QA(VOLK_INIT_PUPP(volk_16ic_s32fc_rotatorpuppet_32fc,
+                      volk_16ic_s32f_s32fc_x2_rotator_32fc,
+                      test_params_rotator))
+    QA(VOLK_INIT_PUPP(volk_8ic_s32fc_rotatorpuppet_32fc,
+                      volk_8ic_s32f_s32fc_x2_rotator_32fc,
+                      test_params_rotator))
+    QA(VOLK_INIT_PUPP(volk_32fc_rotator_bankpuppet_32fc,
+                      volk_32fc_rotator_bank_32fc,
+                      test_params_rotator))
     QA(VOLK_INIT_PUPP(
         volk_8u_conv_k7_r2puppet_8u, volk_8u_x4_conv_k7_r2_8u, test_params.make_tol(0)))
+    QA(VOLK_INIT_PUPP(volk_8u_conv_viterbipuppet_8u,
+                      volk_8u_x4_conv_viterbi_8u,
+                      test_params.make_tol(0)))
     QA(VOLK_INIT_PUPP(
         volk_32f_x2_fm_detectpuppet_32f, volk_32f_s32f_32f_fm_detect_32f, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_s32f_deinterleave_real_32f, test_params))
@@ -66,6 +97,19 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_16ic_magnitude_16i, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_s32f_magnitude_32f, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_convert_32fc, test_params))
+    QA(VOLK_INIT_TEST(volk_16ic_s32f_convert_be_32fc, test_params))
+    QA(VOLK_INIT_TEST(volk_16ic_pack_sc4_8u, test_params))
+    QA(VOLK_INIT_PUPP(volk_16ic_pack_sc12puppet_8u, volk_16ic_pack_sc12_8u, test_params))
+    QA(VOLK_INIT_TEST(volk_8u_unpack_sc4_16ic, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_unpack_sc12puppet_16ic, volk_8u_unpack_sc12_16ic, test_params))
+    QA(VOLK_INIT_TEST(volk_8u_s32f_unpack_sc4_32fc, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_s32f_unpack_sc12puppet_32fc,
+                      volk_8u_s32f_unpack_sc12_32fc,
+                      test_params))
+    QA(VOLK_INIT_TEST(volk_16f_convert_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_16fc_convert_32fc, test_params))
+    QA(VOLK_INIT_TEST(volk_16bf_convert_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_16f_x2_dot_prod_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_16ic_x2_multiply_16ic, test_params))
     QA(VOLK_INIT_TEST(volk_16ic_x2_dot_prod_16ic, test_params))
     QA(VOLK_INIT_TEST(volk_16i_s32f_convert_32f, test_params))
@@ -75,11 +119,17 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_32f_x2_add_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_index_max_16u, test_params))
     QA(VOLK_INIT_TEST(volk_32f_index_max_32u, test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_index_maxpuppet_64u, volk_32f_index_max_64u, test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_index_max_and_valuepuppet_64u_32f,
+                      volk_32f_index_max_and_value_64u_32f,
+                      test_params))
     QA(VOLK_INIT_TEST(volk_32f_index_min_16u, test_params))
     QA(VOLK_INIT_TEST(volk_32f_index_min_32u, test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_index_minpuppet_64u, volk_32f_index_min_64u, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_32f_multiply_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_32f_add_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_32f_log2_32f, test_params.make_absolute(1e-5)))
+    QA(VOLK_INIT_TEST(volk_32f_exp_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_expfast_32f, test_params_inacc_tenth))
     QA(VOLK_INIT_TEST(volk_32f_x2_pow_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_sin_32f, test_params_inacc))
@@ -91,6 +141,7 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_32fc_s32f_power_32fc, test_params_power))
     QA(VOLK_INIT_TEST(volk_32f_s32f_calc_spectral_noise_floor_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32fc_s32f_atan2_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_32fc_x2_s32f_phase_diff_32f, test_params.make_absolute(1e-2)))
     QA(VOLK_INIT_TEST(volk_32fc_x2_conjugate_dot_prod_32fc, test_params_inacc_tenth))
     QA(VOLK_INIT_TEST(volk_32fc_deinterleave_32f_x2, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_accumulator_s32fc, test_params.make_tol(1e-3)))
@@ -103,8 +154,12 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_32fc_32f_dot_prod_32fc, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32fc_index_max_16u, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_index_max_32u, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_index_maxpuppet_64u, volk_32fc_index_max_64u, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_index_min_16u, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_index_min_32u, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_index_minpuppet_64u, volk_32fc_index_min_64u, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_s32f_magnitude_16i, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_magnitude_32f, test_params_inacc_tenth))
     QA(VOLK_INIT_TEST(volk_32fc_magnitude_squared_32f, test_params))
@@ -116,8 +171,14 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_32f_s32f_convert_16i, test_params))
     QA(VOLK_INIT_TEST(volk_32f_s32f_convert_32i, test_params))
     QA(VOLK_INIT_TEST(volk_32f_convert_64f, test_params))
+    QA(VOLK_INIT_TEST(volk_32f_convert_16f, test_params))
+    QA(VOLK_INIT_TEST(volk_32f_convert_16bf, test_params))
+    QA(VOLK_INIT_TEST(volk_32f_16f_x2_multiply_add_32f, test_params.make_absolute(1e-6)))
     QA(VOLK_INIT_TEST(volk_32f_s32f_convert_8i, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_convert_16ic, test_params))
+    QA(VOLK_INIT_TEST(volk_32fc_s32f_convert_be_16ic, test_params))
+    QA(VOLK_INIT_TEST(volk_32fc_convert_16fc, test_params))
+    QA(VOLK_INIT_TEST(volk_32fc_16f_dot_prod_32fc, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32fc_s32f_power_spectrum_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_x2_square_dist_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32fc_x2_s32f_square_dist_scalar_mult_32f, test_params))
@@ -155,6 +216,10 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_8ic_x2_s32f_multiply_conjugate_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_8i_convert_16i, test_params))
     QA(VOLK_INIT_TEST(volk_8i_s32f_convert_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_8uc_s32f_convert_32fc, test_params))
+    QA(VOLK_INIT_PUPP(volk_8uc_s32fc_convertpuppet_32fc,
+                      volk_8uc_s32fc_s32f_convert_32fc,
+                      test_params))
     QA(VOLK_INIT_TEST(volk_32fc_s32fc_multiply_32fc, test_params))
     QA(VOLK_INIT_TEST(volk_32f_s32f_multiply_32f, test_params))
     QA(VOLK_INIT_TEST(volk_32f_s32f_add_32f, test_params))
@@ -173,6 +238,67 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_PUPP(volk_32fc_s32f_power_spectral_densitypuppet_32f,
                       volk_32fc_s32f_x2_power_spectral_density_32f,
                       test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_x2_dot_prod_batchpuppet_32f,
+                      volk_32f_x2_dot_prod_batch_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_dot_prod_batchpuppet_32fc,
+                      volk_32fc_x2_dot_prod_batch_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_dot_prod_batchpuppet_32fc,
+                      volk_32fc_32f_dot_prod_batch_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_multiply_batchpuppet_32fc,
+                      volk_32fc_x2_multiply_batch_32fc,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_x2_add_stridedpuppet_32f,
+                      volk_32f_x2_add_strided_32f,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_x2_multiply_stridedpuppet_32f,
+                      volk_32f_x2_multiply_strided_32f,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_multiply_stridedpuppet_32fc,
+                      volk_32fc_x2_multiply_strided_32fc,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_multiply_conjugate_stridedpuppet_32fc,
+                      volk_32fc_x2_multiply_conjugate_strided_32fc,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_magnitude_stridedpuppet_32f,
+                      volk_32fc_magnitude_strided_32f,
+                      test_params_inacc_tenth))
+    QA(VOLK_INIT_PUPP(volk_32f_x2_dot_prod_stridedpuppet_32f,
+                      volk_32f_x2_dot_prod_strided_32f,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_dot_prod_stridedpuppet_32fc,
+                      volk_32fc_x2_dot_prod_strided_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_16ic_convert_stridedpuppet_32fc,
+                      volk_16ic_convert_strided_32fc,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_16i_s32f_convert_stridedpuppet_32f,
+                      volk_16i_s32f_convert_strided_32f,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_x2_fir_decimpuppet_32f,
+                      volk_32f_x2_fir_decim_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_fir_decimpuppet_32fc,
+                      volk_32fc_32f_fir_decim_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_fir_decimpuppet_32fc,
+                      volk_32fc_x2_fir_decim_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32f_x2_polyphase_resamplepuppet_32f,
+                      volk_32f_x2_polyphase_resample_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_polyphase_resamplepuppet_32fc,
+                      volk_32fc_32f_polyphase_resample_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_fftpuppet_32fc, volk_32fc_x2_fft_32fc, test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_windowed_psdpuppet_32f,
+                      volk_32fc_32f_windowed_psd_32f,
+                      test_params.make_absolute(1e-2)))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_index_topkpuppet_32u, volk_32f_index_topk_32u, test_params))
     // no one uses these, so don't test them
     // VOLK_PROFILE(volk_16i_x5_add_quad_16i_x4, 1e-4, 2046, 10000, &results,
     // benchmark_mode, kernel_regex); VOLK_PROFILE(volk_16i_branch_4_state_8, 1e-4, 2046,
@@ -0,0 +1,40 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef VOLK_QA_CPP_H
+#define VOLK_QA_CPP_H
+
+#include <iostream> // for operator<<, cerr, endl
+
+/************************************************
+ * QA of the C++ and library helpers around the *
+ * kernels, run by volk_test_cpp <name>         *
+ ************************************************/
+struct volk_cpp_test_case_t {
+    const char* name;
+    bool (*run)();
+};
+
+// Fails the enclosing test, which returns bool, when cond does not hold
+#define VOLK_QA_CHECK(cond)                                                     \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond \
+                      << std::endl;                                             \
+            return false;                                                       \
+        }                                                                       \
+    } while (0)
+
+bool qa_volk_alloc();
+bool qa_volk_hh();
+bool qa_volk_expr();
+bool qa_volk_parallel();
+bool qa_volk_async();
+
+#endif // VOLK_QA_CPP_H
@@ -10,8 +10,9 @@
 #include "qa_utils.h"
 #include <volk/volk.h>
 
-#include <volk/volk.h>        // for volk_func_desc_t
-#include <volk/volk_malloc.h> // for volk_free, volk_m...
+#include <volk/volk.h>         // for volk_func_desc_t
+#include <volk/volk_float16.h> // for volk_32f_to_16f, volk_16f_to_32f, ...
+#include <volk/volk_malloc.h>  // for volk_free, volk_m...
 
 #include <assert.h>    // for assert
 #include <stdint.h>    // for uint16_t, uint64_t
@@ -47,6 +48,13 @@ void load_random_data(void* data, volk_type_t type, unsigned int n)
     if (type.is_float) {
         if (type.size == 8) {
             random_floats<double>(data, n, rnd_engine);
+        } else if (type.size == 2) {
+            std::vector<float> values(n);
+            random_floats<float>(values.data(), n, rnd_engine);
+            for (unsigned int i = 0; i < n; i++) {
+                ((uint16_t*)data)[i] = type.is_bfloat ? volk_32f_to_16bf(values[i])
+                                                      : volk_32f_to_16f(values[i]);
+            }
         } else {
             random_floats<float>(data, n, rnd_engine);
         }
@@ -124,6 +132,7 @@ volk_type_t volk_type_from_string(std::string name)
 {
     volk_type_t type;
     type.is_float = false;
+    type.is_bfloat = false;
     type.is_scalar = false;
     type.is_complex = false;
     type.is_signed = false;
@@ -165,6 +174,9 @@ volk_type_t volk_type_from_string(std::string name)
         case 'u':
             type.is_signed = false;
             break;
+        case 'b':
+            type.is_bfloat = true;
+            break;
         default:
             throw std::string("Error: no such type: '") + name[i] + "'";
         }
@@ -401,10 +413,6 @@ bool fcompare(t* in1, t* in2, unsigned int vlen, float tol, bool absolute_mode)
 template <class t>
 bool ccompare(t* in1, t* in2, unsigned int vlen, float tol, bool absolute_mode)
 {
-    if (absolute_mode) {
-        std::cout << "ccompare does not support absolute mode" << std::endl;
-        return true;
-    }
     bool fail = false;
     int print_max_errs = 10;
     for (unsigned int i = 0; i < 2 * vlen; i += 2) {
@@ -423,9 +431,9 @@ bool ccompare(t* in1, t* in2, unsigned int vlen, float tol, bool absolute_mode)
         t err = std::sqrt(diff[0] * diff[0] + diff[1] * diff[1]);
         t norm = std::sqrt(in1[i] * in1[i] + in1[i + 1] * in1[i + 1]);
 
-        // for very small numbers we'll see round off errors due to limited
-        // precision. So a special test case...
-        if (norm < 1e-30) {
+        // in absolute mode, and for very small numbers where we'll see round off
+        // errors due to limited precision, the magnitude of the error is tested
+        if (absolute_mode || norm < 1e-30) {
             if (err > tol) {
                 fail = true;
                 if (print_max_errs-- > 0) {
@@ -451,6 +459,17 @@ bool ccompare(t* in1, t* in2, unsigned int vlen, float tol, bool absolute_mode)
     return fail;
 }
 
+// 16 bit floats are compared as the 32 bit floats they stand for
+static std::vector<float> widen_16f(const void* in, unsigned int n, bool is_bfloat)
+{
+    std::vector<float> out(n);
+    for (unsigned int i = 0; i < n; i++) {
+        const uint16_t h = ((const uint16_t*)in)[i];
+        out[i] = is_bfloat ? volk_16bf_to_32f(h) : volk_16f_to_32f(h);
+    }
+    return out;
+}
+
 template <class t>
 bool icompare(t* in1, t* in2, unsigned int vlen, unsigned int tol, bool absolute_mode)
 {
@@ -731,7 +750,20 @@ bool run_volk_tests(volk_func_desc_t desc,
         fail = false;
         if (i != generic_offset) {
             for (size_t j = 0; j < both_sigs.size(); j++) {
-                if (both_sigs[j].is_float) {
+                if (both_sigs[j].is_float && both_sigs[j].size == 2) {
+                    const unsigned int n = vlen * (both_sigs[j].is_complex ? 2 : 1);
+                    std::vector<float> in1 = widen_16f(
+                        test_data[generic_offset][j], n, both_sigs[j].is_bfloat);
+                    std::vector<float> in2 =
+                        widen_16f(test_data[i][j], n, both_sigs[j].is_bfloat);
+                    if (both_sigs[j].is_complex) {
+                        fail = ccompare(
+                            in1.data(), in2.data(), vlen, tol_f, absolute_mode);
+                    } else {
+                        fail = fcompare(
+                            in1.data(), in2.data(), vlen, tol_f, absolute_mode);
+                    }
+                } else if (both_sigs[j].is_float) {
                     if (both_sigs[j].size == 8) {
                         if (both_sigs[j].is_complex) {
                             fail = ccompare((double*)test_data[generic_offset][j],
@@ -24,6 +24,7 @@
  ************************************************/
 struct volk_type_t {
     bool is_float;
+    bool is_bfloat; // 16 bit floats: bfloat16 instead of IEEE binary16
     bool is_scalar;
     bool is_signed;
     bool is_complex;
@@ -0,0 +1,88 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <cstddef>   // for size_t
+#include <limits>    // for numeric_limits
+#include <stdexcept> // for length_error
+
+#include "qa_cpp.h"            // for VOLK_QA_CHECK
+#include "volk/volk_complex.h" // for lv_16sc_t, lv_32fc_t
+#include <volk/volk.h>
+#include <volk/volk_alloc.hh>
+
+bool qa_volk_alloc()
+{
+    const size_t alignment = volk_get_alignment();
+
+    // the padded count is the same for every element type
+    for (size_t n : { size_t(0), size_t(1), alignment - 1, alignment, alignment + 1 }) {
+        volk::buffer<char> b8(n);
+        volk::buffer<lv_16sc_t> b16(n);
+        volk::buffer<lv_32fc_t> b32(n);
+        volk::buffer<lv_64fc_t> b64(n);
+        VOLK_QA_CHECK(b8.padded_size() == b64.padded_size());
+        VOLK_QA_CHECK(b16.padded_size() == b32.padded_size());
+        VOLK_QA_CHECK(b8.padded_size() == b32.padded_size());
+        VOLK_QA_CHECK(b32.padded_size() % alignment == 0);
+        VOLK_QA_CHECK(b32.padded_size() >= n && b32.padded_size() < n + alignment);
+        VOLK_QA_CHECK(b16.capacity() >= b16.padded_size());
+        VOLK_QA_CHECK(b64.capacity() >= b64.padded_size());
+    }
+
+    // a conversion from a smaller to a larger element type over the padded count
+    volk::buffer<lv_16sc_t> in(1, lv_16sc_t(3, -4));
+    volk::buffer<lv_32fc_t> out(1);
+    volk_16ic_convert_32fc(out.data(), in.data(), in.padded_size());
+    VOLK_QA_CHECK(out[0] == lv_32fc_t(3.f, -4.f));
+    for (size_t i = 1; i < out.padded_size(); i++)
+        VOLK_QA_CHECK(out[i] == lv_32fc_t(0.f, 0.f));
+
+    // growing keeps the contents and zeroes the padding
+    volk::buffer<float> b(3, 1.f);
+    b[2] = 2.f;
+    b.resize(5, 7.f);
+    VOLK_QA_CHECK(b.size() == 5);
+    VOLK_QA_CHECK(b[0] == 1.f && b[2] == 2.f && b[3] == 7.f && b[4] == 7.f);
+    for (size_t i = b.size(); i < b.padded_size(); i++)
+        VOLK_QA_CHECK(b[i] == 0.f);
+    b[b.size()] = 5.f;
+    b.resize(4);
+    for (size_t i = b.size(); i < b.padded_size(); i++)
+        VOLK_QA_CHECK(b[i] == 0.f);
+
+    // growing one element at a time reallocates O(log n) times
+    volk::buffer<float> grown;
+    unsigned int reallocations = 0;
+    for (size_t n = 1; n <= 1 << 16; n++) {
+        const float* before = grown.data();
+        grown.resize(n);
+        reallocations += grown.data() != before;
+    }
+    VOLK_QA_CHECK(reallocations <= 17);
+    VOLK_QA_CHECK(grown.capacity() >= grown.padded_size());
+
+    // copies are deep, moves take the storage
+    volk::buffer<float> copy(b);
+    VOLK_QA_CHECK(copy.size() == b.size() && copy.data() != b.data());
+    VOLK_QA_CHECK(copy[2] == 2.f);
+    const float* storage = copy.data();
+    volk::buffer<float> moved(std::move(copy));
+    VOLK_QA_CHECK(moved.data() == storage && copy.empty());
+
+    // sizes whose padding would wrap around are refused
+    bool refused = false;
+    try {
+        moved.resize(std::numeric_limits<size_t>::max() - 1);
+    } catch (const std::length_error&) {
+        refused = true;
+    }
+    VOLK_QA_CHECK(refused && moved.size() == 4);
+
+    return true;
+}
@@ -0,0 +1,185 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <atomic>    // for atomic
+#include <chrono>    // for steady_clock, seconds
+#include <exception> // for terminate
+#include <thread>    // for this_thread, thread
+#include <vector>    // for vector
+
+#include "qa_cpp.h" // for VOLK_QA_CHECK
+#include <volk/volk_async.hh>
+
+namespace {
+
+// spins until pred() holds; false after a few seconds, so a broken scheduler
+// fails the test instead of hanging it
+template <class Pred>
+bool spin_until(Pred pred)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+#ifdef VOLK_ASYNC_COROUTINES
+struct detached {
+    struct promise_type {
+        detached get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+detached await_task(const volk::async::task& t, std::atomic<int>& resumed)
+{
+    co_await t;
+    resumed++;
+}
+#endif
+
+// order in which completion callbacks ran
+struct callback_log {
+    int order[4];
+    std::atomic<int> count;
+};
+
+template <int ID>
+void log_callback(void* p)
+{
+    callback_log* log = static_cast<callback_log*>(p);
+    log->order[log->count.load()] = ID;
+    log->count++;
+}
+
+} // namespace
+
+bool qa_volk_async()
+{
+    using namespace volk::async;
+
+    VOLK_QA_CHECK(volk_async_set_num_workers(4) == 0);
+    VOLK_QA_CHECK(volk_async_get_num_workers() == 4);
+
+    // graph: a reader waits for the writer before it, a writer for the reader
+    {
+        std::vector<float> v(1000, 0.f), w(1000, 0.f);
+        submit(
+            [&] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                for (auto& x : v)
+                    x = 1.f;
+            },
+            { writes(v) });
+        submit(
+            [&] {
+                for (size_t i = 0; i < v.size(); i++)
+                    w[i] = 2.f * v[i];
+            },
+            { reads(v), writes(w) });
+        task last = submit(
+            [&] {
+                for (auto& x : v)
+                    x = 5.f;
+            },
+            { writes(v) });
+        last.wait();
+        VOLK_QA_CHECK(last.ready());
+        wait_all();
+        for (size_t i = 0; i < v.size(); i++)
+            VOLK_QA_CHECK(v[i] == 5.f && w[i] == 2.f);
+    }
+
+    // tasks without conflicts run at the same time
+    {
+        std::atomic<int> running(0);
+        std::atomic<bool> all_met(true);
+        std::vector<std::vector<float>> bufs(4, std::vector<float>(16));
+        for (auto& b : bufs)
+            submit(
+                [&] {
+                    running++;
+                    if (!spin_until([&] { return running.load() == 4; }))
+                        all_met = false;
+                },
+                { writes(b) });
+        wait_all();
+        VOLK_QA_CHECK(all_met);
+    }
+
+    // work stealing: tasks a task submits go to its worker's deque; while it
+    // is busy other workers have to steal them. The main thread only polls,
+    // so that the parent is not run by a helping volk_async_wait().
+    {
+        std::atomic<int> done(0);
+        std::atomic<bool> stolen(true);
+        std::atomic<int> resize_result(0);
+        task parent = submit([&] {
+            const std::thread::id self = std::this_thread::get_id();
+            std::vector<task> children;
+            for (int i = 0; i < 3; i++)
+                children.push_back(submit([&, self] {
+                    if (std::this_thread::get_id() == self)
+                        stolen = false;
+                    done++;
+                }));
+            if (!spin_until([&] { return done.load() == 3; }))
+                stolen = false;
+            // resizing the pool from a task is refused instead of deadlocking
+            resize_result = volk_async_set_num_workers(2);
+        });
+        VOLK_QA_CHECK(spin_until([&] { return parent.ready(); }));
+        VOLK_QA_CHECK(stolen);
+        VOLK_QA_CHECK(resize_result == -1);
+        VOLK_QA_CHECK(volk_async_get_num_workers() == 4);
+    }
+
+    // several continuations per task, run in registration order
+    {
+        std::atomic<bool> gate(false);
+        callback_log log;
+        log.count = 0;
+        task t = submit([&] { spin_until([&] { return gate.load(); }); });
+        VOLK_QA_CHECK(volk_async_then(t.get(), log_callback<1>, &log));
+        VOLK_QA_CHECK(volk_async_then(t.get(), log_callback<2>, &log));
+        VOLK_QA_CHECK(volk_async_then(t.get(), log_callback<3>, &log));
+        gate = true;
+        t.wait();
+        VOLK_QA_CHECK(spin_until([&] { return log.count.load() == 3; }));
+        VOLK_QA_CHECK(log.order[0] == 1 && log.order[1] == 2 && log.order[2] == 3);
+        VOLK_QA_CHECK(volk_async_then(t.get(), log_callback<4>, &log) == 0);
+    }
+
+#ifdef VOLK_ASYNC_COROUTINES
+    // two coroutines awaiting the same task both resume
+    {
+        std::atomic<bool> gate(false);
+        std::atomic<int> resumed(0);
+        task t = submit([&] { spin_until([&] { return gate.load(); }); });
+        await_task(t, resumed);
+        await_task(t, resumed);
+        VOLK_QA_CHECK(resumed == 0);
+        gate = true;
+        VOLK_QA_CHECK(spin_until([&] { return resumed.load() == 2; }));
+        // awaiting a completed task does not suspend
+        await_task(t, resumed);
+        VOLK_QA_CHECK(resumed == 3);
+    }
+#endif
+
+    wait_all();
+    VOLK_QA_CHECK(volk_async_set_num_workers(0) == 0);
+    return true;
+}
@@ -0,0 +1,85 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+// keep the assertions of the expression nodes active in release builds
+#undef NDEBUG
+
+#include <cmath>   // for fabs
+#include <cstddef> // for size_t
+#include <vector>  // for vector
+
+#include "qa_cpp.h"            // for VOLK_QA_CHECK
+#include "volk/volk_complex.h" // for lv_32fc_t
+#include <volk/volk_expr.hh>
+
+bool qa_volk_expr()
+{
+    using namespace volk::expr;
+
+    // two full tiles and a partial one
+    const size_t N = 2 * default_tile_points + 17;
+
+    volk::vector<lv_32fc_t> a(N), b(N), c(N);
+    volk::vector<float> f(N), g(N);
+    std::vector<double> x(N), y(N);
+    for (size_t i = 0; i < N; i++) {
+        a[i] = lv_32fc_t(float(i % 13) - 6.f, float(i % 5));
+        b[i] = lv_32fc_t(0.5f, -float(i % 3));
+        c[i] = lv_32fc_t(float(i % 7), 1.f);
+        f[i] = float(i % 11) - 5.f;
+        g[i] = 0.5f * float(i % 6);
+        x[i] = double(i % 9) - 4.0;
+        y[i] = 0.25 * double(i % 4);
+    }
+
+    // every point, including the tail tile, gets the same result as unfused code
+    volk::vector<float> out(N);
+    assign(out, magnitude_squared(lazy(a) * lazy(b) + lazy(c)));
+    for (size_t i = 0; i < N; i++)
+        VOLK_QA_CHECK(std::fabs(out[i] - std::norm(a[i] * b[i] + c[i])) <=
+                      1e-5f * std::norm(a[i] * b[i] + c[i]) + 1e-5f);
+
+    // tiles that do not divide the length
+    const auto e = lazy(f) * 2.f - lazy(g);
+    volk::vector<float> z(N);
+    assign(z, e, 7);
+    for (size_t i = 0; i < N; i++)
+        VOLK_QA_CHECK(z[i] == f[i] * 2.f - g[i]);
+
+    // the destination may be one of the operands
+    volk::vector<lv_32fc_t> d(a);
+    assign(d, lazy(d) * lazy(b) + lazy(d));
+    for (size_t i = 0; i < N; i++)
+        VOLK_QA_CHECK(std::abs(d[i] - (a[i] * b[i] + a[i])) <= 1e-5f * std::abs(a[i]));
+    volk::vector<lv_32fc_t> d2(a);
+    assign(d2, lazy(d2));
+    for (size_t i = 0; i < N; i++)
+        VOLK_QA_CHECK(d2[i] == a[i]);
+
+    // sum() with the float and complex accumulators and with the plain loop
+    const float energy = sum(magnitude_squared(lazy(a)));
+    double expected = 0.0;
+    for (size_t i = 0; i < N; i++)
+        expected += std::norm(a[i]);
+    VOLK_QA_CHECK(std::fabs(energy - expected) <= 1e-5 * expected);
+
+    const lv_32fc_t total = sum(lazy(a) * lazy(b), 100);
+    lv_32fc_t expected_c = 0.f;
+    for (size_t i = 0; i < N; i++)
+        expected_c += a[i] * b[i];
+    VOLK_QA_CHECK(std::abs(total - expected_c) <= 1e-4f * std::abs(expected_c));
+
+    const double dot = sum(lazy(x) * lazy(y));
+    double expected_d = 0.0;
+    for (size_t i = 0; i < N; i++)
+        expected_d += x[i] * y[i];
+    VOLK_QA_CHECK(dot == expected_d);
+
+    return true;
+}
@@ -0,0 +1,111 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+// keep the size checks of the overloads active in release builds
+#undef NDEBUG
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint8_t, uint32_t, uint64_t, int16_t
+#include <vector>  // for vector
+
+#include "qa_cpp.h"            // for VOLK_QA_CHECK
+#include "volk/volk_complex.h" // for lv_16sc_t, lv_32fc_t
+#include <volk/volk.hh>
+
+bool qa_volk_hh()
+{
+    const size_t N = 37;
+
+    volk::vector<lv_32fc_t> a(N), b(N);
+    std::vector<float> x(N);
+    for (size_t i = 0; i < N; i++) {
+        a[i] = lv_32fc_t(float(i), 1.f);
+        b[i] = lv_32fc_t(1.f, -float(i % 5));
+        x[i] = float((i * 7) % 11) - 5.f;
+    }
+
+    // the number of points comes from the inputs, a longer output is left alone
+    volk::vector<lv_32fc_t> c(N + 3, lv_32fc_t(-1.f, -1.f));
+    volk::multiply(c, a, b);
+    for (size_t i = 0; i < N; i++)
+        VOLK_QA_CHECK(c[i] == a[i] * b[i]);
+    for (size_t i = N; i < c.size(); i++)
+        VOLK_QA_CHECK(c[i] == lv_32fc_t(-1.f, -1.f));
+
+    // reductions write through a reference
+    float acc = 0.f;
+    volk::accumulator(acc, x);
+    float expected = 0.f;
+    for (float v : x)
+        expected += v;
+    VOLK_QA_CHECK(acc == expected);
+
+    uint32_t index = N;
+    volk::index_max(index, x);
+    for (size_t i = 0; i < N; i++)
+        VOLK_QA_CHECK(x[i] <= x[index]);
+
+    uint64_t max_index = N;
+    float max_value = 0.f;
+    volk::index_max_and_value(max_index, max_value, x);
+    VOLK_QA_CHECK(max_index < N && max_value == x[max_index] && max_value == x[index]);
+
+    // index_topk fills k entries, not num_points
+    uint32_t top[3];
+    volk::index_topk(top, x, 3, 0);
+    VOLK_QA_CHECK(top[0] == index);
+    VOLK_QA_CHECK(x[top[0]] >= x[top[1]] && x[top[1]] >= x[top[2]]);
+    for (size_t i = 0; i < N; i++)
+        if (i != top[0] && i != top[1] && i != top[2])
+            VOLK_QA_CHECK(x[i] <= x[top[2]]);
+
+    const lv_32fc_t d = volk::dot(a, b);
+    lv_32fc_t expected_d = 0.f;
+    for (size_t i = 0; i < N; i++)
+        expected_d += a[i] * b[i];
+    VOLK_QA_CHECK(std::abs(d - expected_d) <= 1e-4f * std::abs(expected_d));
+
+    // scalars by value, state by reference
+    const auto s = volk::convert<int16_t>(x, 2.f);
+    VOLK_QA_CHECK(s.size() == N);
+    for (size_t i = 0; i < N; i++)
+        VOLK_QA_CHECK(s[i] == int16_t(2.f * x[i]));
+
+    volk::vector<lv_32fc_t> r(N);
+    lv_32fc_t phase(1.f, 0.f);
+    volk::rotator(r, a, lv_32fc_t(0.f, 1.f), phase);
+    VOLK_QA_CHECK(std::abs(r[1] - a[1] * lv_32fc_t(0.f, 1.f)) < 1e-5f);
+    VOLK_QA_CHECK(std::abs(phase - lv_32fc_t(0.f, 1.f)) < 1e-3f);
+
+    // square_dist measures one point against num_points others
+    const lv_32fc_t point(2.f, 1.f);
+    std::vector<float> dist(N);
+    volk::square_dist(dist, volk::span<const lv_32fc_t>(&point, 1), a);
+    for (size_t i = 0; i < N; i++)
+        VOLK_QA_CHECK(dist[i] == std::norm(point - a[i]));
+
+    // packed formats: num_points counts samples, not bytes
+    volk::vector<lv_16sc_t> samples(N), unpacked(N);
+    for (size_t i = 0; i < N; i++)
+        samples[i] = lv_16sc_t(int16_t(i % 8) - 4, 3 - int16_t(i % 7));
+    std::vector<uint8_t> packed(N);
+    volk::pack_sc4(packed, samples);
+    volk::unpack_sc4(unpacked, packed);
+    for (size_t i = 0; i < N; i++)
+        VOLK_QA_CHECK(unpacked[i] == samples[i]);
+
+    std::vector<uint8_t> packed12(3 * N);
+    volk::vector<lv_16sc_t> unpacked12(N);
+    volk::pack_sc12(packed12, samples);
+    volk::unpack_sc12(unpacked12, packed12);
+    for (size_t i = 0; i < N; i++)
+        VOLK_QA_CHECK(unpacked12[i] == samples[i]);
+
+    return true;
+}
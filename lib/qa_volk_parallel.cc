@@ -0,0 +1,153 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <atomic>  // for atomic
+#include <cmath>   // for fabs, sqrt
+#include <cstddef> // for size_t
+#include <cstdint> // for uint32_t
+#include <vector>  // for vector
+
+#include "qa_cpp.h"            // for VOLK_QA_CHECK
+#include "volk/volk_complex.h" // for lv_32fc_t
+#include <volk/volk.h>
+#include <volk/volk_parallel.h>
+
+namespace {
+
+struct coverage {
+    std::vector<std::atomic<unsigned int>> hits;
+    std::atomic<unsigned int> calls;
+    std::atomic<bool> misaligned;
+    explicit coverage(size_t n) : hits(n), calls(0), misaligned(false)
+    {
+        for (auto& h : hits)
+            h = 0;
+    }
+};
+
+void count_chunk(void* p, unsigned int chunk, size_t offset, size_t num_points)
+{
+    coverage* c = static_cast<coverage*>(p);
+    (void)chunk;
+    c->calls++;
+    if (offset % 64 != 0)
+        c->misaligned = true;
+    for (size_t i = offset; i < offset + num_points; i++)
+        c->hits[i]++;
+}
+
+bool covered_once(const coverage& c)
+{
+    for (const auto& h : c.hits)
+        if (h != 1)
+            return false;
+    return true;
+}
+
+} // namespace
+
+bool qa_volk_parallel()
+{
+    const size_t saved_threshold = volk_parallel_get_threshold();
+    volk_parallel_set_num_threads(4);
+    VOLK_QA_CHECK(volk_parallel_get_num_threads() == 4);
+
+    // the threshold keeps shorter calls on the calling thread, in one piece
+    volk_parallel_set_threshold(10000);
+    VOLK_QA_CHECK(volk_parallel_get_threshold() == 10000);
+    {
+        coverage c(9999);
+        VOLK_QA_CHECK(volk_parallel_for(count_chunk, &c, c.hits.size()) == 1);
+        VOLK_QA_CHECK(c.calls == 1);
+        VOLK_QA_CHECK(covered_once(c));
+    }
+
+    // empty calls run once on the calling thread, whatever the threshold
+    volk_parallel_set_threshold(0);
+    {
+        coverage c(0);
+        VOLK_QA_CHECK(volk_parallel_for(count_chunk, &c, 0) == 1);
+        VOLK_QA_CHECK(c.calls == 1);
+    }
+    volk_parallel_set_threshold(10000);
+
+    // longer calls are split into chunks that cover every point exactly once
+    for (size_t n : { size_t(10000), size_t(100003), size_t(1 << 20) }) {
+        coverage c(n);
+        const unsigned int num_chunks = volk_parallel_for(count_chunk, &c, n);
+        VOLK_QA_CHECK(num_chunks > 1 && num_chunks <= VOLK_PARALLEL_MAX_CHUNKS);
+        VOLK_QA_CHECK(c.calls == num_chunks);
+        VOLK_QA_CHECK(!c.misaligned);
+        VOLK_QA_CHECK(covered_once(c));
+    }
+
+    // reductions: the merged partial results match a single kernel call
+    const unsigned int N = 200003;
+    volk_parallel_set_threshold(0);
+    std::vector<float> a(N), b(N);
+    std::vector<lv_32fc_t> x(N), y(N);
+    for (unsigned int i = 0; i < N; i++) {
+        a[i] = float(i % 17) * 0.25f - 2.f;
+        b[i] = float(i % 5) - 2.f;
+        x[i] = lv_cmake(a[i], b[i]);
+        y[i] = lv_cmake(b[i], 0.5f);
+    }
+
+    float dot = 0.f, expected_dot = 0.f;
+    volk_parallel_32f_x2_dot_prod_32f(&dot, a.data(), b.data(), N);
+    volk_32f_x2_dot_prod_32f(&expected_dot, a.data(), b.data(), N);
+    VOLK_QA_CHECK(std::fabs(dot - expected_dot) <= 1e-4f * std::fabs(expected_dot) + 1.f);
+
+    lv_32fc_t cdot, expected_cdot;
+    volk_parallel_32fc_x2_dot_prod_32fc(&cdot, x.data(), y.data(), N);
+    volk_32fc_x2_dot_prod_32fc(&expected_cdot, x.data(), y.data(), N);
+    VOLK_QA_CHECK(std::abs(cdot - expected_cdot) <= 1e-4f * std::abs(expected_cdot));
+
+    float acc = 0.f, expected_acc = 0.f;
+    volk_parallel_32f_accumulator_s32f(&acc, a.data(), N);
+    volk_32f_accumulator_s32f(&expected_acc, a.data(), N);
+    VOLK_QA_CHECK(std::fabs(acc - expected_acc) <= 1e-4f * std::fabs(expected_acc) + 1.f);
+
+    float stddev, mean, expected_stddev, expected_mean;
+    volk_parallel_32f_stddev_and_mean_32f_x2(&stddev, &mean, a.data(), N);
+    volk_32f_stddev_and_mean_32f_x2(&expected_stddev, &expected_mean, a.data(), N);
+    VOLK_QA_CHECK(std::fabs(stddev - expected_stddev) <= 1e-4f * expected_stddev);
+    VOLK_QA_CHECK(std::fabs(mean - expected_mean) <= 1e-4f);
+
+    // ties across chunks resolve to the first occurrence
+    std::vector<float> ties(N, 0.f);
+    ties[N - 1] = ties[N / 2] = ties[N / 3] = 5.f;
+    ties[N / 4] = -5.f;
+    ties[N - 2] = -5.f;
+    uint32_t index = 0;
+    volk_parallel_32f_index_max_32u(&index, ties.data(), N);
+    VOLK_QA_CHECK(index == N / 3);
+    volk_parallel_32f_index_min_32u(&index, ties.data(), N);
+    VOLK_QA_CHECK(index == N / 4);
+
+    // empty inputs are not read
+    index = N;
+    volk_parallel_32f_index_max_32u(&index, nullptr, 0);
+    volk_parallel_32fc_index_max_32u(&index, nullptr, 0);
+    float empty_dot = 1.f;
+    volk_parallel_32f_x2_dot_prod_32f(&empty_dot, nullptr, nullptr, 0);
+    VOLK_QA_CHECK(empty_dot == 0.f);
+
+    // restarting the workers with a new placement
+    const int cpus[] = { 0 };
+    volk_parallel_set_affinity(cpus, 1);
+    coverage pinned(N);
+    VOLK_QA_CHECK(volk_parallel_for(count_chunk, &pinned, N) > 1);
+    VOLK_QA_CHECK(covered_once(pinned));
+    volk_parallel_set_affinity(NULL, 0);
+
+    volk_parallel_set_threshold(saved_threshold);
+    volk_parallel_set_num_threads(0);
+    return true;
+}
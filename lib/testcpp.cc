@@ -0,0 +1,40 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <iostream> // for operator<<, basic_ostream, endl, cerr
+#include <string>   // for string, operator==
+
+#include "qa_cpp.h" // for volk_cpp_test_case_t
+
+static const volk_cpp_test_case_t test_cases[] = {
+    { "volk_alloc", qa_volk_alloc },
+    { "volk_hh", qa_volk_hh },
+    { "volk_expr", qa_volk_expr },
+    { "volk_parallel", qa_volk_parallel },
+    { "volk_async", qa_volk_async },
+};
+
+int main(int argc, char* argv[])
+{
+    bool failed = false;
+    for (const volk_cpp_test_case_t& test_case : test_cases) {
+        if (argc > 1 && std::string(argv[1]) != test_case.name)
+            continue;
+        const bool passed = test_case.run();
+        std::cout << test_case.name << (passed ? ": pass" : ": fail") << std::endl;
+        failed |= !passed;
+        if (argc > 1)
+            return failed;
+    }
+    if (argc > 1) {
+        std::cerr << "Did not run a test for: " << argv[1] << " !" << std::endl;
+        return 1;
+    }
+    return failed;
+}
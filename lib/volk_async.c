@@ -0,0 +1,583 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <volk/volk_async.h>
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#endif
+
+struct volk_async_continuation {
+    volk_async_fn_t fn;
+    void* ctx;
+};
+
+struct volk_async_task {
+    volk_async_fn_t fn;
+    void* ctx;
+    volk_async_access_t* accesses;
+    unsigned int num_accesses;
+
+    unsigned int refs; // handle + graph
+    unsigned int deps; // predecessors that have not completed
+    bool done;
+
+    // tasks waiting for this one
+    struct volk_async_task** succ;
+    unsigned int num_succ;
+    unsigned int cap_succ;
+
+    // list of tasks that have not completed, in submission order
+    struct volk_async_task* prev_live;
+    struct volk_async_task* next_live;
+
+    // completion callbacks, run in registration order
+    struct volk_async_continuation* then;
+    unsigned int num_then;
+    unsigned int cap_then;
+};
+
+static void task_free(volk_async_task_t* task)
+{
+    free(task->accesses);
+    free(task->succ);
+    free(task->then);
+    free(task);
+}
+
+static volk_async_task_t* task_create(volk_async_fn_t fn,
+                                      void* ctx,
+                                      const volk_async_access_t* accesses,
+                                      unsigned int num_accesses)
+{
+    volk_async_task_t* task = (volk_async_task_t*)calloc(1, sizeof(volk_async_task_t));
+    if (!task)
+        return NULL;
+    if (num_accesses > 0) {
+        task->accesses =
+            (volk_async_access_t*)malloc(num_accesses * sizeof(volk_async_access_t));
+        if (!task->accesses) {
+            free(task);
+            return NULL;
+        }
+        memcpy(task->accesses, accesses, num_accesses * sizeof(volk_async_access_t));
+    }
+    task->fn = fn;
+    task->ctx = ctx;
+    task->num_accesses = num_accesses;
+    task->refs = 2;
+    return task;
+}
+
+#ifdef HAVE_PTHREAD
+
+// double-ended task queue of one worker: the owner pushes and pops at the
+// tail, thieves take from the head
+struct task_deque {
+    pthread_mutex_t lock;
+    volk_async_task_t** items;
+    size_t head;
+    size_t tail;
+    size_t cap; // power of two
+};
+
+// __lock guards the graph (dependencies, live list, reference counts) and
+// the threads sleeping on __cond. Ready tasks are pushed, popped and stolen
+// under the lock of their deque only. __queued counts them; it is updated
+// after the push or pop, so it may lag behind the deques for a moment.
+static pthread_mutex_t __lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t __cond = PTHREAD_COND_INITIALIZER;
+static volk_async_task_t* __live_head = NULL;
+static volk_async_task_t* __live_tail = NULL;
+static size_t __pending = 0; // submitted tasks that have not completed
+static bool __shutdown = false;
+static atomic_long __queued;     // ready tasks sitting in a deque
+static atomic_uint __num_idle;   // threads sleeping on __cond
+static unsigned int __num_helpers = 0; // of those, threads in volk_async_wait()
+
+static unsigned int __num_workers = 0; // 0: not yet determined
+static pthread_t* __threads = NULL;
+static struct task_deque* __deques = NULL;
+static atomic_uint __next_inject;
+static bool __started = false;
+
+// holds worker index + 1 on worker threads
+static pthread_key_t __worker_key;
+// holds the task a thread is running (including its callbacks), on workers
+// and on threads helping in volk_async_wait()
+static pthread_key_t __task_key;
+static pthread_once_t __key_once = PTHREAD_ONCE_INIT;
+
+static void make_keys(void)
+{
+    pthread_key_create(&__worker_key, NULL);
+    pthread_key_create(&__task_key, NULL);
+}
+
+static int current_worker(void)
+{
+    pthread_once(&__key_once, make_keys);
+    return (int)(intptr_t)pthread_getspecific(__worker_key) - 1;
+}
+
+static unsigned int online_cpus(void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (unsigned int)n : 1;
+}
+
+static bool deque_push(struct task_deque* q, volk_async_task_t* task)
+{
+    pthread_mutex_lock(&q->lock);
+    if (q->tail - q->head == q->cap) {
+        const size_t cap = q->cap ? 2 * q->cap : 64;
+        volk_async_task_t** items =
+            (volk_async_task_t**)malloc(cap * sizeof(volk_async_task_t*));
+        if (!items) {
+            pthread_mutex_unlock(&q->lock);
+            return false;
+        }
+        for (size_t i = q->head; i != q->tail; i++)
+            items[i & (cap - 1)] = q->items[i & (q->cap - 1)];
+        free(q->items);
+        q->items = items;
+        q->cap = cap;
+    }
+    q->items[q->tail++ & (q->cap - 1)] = task;
+    pthread_mutex_unlock(&q->lock);
+    return true;
+}
+
+static volk_async_task_t* deque_pop(struct task_deque* q)
+{
+    volk_async_task_t* task = NULL;
+    pthread_mutex_lock(&q->lock);
+    if (q->tail != q->head)
+        task = q->items[--q->tail & (q->cap - 1)];
+    pthread_mutex_unlock(&q->lock);
+    return task;
+}
+
+static volk_async_task_t* deque_steal(struct task_deque* q)
+{
+    volk_async_task_t* task = NULL;
+    pthread_mutex_lock(&q->lock);
+    if (q->tail != q->head)
+        task = q->items[q->head++ & (q->cap - 1)];
+    pthread_mutex_unlock(&q->lock);
+    return task;
+}
+
+static void run_task(volk_async_task_t* task, int self);
+
+// sleeps on __cond unless a task was queued in the meantime; called with
+// __lock held. enqueue() raises __queued before it looks at __num_idle, and
+// this raises __num_idle before it looks at __queued, so at least one of them
+// sees the other and no wake-up is lost.
+static void idle_wait(void)
+{
+    atomic_fetch_add(&__num_idle, 1);
+    if (atomic_load(&__queued) <= 0)
+        pthread_cond_wait(&__cond, &__lock);
+    atomic_fetch_sub(&__num_idle, 1);
+}
+
+// queues a ready task and wakes one sleeping thread; called without __lock
+static void enqueue(volk_async_task_t* task, int self)
+{
+    unsigned int target;
+    if (self >= 0)
+        target = (unsigned int)self; // keep successors on the warm core
+    else
+        target = atomic_fetch_add(&__next_inject, 1) % __num_workers;
+    if (!deque_push(&__deques[target], task)) {
+        // out of memory: run it right here rather than lose it
+        run_task(task, self);
+        return;
+    }
+    atomic_fetch_add(&__queued, 1);
+    if (atomic_load(&__num_idle) > 0) {
+        pthread_mutex_lock(&__lock);
+        pthread_cond_signal(&__cond);
+        pthread_mutex_unlock(&__lock);
+    }
+}
+
+// takes a ready task, preferring the own deque; called without __lock
+static volk_async_task_t* take(int self)
+{
+    if (atomic_load(&__queued) <= 0)
+        return NULL;
+    volk_async_task_t* task = NULL;
+    if (self >= 0)
+        task = deque_pop(&__deques[self]);
+    for (unsigned int i = 1; !task && i <= __num_workers; i++)
+        task = deque_steal(&__deques[(self + i) % __num_workers]);
+    if (task)
+        atomic_fetch_sub(&__queued, 1);
+    return task;
+}
+
+static void task_unref(volk_async_task_t* task)
+{
+    if (--task->refs == 0)
+        task_free(task);
+}
+
+static void run_task(volk_async_task_t* task, int self)
+{
+    void* outer = pthread_getspecific(__task_key);
+    pthread_setspecific(__task_key, task);
+    task->fn(task->ctx);
+
+    pthread_mutex_lock(&__lock);
+    task->done = true;
+    if (task->prev_live)
+        task->prev_live->next_live = task->next_live;
+    else
+        __live_head = task->next_live;
+    if (task->next_live)
+        task->next_live->prev_live = task->prev_live;
+    else
+        __live_tail = task->prev_live;
+    __pending--;
+    // successors that became ready move to the front of the list, they are
+    // queued once __lock is released; a completed task gains no successors
+    unsigned int num_ready = 0;
+    for (unsigned int i = 0; i < task->num_succ; i++)
+        if (--task->succ[i]->deps == 0)
+            task->succ[num_ready++] = task->succ[i];
+    if (__num_helpers > 0)
+        pthread_cond_broadcast(&__cond);
+    pthread_mutex_unlock(&__lock);
+    for (unsigned int i = 0; i < num_ready; i++)
+        enqueue(task->succ[i], self);
+
+    // no callback can be added once done is set, so the list is stable
+    for (unsigned int i = 0; i < task->num_then; i++)
+        task->then[i].fn(task->then[i].ctx);
+
+    pthread_mutex_lock(&__lock);
+    task_unref(task);
+    pthread_mutex_unlock(&__lock);
+    pthread_setspecific(__task_key, outer);
+}
+
+static void* worker_main(void* arg)
+{
+    const int self = (int)(intptr_t)arg;
+    pthread_setspecific(__worker_key, (void*)(intptr_t)(self + 1));
+
+    while (true) {
+        volk_async_task_t* task = take(self);
+        if (task) {
+            run_task(task, self);
+            continue;
+        }
+        pthread_mutex_lock(&__lock);
+        const bool shutdown = __shutdown;
+        if (!shutdown)
+            idle_wait();
+        pthread_mutex_unlock(&__lock);
+        if (shutdown)
+            break;
+    }
+    return NULL;
+}
+
+// starts the workers; called with __lock held
+static bool pool_start(void)
+{
+    if (__num_workers == 0)
+        __num_workers = online_cpus();
+    __threads = (pthread_t*)calloc(__num_workers, sizeof(pthread_t));
+    __deques = (struct task_deque*)calloc(__num_workers, sizeof(struct task_deque));
+    if (!__threads || !__deques) {
+        free(__threads);
+        free(__deques);
+        __threads = NULL;
+        __deques = NULL;
+        return false;
+    }
+    for (unsigned int i = 0; i < __num_workers; i++)
+        pthread_mutex_init(&__deques[i].lock, NULL);
+    pthread_once(&__key_once, make_keys);
+    __shutdown = false;
+    atomic_store(&__queued, 0);
+    unsigned int started = 0;
+    for (; started < __num_workers; started++)
+        if (pthread_create(
+                &__threads[started], NULL, worker_main, (void*)(intptr_t)started) != 0)
+            break;
+    if (started == 0) {
+        free(__threads);
+        free(__deques);
+        __threads = NULL;
+        __deques = NULL;
+        return false;
+    }
+    __num_workers = started;
+    __started = true;
+    return true;
+}
+
+// joins the workers; the graph must be empty
+static void pool_stop(void)
+{
+    pthread_mutex_lock(&__lock);
+    if (!__started) {
+        pthread_mutex_unlock(&__lock);
+        return;
+    }
+    __shutdown = true;
+    pthread_cond_broadcast(&__cond);
+    pthread_mutex_unlock(&__lock);
+    for (unsigned int i = 0; i < __num_workers; i++)
+        pthread_join(__threads[i], NULL);
+    for (unsigned int i = 0; i < __num_workers; i++) {
+        pthread_mutex_destroy(&__deques[i].lock);
+        free(__deques[i].items);
+    }
+    free(__threads);
+    free(__deques);
+    __threads = NULL;
+    __deques = NULL;
+    __started = false;
+}
+
+static bool conflicts(const volk_async_task_t* a, const volk_async_task_t* b)
+{
+    for (unsigned int i = 0; i < a->num_accesses; i++) {
+        const volk_async_access_t* x = &a->accesses[i];
+        const char* x_begin = (const char*)x->ptr;
+        for (unsigned int j = 0; j < b->num_accesses; j++) {
+            const volk_async_access_t* y = &b->accesses[j];
+            if (!((x->mode | y->mode) & VOLK_ASYNC_WRITE))
+                continue;
+            const char* y_begin = (const char*)y->ptr;
+            if (x_begin < y_begin + y->size && y_begin < x_begin + x->size)
+                return true;
+        }
+    }
+    return false;
+}
+
+static bool add_successor(volk_async_task_t* pred, volk_async_task_t* task)
+{
+    if (pred->num_succ == pred->cap_succ) {
+        const unsigned int cap = pred->cap_succ ? 2 * pred->cap_succ : 4;
+        volk_async_task_t** succ = (volk_async_task_t**)realloc(
+            pred->succ, cap * sizeof(volk_async_task_t*));
+        if (!succ)
+            return false;
+        pred->succ = succ;
+        pred->cap_succ = cap;
+    }
+    pred->succ[pred->num_succ++] = task;
+    return true;
+}
+
+volk_async_task_t* volk_async_submit(volk_async_fn_t fn,
+                                     void* ctx,
+                                     const volk_async_access_t* accesses,
+                                     unsigned int num_accesses)
+{
+    volk_async_task_t* task = task_create(fn, ctx, accesses, num_accesses);
+    if (!task)
+        return NULL;
+
+    pthread_mutex_lock(&__lock);
+    if (!__started && !pool_start()) {
+        // no workers: run synchronously once all earlier tasks are done
+        pthread_mutex_unlock(&__lock);
+        volk_async_wait_all();
+        fn(ctx);
+        task->done = true;
+        task->refs = 1;
+        return task;
+    }
+    for (volk_async_task_t* live = __live_head; live; live = live->next_live) {
+        if (conflicts(live, task)) {
+            if (!add_successor(live, task)) {
+                pthread_mutex_unlock(&__lock);
+                task_free(task);
+                return NULL;
+            }
+            task->deps++;
+        }
+    }
+    task->prev_live = __live_tail;
+    if (__live_tail)
+        __live_tail->next_live = task;
+    else
+        __live_head = task;
+    __live_tail = task;
+    __pending++;
+    const bool ready = task->deps == 0;
+    pthread_mutex_unlock(&__lock);
+    if (ready)
+        enqueue(task, current_worker());
+    return task;
+}
+
+int volk_async_test(volk_async_task_t* task)
+{
+    pthread_mutex_lock(&__lock);
+    const bool done = task->done;
+    pthread_mutex_unlock(&__lock);
+    return done;
+}
+
+// waits for *flag (or for __pending to drop to zero if flag is NULL) while
+// running queued tasks
+static void wait_helping(const bool* flag)
+{
+    const int self = current_worker();
+    pthread_mutex_lock(&__lock);
+    while (flag ? !*flag : __pending > 0) {
+        pthread_mutex_unlock(&__lock);
+        volk_async_task_t* other = take(self);
+        if (other)
+            run_task(other, self);
+        pthread_mutex_lock(&__lock);
+        if (other || (flag ? *flag : __pending == 0))
+            continue;
+        // woken by a queued task or, since __num_helpers > 0, a completion
+        __num_helpers++;
+        idle_wait();
+        __num_helpers--;
+    }
+    // a wake-up meant for a queued task may have landed here; pass it on
+    if (atomic_load(&__queued) > 0 && atomic_load(&__num_idle) > 0)
+        pthread_cond_signal(&__cond);
+    pthread_mutex_unlock(&__lock);
+}
+
+void volk_async_wait(volk_async_task_t* task) { wait_helping(&task->done); }
+
+void volk_async_wait_all(void)
+{
+    pthread_mutex_lock(&__lock);
+    const bool started = __started;
+    pthread_mutex_unlock(&__lock);
+    if (started)
+        wait_helping(NULL);
+}
+
+int volk_async_then(volk_async_task_t* task, volk_async_fn_t fn, void* ctx)
+{
+    pthread_mutex_lock(&__lock);
+    if (task->done) {
+        pthread_mutex_unlock(&__lock);
+        return 0;
+    }
+    if (task->num_then == task->cap_then) {
+        const unsigned int cap = task->cap_then ? 2 * task->cap_then : 2;
+        struct volk_async_continuation* then = (struct volk_async_continuation*)realloc(
+            task->then, cap * sizeof(struct volk_async_continuation));
+        if (!then) {
+            // out of memory: wait here and let the caller run fn itself
+            pthread_mutex_unlock(&__lock);
+            volk_async_wait(task);
+            return 0;
+        }
+        task->then = then;
+        task->cap_then = cap;
+    }
+    task->then[task->num_then].fn = fn;
+    task->then[task->num_then].ctx = ctx;
+    task->num_then++;
+    pthread_mutex_unlock(&__lock);
+    return 1;
+}
+
+void volk_async_release(volk_async_task_t* task)
+{
+    if (!task)
+        return;
+    pthread_mutex_lock(&__lock);
+    task_unref(task);
+    pthread_mutex_unlock(&__lock);
+}
+
+int volk_async_set_num_workers(unsigned int num_workers)
+{
+    // a task would wait for itself, a worker would join itself
+    pthread_once(&__key_once, make_keys);
+    if (current_worker() >= 0 || pthread_getspecific(__task_key))
+        return -1;
+    volk_async_wait_all();
+    pool_stop();
+    pthread_mutex_lock(&__lock);
+    __num_workers = num_workers ? num_workers : online_cpus();
+    pthread_mutex_unlock(&__lock);
+    return 0;
+}
+
+unsigned int volk_async_get_num_workers(void)
+{
+    pthread_mutex_lock(&__lock);
+    if (__num_workers == 0)
+        __num_workers = online_cpus();
+    const unsigned int n = __num_workers;
+    pthread_mutex_unlock(&__lock);
+    return n;
+}
+
+#else
+
+volk_async_task_t* volk_async_submit(volk_async_fn_t fn,
+                                     void* ctx,
+                                     const volk_async_access_t* accesses,
+                                     unsigned int num_accesses)
+{
+    volk_async_task_t* task = task_create(fn, ctx, accesses, num_accesses);
+    if (!task)
+        return NULL;
+    fn(ctx);
+    task->done = true;
+    task->refs = 1;
+    return task;
+}
+
+int volk_async_test(volk_async_task_t* task) { return task->done; }
+
+void volk_async_wait(volk_async_task_t* task) { (void)task; }
+
+void volk_async_wait_all(void) {}
+
+int volk_async_then(volk_async_task_t* task, volk_async_fn_t fn, void* ctx)
+{
+    (void)task;
+    (void)fn;
+    (void)ctx;
+    return 0;
+}
+
+void volk_async_release(volk_async_task_t* task)
+{
+    if (task && --task->refs == 0)
+        task_free(task);
+}
+
+int volk_async_set_num_workers(unsigned int num_workers)
+{
+    (void)num_workers;
+    return 0;
+}
+
+unsigned int volk_async_get_num_workers(void) { return 0; }
+
+#endif /* HAVE_PTHREAD */
@@ -0,0 +1,75 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <volk/volk.h>
+#include <volk/volk_fft.h>
+
+struct volk_fft_plan {
+    unsigned int num_points;
+    int direction;
+    lv_32fc_t* twiddles; // num_points - 1 values, volk_malloc'ed
+};
+
+volk_fft_plan_t* volk_fft_plan_create(unsigned int num_points, int direction)
+{
+    if (num_points == 0 || num_points > VOLK_FFT_MAX_POINTS ||
+        (num_points & (num_points - 1)) != 0)
+        return NULL;
+    if (direction != VOLK_FFT_FORWARD && direction != VOLK_FFT_INVERSE)
+        return NULL;
+
+    volk_fft_plan_t* plan = (volk_fft_plan_t*)malloc(sizeof(volk_fft_plan_t));
+    if (!plan)
+        return NULL;
+    plan->num_points = num_points;
+    plan->direction = direction;
+
+    // at least one value, so the table is never a zero sized allocation
+    const unsigned int len = num_points > 1 ? num_points - 1 : 1;
+    plan->twiddles =
+        (lv_32fc_t*)volk_malloc(len * sizeof(lv_32fc_t), volk_get_alignment());
+    if (!plan->twiddles) {
+        free(plan);
+        return NULL;
+    }
+    plan->twiddles[0] = lv_cmake(1.f, 0.f);
+
+    // the run for stage h holds exp(direction * 2 pi i j / (2h)) for j < h
+    for (unsigned int h = 1; h < num_points; h *= 2) {
+        for (unsigned int j = 0; j < h; j++) {
+            const double arg = direction * M_PI * j / h;
+            plan->twiddles[h - 1 + j] = lv_cmake((float)cos(arg), (float)sin(arg));
+        }
+    }
+    return plan;
+}
+
+void volk_fft_plan_destroy(volk_fft_plan_t* plan)
+{
+    if (!plan)
+        return;
+    volk_free(plan->twiddles);
+    free(plan);
+}
+
+unsigned int volk_fft_plan_size(const volk_fft_plan_t* plan) { return plan->num_points; }
+
+const lv_32fc_t* volk_fft_plan_twiddles(const volk_fft_plan_t* plan)
+{
+    return plan->twiddles;
+}
+
+void volk_fft_execute(const volk_fft_plan_t* plan,
+                      lv_32fc_t* output,
+                      const lv_32fc_t* input)
+{
+    volk_32fc_x2_fft_32fc(output, input, plan->twiddles, plan->num_points);
+}
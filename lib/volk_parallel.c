@@ -0,0 +1,565 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // for pthread_setaffinity_np
+#endif
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_parallel.h>
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+// chunk boundaries are multiples of this many points
+#define VOLK_PARALLEL_GRANULARITY 64
+// chunks handed out per thread, for load balancing
+#define VOLK_PARALLEL_CHUNKS_PER_THREAD 4
+
+// __num_threads and __affinity are guarded by __call_lock, __threshold by
+// __threshold_lock since every call reads it before trying __call_lock
+static unsigned int __num_threads = 0; // 0: not yet determined
+static size_t __threshold = 1 << 18;
+static int* __affinity = NULL;
+static unsigned int __affinity_len = 0;
+
+#ifdef HAVE_PTHREAD
+
+struct volk_parallel_pool {
+    pthread_mutex_t lock;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    pthread_t* threads;
+    unsigned int num_workers;
+    unsigned long generation;
+    bool shutdown;
+
+    // the job currently being processed
+    volk_parallel_fn_t fn;
+    void* ctx;
+    size_t num_points;
+    size_t chunk_len;
+    unsigned int num_chunks;
+    unsigned int next_chunk;
+    unsigned int chunks_left;
+};
+
+// serializes callers; a call that finds the pool busy runs serially
+static pthread_mutex_t __call_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t __threshold_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct volk_parallel_pool* __pool = NULL;
+
+struct volk_parallel_worker_arg {
+    struct volk_parallel_pool* pool;
+    int cpu; // -1: no placement
+};
+
+// grabs and runs chunks until none are left; called with pool->lock held
+static void run_chunks(struct volk_parallel_pool* pool)
+{
+    while (pool->next_chunk < pool->num_chunks) {
+        const unsigned int chunk = pool->next_chunk++;
+        const size_t offset = chunk * pool->chunk_len;
+        size_t len = pool->num_points - offset;
+        if (len > pool->chunk_len)
+            len = pool->chunk_len;
+        pthread_mutex_unlock(&pool->lock);
+        pool->fn(pool->ctx, chunk, offset, len);
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->chunks_left == 0)
+            pthread_cond_signal(&pool->done_cond);
+    }
+}
+
+static void* worker_main(void* p)
+{
+    struct volk_parallel_worker_arg arg = *(struct volk_parallel_worker_arg*)p;
+    struct volk_parallel_pool* pool = arg.pool;
+    free(p);
+
+#ifdef __linux__
+    if (arg.cpu >= 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(arg.cpu, &cpus);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    }
+#endif
+
+    pthread_mutex_lock(&pool->lock);
+    unsigned long seen = pool->generation;
+    while (true) {
+        while (!pool->shutdown && pool->generation == seen)
+            pthread_cond_wait(&pool->work_cond, &pool->lock);
+        if (pool->shutdown)
+            break;
+        seen = pool->generation;
+        run_chunks(pool);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+static void pool_destroy(struct volk_parallel_pool* pool)
+{
+    if (!pool)
+        return;
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->lock);
+    for (unsigned int i = 0; i < pool->num_workers; i++)
+        pthread_join(pool->threads[i], NULL);
+    pthread_cond_destroy(&pool->work_cond);
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+// called with __call_lock held
+static struct volk_parallel_pool* pool_create(unsigned int num_workers)
+{
+    struct volk_parallel_pool* pool =
+        (struct volk_parallel_pool*)calloc(1, sizeof(struct volk_parallel_pool));
+    if (!pool)
+        return NULL;
+    pool->threads = (pthread_t*)calloc(num_workers, sizeof(pthread_t));
+    if (!pool->threads) {
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+
+    for (unsigned int i = 0; i < num_workers; i++) {
+        struct volk_parallel_worker_arg* arg = (struct volk_parallel_worker_arg*)malloc(
+            sizeof(struct volk_parallel_worker_arg));
+        if (!arg)
+            break;
+        arg->pool = pool;
+        arg->cpu = __affinity_len > 0 ? __affinity[i % __affinity_len] : -1;
+        if (pthread_create(&pool->threads[i], NULL, worker_main, arg) != 0) {
+            free(arg);
+            break;
+        }
+        pool->num_workers++;
+    }
+    return pool;
+}
+
+static unsigned int online_cpus(void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (unsigned int)n : 1;
+}
+
+#else
+
+static unsigned int online_cpus(void) { return 1; }
+
+#endif /* HAVE_PTHREAD */
+
+void volk_parallel_set_num_threads(unsigned int num_threads)
+{
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&__call_lock);
+    pool_destroy(__pool);
+    __pool = NULL;
+    __num_threads = num_threads ? num_threads : online_cpus();
+    pthread_mutex_unlock(&__call_lock);
+#else
+    (void)num_threads;
+#endif
+}
+
+unsigned int volk_parallel_get_num_threads(void)
+{
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&__call_lock);
+    if (__num_threads == 0)
+        __num_threads = online_cpus();
+    const unsigned int n = __num_threads;
+    pthread_mutex_unlock(&__call_lock);
+    return n;
+#else
+    return 1;
+#endif
+}
+
+void volk_parallel_set_threshold(size_t num_points)
+{
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&__threshold_lock);
+    __threshold = num_points;
+    pthread_mutex_unlock(&__threshold_lock);
+#else
+    __threshold = num_points;
+#endif
+}
+
+size_t volk_parallel_get_threshold(void)
+{
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&__threshold_lock);
+    const size_t threshold = __threshold;
+    pthread_mutex_unlock(&__threshold_lock);
+    return threshold;
+#else
+    return __threshold;
+#endif
+}
+
+void volk_parallel_set_affinity(const int* cpus, unsigned int num_cpus)
+{
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&__call_lock);
+    // join the workers before replacing the placement; the next call starts
+    // new ones with it
+    pool_destroy(__pool);
+    __pool = NULL;
+    free(__affinity);
+    __affinity = NULL;
+    __affinity_len = 0;
+    if (cpus && num_cpus) {
+        __affinity = (int*)malloc(num_cpus * sizeof(int));
+        if (__affinity) {
+            memcpy(__affinity, cpus, num_cpus * sizeof(int));
+            __affinity_len = num_cpus;
+        }
+    }
+    pthread_mutex_unlock(&__call_lock);
+#else
+    (void)cpus;
+    (void)num_cpus;
+#endif
+}
+
+unsigned int volk_parallel_for(volk_parallel_fn_t fn, void* ctx, size_t num_points)
+{
+#ifdef HAVE_PTHREAD
+    if (num_points > 0 && num_points >= volk_parallel_get_threshold() &&
+        pthread_mutex_trylock(&__call_lock) == 0) {
+        if (__num_threads == 0)
+            __num_threads = online_cpus();
+        if (__num_threads > 1 && !__pool) {
+            // make sure the machine is selected before the workers dispatch
+            volk_get_alignment();
+            __pool = pool_create(__num_threads - 1);
+        }
+        struct volk_parallel_pool* pool = __pool;
+        if (pool && pool->num_workers > 0) {
+            size_t num_chunks =
+                (size_t)(pool->num_workers + 1) * VOLK_PARALLEL_CHUNKS_PER_THREAD;
+            if (num_chunks > VOLK_PARALLEL_MAX_CHUNKS)
+                num_chunks = VOLK_PARALLEL_MAX_CHUNKS;
+            size_t chunk_len = (num_points + num_chunks - 1) / num_chunks;
+            chunk_len = (chunk_len + VOLK_PARALLEL_GRANULARITY - 1) /
+                        VOLK_PARALLEL_GRANULARITY * VOLK_PARALLEL_GRANULARITY;
+            if (chunk_len < VOLK_PARALLEL_GRANULARITY)
+                chunk_len = VOLK_PARALLEL_GRANULARITY;
+            num_chunks = (num_points + chunk_len - 1) / chunk_len;
+
+            pthread_mutex_lock(&pool->lock);
+            pool->fn = fn;
+            pool->ctx = ctx;
+            pool->num_points = num_points;
+            pool->chunk_len = chunk_len;
+            pool->num_chunks = (unsigned int)num_chunks;
+            pool->next_chunk = 0;
+            pool->chunks_left = (unsigned int)num_chunks;
+            pool->generation++;
+            pthread_cond_broadcast(&pool->work_cond);
+            run_chunks(pool);
+            while (pool->chunks_left > 0)
+                pthread_cond_wait(&pool->done_cond, &pool->lock);
+            pthread_mutex_unlock(&pool->lock);
+            pthread_mutex_unlock(&__call_lock);
+            return (unsigned int)num_chunks;
+        }
+        pthread_mutex_unlock(&__call_lock);
+    }
+#endif
+    fn(ctx, 0, 0, num_points);
+    return 1;
+}
+
+
+/*
+ * Elementwise kernels: every chunk runs the kernel on its slice.
+ */
+
+struct volk_parallel_x2_ctx {
+    void* out;
+    const void* a;
+    const void* b;
+    size_t out_size;
+    size_t a_size;
+    size_t b_size;
+    lv_32fc_t scalar;
+};
+
+#define VOLK_PARALLEL_SLICE(ctx, member, offset) \
+    ((char*)(ctx)->member + (offset) * (ctx)->member##_size)
+
+#define VOLK_PARALLEL_X2(kernel, out_t, a_t, b_t)                               \
+    static void chunk_##kernel(void* p, unsigned int chunk, size_t off, size_t n) \
+    {                                                                            \
+        struct volk_parallel_x2_ctx* ctx = (struct volk_parallel_x2_ctx*)p;      \
+        (void)chunk;                                                             \
+        volk_##kernel((out_t*)VOLK_PARALLEL_SLICE(ctx, out, off),                \
+                      (const a_t*)VOLK_PARALLEL_SLICE(ctx, a, off),              \
+                      (const b_t*)VOLK_PARALLEL_SLICE(ctx, b, off),              \
+                      (unsigned int)n);                                          \
+    }                                                                            \
+    void volk_parallel_##kernel(                                                 \
+        out_t* out, const a_t* a, const b_t* b, unsigned int num_points)         \
+    {                                                                            \
+        struct volk_parallel_x2_ctx ctx = {                                      \
+            out, a, b, sizeof(out_t), sizeof(a_t), sizeof(b_t), lv_cmake(0.f, 0.f)   \
+        };                                                                       \
+        volk_parallel_for(chunk_##kernel, &ctx, num_points);                     \
+    }
+
+#define VOLK_PARALLEL_X1(kernel, out_t, a_t)                                      \
+    static void chunk_##kernel(void* p, unsigned int chunk, size_t off, size_t n) \
+    {                                                                            \
+        struct volk_parallel_x2_ctx* ctx = (struct volk_parallel_x2_ctx*)p;      \
+        (void)chunk;                                                             \
+        volk_##kernel((out_t*)VOLK_PARALLEL_SLICE(ctx, out, off),                \
+                      (const a_t*)VOLK_PARALLEL_SLICE(ctx, a, off),              \
+                      (unsigned int)n);                                          \
+    }                                                                            \
+    void volk_parallel_##kernel(out_t* out, const a_t* a, unsigned int num_points) \
+    {                                                                            \
+        struct volk_parallel_x2_ctx ctx = {                                      \
+            out, a, NULL, sizeof(out_t), sizeof(a_t), 0, lv_cmake(0.f, 0.f)          \
+        };                                                                       \
+        volk_parallel_for(chunk_##kernel, &ctx, num_points);                     \
+    }
+
+VOLK_PARALLEL_X2(32fc_x2_multiply_32fc, lv_32fc_t, lv_32fc_t, lv_32fc_t)
+VOLK_PARALLEL_X2(32fc_x2_multiply_conjugate_32fc, lv_32fc_t, lv_32fc_t, lv_32fc_t)
+VOLK_PARALLEL_X2(32fc_x2_add_32fc, lv_32fc_t, lv_32fc_t, lv_32fc_t)
+VOLK_PARALLEL_X2(32fc_32f_multiply_32fc, lv_32fc_t, lv_32fc_t, float)
+VOLK_PARALLEL_X2(32f_x2_multiply_32f, float, float, float)
+VOLK_PARALLEL_X2(32f_x2_add_32f, float, float, float)
+VOLK_PARALLEL_X1(32fc_magnitude_32f, float, lv_32fc_t)
+VOLK_PARALLEL_X1(32fc_magnitude_squared_32f, float, lv_32fc_t)
+VOLK_PARALLEL_X1(16ic_convert_32fc, lv_32fc_t, lv_16sc_t)
+
+static void
+s32fc_multiply_chunk(void* p, unsigned int chunk, size_t offset, size_t num_points)
+{
+    struct volk_parallel_x2_ctx* ctx = (struct volk_parallel_x2_ctx*)p;
+    (void)chunk;
+    volk_32fc_s32fc_multiply_32fc((lv_32fc_t*)ctx->out + offset,
+                                  (const lv_32fc_t*)ctx->a + offset,
+                                  ctx->scalar,
+                                  (unsigned int)num_points);
+}
+
+void volk_parallel_32fc_s32fc_multiply_32fc(lv_32fc_t* cVector,
+                                            const lv_32fc_t* aVector,
+                                            const lv_32fc_t scalar,
+                                            unsigned int num_points)
+{
+    struct volk_parallel_x2_ctx ctx = {
+        cVector, aVector, NULL, sizeof(lv_32fc_t), sizeof(lv_32fc_t), 0, scalar
+    };
+    volk_parallel_for(s32fc_multiply_chunk, &ctx, num_points);
+}
+
+static void
+s32f_multiply_chunk(void* p, unsigned int chunk, size_t offset, size_t num_points)
+{
+    struct volk_parallel_x2_ctx* ctx = (struct volk_parallel_x2_ctx*)p;
+    (void)chunk;
+    volk_32f_s32f_multiply_32f((float*)ctx->out + offset,
+                               (const float*)ctx->a + offset,
+                               lv_creal(ctx->scalar),
+                               (unsigned int)num_points);
+}
+
+void volk_parallel_32f_s32f_multiply_32f(float* cVector,
+                                         const float* aVector,
+                                         const float scalar,
+                                         unsigned int num_points)
+{
+    struct volk_parallel_x2_ctx ctx = {
+        cVector, aVector, NULL, sizeof(float), sizeof(float), 0, lv_cmake(scalar, 0.f)
+    };
+    volk_parallel_for(s32f_multiply_chunk, &ctx, num_points);
+}
+
+
+/*
+ * Reductions: every chunk stores its partial result, the caller combines them
+ * in chunk order.
+ */
+
+struct volk_parallel_reduce_ctx {
+    const void* a;
+    const void* b;
+    float partial_32f[VOLK_PARALLEL_MAX_CHUNKS];
+    float partial2_32f[VOLK_PARALLEL_MAX_CHUNKS];
+    lv_32fc_t partial_32fc[VOLK_PARALLEL_MAX_CHUNKS];
+    uint32_t partial_index[VOLK_PARALLEL_MAX_CHUNKS];
+    size_t partial_len[VOLK_PARALLEL_MAX_CHUNKS];
+};
+
+#define VOLK_PARALLEL_DOT(kernel, res_t, partial, a_t, b_t)                      \
+    static void chunk_##kernel(void* p, unsigned int chunk, size_t off, size_t n) \
+    {                                                                            \
+        struct volk_parallel_reduce_ctx* ctx = (struct volk_parallel_reduce_ctx*)p; \
+        volk_##kernel(&ctx->partial[chunk],                                      \
+                      (const a_t*)ctx->a + off,                                  \
+                      (const b_t*)ctx->b + off,                                  \
+                      (unsigned int)n);                                          \
+    }                                                                            \
+    void volk_parallel_##kernel(                                                 \
+        res_t* result, const a_t* input, const b_t* taps, unsigned int num_points) \
+    {                                                                            \
+        struct volk_parallel_reduce_ctx* ctx = (struct volk_parallel_reduce_ctx*)malloc( \
+            sizeof(struct volk_parallel_reduce_ctx));                            \
+        if (!ctx) {                                                              \
+            volk_##kernel(result, input, taps, num_points);                      \
+            return;                                                              \
+        }                                                                        \
+        ctx->a = input;                                                          \
+        ctx->b = taps;                                                           \
+        const unsigned int num_chunks =                                          \
+            volk_parallel_for(chunk_##kernel, ctx, num_points);                  \
+        res_t sum = ctx->partial[0];                                             \
+        for (unsigned int i = 1; i < num_chunks; i++)                            \
+            sum += ctx->partial[i];                                              \
+        *result = sum;                                                           \
+        free(ctx);                                                               \
+    }
+
+VOLK_PARALLEL_DOT(32f_x2_dot_prod_32f, float, partial_32f, float, float)
+VOLK_PARALLEL_DOT(32fc_x2_dot_prod_32fc, lv_32fc_t, partial_32fc, lv_32fc_t, lv_32fc_t)
+VOLK_PARALLEL_DOT(
+    32fc_x2_conjugate_dot_prod_32fc, lv_32fc_t, partial_32fc, lv_32fc_t, lv_32fc_t)
+VOLK_PARALLEL_DOT(32fc_32f_dot_prod_32fc, lv_32fc_t, partial_32fc, lv_32fc_t, float)
+
+#define VOLK_PARALLEL_ACCUMULATE(kernel, res_t, partial)                         \
+    static void chunk_##kernel(void* p, unsigned int chunk, size_t off, size_t n) \
+    {                                                                            \
+        struct volk_parallel_reduce_ctx* ctx = (struct volk_parallel_reduce_ctx*)p; \
+        volk_##kernel(&ctx->partial[chunk], (const res_t*)ctx->a + off, (unsigned int)n); \
+    }                                                                            \
+    void volk_parallel_##kernel(res_t* result, const res_t* input, unsigned int num_points) \
+    {                                                                            \
+        struct volk_parallel_reduce_ctx* ctx = (struct volk_parallel_reduce_ctx*)malloc( \
+            sizeof(struct volk_parallel_reduce_ctx));                            \
+        if (!ctx) {                                                              \
+            volk_##kernel(result, input, num_points);                            \
+            return;                                                              \
+        }                                                                        \
+        ctx->a = input;                                                          \
+        const unsigned int num_chunks =                                          \
+            volk_parallel_for(chunk_##kernel, ctx, num_points);                  \
+        res_t sum = ctx->partial[0];                                             \
+        for (unsigned int i = 1; i < num_chunks; i++)                            \
+            sum += ctx->partial[i];                                              \
+        *result = sum;                                                           \
+        free(ctx);                                                               \
+    }
+
+VOLK_PARALLEL_ACCUMULATE(32f_accumulator_s32f, float, partial_32f)
+VOLK_PARALLEL_ACCUMULATE(32fc_accumulator_s32fc, lv_32fc_t, partial_32fc)
+
+// Index searches keep the first occurrence like the kernels do: a later chunk
+// only wins on a strictly better value.
+#define VOLK_PARALLEL_INDEX(kernel, a_t, value_of, better)                       \
+    static void chunk_##kernel(void* p, unsigned int chunk, size_t off, size_t n) \
+    {                                                                            \
+        struct volk_parallel_reduce_ctx* ctx = (struct volk_parallel_reduce_ctx*)p; \
+        const a_t* a = (const a_t*)ctx->a + off;                                 \
+        uint32_t index = 0;                                                      \
+        volk_##kernel(&index, (a_t*)a, (uint32_t)n);                             \
+        ctx->partial_index[chunk] = (uint32_t)off + index;                       \
+        ctx->partial_32f[chunk] = value_of(a[index]);                            \
+    }                                                                            \
+    void volk_parallel_##kernel(uint32_t* target, const a_t* src, uint32_t num_points) \
+    {                                                                            \
+        struct volk_parallel_reduce_ctx* ctx = (struct volk_parallel_reduce_ctx*)malloc( \
+            sizeof(struct volk_parallel_reduce_ctx));                            \
+        if (!ctx || num_points == 0) {                                           \
+            free(ctx);                                                           \
+            volk_##kernel(target, (a_t*)src, num_points);                        \
+            return;                                                              \
+        }                                                                        \
+        ctx->a = src;                                                            \
+        const unsigned int num_chunks =                                          \
+            volk_parallel_for(chunk_##kernel, ctx, num_points);                  \
+        unsigned int best = 0;                                                   \
+        for (unsigned int i = 1; i < num_chunks; i++)                            \
+            if (ctx->partial_32f[i] better ctx->partial_32f[best])               \
+                best = i;                                                        \
+        *target = ctx->partial_index[best];                                      \
+        free(ctx);                                                               \
+    }
+
+#define VOLK_PARALLEL_VALUE_32F(x) (x)
+#define VOLK_PARALLEL_VALUE_32FC(x) (lv_creal(x) * lv_creal(x) + lv_cimag(x) * lv_cimag(x))
+
+VOLK_PARALLEL_INDEX(32f_index_max_32u, float, VOLK_PARALLEL_VALUE_32F, >)
+VOLK_PARALLEL_INDEX(32f_index_min_32u, float, VOLK_PARALLEL_VALUE_32F, <)
+VOLK_PARALLEL_INDEX(32fc_index_max_32u, lv_32fc_t, VOLK_PARALLEL_VALUE_32FC, >)
+
+static void
+stddev_and_mean_chunk(void* p, unsigned int chunk, size_t offset, size_t num_points)
+{
+    struct volk_parallel_reduce_ctx* ctx = (struct volk_parallel_reduce_ctx*)p;
+    volk_32f_stddev_and_mean_32f_x2(&ctx->partial_32f[chunk],
+                                    &ctx->partial2_32f[chunk],
+                                    (const float*)ctx->a + offset,
+                                    (unsigned int)num_points);
+    ctx->partial_len[chunk] = num_points;
+}
+
+void volk_parallel_32f_stddev_and_mean_32f_x2(float* stddev,
+                                              float* mean,
+                                              const float* inputBuffer,
+                                              unsigned int num_points)
+{
+    struct volk_parallel_reduce_ctx* ctx =
+        (struct volk_parallel_reduce_ctx*)malloc(sizeof(struct volk_parallel_reduce_ctx));
+    if (!ctx || num_points == 0) {
+        free(ctx);
+        volk_32f_stddev_and_mean_32f_x2(stddev, mean, inputBuffer, num_points);
+        return;
+    }
+    ctx->a = inputBuffer;
+    const unsigned int num_chunks =
+        volk_parallel_for(stddev_and_mean_chunk, ctx, num_points);
+
+    // pooled mean and variance from the per-chunk population statistics
+    double total_mean = 0.0;
+    for (unsigned int i = 0; i < num_chunks; i++)
+        total_mean += (double)ctx->partial2_32f[i] * ctx->partial_len[i];
+    total_mean /= num_points;
+    double square_sum = 0.0;
+    for (unsigned int i = 0; i < num_chunks; i++) {
+        const double s = ctx->partial_32f[i];
+        const double d = ctx->partial2_32f[i] - total_mean;
+        square_sum += ctx->partial_len[i] * (s * s + d * d);
+    }
+    *stddev = (float)sqrt(square_sum / num_points);
+    *mean = (float)total_mean;
+    free(ctx);
+}
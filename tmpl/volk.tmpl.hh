@@ -0,0 +1,315 @@
+/* -*- C++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_HH
+#define INCLUDED_VOLK_HH
+
+#include <volk/volk.h>
+#include <volk/volk_alloc.hh>
+
+#include <cassert>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+/*!
+ * \brief Typed C++ front end for the VOLK kernels
+ *
+ * \details
+ * Every kernel is exposed as an overload named after the operation part of
+ * its name, e.g. volk_32fc_x2_multiply_conjugate_32fc becomes
+ * volk::multiply_conjugate(). The overload, and thus the kernel, is selected
+ * at compile time from the argument types. Vectors are passed as volk::span,
+ * which converts implicitly from volk::vector, volk::buffer, std::vector and
+ * arrays. The number of points is taken from the first input vector, or from
+ * the first output vector of kernels without vector inputs. The other vectors
+ * are checked to be at least that long with assert(), so the checks vanish in
+ * NDEBUG builds, as does the check that the number of points fits the length
+ * type of the kernel. Kernels whose vectors have other lengths, e.g. packed
+ * formats, spell them out in the generator.
+ *
+ * Reductions (dot products, accumulators, index searches, ...) write their
+ * result through a reference, kernels with state (e.g. the rotator phase)
+ * take that state by reference.
+ *
+ * example code:
+ *   volk::vector<std::complex<float>> a(N), b(N), c(N);
+ *   volk::multiply(c, a, b);                  // volk_32fc_x2_multiply_32fc
+ *   std::complex<float> d = volk::dot(a, b);  // volk_32fc_x2_dot_prod_32fc
+ *   auto s = volk::convert<int16_t>(x, 32767.f); // volk_32f_s32f_convert_16i
+ */
+namespace volk {
+
+#if defined(__cpp_lib_span)
+template <class T>
+using span = std::span<T>;
+#else
+/*!
+ * \brief minimal stand-in for C++20 std::span (dynamic extent only)
+ */
+template <class T>
+class span
+{
+    template <class C>
+    using data_t = decltype(std::declval<C&>().data());
+
+    template <class C>
+    using if_compatible_t = typename std::enable_if<
+        std::is_convertible<typename std::remove_pointer<data_t<C>>::type (*)[],
+                            T (*)[]>::value>::type;
+
+public:
+    typedef T element_type;
+    typedef typename std::remove_cv<T>::type value_type;
+    typedef std::size_t size_type;
+    typedef T* pointer;
+    typedef T& reference;
+    typedef T* iterator;
+
+    constexpr span() noexcept : _data(nullptr), _size(0) {}
+    constexpr span(T* data, size_type size) noexcept : _data(data), _size(size) {}
+
+    template <std::size_t N>
+    constexpr span(T (&arr)[N]) noexcept : _data(arr), _size(N)
+    {
+    }
+
+    template <class C, class = if_compatible_t<C>>
+    constexpr span(C& c) : _data(c.data()), _size(c.size())
+    {
+    }
+
+    template <class C, class = if_compatible_t<const C>>
+    constexpr span(const C& c) : _data(c.data()), _size(c.size())
+    {
+    }
+
+    constexpr T* data() const noexcept { return _data; }
+    constexpr size_type size() const noexcept { return _size; }
+    constexpr bool empty() const noexcept { return _size == 0; }
+    constexpr T& operator[](size_type i) const { return _data[i]; }
+    constexpr T* begin() const noexcept { return _data; }
+    constexpr T* end() const noexcept { return _data + _size; }
+    constexpr span subspan(size_type offset, size_type count) const
+    {
+        return span(_data + offset, count);
+    }
+
+private:
+    T* _data;
+    size_type _size;
+};
+#endif
+
+namespace detail {
+
+template <class T>
+using element_t = typename std::remove_cv<
+    typename std::remove_pointer<decltype(std::declval<const T&>().data())>::type>::type;
+
+template <class T>
+struct is_complex : std::false_type {
+};
+
+template <class T>
+struct is_complex<std::complex<T>> : std::true_type {
+};
+
+//! Result type of a dot product of vectors with element types A and B
+template <class A, class B>
+using dot_result_t = typename std::conditional<
+    std::is_same<A, lv_32fc_t>::value || std::is_same<B, lv_32fc_t>::value,
+    lv_32fc_t,
+    typename std::conditional<is_complex<A>::value && is_complex<B>::value,
+                              A,
+                              float>::type>::type;
+
+} // namespace detail
+
+<%
+# C++ keywords or alternative tokens that appear as operation names
+renames = {'and': 'bitwise_and', 'or': 'bitwise_or'}
+
+# kernels that do not follow the (outputs, inputs, scalars, num_points) layout
+skipped = ('volk_16i_branch_4_state_8', 'volk_16i_max_star_16i',
+           'volk_16i_max_star_horizontal_16i', 'volk_16i_permute_and_scalar_add',
+           'volk_16i_x4_quad_max_star_16i', 'volk_16i_x5_add_quad_16i_x4',
+           'volk_32f_x3_sum_of_poly_32f', 'volk_32f_null_32f')
+
+# operations that produce a single value per output instead of a vector
+reductions = ('dot_prod', 'conjugate_dot_prod', 'accumulator', 'index_max',
+              'index_max_and_value', 'index_min', 'stddev', 'stddev_and_mean',
+              'calc_spectral_noise_floor')
+
+# kernels whose vectors are not all num_points long: the vector num_points is
+# taken from, and the exact length of other vectors as a C++ expression
+lengths = {
+    'volk_32fc_x2_square_dist_32f': ('points', {'src0': '1'}),
+    'volk_32fc_x2_s32f_square_dist_scalar_mult_32f': ('points', {'src0': '1'}),
+    # packed formats: num_points counts samples, sc12 takes 3 bytes per sample
+    'volk_16ic_pack_sc12_8u': ('inputVector', {'outputVector': '3 * num_points'}),
+    'volk_16ic_pack_sc4_8u': ('inputVector', {'outputVector': 'num_points'}),
+    'volk_8u_unpack_sc12_16ic': ('outputVector', {'inputVector': '3 * num_points'}),
+    'volk_8u_unpack_sc4_16ic': ('outputVector', {'inputVector': 'num_points'}),
+    'volk_8u_s32f_unpack_sc12_32fc': ('outputVector', {'inputVector': '3 * num_points'}),
+    'volk_8u_s32f_unpack_sc4_32fc': ('outputVector', {'inputVector': 'num_points'}),
+}
+
+# outputs whose length follows from a scalar instead of num_points: the least
+# length as a C++ expression
+min_lengths = {
+    'volk_32f_index_topk_32u': {'target': 'k'},
+}
+
+def base_type(arg_type):
+    return ' '.join(arg_type.replace('*', ' ').replace('const', ' ').split())
+
+def bind(kern):
+    """Map the C prototype onto typed C++ parameters.
+    Returns (parameters, call arguments, names of vector parameters, name of the
+    vector num_points is taken from)."""
+    if 'puppet' in kern.name or kern.name in skipped:
+        return None
+    if kern.args[-1][1] != 'num_points':
+        return None
+    # batched and strided kernels: vector lengths do not follow from num_points
+    if any(name.endswith('stride') or name == 'num_batches' for _, name in kern.args):
+        return None
+    # filters and resamplers: the input and the taps are not num_points long
+    if any(name in ('num_taps', 'taps_per_phase') for _, name in kern.args):
+        return None
+    # FFTs: the twiddle table holds num_points - 1 values
+    if any(name == 'twiddles' for _, name in kern.args):
+        return None
+    # 16 bit floats are stored as uint16_t, which overloads can't tell from integers
+    if any(s.lstrip('s') in ('16f', '16fc', '16bf') for s in kern.inputs + kern.outputs):
+        return None
+    n_out = len(kern.outputs)
+    n_in = len([sig for sig in kern.inputs if not sig.startswith('s')])
+    reduction = kern.op_name in reductions
+    params, call, spans, inputs = list(), list(), list(), list()
+    seen_const = False
+    n_ptr = 0
+    for arg_type, arg_name in kern.args[:-1]:
+        t = base_type(arg_type)
+        if '*' not in arg_type:
+            params.append('%s %s' % (t, arg_name))
+            call.append(arg_name)
+            continue
+        is_const = 'const' in arg_type
+        if n_ptr < n_out:
+            if reduction or kern.outputs[n_ptr].startswith('s'):
+                params.append('%s& %s' % (t, arg_name))
+                call.append('&' + arg_name)
+            else:
+                params.append('span<%s> %s' % (t, arg_name))
+                call.append(arg_name + '.data()')
+                spans.append(arg_name)
+        elif n_ptr < n_out + n_in and not (seen_const and not is_const):
+            if n_out == 0 and not is_const:
+                # in-place kernel
+                params.append('span<%s> %s' % (t, arg_name))
+                call.append(arg_name + '.data()')
+            else:
+                params.append('span<const %s> %s' % (t, arg_name))
+                call.append(arg_name + '.data()' if is_const else
+                            'const_cast<%s*>(%s.data())' % (t, arg_name))
+            spans.append(arg_name)
+            inputs.append(arg_name)
+            seen_const = seen_const or is_const
+        else:
+            # state carried between calls, e.g. the rotator phase
+            params.append('%s& %s' % (t, arg_name))
+            call.append('&' + arg_name)
+        n_ptr += 1
+    if not spans:
+        return None
+    size_from = (inputs or spans)[0]
+    if kern.name in lengths:
+        size_from = lengths[kern.name][0]
+    return params, call, spans, size_from
+
+# two kernels with the same overload would make the choice between them depend
+# on the order of the kernel list, so that is an error: skip or rename one
+bindings = list()
+seen = dict()
+for kern in kernels:
+    b = bind(kern)
+    if b is None:
+        continue
+    op = renames.get(kern.op_name, kern.op_name)
+    key = (op, tuple(p.rsplit(' ', 1)[0] for p in b[0]))
+    if key in seen:
+        raise ValueError('%s and %s both bind volk::%s(%s), add one of them to '
+                         'skipped or renames' %
+                         (seen[key], kern.name, op, ', '.join(key[1])))
+    seen[key] = kern.name
+    bindings.append((kern, op) + b)
+%>
+%for kern, op, params, call, spans, size_from in bindings:
+<%
+    exact = lengths.get(kern.name, (None, {}))[1]
+    least = min_lengths.get(kern.name, {})
+    length_type = base_type(kern.args[-1][0])
+%>\
+//! Calls ${kern.name}
+inline void ${op}(${', '.join(params)})
+{
+    const auto num_points = ${size_from}.size();
+% for s in spans:
+%  if s in exact:
+    assert(${s}.size() == ${exact[s]});
+%  elif s in least:
+    assert(${s}.size() >= ${least[s]});
+%  elif s != size_from:
+    assert(${s}.size() >= num_points);
+%  endif
+% endfor
+% if length_type != 'uint64_t':
+    assert(num_points <= std::numeric_limits<${length_type}>::max());
+% endif
+    ${kern.name}(${', '.join(call)}, static_cast<${length_type}>(num_points));
+}
+
+%endfor
+/*!
+ * \brief Returns the dot product of \p a and \p b
+ */
+template <class A, class B>
+detail::dot_result_t<detail::element_t<A>, detail::element_t<B>> dot(const A& a,
+                                                                      const B& b)
+{
+    detail::dot_result_t<detail::element_t<A>, detail::element_t<B>> result;
+    dot_prod(result,
+             span<const detail::element_t<A>>(a),
+             span<const detail::element_t<B>>(b));
+    return result;
+}
+
+/*!
+ * \brief Returns a new volk::vector holding \p in converted to \p To
+ * \details Additional arguments (e.g. the scale factor) are passed on to the
+ * kernel.
+ */
+template <class To, class In, class... Scalars>
+vector<To> convert(const In& in, Scalars... scalars)
+{
+    vector<To> out(in.size());
+    convert(span<To>(out), span<const detail::element_t<In>>(in), scalars...);
+    return out;
+}
+
+} // namespace volk
+
+#endif /* INCLUDED_VOLK_HH */